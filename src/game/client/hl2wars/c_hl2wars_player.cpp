@@ -446,26 +446,23 @@ C_BaseCombatWeapon *C_HL2WarsPlayer::GetWeapon( int i ) const
 //-----------------------------------------------------------------------------
 void C_HL2WarsPlayer::GetBoxSelection( int iXMin, int iYMin, int iXMax, int iYMax,  CUtlVector< EHANDLE > &selection )
 {
-	UnitListInfo *pUnitList;
 	CUnitBase *pUnit;
-	int iX, iY, i;
-	bool bInScreen;
+	int i;
 #ifndef DISABLE_PYTHON
 	boost::python::list pytargetselection;
 #endif // DISABLE_PYTHON
 	CUtlVector< EHANDLE > targetselection;
 
-	// See which units we will select
-	pUnitList = GetUnitListForOwnernumber(GetOwnerNumber());
-	if( !pUnitList )
-		return;
-	for( pUnit=pUnitList->m_pHead; pUnit; pUnit=pUnit->GetNext() )
+	// See which units we will select. The grid only visits the cells in the view 
+	// frustum of the box that contain units of our owner.
+	CUtlVector< CUnitBase * > units;
+	g_Unit_Manager.FindUnitsInScreenRect( units, iXMin, iYMin, iXMax, iYMax, UnitGridOwnerBit( GetOwnerNumber() ) );
+	for( i = 0; i < units.Count(); i++ )
 	{
-		if( !pUnit->IsAlive() )
+		pUnit = units[i];
+		if( !pUnit->IsAlive() || pUnit->GetOwnerNumber() != GetOwnerNumber() )
 			continue;
-		bInScreen = GetVectorInScreenSpace(pUnit->GetAbsOrigin(), iX, iY);
-		if( bInScreen && iX >= iXMin && iY >= iYMin && iX <= iXMax && iY <= iYMax )
-			targetselection.AddToTail(pUnit);
+		targetselection.AddToTail(pUnit);
 	}
 
 	// For each unit see if it wants to be selected in this group
@@ -507,19 +504,17 @@ void C_HL2WarsPlayer::SelectBox( int iXMin, int iYMin, int iXMax, int iYMax )
 		return;
 	}
 
-	if( (m_nButtons & IN_SPEED) == 0 ) {
+	bool bClear = (m_nButtons & IN_SPEED) == 0;
+	if( bClear ) {
 		ClearSelection( false ); // Do not trigger on selection changed, since we do that below too already.
-		engine->ServerCmd("player_clearselection");
 	}
 
-
-
 	// Make selection
 	for(i=0; i<finalselection.Count(); i++)
 	{
 		finalselection[i]->GetIUnit()->Select(this, false);
-		engine->ServerCmd( VarArgs("player_addunit %ld", EncodeEntity(finalselection[i].Get())) );
 	}
+	SendUnitsCommand( "player_selection", bClear, finalselection );
 	
 	ScheduleSelectionChangedSignal();
 }
@@ -531,8 +526,7 @@ void C_HL2WarsPlayer::SelectAllUnitsOfTypeInScreen(const char *pUnitType)
 {
 	UnitListInfo *pUnitList;
 	CUnitBase *pUnit;
-	int iX, iY;
-	bool bInScreen;
+	int i;
 
 	if( !g_pUnitListHead )
 		return;
@@ -546,25 +540,57 @@ void C_HL2WarsPlayer::SelectAllUnitsOfTypeInScreen(const char *pUnitType)
 	}
 
 	ClearSelection( false ); // Do not trigger on selection changed, since we do that below too already.
-	engine->ServerCmd("player_clearselection");
 
-	for( pUnit=pUnitList->m_pHead; pUnit; pUnit=pUnit->GetNext() )
+	CUtlVector< EHANDLE > selection;
+	CUtlVector< CUnitBase * > units;
+	g_Unit_Manager.FindUnitsInScreenRect( units, 0, 0, ScreenWidth() - 1, ScreenHeight() - 1, UnitGridOwnerBit( GetOwnerNumber() ) );
+	for( i = 0; i < units.Count(); i++ )
 	{
-		if( !pUnit->IsAlive() || Q_stricmp( pUnitType, pUnit->GetUnitType() ) )
-			continue;
-
-		bInScreen = GetVectorInScreenSpace(pUnit->GetLocalOrigin(), iX, iY);
-		if( !bInScreen || iX < 0 || iX >= ScreenWidth() || iY < 0 || iY >= ScreenHeight() ) {
+		pUnit = units[i];
+		if( !pUnit->IsAlive() || pUnit->GetOwnerNumber() != GetOwnerNumber() || Q_stricmp( pUnitType, pUnit->GetUnitType() ) )
 			continue;
-		}
 
 		AddUnit(pUnit, false);
-		engine->ServerCmd( VarArgs("player_addunit %ld", EncodeEntity(pUnit)) );
+		selection.AddToTail( pUnit );
 	}
+	SendUnitsCommand( "player_selection", true, selection );
 
 	ScheduleSelectionChangedSignal();
 }
 
+//-----------------------------------------------------------------------------
+// Purpose: Sends a list of units to the server in as few commands as possible.
+//			The units are packed as argument after the clear flag. Only the
+//			first command clears in case the list does not fit in one command.
+//			The order of the units is kept.
+//-----------------------------------------------------------------------------
+void C_HL2WarsPlayer::SendUnitsCommand( const char *pCommand, bool bClear, const CUtlVector< EHANDLE > &units )
+{
+	// Callers may pass in the result of VarArgs, which is reused below
+	char command[128];
+	Q_strncpy( command, pCommand, sizeof(command) );
+
+	CUtlVector< long > encoded;
+	encoded.EnsureCapacity( units.Count() );
+	for( int i = 0; i < units.Count(); i++ )
+	{
+		if( units[i] )
+			encoded.AddToTail( EncodeEntity( units[i] ) );
+	}
+
+	char packed[ENTITYLIST_MAX_PACKED];
+	int iStart = 0;
+	do
+	{
+		int nPacked = PackEntityList( encoded, iStart, packed, sizeof(packed) );
+		engine->ServerCmd( VarArgs( "%s %d %s", command, bClear ? 1 : 0, packed ) );
+		if( nPacked == 0 )
+			break;
+		iStart += nPacked;
+		bClear = false;
+	} while( iStart < encoded.Count() );
+}
+
 //-----------------------------------------------------------------------------
 // Purpose: 
 //-----------------------------------------------------------------------------
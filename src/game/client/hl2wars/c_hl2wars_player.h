@@ -102,6 +102,7 @@ public:
 	void							GetBoxSelection( int iXMin, int iYMin, int iXMax, int iYMax,  CUtlVector< EHANDLE > &selection );
 	void							SelectBox( int xmin, int ymin, int xmax, int ymax );
 	void							SelectAllUnitsOfTypeInScreen( const char *pUnitType );
+	void							SendUnitsCommand( const char *pCommand, bool bClear, const CUtlVector< EHANDLE > &units );
 	void							SimulateOrderUnits( Vector &vStart, Vector &vEnd, CBaseEntity *pHitEnt );
 	void							MinimapClick( Vector &vStart, Vector &vEnd, CBaseEntity *pHitEnt );
 
@@ -115,6 +116,7 @@ public:
 	void							ClearGroup( int group );
 	void							AddToGroup( int group, CBaseEntity *pUnit );
 	void							MakeCurrentSelectionGroup( int group, bool bClearGroup );
+	void							OnGroupChanged( int group );
 	void							SelectGroup( int group );
 	int								GetGroupNumber( CBaseEntity *pUnit );
 	int								CountGroup( int group );
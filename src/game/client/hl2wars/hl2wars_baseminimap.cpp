@@ -20,6 +20,8 @@ using namespace vgui;
 int CBaseMinimap::OVERVIEW_MAP_SIZE = 1024;
 
 ConVar minimap_outline_alpha("minimap_outline_alpha", "220");
+ConVar minimap_batch("minimap_batch", "1", 0, "Draws the entity objects of the minimap in batches per color and icon.");
+ConVar minimap_batch_rate("minimap_batch_rate", "20", 0, "Number of times per second the batched entity objects of the minimap are updated. 0 updates every paint.");
 
 //-----------------------------------------------------------------------------
 // Purpose: 
@@ -43,6 +45,9 @@ CBaseMinimap::CBaseMinimap(Panel *parent, const char *panelName, bool registerli
 
 	playerviewcolor = Color(255, 255, 255, 220);
 
+	m_fNextBatchUpdateTime = 0.0f;
+	Q_memset( m_BatchTransform, 0, sizeof(m_BatchTransform) );
+
 	if( registerlisteners )
 	{
 		ListenForGameEvent("game_newmap");
@@ -81,6 +86,7 @@ void CBaseMinimap::InsertEntityObject( CBaseEntity *pEnt, CHudTexture *pIcon, in
 		return;
 	}
 	m_EntityObjects.AddToTail( EntityObject(pEnt, pIcon, iHalfWide, iHalfTall) );
+	m_fNextBatchUpdateTime = 0.0f;
 }
 
 //-----------------------------------------------------------------------------
@@ -94,6 +100,7 @@ void CBaseMinimap::RemoveEntityObject( CBaseEntity *pEnt )
 		if( m_EntityObjects.Element(i).m_hEntity == pEnt )
 		{
 			m_EntityObjects.Remove(i);
+			m_fNextBatchUpdateTime = 0.0f;
 			break;
 		}
 	}
@@ -108,6 +115,12 @@ void CBaseMinimap::RemoveEntityObject( CBaseEntity *pEnt )
 //-----------------------------------------------------------------------------
 void CBaseMinimap::DrawEntityObjects()
 {
+	if( minimap_batch.GetBool() )
+	{
+		DrawEntityObjectsBatched();
+		return;
+	}
+
 	int i, count;
 	Vector2D pos2d;
 	CBaseEntity *pEnt;
@@ -183,6 +196,180 @@ void CBaseMinimap::DrawEntityObjects()
 	}
 }
 
+//-----------------------------------------------------------------------------
+// Purpose: Draws the entity objects from the batches. The outlines are drawn
+//			in one call, the fills in one call per color and the icons set
+//			their texture and color once per batch.
+//-----------------------------------------------------------------------------
+void CBaseMinimap::DrawEntityObjectsBatched()
+{
+	VPROF_BUDGET( "CBaseMinimap::DrawEntityObjectsBatched", VPROF_BUDGETGROUP_OTHER_VGUI );
+
+	BuildEntityObjectBatches();
+
+	int i, j;
+	if( m_OutlineRects.Count() )
+	{
+		surface()->DrawSetColor( 50, 50, 50, minimap_outline_alpha.GetInt() );
+		surface()->DrawFilledRectArray( m_OutlineRects.Base(), m_OutlineRects.Count() );
+	}
+
+	for( i = 0; i < m_FillBatches.Count(); i++ )
+	{
+		MinimapRectBatch_t &batch = m_FillBatches[i];
+		if( batch.m_Rects.Count() == 0 )
+			continue;
+		surface()->DrawSetColor( batch.m_Color );
+		surface()->DrawFilledRectArray( batch.m_Rects.Base(), batch.m_Rects.Count() );
+	}
+
+	for( i = 0; i < m_IconBatches.Count(); i++ )
+	{
+		MinimapIconBatch_t &batch = m_IconBatches[i];
+		if( batch.m_Rects.Count() == 0 )
+			continue;
+
+		CHudTexture *pIcon = batch.m_pIcon;
+		if( pIcon->bRenderUsingFont )
+		{
+			for( j = 0; j < batch.m_Rects.Count(); j++ )
+			{
+				const IntRect &rect = batch.m_Rects[j];
+				pIcon->DrawSelf( rect.x0, rect.y0, rect.x1 - rect.x0, rect.y1 - rect.y0, batch.m_Color );
+			}
+			continue;
+		}
+
+		if( pIcon->textureId == -1 )
+			continue;
+
+		surface()->DrawSetTexture( pIcon->textureId );
+		surface()->DrawSetColor( batch.m_Color );
+		for( j = 0; j < batch.m_Rects.Count(); j++ )
+		{
+			const IntRect &rect = batch.m_Rects[j];
+			surface()->DrawTexturedSubRect( rect.x0, rect.y0, rect.x1, rect.y1, 
+				pIcon->texCoords[0], pIcon->texCoords[1], pIcon->texCoords[2], pIcon->texCoords[3] );
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Rebuilds the batches at minimap_batch_rate, or directly when the
+//			view of the minimap changed.
+//-----------------------------------------------------------------------------
+void CBaseMinimap::BuildEntityObjectBatches()
+{
+	int i;
+
+	// World to panel is an affine transform, so derive it once instead of transforming each entity
+	Vector2D vOrigin = MapToPanel( WorldToMap( vec3_origin ) );
+	Vector2D vAxisX = ( MapToPanel( WorldToMap( Vector( 1024.0f, 0.0f, 0.0f ) ) ) - vOrigin ) / 1024.0f;
+	Vector2D vAxisY = ( MapToPanel( WorldToMap( Vector( 0.0f, 1024.0f, 0.0f ) ) ) - vOrigin ) / 1024.0f;
+	float transform[6] = { vAxisX.x, vAxisY.x, vOrigin.x, vAxisX.y, vAxisY.y, vOrigin.y };
+
+	bool bViewChanged = Q_memcmp( transform, m_BatchTransform, sizeof(transform) ) != 0;
+	if( !bViewChanged && gpGlobals->curtime < m_fNextBatchUpdateTime )
+		return;
+
+	Q_memcpy( m_BatchTransform, transform, sizeof(transform) );
+	float fRate = minimap_batch_rate.GetFloat();
+	m_fNextBatchUpdateTime = fRate > 0.0f ? gpGlobals->curtime + ( 1.0f / fRate ) : 0.0f;
+
+	m_OutlineRects.RemoveAll();
+	for( i = 0; i < m_FillBatches.Count(); i++ )
+		m_FillBatches[i].m_Rects.RemoveAll();
+	for( i = 0; i < m_IconBatches.Count(); i++ )
+		m_IconBatches[i].m_Rects.RemoveAll();
+
+	IntRect rect;
+	for( i = m_EntityObjects.Count() - 1; i >= 0; i-- )
+	{
+		EntityObject &eo = m_EntityObjects.Element(i);
+		CBaseEntity *pEnt = eo.m_hEntity.Get();
+		if( pEnt == NULL )
+		{
+			m_EntityObjects.Remove(i);
+			continue;
+		}
+
+		const Vector &vPos = pEnt->GetAbsOrigin();
+		float x = transform[0] * vPos.x + transform[1] * vPos.y + transform[2];
+		float y = transform[3] * vPos.x + transform[4] * vPos.y + transform[5];
+
+		const Vector &vTeamColor = pEnt->GetTeamColor();
+		Color color( vTeamColor.x*255, vTeamColor.y*255, vTeamColor.z*255, 255 );
+
+		if( eo.m_pIcon )
+		{
+			if( eo.m_iHalfWide == 0 )
+			{
+				rect.x0 = int(x - int(eo.m_pIcon->Width() / 2.0));
+				rect.y0 = int(y - int(eo.m_pIcon->Height() / 2.0));
+				rect.x1 = rect.x0 + eo.m_pIcon->Width();
+				rect.y1 = rect.y0 + eo.m_pIcon->Height();
+			}
+			else
+			{
+				rect.x0 = int(x-eo.m_iHalfWide);
+				rect.y0 = int(y-eo.m_iHalfTall);
+				rect.x1 = rect.x0 + eo.m_iHalfWide * 2;
+				rect.y1 = rect.y0 + eo.m_iHalfTall * 2;
+			}
+			FindIconBatch( eo.m_pIcon, color ).m_Rects.AddToTail( rect );
+			continue;
+		}
+
+		rect.x0 = int(x-eo.m_iHalfWide);
+		rect.y0 = int(y-eo.m_iHalfTall);
+		rect.x1 = int(x+eo.m_iHalfWide);
+		rect.y1 = int(y+eo.m_iHalfTall);
+		FindFillBatch( color ).m_Rects.AddToTail( rect );
+
+		// The outline as the four one pixel wide edges around the fill
+		IntRect outer = { rect.x0 - 1, rect.y0 - 1, rect.x1 + 1, rect.y1 + 1 };
+		IntRect edges[4] = {
+			{ outer.x0, outer.y0, outer.x1, outer.y0 + 1 },
+			{ outer.x0, outer.y1 - 1, outer.x1, outer.y1 },
+			{ outer.x0, outer.y0 + 1, outer.x0 + 1, outer.y1 - 1 },
+			{ outer.x1 - 1, outer.y0 + 1, outer.x1, outer.y1 - 1 },
+		};
+		m_OutlineRects.AddMultipleToTail( 4, edges );
+	}
+
+	// Drop the batches of icons no longer in use, the icon may be freed
+	for( i = m_IconBatches.Count() - 1; i >= 0; i-- )
+	{
+		if( m_IconBatches[i].m_Rects.Count() == 0 )
+			m_IconBatches.Remove( i );
+	}
+}
+
+MinimapRectBatch_t &CBaseMinimap::FindFillBatch( const Color &color )
+{
+	for( int i = 0; i < m_FillBatches.Count(); i++ )
+	{
+		if( m_FillBatches[i].m_Color == color )
+			return m_FillBatches[i];
+	}
+	int idx = m_FillBatches.AddToTail();
+	m_FillBatches[idx].m_Color = color;
+	return m_FillBatches[idx];
+}
+
+MinimapIconBatch_t &CBaseMinimap::FindIconBatch( CHudTexture *pIcon, const Color &color )
+{
+	for( int i = 0; i < m_IconBatches.Count(); i++ )
+	{
+		if( m_IconBatches[i].m_pIcon == pIcon && m_IconBatches[i].m_Color == color )
+			return m_IconBatches[i];
+	}
+	int idx = m_IconBatches.AddToTail();
+	m_IconBatches[idx].m_pIcon = pIcon;
+	m_IconBatches[idx].m_Color = color;
+	return m_IconBatches[idx];
+}
+
 //-----------------------------------------------------------------------------
 // Purpose: 
 //-----------------------------------------------------------------------------
@@ -12,6 +12,7 @@
 #endif
 
 #include <vgui_controls/Panel.h>
+#include <vgui/ISurface.h>
 #include "GameEventListener.h"
 
 struct EntityObject
@@ -30,6 +31,20 @@ struct EntityObject
 	int m_iHalfTall;
 };
 
+// Entity object markers sharing a color (and icon), drawn together
+struct MinimapRectBatch_t
+{
+	Color m_Color;
+	CUtlVector< vgui::IntRect > m_Rects;
+};
+
+struct MinimapIconBatch_t
+{
+	CHudTexture *m_pIcon;
+	Color m_Color;
+	CUtlVector< vgui::IntRect > m_Rects;
+};
+
 class CBaseMinimap :  public vgui::Panel, public CGameEventListener
 {
 	DECLARE_CLASS_SIMPLE( CBaseMinimap, vgui::Panel );
@@ -78,7 +93,19 @@ public:		// Public settings for python
 	Color		playerviewcolor;
 
 private:
+	// Batched drawing of the entity objects, see minimap_batch
+	void					DrawEntityObjectsBatched();
+	void					BuildEntityObjectBatches();
+	MinimapRectBatch_t &	FindFillBatch( const Color &color );
+	MinimapIconBatch_t &	FindIconBatch( CHudTexture *pIcon, const Color &color );
+
 	CUtlVector<EntityObject> m_EntityObjects;
+
+	CUtlVector< vgui::IntRect > m_OutlineRects;
+	CUtlVector< MinimapRectBatch_t > m_FillBatches;
+	CUtlVector< MinimapIconBatch_t > m_IconBatches;
+	float m_fNextBatchUpdateTime;
+	float m_BatchTransform[6]; // World to panel transform the batches were build with
 };
 
 #endif // HL2WARS_BASEMINIMAP_H
\ No newline at end of file
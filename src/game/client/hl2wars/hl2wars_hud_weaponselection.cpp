@@ -167,12 +167,12 @@ void CHudWeaponSelection::SelectSlot( int iSlot )
 	if( pPlayer->m_nButtons & IN_SPEED )
 	{
 		pPlayer->MakeCurrentSelectionGroup( iSlot, false );
-		engine->ServerCmd( VarArgs( "make_group %d %d", iSlot, 0 ) );
+		pPlayer->SendUnitsCommand( VarArgs( "player_group %d", iSlot ), true, pPlayer->GetGroup( iSlot ) );
 	}
 	else if( pPlayer->m_nButtons & IN_DUCK )
 	{
 		pPlayer->MakeCurrentSelectionGroup( iSlot, true );
-		engine->ServerCmd( VarArgs( "make_group %d %d", iSlot, 1 ) );
+		pPlayer->SendUnitsCommand( VarArgs( "player_group %d", iSlot ), true, pPlayer->GetGroup( iSlot ) );
 	}
 	else 
 	{
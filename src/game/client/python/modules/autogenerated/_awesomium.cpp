@@ -50,7 +50,7 @@ struct WebView_wrapper : WebView, bp::wrapper< WebView > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetCursor(  ) of Class: WebView\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetCursor = this->get_override( "GetCursor" );
+        PY_OVERRIDE_LOOKUP( func_GetCursor, "GetCursor" );
         if( func_GetCursor.ptr() != Py_None )
             try {
                 return func_GetCursor(  );
@@ -80,7 +80,7 @@ struct WebView_wrapper : WebView, bp::wrapper< WebView > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnChangeFocus( boost::python::ptr(caller), focused_type ) of Class: WebView\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnChangeFocus = this->get_override( "OnChangeFocus" );
+        PY_OVERRIDE_LOOKUP( func_OnChangeFocus, "OnChangeFocus" );
         if( func_OnChangeFocus.ptr() != Py_None )
             try {
                 func_OnChangeFocus( boost::python::ptr(caller), focused_type );
@@ -110,7 +110,7 @@ struct WebView_wrapper : WebView, bp::wrapper< WebView > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnSizeChanged( newWide, newTall ) of Class: WebView\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnSizeChanged = this->get_override( "OnSizeChanged" );
+        PY_OVERRIDE_LOOKUP( func_OnSizeChanged, "OnSizeChanged" );
         if( func_OnSizeChanged.ptr() != Py_None )
             try {
                 func_OnSizeChanged( newWide, newTall );
@@ -140,7 +140,7 @@ struct WebView_wrapper : WebView, bp::wrapper< WebView > {
         if( py_log_overrides.GetBool() )
             Msg("Calling PerformLayout(  ) of Class: WebView\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PerformLayout = this->get_override( "PerformLayout" );
+        PY_OVERRIDE_LOOKUP( func_PerformLayout, "PerformLayout" );
         if( func_PerformLayout.ptr() != Py_None )
             try {
                 func_PerformLayout(  );
@@ -170,7 +170,7 @@ struct WebView_wrapper : WebView, bp::wrapper< WebView > {
         if( py_log_overrides.GetBool() )
             Msg("Calling PyOnMethodCall( remote_object_id, arg1, args ) of Class: WebView\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnMethodCall = this->get_override( "OnMethodCall" );
+        PY_OVERRIDE_LOOKUP( func_OnMethodCall, "OnMethodCall" );
         if( func_OnMethodCall.ptr() != Py_None )
             try {
                 return func_OnMethodCall( remote_object_id, arg1, args );
@@ -200,7 +200,7 @@ struct WebView_wrapper : WebView, bp::wrapper< WebView > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCursor( cursor ) of Class: WebView\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCursor = this->get_override( "SetCursor" );
+        PY_OVERRIDE_LOOKUP( func_SetCursor, "SetCursor" );
         if( func_SetCursor.ptr() != Py_None )
             try {
                 func_SetCursor( cursor );
@@ -68,7 +68,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling GetCollideType(  ) of Class: C_BaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetCollideType = this->get_override( "GetCollideType" );
+        PY_OVERRIDE_LOOKUP( func_GetCollideType, "GetCollideType" );
         if( func_GetCollideType.ptr() != Py_None )
             try {
                 return func_GetCollideType(  );
@@ -105,7 +105,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling OnDataChanged( updateType ) of Class: C_BaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnDataChanged = this->get_override( "OnDataChanged" );
+        PY_OVERRIDE_LOOKUP( func_OnDataChanged, "OnDataChanged" );
         if( func_OnDataChanged.ptr() != Py_None )
             try {
                 func_OnDataChanged( updateType );
@@ -135,7 +135,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling PyOnNewModel(  ) of Class: C_BaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnNewModel = this->get_override( "OnNewModel" );
+        PY_OVERRIDE_LOOKUP( func_OnNewModel, "OnNewModel" );
         if( func_OnNewModel.ptr() != Py_None )
             try {
                 func_OnNewModel(  );
@@ -165,7 +165,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling Simulate(  ) of Class: C_BaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Simulate = this->get_override( "Simulate" );
+        PY_OVERRIDE_LOOKUP( func_Simulate, "Simulate" );
         if( func_Simulate.ptr() != Py_None )
             try {
                 return func_Simulate(  );
@@ -195,7 +195,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling Activate(  ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Activate = this->get_override( "Activate" );
+        PY_OVERRIDE_LOOKUP( func_Activate, "Activate" );
         if( func_Activate.ptr() != Py_None )
             try {
                 func_Activate(  );
@@ -229,7 +229,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling ClientThink(  ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ClientThink = this->get_override( "ClientThink" );
+        PY_OVERRIDE_LOOKUP( func_ClientThink, "ClientThink" );
         if( func_ClientThink.ptr() != Py_None )
             try {
                 func_ClientThink(  );
@@ -259,7 +259,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling ComputeWorldSpaceSurroundingBox( boost::python::ptr(pVecWorldMins), boost::python::ptr(pVecWorldMaxs) ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ComputeWorldSpaceSurroundingBox = this->get_override( "ComputeWorldSpaceSurroundingBox" );
+        PY_OVERRIDE_LOOKUP( func_ComputeWorldSpaceSurroundingBox, "ComputeWorldSpaceSurroundingBox" );
         if( func_ComputeWorldSpaceSurroundingBox.ptr() != Py_None )
             try {
                 func_ComputeWorldSpaceSurroundingBox( boost::python::ptr(pVecWorldMins), boost::python::ptr(pVecWorldMaxs) );
@@ -289,7 +289,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling CreateVPhysics(  ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_CreateVPhysics = this->get_override( "CreateVPhysics" );
+        PY_OVERRIDE_LOOKUP( func_CreateVPhysics, "CreateVPhysics" );
         if( func_CreateVPhysics.ptr() != Py_None )
             try {
                 return func_CreateVPhysics(  );
@@ -319,7 +319,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling DoImpactEffect( boost::ref(tr), nDamageType ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_DoImpactEffect = this->get_override( "DoImpactEffect" );
+        PY_OVERRIDE_LOOKUP( func_DoImpactEffect, "DoImpactEffect" );
         if( func_DoImpactEffect.ptr() != Py_None )
             try {
                 func_DoImpactEffect( boost::ref(tr), nDamageType );
@@ -349,7 +349,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling EndTouch( boost::python::ptr(pOther) ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_EndTouch = this->get_override( "EndTouch" );
+        PY_OVERRIDE_LOOKUP( func_EndTouch, "EndTouch" );
         if( func_EndTouch.ptr() != Py_None )
             try {
                 func_EndTouch( boost::python::ptr(pOther) );
@@ -379,7 +379,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling GetIMouse(  ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetIMouse = this->get_override( "GetIMouse" );
+        PY_OVERRIDE_LOOKUP( func_GetIMouse, "GetIMouse" );
         if( func_GetIMouse.ptr() != Py_None )
             try {
                 return func_GetIMouse(  );
@@ -409,7 +409,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTracerType(  ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTracerType = this->get_override( "GetTracerType" );
+        PY_OVERRIDE_LOOKUP( func_GetTracerType, "GetTracerType" );
         if( func_GetTracerType.ptr() != Py_None )
             try {
                 return func_GetTracerType(  );
@@ -439,7 +439,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling KeyValue( szKeyName, szValue ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_KeyValue = this->get_override( "KeyValue" );
+        PY_OVERRIDE_LOOKUP( func_KeyValue, "KeyValue" );
         if( func_KeyValue.ptr() != Py_None )
             try {
                 return func_KeyValue( szKeyName, szValue );
@@ -469,7 +469,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling KeyValue( szKeyName, flValue ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_KeyValue = this->get_override( "KeyValue" );
+        PY_OVERRIDE_LOOKUP( func_KeyValue, "KeyValue" );
         if( func_KeyValue.ptr() != Py_None )
             try {
                 return func_KeyValue( szKeyName, flValue );
@@ -499,7 +499,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling KeyValue( szKeyName, nValue ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_KeyValue = this->get_override( "KeyValue" );
+        PY_OVERRIDE_LOOKUP( func_KeyValue, "KeyValue" );
         if( func_KeyValue.ptr() != Py_None )
             try {
                 return func_KeyValue( szKeyName, nValue );
@@ -529,7 +529,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling KeyValue( szKeyName, boost::ref(vecValue) ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_KeyValue = this->get_override( "KeyValue" );
+        PY_OVERRIDE_LOOKUP( func_KeyValue, "KeyValue" );
         if( func_KeyValue.ptr() != Py_None )
             try {
                 return func_KeyValue( szKeyName, boost::ref(vecValue) );
@@ -559,7 +559,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling MakeTracer( boost::ref(vecTracerSrc), boost::ref(tr), iTracerType ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_MakeTracer = this->get_override( "MakeTracer" );
+        PY_OVERRIDE_LOOKUP( func_MakeTracer, "MakeTracer" );
         if( func_MakeTracer.ptr() != Py_None )
             try {
                 func_MakeTracer( boost::ref(vecTracerSrc), boost::ref(tr), iTracerType );
@@ -589,7 +589,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling OnChangeOwnerNumber( old_owner_number ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnChangeOwnerNumber = this->get_override( "OnChangeOwnerNumber" );
+        PY_OVERRIDE_LOOKUP( func_OnChangeOwnerNumber, "OnChangeOwnerNumber" );
         if( func_OnChangeOwnerNumber.ptr() != Py_None )
             try {
                 func_OnChangeOwnerNumber( old_owner_number );
@@ -619,7 +619,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling Precache(  ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Precache = this->get_override( "Precache" );
+        PY_OVERRIDE_LOOKUP( func_Precache, "Precache" );
         if( func_Precache.ptr() != Py_None )
             try {
                 func_Precache(  );
@@ -649,7 +649,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling PyNotifyShouldTransmit( state ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_NotifyShouldTransmit = this->get_override( "NotifyShouldTransmit" );
+        PY_OVERRIDE_LOOKUP( func_NotifyShouldTransmit, "NotifyShouldTransmit" );
         if( func_NotifyShouldTransmit.ptr() != Py_None )
             try {
                 func_NotifyShouldTransmit( state );
@@ -679,7 +679,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling PyReceiveMessage( msg ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ReceiveMessage = this->get_override( "ReceiveMessage" );
+        PY_OVERRIDE_LOOKUP( func_ReceiveMessage, "ReceiveMessage" );
         if( func_ReceiveMessage.ptr() != Py_None )
             try {
                 func_ReceiveMessage( msg );
@@ -713,7 +713,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldDraw(  ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldDraw = this->get_override( "ShouldDraw" );
+        PY_OVERRIDE_LOOKUP( func_ShouldDraw, "ShouldDraw" );
         if( func_ShouldDraw.ptr() != Py_None )
             try {
                 return func_ShouldDraw(  );
@@ -743,7 +743,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling Spawn(  ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Spawn = this->get_override( "Spawn" );
+        PY_OVERRIDE_LOOKUP( func_Spawn, "Spawn" );
         if( func_Spawn.ptr() != Py_None )
             try {
                 func_Spawn(  );
@@ -773,7 +773,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling StartTouch( boost::python::ptr(pOther) ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_StartTouch = this->get_override( "StartTouch" );
+        PY_OVERRIDE_LOOKUP( func_StartTouch, "StartTouch" );
         if( func_StartTouch.ptr() != Py_None )
             try {
                 func_StartTouch( boost::python::ptr(pOther) );
@@ -803,7 +803,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
         if( py_log_overrides.GetBool() )
             Msg("Calling UpdateOnRemove(  ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_UpdateOnRemove = this->get_override( "UpdateOnRemove" );
+        PY_OVERRIDE_LOOKUP( func_UpdateOnRemove, "UpdateOnRemove" );
         if( func_UpdateOnRemove.ptr() != Py_None )
             try {
                 func_UpdateOnRemove(  );
@@ -841,7 +841,7 @@ struct C_BaseAnimating_wrapper : C_BaseAnimating, bp::wrapper< C_BaseAnimating >
                 if( py_log_overrides.GetBool() )
                     Msg("Calling TestCollision( boost::ref(ray), mask, boost::ref(trace) ) of Class: C_BaseAnimating\n");
                 #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-                bp::override func_TestCollision = this->get_override( "TestCollision" );
+                PY_OVERRIDE_LOOKUP( func_TestCollision, "TestCollision" );
                 if( func_TestCollision.ptr() != Py_None )
                     try {
                         return func_TestCollision( PyRay_t(ray), mask, boost::ref(trace) );
@@ -66,7 +66,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling CustomCanBeSeen( boost::python::ptr(pUnit) ) of Class: C_UnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_CustomCanBeSeen = this->get_override( "CustomCanBeSeen" );
+        PY_OVERRIDE_LOOKUP( func_CustomCanBeSeen, "CustomCanBeSeen" );
         if( func_CustomCanBeSeen.ptr() != Py_None )
             try {
                 return func_CustomCanBeSeen( boost::python::ptr(pUnit) );
@@ -96,7 +96,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling DoImpactEffect( boost::ref(tr), nDamageType ) of Class: C_UnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_DoImpactEffect = this->get_override( "DoImpactEffect" );
+        PY_OVERRIDE_LOOKUP( func_DoImpactEffect, "DoImpactEffect" );
         if( func_DoImpactEffect.ptr() != Py_None )
             try {
                 func_DoImpactEffect( boost::ref(tr), nDamageType );
@@ -126,7 +126,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetCursor(  ) of Class: C_UnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetCursor = this->get_override( "GetCursor" );
+        PY_OVERRIDE_LOOKUP( func_GetCursor, "GetCursor" );
         if( func_GetCursor.ptr() != Py_None )
             try {
                 return func_GetCursor(  );
@@ -156,7 +156,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetIMouse(  ) of Class: C_UnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetIMouse = this->get_override( "GetIMouse" );
+        PY_OVERRIDE_LOOKUP( func_GetIMouse, "GetIMouse" );
         if( func_GetIMouse.ptr() != Py_None )
             try {
                 return func_GetIMouse(  );
@@ -186,7 +186,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTracerType(  ) of Class: C_UnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTracerType = this->get_override( "GetTracerType" );
+        PY_OVERRIDE_LOOKUP( func_GetTracerType, "GetTracerType" );
         if( func_GetTracerType.ptr() != Py_None )
             try {
                 return func_GetTracerType(  );
@@ -216,7 +216,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling MakeTracer( boost::ref(vecTracerSrc), boost::ref(tr), iTracerType ) of Class: C_UnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_MakeTracer = this->get_override( "MakeTracer" );
+        PY_OVERRIDE_LOOKUP( func_MakeTracer, "MakeTracer" );
         if( func_MakeTracer.ptr() != Py_None )
             try {
                 func_MakeTracer( boost::ref(vecTracerSrc), boost::ref(tr), iTracerType );
@@ -246,7 +246,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnActiveWeaponChanged(  ) of Class: C_UnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnActiveWeaponChanged = this->get_override( "OnActiveWeaponChanged" );
+        PY_OVERRIDE_LOOKUP( func_OnActiveWeaponChanged, "OnActiveWeaponChanged" );
         if( func_OnActiveWeaponChanged.ptr() != Py_None )
             try {
                 func_OnActiveWeaponChanged(  );
@@ -276,7 +276,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnButtonsChanged( buttonsMask, buttonsChanged ) of Class: C_UnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnButtonsChanged = this->get_override( "OnButtonsChanged" );
+        PY_OVERRIDE_LOOKUP( func_OnButtonsChanged, "OnButtonsChanged" );
         if( func_OnButtonsChanged.ptr() != Py_None )
             try {
                 func_OnButtonsChanged( buttonsMask, buttonsChanged );
@@ -306,7 +306,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnDataChanged( updateType ) of Class: C_UnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnDataChanged = this->get_override( "OnDataChanged" );
+        PY_OVERRIDE_LOOKUP( func_OnDataChanged, "OnDataChanged" );
         if( func_OnDataChanged.ptr() != Py_None )
             try {
                 func_OnDataChanged( updateType );
@@ -336,7 +336,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnHoverPaint(  ) of Class: C_UnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnHoverPaint = this->get_override( "OnHoverPaint" );
+        PY_OVERRIDE_LOOKUP( func_OnHoverPaint, "OnHoverPaint" );
         if( func_OnHoverPaint.ptr() != Py_None )
             try {
                 func_OnHoverPaint(  );
@@ -366,7 +366,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnInSelectionBox(  ) of Class: C_UnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnInSelectionBox = this->get_override( "OnInSelectionBox" );
+        PY_OVERRIDE_LOOKUP( func_OnInSelectionBox, "OnInSelectionBox" );
         if( func_OnInSelectionBox.ptr() != Py_None )
             try {
                 func_OnInSelectionBox(  );
@@ -396,7 +396,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnOutSelectionBox(  ) of Class: C_UnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnOutSelectionBox = this->get_override( "OnOutSelectionBox" );
+        PY_OVERRIDE_LOOKUP( func_OnOutSelectionBox, "OnOutSelectionBox" );
         if( func_OnOutSelectionBox.ptr() != Py_None )
             try {
                 func_OnOutSelectionBox(  );
@@ -426,7 +426,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnUnitTypeChanged( old_unit_type ) of Class: C_UnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnUnitTypeChanged = this->get_override( "OnUnitTypeChanged" );
+        PY_OVERRIDE_LOOKUP( func_OnUnitTypeChanged, "OnUnitTypeChanged" );
         if( func_OnUnitTypeChanged.ptr() != Py_None )
             try {
                 func_OnUnitTypeChanged( old_unit_type );
@@ -456,7 +456,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldDraw(  ) of Class: C_UnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldDraw = this->get_override( "ShouldDraw" );
+        PY_OVERRIDE_LOOKUP( func_ShouldDraw, "ShouldDraw" );
         if( func_ShouldDraw.ptr() != Py_None )
             try {
                 return func_ShouldDraw(  );
@@ -486,7 +486,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling UpdateOnRemove(  ) of Class: C_UnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_UpdateOnRemove = this->get_override( "UpdateOnRemove" );
+        PY_OVERRIDE_LOOKUP( func_UpdateOnRemove, "UpdateOnRemove" );
         if( func_UpdateOnRemove.ptr() != Py_None )
             try {
                 func_UpdateOnRemove(  );
@@ -516,7 +516,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling UserCmd( boost::python::ptr(pCmd) ) of Class: C_UnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_UserCmd = this->get_override( "UserCmd" );
+        PY_OVERRIDE_LOOKUP( func_UserCmd, "UserCmd" );
         if( func_UserCmd.ptr() != Py_None )
             try {
                 func_UserCmd( boost::python::ptr(pCmd) );
@@ -546,7 +546,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Activate(  ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Activate = this->get_override( "Activate" );
+        PY_OVERRIDE_LOOKUP( func_Activate, "Activate" );
         if( func_Activate.ptr() != Py_None )
             try {
                 func_Activate(  );
@@ -580,7 +580,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling ClientThink(  ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ClientThink = this->get_override( "ClientThink" );
+        PY_OVERRIDE_LOOKUP( func_ClientThink, "ClientThink" );
         if( func_ClientThink.ptr() != Py_None )
             try {
                 func_ClientThink(  );
@@ -610,7 +610,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling ComputeWorldSpaceSurroundingBox( boost::python::ptr(pVecWorldMins), boost::python::ptr(pVecWorldMaxs) ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ComputeWorldSpaceSurroundingBox = this->get_override( "ComputeWorldSpaceSurroundingBox" );
+        PY_OVERRIDE_LOOKUP( func_ComputeWorldSpaceSurroundingBox, "ComputeWorldSpaceSurroundingBox" );
         if( func_ComputeWorldSpaceSurroundingBox.ptr() != Py_None )
             try {
                 func_ComputeWorldSpaceSurroundingBox( boost::python::ptr(pVecWorldMins), boost::python::ptr(pVecWorldMaxs) );
@@ -640,7 +640,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling CreateVPhysics(  ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_CreateVPhysics = this->get_override( "CreateVPhysics" );
+        PY_OVERRIDE_LOOKUP( func_CreateVPhysics, "CreateVPhysics" );
         if( func_CreateVPhysics.ptr() != Py_None )
             try {
                 return func_CreateVPhysics(  );
@@ -670,7 +670,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling EndTouch( boost::python::ptr(pOther) ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_EndTouch = this->get_override( "EndTouch" );
+        PY_OVERRIDE_LOOKUP( func_EndTouch, "EndTouch" );
         if( func_EndTouch.ptr() != Py_None )
             try {
                 func_EndTouch( boost::python::ptr(pOther) );
@@ -700,7 +700,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetCollideType(  ) of Class: C_BaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetCollideType = this->get_override( "GetCollideType" );
+        PY_OVERRIDE_LOOKUP( func_GetCollideType, "GetCollideType" );
         if( func_GetCollideType.ptr() != Py_None )
             try {
                 return func_GetCollideType(  );
@@ -730,7 +730,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling KeyValue( szKeyName, szValue ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_KeyValue = this->get_override( "KeyValue" );
+        PY_OVERRIDE_LOOKUP( func_KeyValue, "KeyValue" );
         if( func_KeyValue.ptr() != Py_None )
             try {
                 return func_KeyValue( szKeyName, szValue );
@@ -760,7 +760,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling KeyValue( szKeyName, flValue ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_KeyValue = this->get_override( "KeyValue" );
+        PY_OVERRIDE_LOOKUP( func_KeyValue, "KeyValue" );
         if( func_KeyValue.ptr() != Py_None )
             try {
                 return func_KeyValue( szKeyName, flValue );
@@ -790,7 +790,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling KeyValue( szKeyName, nValue ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_KeyValue = this->get_override( "KeyValue" );
+        PY_OVERRIDE_LOOKUP( func_KeyValue, "KeyValue" );
         if( func_KeyValue.ptr() != Py_None )
             try {
                 return func_KeyValue( szKeyName, nValue );
@@ -820,7 +820,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling KeyValue( szKeyName, boost::ref(vecValue) ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_KeyValue = this->get_override( "KeyValue" );
+        PY_OVERRIDE_LOOKUP( func_KeyValue, "KeyValue" );
         if( func_KeyValue.ptr() != Py_None )
             try {
                 return func_KeyValue( szKeyName, boost::ref(vecValue) );
@@ -850,7 +850,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnChangeOwnerNumber( old_owner_number ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnChangeOwnerNumber = this->get_override( "OnChangeOwnerNumber" );
+        PY_OVERRIDE_LOOKUP( func_OnChangeOwnerNumber, "OnChangeOwnerNumber" );
         if( func_OnChangeOwnerNumber.ptr() != Py_None )
             try {
                 func_OnChangeOwnerNumber( old_owner_number );
@@ -880,7 +880,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Precache(  ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Precache = this->get_override( "Precache" );
+        PY_OVERRIDE_LOOKUP( func_Precache, "Precache" );
         if( func_Precache.ptr() != Py_None )
             try {
                 func_Precache(  );
@@ -910,7 +910,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling PyNotifyShouldTransmit( state ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_NotifyShouldTransmit = this->get_override( "NotifyShouldTransmit" );
+        PY_OVERRIDE_LOOKUP( func_NotifyShouldTransmit, "NotifyShouldTransmit" );
         if( func_NotifyShouldTransmit.ptr() != Py_None )
             try {
                 func_NotifyShouldTransmit( state );
@@ -940,7 +940,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling PyOnNewModel(  ) of Class: C_BaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnNewModel = this->get_override( "OnNewModel" );
+        PY_OVERRIDE_LOOKUP( func_OnNewModel, "OnNewModel" );
         if( func_OnNewModel.ptr() != Py_None )
             try {
                 func_OnNewModel(  );
@@ -970,7 +970,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling PyReceiveMessage( msg ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ReceiveMessage = this->get_override( "ReceiveMessage" );
+        PY_OVERRIDE_LOOKUP( func_ReceiveMessage, "ReceiveMessage" );
         if( func_ReceiveMessage.ptr() != Py_None )
             try {
                 func_ReceiveMessage( msg );
@@ -1004,7 +1004,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Simulate(  ) of Class: C_BaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Simulate = this->get_override( "Simulate" );
+        PY_OVERRIDE_LOOKUP( func_Simulate, "Simulate" );
         if( func_Simulate.ptr() != Py_None )
             try {
                 return func_Simulate(  );
@@ -1034,7 +1034,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Spawn(  ) of Class: C_BaseFlex\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Spawn = this->get_override( "Spawn" );
+        PY_OVERRIDE_LOOKUP( func_Spawn, "Spawn" );
         if( func_Spawn.ptr() != Py_None )
             try {
                 func_Spawn(  );
@@ -1064,7 +1064,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling StartTouch( boost::python::ptr(pOther) ) of Class: C_BaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_StartTouch = this->get_override( "StartTouch" );
+        PY_OVERRIDE_LOOKUP( func_StartTouch, "StartTouch" );
         if( func_StartTouch.ptr() != Py_None )
             try {
                 func_StartTouch( boost::python::ptr(pOther) );
@@ -1102,7 +1102,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
                 if( py_log_overrides.GetBool() )
                     Msg("Calling TestCollision( boost::ref(ray), mask, boost::ref(trace) ) of Class: C_UnitBase\n");
                 #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-                bp::override func_TestCollision = this->get_override( "TestCollision" );
+                PY_OVERRIDE_LOOKUP( func_TestCollision, "TestCollision" );
                 if( func_TestCollision.ptr() != Py_None )
                     try {
                         return func_TestCollision( PyRay_t(ray), mask, boost::ref(trace) );
@@ -1121,7 +1121,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
     virtual PyObject *GetPySelf() const { return bp::detail::wrapper_base_::get_owner(*this); }
 
     virtual bool IsSelectableByPlayer( ::C_HL2WarsPlayer * pPlayer, ::boost::python::object target_selection=boost::python::object() ) {
-        boost::python::override func_IsSelectableByPlayer = this->get_override( "IsSelectableByPlayer" );
+        PY_OVERRIDE_LOOKUP( func_IsSelectableByPlayer, "IsSelectableByPlayer" );
         if( func_IsSelectableByPlayer.ptr() != Py_None )
             try {
                 return func_IsSelectableByPlayer( pPlayer ? pPlayer->GetPyHandle() : bp::object(), target_selection );
@@ -1138,7 +1138,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
     }
 
     virtual void Select( ::C_HL2WarsPlayer * pPlayer, bool bTriggerOnSel=true ) {
-        boost::python::override func_Select = this->get_override( "Select" );
+        PY_OVERRIDE_LOOKUP( func_Select, "Select" );
         if( func_Select.ptr() != Py_None )
             try {
                 func_Select( pPlayer ? pPlayer->GetPyHandle() : bp::object(), bTriggerOnSel );
@@ -1155,7 +1155,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
     }
 
     virtual void OnSelected( ::C_HL2WarsPlayer * pPlayer ) {
-        boost::python::override func_OnSelected = this->get_override( "OnSelected" );
+        PY_OVERRIDE_LOOKUP( func_OnSelected, "OnSelected" );
         if( func_OnSelected.ptr() != Py_None )
             try {
                 func_OnSelected( pPlayer ? pPlayer->GetPyHandle() : bp::object() );
@@ -1172,7 +1172,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
     }
 
     virtual void OnDeSelected( ::C_HL2WarsPlayer * pPlayer ) {
-        boost::python::override func_OnDeSelected = this->get_override( "OnDeSelected" );
+        PY_OVERRIDE_LOOKUP( func_OnDeSelected, "OnDeSelected" );
         if( func_OnDeSelected.ptr() != Py_None )
             try {
                 func_OnDeSelected( pPlayer ? pPlayer->GetPyHandle() : bp::object() );
@@ -1189,7 +1189,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
     }
 
     virtual void Order( ::C_HL2WarsPlayer * pPlayer ) {
-        boost::python::override func_Order = this->get_override( "Order" );
+        PY_OVERRIDE_LOOKUP( func_Order, "Order" );
         if( func_Order.ptr() != Py_None )
             try {
                 func_Order( pPlayer ? pPlayer->GetPyHandle() : bp::object() );
@@ -1206,7 +1206,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
     }
 
     virtual void OnUserControl( ::C_HL2WarsPlayer * pPlayer ) {
-        boost::python::override func_OnUserControl = this->get_override( "OnUserControl" );
+        PY_OVERRIDE_LOOKUP( func_OnUserControl, "OnUserControl" );
         if( func_OnUserControl.ptr() != Py_None )
             try {
                 func_OnUserControl( pPlayer ? pPlayer->GetPyHandle() : bp::object() );
@@ -1223,7 +1223,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
     }
 
     virtual void OnUserLeftControl( ::C_HL2WarsPlayer * pPlayer ) {
-        boost::python::override func_OnUserLeftControl = this->get_override( "OnUserLeftControl" );
+        PY_OVERRIDE_LOOKUP( func_OnUserLeftControl, "OnUserLeftControl" );
         if( func_OnUserLeftControl.ptr() != Py_None )
             try {
                 func_OnUserLeftControl( pPlayer ? pPlayer->GetPyHandle() : bp::object() );
@@ -1240,7 +1240,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
     }
 
     virtual bool CanUserControl( ::C_HL2WarsPlayer * pPlayer ) {
-        boost::python::override func_CanUserControl = this->get_override( "CanUserControl" );
+        PY_OVERRIDE_LOOKUP( func_CanUserControl, "CanUserControl" );
         if( func_CanUserControl.ptr() != Py_None )
             try {
                 return func_CanUserControl( pPlayer ? pPlayer->GetPyHandle() : bp::object() );
@@ -1257,7 +1257,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
     }
 
     virtual void OnClickLeftPressed( ::C_HL2WarsPlayer * player ) {
-        boost::python::override func_OnClickLeftPressed = this->get_override( "OnClickLeftPressed" );
+        PY_OVERRIDE_LOOKUP( func_OnClickLeftPressed, "OnClickLeftPressed" );
         if( func_OnClickLeftPressed.ptr() != Py_None )
             try {
                 func_OnClickLeftPressed( player ? player->GetPyHandle() : bp::object() );
@@ -1274,7 +1274,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
     }
 
     virtual void OnClickRightPressed( ::C_HL2WarsPlayer * player ) {
-        boost::python::override func_OnClickRightPressed = this->get_override( "OnClickRightPressed" );
+        PY_OVERRIDE_LOOKUP( func_OnClickRightPressed, "OnClickRightPressed" );
         if( func_OnClickRightPressed.ptr() != Py_None )
             try {
                 func_OnClickRightPressed( player ? player->GetPyHandle() : bp::object() );
@@ -1291,7 +1291,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
     }
 
     virtual void OnClickLeftReleased( ::C_HL2WarsPlayer * player ) {
-        boost::python::override func_OnClickLeftReleased = this->get_override( "OnClickLeftReleased" );
+        PY_OVERRIDE_LOOKUP( func_OnClickLeftReleased, "OnClickLeftReleased" );
         if( func_OnClickLeftReleased.ptr() != Py_None )
             try {
                 func_OnClickLeftReleased( player ? player->GetPyHandle() : bp::object() );
@@ -1308,7 +1308,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
     }
 
     virtual void OnClickRightReleased( ::C_HL2WarsPlayer * player ) {
-        boost::python::override func_OnClickRightReleased = this->get_override( "OnClickRightReleased" );
+        PY_OVERRIDE_LOOKUP( func_OnClickRightReleased, "OnClickRightReleased" );
         if( func_OnClickRightReleased.ptr() != Py_None )
             try {
                 func_OnClickRightReleased( player ? player->GetPyHandle() : bp::object() );
@@ -1325,7 +1325,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
     }
 
     virtual void OnClickLeftDoublePressed( ::C_HL2WarsPlayer * player ) {
-        boost::python::override func_OnClickLeftDoublePressed = this->get_override( "OnClickLeftDoublePressed" );
+        PY_OVERRIDE_LOOKUP( func_OnClickLeftDoublePressed, "OnClickLeftDoublePressed" );
         if( func_OnClickLeftDoublePressed.ptr() != Py_None )
             try {
                 func_OnClickLeftDoublePressed( player ? player->GetPyHandle() : bp::object() );
@@ -1342,7 +1342,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
     }
 
     virtual void OnClickRightDoublePressed( ::C_HL2WarsPlayer * player ) {
-        boost::python::override func_OnClickRightDoublePressed = this->get_override( "OnClickRightDoublePressed" );
+        PY_OVERRIDE_LOOKUP( func_OnClickRightDoublePressed, "OnClickRightDoublePressed" );
         if( func_OnClickRightDoublePressed.ptr() != Py_None )
             try {
                 func_OnClickRightDoublePressed( player ? player->GetPyHandle() : bp::object() );
@@ -1359,7 +1359,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
     }
 
     virtual void OnCursorEntered( ::C_HL2WarsPlayer * player ) {
-        boost::python::override func_OnCursorEntered = this->get_override( "OnCursorEntered" );
+        PY_OVERRIDE_LOOKUP( func_OnCursorEntered, "OnCursorEntered" );
         if( func_OnCursorEntered.ptr() != Py_None )
             try {
                 func_OnCursorEntered( player ? player->GetPyHandle() : bp::object() );
@@ -1376,7 +1376,7 @@ struct C_UnitBase_wrapper : C_UnitBase, bp::wrapper< C_UnitBase > {
     }
 
     virtual void OnCursorExited( ::C_HL2WarsPlayer * player ) {
-        boost::python::override func_OnCursorExited = this->get_override( "OnCursorExited" );
+        PY_OVERRIDE_LOOKUP( func_OnCursorExited, "OnCursorExited" );
         if( func_OnCursorExited.ptr() != Py_None )
             try {
                 func_OnCursorExited( player ? player->GetPyHandle() : bp::object() );
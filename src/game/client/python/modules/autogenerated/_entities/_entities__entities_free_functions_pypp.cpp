@@ -78,5 +78,38 @@ void register__entities_free_functions(){
     
     }
 
+    { //::UnitsInBox
+    
+        typedef ::boost::python::list ( *UnitsInBox_function_type )( ::Vector const &,::Vector const &,int );
+        
+        bp::def( 
+            "UnitsInBox"
+            , UnitsInBox_function_type( &::UnitsInBox )
+            , ( bp::arg("vMins"), bp::arg("vMaxs"), bp::arg("iOwner")=(int)(-1) ) );
+    
+    }
+
+    { //::UnitsInRadius
+    
+        typedef ::boost::python::list ( *UnitsInRadius_function_type )( ::Vector const &,float,int );
+        
+        bp::def( 
+            "UnitsInRadius"
+            , UnitsInRadius_function_type( &::UnitsInRadius )
+            , ( bp::arg("vCenter"), bp::arg("fRadius"), bp::arg("iOwner")=(int)(-1) ) );
+    
+    }
+
+    { //::UnitsInScreenRect
+    
+        typedef ::boost::python::list ( *UnitsInScreenRect_function_type )( int,int,int,int,int );
+        
+        bp::def( 
+            "UnitsInScreenRect"
+            , UnitsInScreenRect_function_type( &::UnitsInScreenRect )
+            , ( bp::arg("iXMin"), bp::arg("iYMin"), bp::arg("iXMax"), bp::arg("iYMax"), bp::arg("iOwner")=(int)(-1) ) );
+    
+    }
+
 }
 
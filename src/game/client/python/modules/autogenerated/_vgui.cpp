@@ -81,7 +81,7 @@ struct CHudElement_wrapper : CHudElement, bp::wrapper< CHudElement > {
         if( py_log_overrides.GetBool() )
             Msg("Calling FireGameEvent( boost::python::ptr(event) ) of Class: CHudElement\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_FireGameEvent = this->get_override( "FireGameEvent" );
+        PY_OVERRIDE_LOOKUP( func_FireGameEvent, "FireGameEvent" );
         if( func_FireGameEvent.ptr() != Py_None )
             try {
                 func_FireGameEvent( boost::python::ptr(event) );
@@ -111,7 +111,7 @@ struct CHudElement_wrapper : CHudElement, bp::wrapper< CHudElement > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetRenderGroupPriority(  ) of Class: CHudElement\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetRenderGroupPriority = this->get_override( "GetRenderGroupPriority" );
+        PY_OVERRIDE_LOOKUP( func_GetRenderGroupPriority, "GetRenderGroupPriority" );
         if( func_GetRenderGroupPriority.ptr() != Py_None )
             try {
                 return func_GetRenderGroupPriority(  );
@@ -141,7 +141,7 @@ struct CHudElement_wrapper : CHudElement, bp::wrapper< CHudElement > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Init(  ) of Class: CHudElement\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Init = this->get_override( "Init" );
+        PY_OVERRIDE_LOOKUP( func_Init, "Init" );
         if( func_Init.ptr() != Py_None )
             try {
                 func_Init(  );
@@ -171,7 +171,7 @@ struct CHudElement_wrapper : CHudElement, bp::wrapper< CHudElement > {
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelInit(  ) of Class: CHudElement\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelInit = this->get_override( "LevelInit" );
+        PY_OVERRIDE_LOOKUP( func_LevelInit, "LevelInit" );
         if( func_LevelInit.ptr() != Py_None )
             try {
                 func_LevelInit(  );
@@ -201,7 +201,7 @@ struct CHudElement_wrapper : CHudElement, bp::wrapper< CHudElement > {
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelShutdown(  ) of Class: CHudElement\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelShutdown = this->get_override( "LevelShutdown" );
+        PY_OVERRIDE_LOOKUP( func_LevelShutdown, "LevelShutdown" );
         if( func_LevelShutdown.ptr() != Py_None )
             try {
                 func_LevelShutdown(  );
@@ -231,7 +231,7 @@ struct CHudElement_wrapper : CHudElement, bp::wrapper< CHudElement > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnSplitScreenStateChanged(  ) of Class: CHudElement\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnSplitScreenStateChanged = this->get_override( "OnSplitScreenStateChanged" );
+        PY_OVERRIDE_LOOKUP( func_OnSplitScreenStateChanged, "OnSplitScreenStateChanged" );
         if( func_OnSplitScreenStateChanged.ptr() != Py_None )
             try {
                 func_OnSplitScreenStateChanged(  );
@@ -261,7 +261,7 @@ struct CHudElement_wrapper : CHudElement, bp::wrapper< CHudElement > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Reset(  ) of Class: CHudElement\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Reset = this->get_override( "Reset" );
+        PY_OVERRIDE_LOOKUP( func_Reset, "Reset" );
         if( func_Reset.ptr() != Py_None )
             try {
                 func_Reset(  );
@@ -291,7 +291,7 @@ struct CHudElement_wrapper : CHudElement, bp::wrapper< CHudElement > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetHiddenBits( iBits ) of Class: CHudElement\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetHiddenBits = this->get_override( "SetHiddenBits" );
+        PY_OVERRIDE_LOOKUP( func_SetHiddenBits, "SetHiddenBits" );
         if( func_SetHiddenBits.ptr() != Py_None )
             try {
                 func_SetHiddenBits( iBits );
@@ -321,7 +321,7 @@ struct CHudElement_wrapper : CHudElement, bp::wrapper< CHudElement > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetHud( boost::python::ptr(pHud) ) of Class: CHudElement\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetHud = this->get_override( "SetHud" );
+        PY_OVERRIDE_LOOKUP( func_SetHud, "SetHud" );
         if( func_SetHud.ptr() != Py_None )
             try {
                 func_SetHud( boost::python::ptr(pHud) );
@@ -351,7 +351,7 @@ struct CHudElement_wrapper : CHudElement, bp::wrapper< CHudElement > {
         if( py_log_overrides.GetBool() )
             Msg("Calling VidInit(  ) of Class: CHudElement\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_VidInit = this->get_override( "VidInit" );
+        PY_OVERRIDE_LOOKUP( func_VidInit, "VidInit" );
         if( func_VidInit.ptr() != Py_None )
             try {
                 func_VidInit(  );
@@ -381,7 +381,7 @@ struct CHudElement_wrapper : CHudElement, bp::wrapper< CHudElement > {
         if( py_log_overrides.GetBool() )
             Msg("Calling WantsHudLayoutEntry(  ) of Class: CHudElement\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_WantsHudLayoutEntry = this->get_override( "WantsHudLayoutEntry" );
+        PY_OVERRIDE_LOOKUP( func_WantsHudLayoutEntry, "WantsHudLayoutEntry" );
         if( func_WantsHudLayoutEntry.ptr() != Py_None )
             try {
                 return func_WantsHudLayoutEntry(  );
@@ -546,7 +546,7 @@ struct WarsVGUIScreen_wrapper : WarsVGUIScreen, bp::wrapper< WarsVGUIScreen > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Draw(  ) of Class: WarsVGUIScreen\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Draw = this->get_override( "Draw" );
+        PY_OVERRIDE_LOOKUP( func_Draw, "Draw" );
         if( func_Draw.ptr() != Py_None )
             try {
                 func_Draw(  );
@@ -648,7 +648,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     };
 
     virtual bool CandidateListStartsAtOne(  ){
-        bp::override func_CandidateListStartsAtOne = this->get_override( "CandidateListStartsAtOne" );
+        PY_OVERRIDE_LOOKUP( func_CandidateListStartsAtOne, "CandidateListStartsAtOne" );
         try {
             return func_CandidateListStartsAtOne(  );
         } catch(bp::error_already_set &) {
@@ -657,7 +657,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual ::vgui::VPANEL GetAppModalSurface(  ){
-        bp::override func_GetAppModalSurface = this->get_override( "GetAppModalSurface" );
+        PY_OVERRIDE_LOOKUP( func_GetAppModalSurface, "GetAppModalSurface" );
         try {
             return func_GetAppModalSurface(  );
         } catch(bp::error_already_set &) {
@@ -666,7 +666,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual ::vgui::VPANEL GetCalculatedFocus(  ){
-        bp::override func_GetCalculatedFocus = this->get_override( "GetCalculatedFocus" );
+        PY_OVERRIDE_LOOKUP( func_GetCalculatedFocus, "GetCalculatedFocus" );
         try {
             return func_GetCalculatedFocus(  );
         } catch(bp::error_already_set &) {
@@ -675,7 +675,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void GetCandidate( int num, wchar_t * dest, int destSizeBytes ){
-        bp::override func_GetCandidate = this->get_override( "GetCandidate" );
+        PY_OVERRIDE_LOOKUP( func_GetCandidate, "GetCandidate" );
         try {
             func_GetCandidate( num, dest, destSizeBytes );
         } catch(bp::error_already_set &) {
@@ -684,7 +684,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual int GetCandidateListCount(  ){
-        bp::override func_GetCandidateListCount = this->get_override( "GetCandidateListCount" );
+        PY_OVERRIDE_LOOKUP( func_GetCandidateListCount, "GetCandidateListCount" );
         try {
             return func_GetCandidateListCount(  );
         } catch(bp::error_already_set &) {
@@ -693,7 +693,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual int GetCandidateListPageSize(  ){
-        bp::override func_GetCandidateListPageSize = this->get_override( "GetCandidateListPageSize" );
+        PY_OVERRIDE_LOOKUP( func_GetCandidateListPageSize, "GetCandidateListPageSize" );
         try {
             return func_GetCandidateListPageSize(  );
         } catch(bp::error_already_set &) {
@@ -702,7 +702,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual int GetCandidateListPageStart(  ){
-        bp::override func_GetCandidateListPageStart = this->get_override( "GetCandidateListPageStart" );
+        PY_OVERRIDE_LOOKUP( func_GetCandidateListPageStart, "GetCandidateListPageStart" );
         try {
             return func_GetCandidateListPageStart(  );
         } catch(bp::error_already_set &) {
@@ -711,7 +711,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual int GetCandidateListSelectedItem(  ){
-        bp::override func_GetCandidateListSelectedItem = this->get_override( "GetCandidateListSelectedItem" );
+        PY_OVERRIDE_LOOKUP( func_GetCandidateListSelectedItem, "GetCandidateListSelectedItem" );
         try {
             return func_GetCandidateListSelectedItem(  );
         } catch(bp::error_already_set &) {
@@ -720,7 +720,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual int GetCurrentIMEHandle(  ){
-        bp::override func_GetCurrentIMEHandle = this->get_override( "GetCurrentIMEHandle" );
+        PY_OVERRIDE_LOOKUP( func_GetCurrentIMEHandle, "GetCurrentIMEHandle" );
         try {
             return func_GetCurrentIMEHandle(  );
         } catch(bp::error_already_set &) {
@@ -729,7 +729,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual ::vgui::HCursor GetCursorOveride(  ){
-        bp::override func_GetCursorOveride = this->get_override( "GetCursorOveride" );
+        PY_OVERRIDE_LOOKUP( func_GetCursorOveride, "GetCursorOveride" );
         try {
             return func_GetCursorOveride(  );
         } catch(bp::error_already_set &) {
@@ -739,7 +739,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
 
     virtual void GetCursorPos( int & x, int & y ) {
         namespace bpl = boost::python;
-        bpl::override func_GetCursorPos = this->get_override( "GetCursorPos" );
+        PY_OVERRIDE_LOOKUP( func_GetCursorPos, "GetCursorPos" );
         if( func_GetCursorPos.ptr() != Py_None ) {
             bpl::object py_result = bpl::call<bpl::object>( func_GetCursorPos.ptr() );
             x = boost::python::extract< int >( pyplus_conv::get_out_argument( py_result, "x" ) );
@@ -766,7 +766,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
 
     virtual void GetCursorPosition( int & x, int & y ) {
         namespace bpl = boost::python;
-        bpl::override func_GetCursorPosition = this->get_override( "GetCursorPosition" );
+        PY_OVERRIDE_LOOKUP( func_GetCursorPosition, "GetCursorPosition" );
         if( func_GetCursorPosition.ptr() != Py_None ) {
             bpl::object py_result = bpl::call<bpl::object>( func_GetCursorPosition.ptr() );
             x = boost::python::extract< int >( pyplus_conv::get_out_argument( py_result, "x" ) );
@@ -792,7 +792,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual int GetEnglishIMEHandle(  ){
-        bp::override func_GetEnglishIMEHandle = this->get_override( "GetEnglishIMEHandle" );
+        PY_OVERRIDE_LOOKUP( func_GetEnglishIMEHandle, "GetEnglishIMEHandle" );
         try {
             return func_GetEnglishIMEHandle(  );
         } catch(bp::error_already_set &) {
@@ -801,7 +801,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual ::vgui::VPANEL GetFocus(  ){
-        bp::override func_GetFocus = this->get_override( "GetFocus" );
+        PY_OVERRIDE_LOOKUP( func_GetFocus, "GetFocus" );
         try {
             return func_GetFocus(  );
         } catch(bp::error_already_set &) {
@@ -810,7 +810,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual int GetIMEConversionModes( ::vgui::IInput::ConversionModeItem * dest, int destcount ){
-        bp::override func_GetIMEConversionModes = this->get_override( "GetIMEConversionModes" );
+        PY_OVERRIDE_LOOKUP( func_GetIMEConversionModes, "GetIMEConversionModes" );
         try {
             return func_GetIMEConversionModes( boost::python::ptr(dest), destcount );
         } catch(bp::error_already_set &) {
@@ -819,7 +819,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual int GetIMELanguageList( ::vgui::IInput::LanguageItem * dest, int destcount ){
-        bp::override func_GetIMELanguageList = this->get_override( "GetIMELanguageList" );
+        PY_OVERRIDE_LOOKUP( func_GetIMELanguageList, "GetIMELanguageList" );
         try {
             return func_GetIMELanguageList( boost::python::ptr(dest), destcount );
         } catch(bp::error_already_set &) {
@@ -828,7 +828,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void GetIMELanguageName( wchar_t * buf, int unicodeBufferSizeInBytes ){
-        bp::override func_GetIMELanguageName = this->get_override( "GetIMELanguageName" );
+        PY_OVERRIDE_LOOKUP( func_GetIMELanguageName, "GetIMELanguageName" );
         try {
             func_GetIMELanguageName( buf, unicodeBufferSizeInBytes );
         } catch(bp::error_already_set &) {
@@ -837,7 +837,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void GetIMELanguageShortCode( wchar_t * buf, int unicodeBufferSizeInBytes ){
-        bp::override func_GetIMELanguageShortCode = this->get_override( "GetIMELanguageShortCode" );
+        PY_OVERRIDE_LOOKUP( func_GetIMELanguageShortCode, "GetIMELanguageShortCode" );
         try {
             func_GetIMELanguageShortCode( buf, unicodeBufferSizeInBytes );
         } catch(bp::error_already_set &) {
@@ -846,7 +846,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual int GetIMESentenceModes( ::vgui::IInput::SentenceModeItem * dest, int destcount ){
-        bp::override func_GetIMESentenceModes = this->get_override( "GetIMESentenceModes" );
+        PY_OVERRIDE_LOOKUP( func_GetIMESentenceModes, "GetIMESentenceModes" );
         try {
             return func_GetIMESentenceModes( boost::python::ptr(dest), destcount );
         } catch(bp::error_already_set &) {
@@ -855,7 +855,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void * GetIMEWindow(  ){
-        bp::override func_GetIMEWindow = this->get_override( "GetIMEWindow" );
+        PY_OVERRIDE_LOOKUP( func_GetIMEWindow, "GetIMEWindow" );
         try {
             return func_GetIMEWindow(  );
         } catch(bp::error_already_set &) {
@@ -864,7 +864,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void GetKeyCodeText( ::vgui::KeyCode code, char * buf, int buflen ){
-        bp::override func_GetKeyCodeText = this->get_override( "GetKeyCodeText" );
+        PY_OVERRIDE_LOOKUP( func_GetKeyCodeText, "GetKeyCodeText" );
         try {
             func_GetKeyCodeText( code, buf, buflen );
         } catch(bp::error_already_set &) {
@@ -873,7 +873,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual ::vgui::VPANEL GetModalSubTree(  ){
-        bp::override func_GetModalSubTree = this->get_override( "GetModalSubTree" );
+        PY_OVERRIDE_LOOKUP( func_GetModalSubTree, "GetModalSubTree" );
         try {
             return func_GetModalSubTree(  );
         } catch(bp::error_already_set &) {
@@ -882,7 +882,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual ::vgui::VPANEL GetMouseCapture(  ){
-        bp::override func_GetMouseCapture = this->get_override( "GetMouseCapture" );
+        PY_OVERRIDE_LOOKUP( func_GetMouseCapture, "GetMouseCapture" );
         try {
             return func_GetMouseCapture(  );
         } catch(bp::error_already_set &) {
@@ -891,7 +891,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual ::vgui::VPANEL GetMouseFocus(  ){
-        bp::override func_GetMouseFocus = this->get_override( "GetMouseFocus" );
+        PY_OVERRIDE_LOOKUP( func_GetMouseFocus, "GetMouseFocus" );
         try {
             return func_GetMouseFocus(  );
         } catch(bp::error_already_set &) {
@@ -900,7 +900,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual ::vgui::VPANEL GetMouseOver(  ){
-        bp::override func_GetMouseOver = this->get_override( "GetMouseOver" );
+        PY_OVERRIDE_LOOKUP( func_GetMouseOver, "GetMouseOver" );
         try {
             return func_GetMouseOver(  );
         } catch(bp::error_already_set &) {
@@ -909,7 +909,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual bool GetShouldInvertCompositionString(  ){
-        bp::override func_GetShouldInvertCompositionString = this->get_override( "GetShouldInvertCompositionString" );
+        PY_OVERRIDE_LOOKUP( func_GetShouldInvertCompositionString, "GetShouldInvertCompositionString" );
         try {
             return func_GetShouldInvertCompositionString(  );
         } catch(bp::error_already_set &) {
@@ -918,7 +918,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual bool IsKeyDown( ::vgui::KeyCode code ){
-        bp::override func_IsKeyDown = this->get_override( "IsKeyDown" );
+        PY_OVERRIDE_LOOKUP( func_IsKeyDown, "IsKeyDown" );
         try {
             return func_IsKeyDown( code );
         } catch(bp::error_already_set &) {
@@ -927,7 +927,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual bool IsMouseDown( ::vgui::MouseCode code ){
-        bp::override func_IsMouseDown = this->get_override( "IsMouseDown" );
+        PY_OVERRIDE_LOOKUP( func_IsMouseDown, "IsMouseDown" );
         try {
             return func_IsMouseDown( code );
         } catch(bp::error_already_set &) {
@@ -936,7 +936,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void OnChangeIME( bool forward ){
-        bp::override func_OnChangeIME = this->get_override( "OnChangeIME" );
+        PY_OVERRIDE_LOOKUP( func_OnChangeIME, "OnChangeIME" );
         try {
             func_OnChangeIME( forward );
         } catch(bp::error_already_set &) {
@@ -945,7 +945,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void OnChangeIMEByHandle( int handleValue ){
-        bp::override func_OnChangeIMEByHandle = this->get_override( "OnChangeIMEByHandle" );
+        PY_OVERRIDE_LOOKUP( func_OnChangeIMEByHandle, "OnChangeIMEByHandle" );
         try {
             func_OnChangeIMEByHandle( handleValue );
         } catch(bp::error_already_set &) {
@@ -954,7 +954,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void OnChangeIMEConversionModeByHandle( int handleValue ){
-        bp::override func_OnChangeIMEConversionModeByHandle = this->get_override( "OnChangeIMEConversionModeByHandle" );
+        PY_OVERRIDE_LOOKUP( func_OnChangeIMEConversionModeByHandle, "OnChangeIMEConversionModeByHandle" );
         try {
             func_OnChangeIMEConversionModeByHandle( handleValue );
         } catch(bp::error_already_set &) {
@@ -963,7 +963,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void OnChangeIMESentenceModeByHandle( int handleValue ){
-        bp::override func_OnChangeIMESentenceModeByHandle = this->get_override( "OnChangeIMESentenceModeByHandle" );
+        PY_OVERRIDE_LOOKUP( func_OnChangeIMESentenceModeByHandle, "OnChangeIMESentenceModeByHandle" );
         try {
             func_OnChangeIMESentenceModeByHandle( handleValue );
         } catch(bp::error_already_set &) {
@@ -972,7 +972,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void OnIMEChangeCandidates(  ){
-        bp::override func_OnIMEChangeCandidates = this->get_override( "OnIMEChangeCandidates" );
+        PY_OVERRIDE_LOOKUP( func_OnIMEChangeCandidates, "OnIMEChangeCandidates" );
         try {
             func_OnIMEChangeCandidates(  );
         } catch(bp::error_already_set &) {
@@ -981,7 +981,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void OnIMECloseCandidates(  ){
-        bp::override func_OnIMECloseCandidates = this->get_override( "OnIMECloseCandidates" );
+        PY_OVERRIDE_LOOKUP( func_OnIMECloseCandidates, "OnIMECloseCandidates" );
         try {
             func_OnIMECloseCandidates(  );
         } catch(bp::error_already_set &) {
@@ -990,7 +990,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void OnIMEComposition( int flags ){
-        bp::override func_OnIMEComposition = this->get_override( "OnIMEComposition" );
+        PY_OVERRIDE_LOOKUP( func_OnIMEComposition, "OnIMEComposition" );
         try {
             func_OnIMEComposition( flags );
         } catch(bp::error_already_set &) {
@@ -999,7 +999,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void OnIMEEndComposition(  ){
-        bp::override func_OnIMEEndComposition = this->get_override( "OnIMEEndComposition" );
+        PY_OVERRIDE_LOOKUP( func_OnIMEEndComposition, "OnIMEEndComposition" );
         try {
             func_OnIMEEndComposition(  );
         } catch(bp::error_already_set &) {
@@ -1008,7 +1008,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void OnIMERecomputeModes(  ){
-        bp::override func_OnIMERecomputeModes = this->get_override( "OnIMERecomputeModes" );
+        PY_OVERRIDE_LOOKUP( func_OnIMERecomputeModes, "OnIMERecomputeModes" );
         try {
             func_OnIMERecomputeModes(  );
         } catch(bp::error_already_set &) {
@@ -1017,7 +1017,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void OnIMEShowCandidates(  ){
-        bp::override func_OnIMEShowCandidates = this->get_override( "OnIMEShowCandidates" );
+        PY_OVERRIDE_LOOKUP( func_OnIMEShowCandidates, "OnIMEShowCandidates" );
         try {
             func_OnIMEShowCandidates(  );
         } catch(bp::error_already_set &) {
@@ -1026,7 +1026,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void OnIMEStartComposition(  ){
-        bp::override func_OnIMEStartComposition = this->get_override( "OnIMEStartComposition" );
+        PY_OVERRIDE_LOOKUP( func_OnIMEStartComposition, "OnIMEStartComposition" );
         try {
             func_OnIMEStartComposition(  );
         } catch(bp::error_already_set &) {
@@ -1035,7 +1035,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void OnInputLanguageChanged(  ){
-        bp::override func_OnInputLanguageChanged = this->get_override( "OnInputLanguageChanged" );
+        PY_OVERRIDE_LOOKUP( func_OnInputLanguageChanged, "OnInputLanguageChanged" );
         try {
             func_OnInputLanguageChanged(  );
         } catch(bp::error_already_set &) {
@@ -1044,7 +1044,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void OnKeyCodeUnhandled( int keyCode ){
-        bp::override func_OnKeyCodeUnhandled = this->get_override( "OnKeyCodeUnhandled" );
+        PY_OVERRIDE_LOOKUP( func_OnKeyCodeUnhandled, "OnKeyCodeUnhandled" );
         try {
             func_OnKeyCodeUnhandled( keyCode );
         } catch(bp::error_already_set &) {
@@ -1053,7 +1053,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void RegisterKeyCodeUnhandledListener( ::vgui::VPANEL panel ){
-        bp::override func_RegisterKeyCodeUnhandledListener = this->get_override( "RegisterKeyCodeUnhandledListener" );
+        PY_OVERRIDE_LOOKUP( func_RegisterKeyCodeUnhandledListener, "RegisterKeyCodeUnhandledListener" );
         try {
             func_RegisterKeyCodeUnhandledListener( panel );
         } catch(bp::error_already_set &) {
@@ -1062,7 +1062,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void ReleaseAppModalSurface(  ){
-        bp::override func_ReleaseAppModalSurface = this->get_override( "ReleaseAppModalSurface" );
+        PY_OVERRIDE_LOOKUP( func_ReleaseAppModalSurface, "ReleaseAppModalSurface" );
         try {
             func_ReleaseAppModalSurface(  );
         } catch(bp::error_already_set &) {
@@ -1071,7 +1071,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void ReleaseModalSubTree(  ){
-        bp::override func_ReleaseModalSubTree = this->get_override( "ReleaseModalSubTree" );
+        PY_OVERRIDE_LOOKUP( func_ReleaseModalSubTree, "ReleaseModalSubTree" );
         try {
             func_ReleaseModalSubTree(  );
         } catch(bp::error_already_set &) {
@@ -1080,7 +1080,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void SetAppModalSurface( ::vgui::VPANEL panel ){
-        bp::override func_SetAppModalSurface = this->get_override( "SetAppModalSurface" );
+        PY_OVERRIDE_LOOKUP( func_SetAppModalSurface, "SetAppModalSurface" );
         try {
             func_SetAppModalSurface( panel );
         } catch(bp::error_already_set &) {
@@ -1089,7 +1089,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void SetCandidateListPageStart( int start ){
-        bp::override func_SetCandidateListPageStart = this->get_override( "SetCandidateListPageStart" );
+        PY_OVERRIDE_LOOKUP( func_SetCandidateListPageStart, "SetCandidateListPageStart" );
         try {
             func_SetCandidateListPageStart( start );
         } catch(bp::error_already_set &) {
@@ -1098,7 +1098,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void SetCandidateWindowPos( int x, int y ){
-        bp::override func_SetCandidateWindowPos = this->get_override( "SetCandidateWindowPos" );
+        PY_OVERRIDE_LOOKUP( func_SetCandidateWindowPos, "SetCandidateWindowPos" );
         try {
             func_SetCandidateWindowPos( x, y );
         } catch(bp::error_already_set &) {
@@ -1107,7 +1107,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void SetCursorOveride( ::vgui::HCursor cursor ){
-        bp::override func_SetCursorOveride = this->get_override( "SetCursorOveride" );
+        PY_OVERRIDE_LOOKUP( func_SetCursorOveride, "SetCursorOveride" );
         try {
             func_SetCursorOveride( cursor );
         } catch(bp::error_already_set &) {
@@ -1116,7 +1116,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void SetCursorPos( int x, int y ){
-        bp::override func_SetCursorPos = this->get_override( "SetCursorPos" );
+        PY_OVERRIDE_LOOKUP( func_SetCursorPos, "SetCursorPos" );
         try {
             func_SetCursorPos( x, y );
         } catch(bp::error_already_set &) {
@@ -1125,7 +1125,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void SetIMEWindow( void * hwnd ){
-        bp::override func_SetIMEWindow = this->get_override( "SetIMEWindow" );
+        PY_OVERRIDE_LOOKUP( func_SetIMEWindow, "SetIMEWindow" );
         try {
             func_SetIMEWindow( hwnd );
         } catch(bp::error_already_set &) {
@@ -1134,7 +1134,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void SetModalSubTree( ::vgui::VPANEL subTree, ::vgui::VPANEL unhandledMouseClickListener, bool restrictMessagesToSubTree=true ){
-        bp::override func_SetModalSubTree = this->get_override( "SetModalSubTree" );
+        PY_OVERRIDE_LOOKUP( func_SetModalSubTree, "SetModalSubTree" );
         try {
             func_SetModalSubTree( subTree, unhandledMouseClickListener, restrictMessagesToSubTree );
         } catch(bp::error_already_set &) {
@@ -1143,7 +1143,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void SetModalSubTreeReceiveMessages( bool state ){
-        bp::override func_SetModalSubTreeReceiveMessages = this->get_override( "SetModalSubTreeReceiveMessages" );
+        PY_OVERRIDE_LOOKUP( func_SetModalSubTreeReceiveMessages, "SetModalSubTreeReceiveMessages" );
         try {
             func_SetModalSubTreeReceiveMessages( state );
         } catch(bp::error_already_set &) {
@@ -1152,7 +1152,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void SetMouseCapture( ::vgui::VPANEL panel ){
-        bp::override func_SetMouseCapture = this->get_override( "SetMouseCapture" );
+        PY_OVERRIDE_LOOKUP( func_SetMouseCapture, "SetMouseCapture" );
         try {
             func_SetMouseCapture( panel );
         } catch(bp::error_already_set &) {
@@ -1161,7 +1161,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void SetMouseCaptureEx( ::vgui::VPANEL panel, ::vgui::MouseCode captureStartMouseCode ){
-        bp::override func_SetMouseCaptureEx = this->get_override( "SetMouseCaptureEx" );
+        PY_OVERRIDE_LOOKUP( func_SetMouseCaptureEx, "SetMouseCaptureEx" );
         try {
             func_SetMouseCaptureEx( panel, captureStartMouseCode );
         } catch(bp::error_already_set &) {
@@ -1170,7 +1170,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void SetMouseFocus( ::vgui::VPANEL newMouseFocus ){
-        bp::override func_SetMouseFocus = this->get_override( "SetMouseFocus" );
+        PY_OVERRIDE_LOOKUP( func_SetMouseFocus, "SetMouseFocus" );
         try {
             func_SetMouseFocus( newMouseFocus );
         } catch(bp::error_already_set &) {
@@ -1179,7 +1179,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual bool ShouldModalSubTreeReceiveMessages(  ) const {
-        bp::override func_ShouldModalSubTreeReceiveMessages = this->get_override( "ShouldModalSubTreeReceiveMessages" );
+        PY_OVERRIDE_LOOKUP( func_ShouldModalSubTreeReceiveMessages, "ShouldModalSubTreeReceiveMessages" );
         try {
             return func_ShouldModalSubTreeReceiveMessages(  );
         } catch(bp::error_already_set &) {
@@ -1188,7 +1188,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual void UnregisterKeyCodeUnhandledListener( ::vgui::VPANEL panel ){
-        bp::override func_UnregisterKeyCodeUnhandledListener = this->get_override( "UnregisterKeyCodeUnhandledListener" );
+        PY_OVERRIDE_LOOKUP( func_UnregisterKeyCodeUnhandledListener, "UnregisterKeyCodeUnhandledListener" );
         try {
             func_UnregisterKeyCodeUnhandledListener( panel );
         } catch(bp::error_already_set &) {
@@ -1197,7 +1197,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual bool WasKeyPressed( ::vgui::KeyCode code ){
-        bp::override func_WasKeyPressed = this->get_override( "WasKeyPressed" );
+        PY_OVERRIDE_LOOKUP( func_WasKeyPressed, "WasKeyPressed" );
         try {
             return func_WasKeyPressed( code );
         } catch(bp::error_already_set &) {
@@ -1206,7 +1206,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual bool WasKeyReleased( ::vgui::KeyCode code ){
-        bp::override func_WasKeyReleased = this->get_override( "WasKeyReleased" );
+        PY_OVERRIDE_LOOKUP( func_WasKeyReleased, "WasKeyReleased" );
         try {
             return func_WasKeyReleased( code );
         } catch(bp::error_already_set &) {
@@ -1215,7 +1215,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual bool WasKeyTyped( ::vgui::KeyCode code ){
-        bp::override func_WasKeyTyped = this->get_override( "WasKeyTyped" );
+        PY_OVERRIDE_LOOKUP( func_WasKeyTyped, "WasKeyTyped" );
         try {
             return func_WasKeyTyped( code );
         } catch(bp::error_already_set &) {
@@ -1224,7 +1224,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual bool WasMouseDoublePressed( ::vgui::MouseCode code ){
-        bp::override func_WasMouseDoublePressed = this->get_override( "WasMouseDoublePressed" );
+        PY_OVERRIDE_LOOKUP( func_WasMouseDoublePressed, "WasMouseDoublePressed" );
         try {
             return func_WasMouseDoublePressed( code );
         } catch(bp::error_already_set &) {
@@ -1233,7 +1233,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual bool WasMousePressed( ::vgui::MouseCode code ){
-        bp::override func_WasMousePressed = this->get_override( "WasMousePressed" );
+        PY_OVERRIDE_LOOKUP( func_WasMousePressed, "WasMousePressed" );
         try {
             return func_WasMousePressed( code );
         } catch(bp::error_already_set &) {
@@ -1242,7 +1242,7 @@ struct IInput_wrapper : vgui::IInput, bp::wrapper< vgui::IInput > {
     }
 
     virtual bool WasMouseReleased( ::vgui::MouseCode code ){
-        bp::override func_WasMouseReleased = this->get_override( "WasMouseReleased" );
+        PY_OVERRIDE_LOOKUP( func_WasMouseReleased, "WasMouseReleased" );
         try {
             return func_WasMouseReleased( code );
         } catch(bp::error_already_set &) {
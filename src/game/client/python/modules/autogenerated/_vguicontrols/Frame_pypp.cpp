@@ -55,7 +55,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Activate(  ) of Class: vgui::Frame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Activate = this->get_override( "Activate" );
+        PY_OVERRIDE_LOOKUP( func_Activate, "Activate" );
         if( func_Activate.ptr() != Py_None )
             try {
                 func_Activate(  );
@@ -85,7 +85,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling ActivateMinimized(  ) of Class: vgui::Frame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ActivateMinimized = this->get_override( "ActivateMinimized" );
+        PY_OVERRIDE_LOOKUP( func_ActivateMinimized, "ActivateMinimized" );
         if( func_ActivateMinimized.ptr() != Py_None )
             try {
                 func_ActivateMinimized(  );
@@ -102,7 +102,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
     }
 
     virtual void ApplySchemeSettings( ::vgui::IScheme * pScheme ){
-        bp::override func_ApplySchemeSettings = this->get_override( "ApplySchemeSettings" );
+        PY_OVERRIDE_LOOKUP( func_ApplySchemeSettings, "ApplySchemeSettings" );
         if( func_ApplySchemeSettings.ptr() != Py_None )
             try {
                 func_ApplySchemeSettings( boost::python::ptr(pScheme) );
@@ -140,7 +140,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Close(  ) of Class: vgui::Frame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Close = this->get_override( "Close" );
+        PY_OVERRIDE_LOOKUP( func_Close, "Close" );
         if( func_Close.ptr() != Py_None )
             try {
                 func_Close(  );
@@ -170,7 +170,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling CloseModal(  ) of Class: vgui::Frame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_CloseModal = this->get_override( "CloseModal" );
+        PY_OVERRIDE_LOOKUP( func_CloseModal, "CloseModal" );
         if( func_CloseModal.ptr() != Py_None )
             try {
                 func_CloseModal(  );
@@ -200,7 +200,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling DoModal(  ) of Class: vgui::Frame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_DoModal = this->get_override( "DoModal" );
+        PY_OVERRIDE_LOOKUP( func_DoModal, "DoModal" );
         if( func_DoModal.ptr() != Py_None )
             try {
                 func_DoModal(  );
@@ -230,7 +230,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling FlashWindow(  ) of Class: vgui::Frame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_FlashWindow = this->get_override( "FlashWindow" );
+        PY_OVERRIDE_LOOKUP( func_FlashWindow, "FlashWindow" );
         if( func_FlashWindow.ptr() != Py_None )
             try {
                 func_FlashWindow(  );
@@ -260,7 +260,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling FlashWindowStop(  ) of Class: vgui::Frame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_FlashWindowStop = this->get_override( "FlashWindowStop" );
+        PY_OVERRIDE_LOOKUP( func_FlashWindowStop, "FlashWindowStop" );
         if( func_FlashWindowStop.ptr() != Py_None )
             try {
                 func_FlashWindowStop(  );
@@ -281,7 +281,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
     }
 
     virtual bool GetDefaultScreenPosition( int & x, int & y, int & wide, int & tall ){
-        bp::override func_GetDefaultScreenPosition = this->get_override( "GetDefaultScreenPosition" );
+        PY_OVERRIDE_LOOKUP( func_GetDefaultScreenPosition, "GetDefaultScreenPosition" );
         if( func_GetDefaultScreenPosition.ptr() != Py_None )
             try {
                 return func_GetDefaultScreenPosition( x, y, wide, tall );
@@ -318,7 +318,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
     }
 
     virtual void OnChildAdded( ::vgui::VPANEL child ){
-        bp::override func_OnChildAdded = this->get_override( "OnChildAdded" );
+        PY_OVERRIDE_LOOKUP( func_OnChildAdded, "OnChildAdded" );
         if( func_OnChildAdded.ptr() != Py_None )
             try {
                 func_OnChildAdded( child );
@@ -335,7 +335,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
     }
 
     virtual void OnClose(  ){
-        bp::override func_OnClose = this->get_override( "OnClose" );
+        PY_OVERRIDE_LOOKUP( func_OnClose, "OnClose" );
         if( func_OnClose.ptr() != Py_None )
             try {
                 func_OnClose(  );
@@ -352,7 +352,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
     }
 
     virtual void OnCloseFrameButtonPressed(  ){
-        bp::override func_OnCloseFrameButtonPressed = this->get_override( "OnCloseFrameButtonPressed" );
+        PY_OVERRIDE_LOOKUP( func_OnCloseFrameButtonPressed, "OnCloseFrameButtonPressed" );
         if( func_OnCloseFrameButtonPressed.ptr() != Py_None )
             try {
                 func_OnCloseFrameButtonPressed(  );
@@ -382,7 +382,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnCommand( command ) of Class: vgui::Frame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnCommand = this->get_override( "OnCommand" );
+        PY_OVERRIDE_LOOKUP( func_OnCommand, "OnCommand" );
         if( func_OnCommand.ptr() != Py_None )
             try {
                 func_OnCommand( command );
@@ -399,7 +399,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
     }
 
     virtual void OnFinishedClose(  ){
-        bp::override func_OnFinishedClose = this->get_override( "OnFinishedClose" );
+        PY_OVERRIDE_LOOKUP( func_OnFinishedClose, "OnFinishedClose" );
         if( func_OnFinishedClose.ptr() != Py_None )
             try {
                 func_OnFinishedClose(  );
@@ -416,7 +416,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
     }
 
     virtual void OnKeyCodeReleased( ::vgui::KeyCode code ){
-        bp::override func_OnKeyCodeReleased = this->get_override( "OnKeyCodeReleased" );
+        PY_OVERRIDE_LOOKUP( func_OnKeyCodeReleased, "OnKeyCodeReleased" );
         if( func_OnKeyCodeReleased.ptr() != Py_None )
             try {
                 func_OnKeyCodeReleased( code );
@@ -433,7 +433,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
     }
 
     virtual void OnKeyCodeTyped( ::vgui::KeyCode code ){
-        bp::override func_OnKeyCodeTyped = this->get_override( "OnKeyCodeTyped" );
+        PY_OVERRIDE_LOOKUP( func_OnKeyCodeTyped, "OnKeyCodeTyped" );
         if( func_OnKeyCodeTyped.ptr() != Py_None )
             try {
                 func_OnKeyCodeTyped( code );
@@ -450,7 +450,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
     }
 
     virtual void OnKeyFocusTicked(  ){
-        bp::override func_OnKeyFocusTicked = this->get_override( "OnKeyFocusTicked" );
+        PY_OVERRIDE_LOOKUP( func_OnKeyFocusTicked, "OnKeyFocusTicked" );
         if( func_OnKeyFocusTicked.ptr() != Py_None )
             try {
                 func_OnKeyFocusTicked(  );
@@ -467,7 +467,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
     }
 
     virtual void OnMinimize(  ){
-        bp::override func_OnMinimize = this->get_override( "OnMinimize" );
+        PY_OVERRIDE_LOOKUP( func_OnMinimize, "OnMinimize" );
         if( func_OnMinimize.ptr() != Py_None )
             try {
                 func_OnMinimize(  );
@@ -484,7 +484,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
     }
 
     virtual void OnMinimizeToSysTray(  ){
-        bp::override func_OnMinimizeToSysTray = this->get_override( "OnMinimizeToSysTray" );
+        PY_OVERRIDE_LOOKUP( func_OnMinimizeToSysTray, "OnMinimizeToSysTray" );
         if( func_OnMinimizeToSysTray.ptr() != Py_None )
             try {
                 func_OnMinimizeToSysTray(  );
@@ -501,7 +501,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
     }
 
     virtual void OnMousePressed( ::vgui::MouseCode code ){
-        bp::override func_OnMousePressed = this->get_override( "OnMousePressed" );
+        PY_OVERRIDE_LOOKUP( func_OnMousePressed, "OnMousePressed" );
         if( func_OnMousePressed.ptr() != Py_None )
             try {
                 func_OnMousePressed( code );
@@ -518,7 +518,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
     }
 
     virtual void OnScreenSizeChanged( int iOldWide, int iOldTall ){
-        bp::override func_OnScreenSizeChanged = this->get_override( "OnScreenSizeChanged" );
+        PY_OVERRIDE_LOOKUP( func_OnScreenSizeChanged, "OnScreenSizeChanged" );
         if( func_OnScreenSizeChanged.ptr() != Py_None )
             try {
                 func_OnScreenSizeChanged( iOldWide, iOldTall );
@@ -535,7 +535,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
     }
 
     virtual void OnThink(  ){
-        bp::override func_OnThink = this->get_override( "OnThink" );
+        PY_OVERRIDE_LOOKUP( func_OnThink, "OnThink" );
         if( func_OnThink.ptr() != Py_None )
             try {
                 func_OnThink(  );
@@ -552,7 +552,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
     }
 
     virtual void PerformLayout(  ){
-        bp::override func_PerformLayout = this->get_override( "PerformLayout" );
+        PY_OVERRIDE_LOOKUP( func_PerformLayout, "PerformLayout" );
         if( func_PerformLayout.ptr() != Py_None )
             try {
                 func_PerformLayout(  );
@@ -582,7 +582,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetClipToParent( state ) of Class: vgui::Frame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetClipToParent = this->get_override( "SetClipToParent" );
+        PY_OVERRIDE_LOOKUP( func_SetClipToParent, "SetClipToParent" );
         if( func_SetClipToParent.ptr() != Py_None )
             try {
                 func_SetClipToParent( state );
@@ -612,7 +612,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCloseButtonVisible( state ) of Class: vgui::Frame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCloseButtonVisible = this->get_override( "SetCloseButtonVisible" );
+        PY_OVERRIDE_LOOKUP( func_SetCloseButtonVisible, "SetCloseButtonVisible" );
         if( func_SetCloseButtonVisible.ptr() != Py_None )
             try {
                 func_SetCloseButtonVisible( state );
@@ -642,7 +642,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetMaximizeButtonVisible( state ) of Class: vgui::Frame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetMaximizeButtonVisible = this->get_override( "SetMaximizeButtonVisible" );
+        PY_OVERRIDE_LOOKUP( func_SetMaximizeButtonVisible, "SetMaximizeButtonVisible" );
         if( func_SetMaximizeButtonVisible.ptr() != Py_None )
             try {
                 func_SetMaximizeButtonVisible( state );
@@ -672,7 +672,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetMenuButtonVisible( state ) of Class: vgui::Frame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetMenuButtonVisible = this->get_override( "SetMenuButtonVisible" );
+        PY_OVERRIDE_LOOKUP( func_SetMenuButtonVisible, "SetMenuButtonVisible" );
         if( func_SetMenuButtonVisible.ptr() != Py_None )
             try {
                 func_SetMenuButtonVisible( state );
@@ -702,7 +702,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetMinimizeButtonVisible( state ) of Class: vgui::Frame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetMinimizeButtonVisible = this->get_override( "SetMinimizeButtonVisible" );
+        PY_OVERRIDE_LOOKUP( func_SetMinimizeButtonVisible, "SetMinimizeButtonVisible" );
         if( func_SetMinimizeButtonVisible.ptr() != Py_None )
             try {
                 func_SetMinimizeButtonVisible( state );
@@ -732,7 +732,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetMinimizeToSysTrayButtonVisible( state ) of Class: vgui::Frame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetMinimizeToSysTrayButtonVisible = this->get_override( "SetMinimizeToSysTrayButtonVisible" );
+        PY_OVERRIDE_LOOKUP( func_SetMinimizeToSysTrayButtonVisible, "SetMinimizeToSysTrayButtonVisible" );
         if( func_SetMinimizeToSysTrayButtonVisible.ptr() != Py_None )
             try {
                 func_SetMinimizeToSysTrayButtonVisible( state );
@@ -762,7 +762,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetMoveable( state ) of Class: vgui::Frame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetMoveable = this->get_override( "SetMoveable" );
+        PY_OVERRIDE_LOOKUP( func_SetMoveable, "SetMoveable" );
         if( func_SetMoveable.ptr() != Py_None )
             try {
                 func_SetMoveable( state );
@@ -792,7 +792,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetSizeable( state ) of Class: vgui::Frame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetSizeable = this->get_override( "SetSizeable" );
+        PY_OVERRIDE_LOOKUP( func_SetSizeable, "SetSizeable" );
         if( func_SetSizeable.ptr() != Py_None )
             try {
                 func_SetSizeable( state );
@@ -822,7 +822,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetSmallCaption( state ) of Class: vgui::Frame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetSmallCaption = this->get_override( "SetSmallCaption" );
+        PY_OVERRIDE_LOOKUP( func_SetSmallCaption, "SetSmallCaption" );
         if( func_SetSmallCaption.ptr() != Py_None )
             try {
                 func_SetSmallCaption( state );
@@ -852,7 +852,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetTitle( title, surfaceTitle ) of Class: vgui::Frame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetTitle = this->get_override( "SetTitle" );
+        PY_OVERRIDE_LOOKUP( func_SetTitle, "SetTitle" );
         if( func_SetTitle.ptr() != Py_None )
             try {
                 func_SetTitle( title, surfaceTitle );
@@ -882,7 +882,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetTitle( title, surfaceTitle ) of Class: vgui::Frame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetTitle = this->get_override( "SetTitle" );
+        PY_OVERRIDE_LOOKUP( func_SetTitle, "SetTitle" );
         if( func_SetTitle.ptr() != Py_None )
             try {
                 func_SetTitle( title, surfaceTitle );
@@ -912,7 +912,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetTitleBarVisible( state ) of Class: vgui::Frame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetTitleBarVisible = this->get_override( "SetTitleBarVisible" );
+        PY_OVERRIDE_LOOKUP( func_SetTitleBarVisible, "SetTitleBarVisible" );
         if( func_SetTitleBarVisible.ptr() != Py_None )
             try {
                 func_SetTitleBarVisible( state );
@@ -982,7 +982,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnCursorEntered(  ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnCursorEntered = this->get_override( "OnCursorEntered" );
+        PY_OVERRIDE_LOOKUP( func_OnCursorEntered, "OnCursorEntered" );
         if( func_OnCursorEntered.ptr() != Py_None )
             try {
                 func_OnCursorEntered(  );
@@ -1012,7 +1012,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnCursorExited(  ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnCursorExited = this->get_override( "OnCursorExited" );
+        PY_OVERRIDE_LOOKUP( func_OnCursorExited, "OnCursorExited" );
         if( func_OnCursorExited.ptr() != Py_None )
             try {
                 func_OnCursorExited(  );
@@ -1042,7 +1042,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnCursorMoved( x, y ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnCursorMoved = this->get_override( "OnCursorMoved" );
+        PY_OVERRIDE_LOOKUP( func_OnCursorMoved, "OnCursorMoved" );
         if( func_OnCursorMoved.ptr() != Py_None )
             try {
                 func_OnCursorMoved( x, y );
@@ -1076,7 +1076,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnKeyCodePressed( code ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnKeyCodePressed = this->get_override( "OnKeyCodePressed" );
+        PY_OVERRIDE_LOOKUP( func_OnKeyCodePressed, "OnKeyCodePressed" );
         if( func_OnKeyCodePressed.ptr() != Py_None )
             try {
                 func_OnKeyCodePressed( code );
@@ -1106,7 +1106,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnKillFocus(  ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnKillFocus = this->get_override( "OnKillFocus" );
+        PY_OVERRIDE_LOOKUP( func_OnKillFocus, "OnKillFocus" );
         if( func_OnKillFocus.ptr() != Py_None )
             try {
                 func_OnKillFocus(  );
@@ -1136,7 +1136,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnMouseCaptureLost(  ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnMouseCaptureLost = this->get_override( "OnMouseCaptureLost" );
+        PY_OVERRIDE_LOOKUP( func_OnMouseCaptureLost, "OnMouseCaptureLost" );
         if( func_OnMouseCaptureLost.ptr() != Py_None )
             try {
                 func_OnMouseCaptureLost(  );
@@ -1166,7 +1166,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnMouseDoublePressed( code ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnMouseDoublePressed = this->get_override( "OnMouseDoublePressed" );
+        PY_OVERRIDE_LOOKUP( func_OnMouseDoublePressed, "OnMouseDoublePressed" );
         if( func_OnMouseDoublePressed.ptr() != Py_None )
             try {
                 func_OnMouseDoublePressed( code );
@@ -1196,7 +1196,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnMouseFocusTicked(  ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnMouseFocusTicked = this->get_override( "OnMouseFocusTicked" );
+        PY_OVERRIDE_LOOKUP( func_OnMouseFocusTicked, "OnMouseFocusTicked" );
         if( func_OnMouseFocusTicked.ptr() != Py_None )
             try {
                 func_OnMouseFocusTicked(  );
@@ -1226,7 +1226,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnMouseReleased( code ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnMouseReleased = this->get_override( "OnMouseReleased" );
+        PY_OVERRIDE_LOOKUP( func_OnMouseReleased, "OnMouseReleased" );
         if( func_OnMouseReleased.ptr() != Py_None )
             try {
                 func_OnMouseReleased( code );
@@ -1256,7 +1256,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnMouseTriplePressed( code ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnMouseTriplePressed = this->get_override( "OnMouseTriplePressed" );
+        PY_OVERRIDE_LOOKUP( func_OnMouseTriplePressed, "OnMouseTriplePressed" );
         if( func_OnMouseTriplePressed.ptr() != Py_None )
             try {
                 func_OnMouseTriplePressed( code );
@@ -1286,7 +1286,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnMouseWheeled( delta ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnMouseWheeled = this->get_override( "OnMouseWheeled" );
+        PY_OVERRIDE_LOOKUP( func_OnMouseWheeled, "OnMouseWheeled" );
         if( func_OnMouseWheeled.ptr() != Py_None )
             try {
                 func_OnMouseWheeled( delta );
@@ -1320,7 +1320,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnTick(  ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnTick = this->get_override( "OnTick" );
+        PY_OVERRIDE_LOOKUP( func_OnTick, "OnTick" );
         if( func_OnTick.ptr() != Py_None )
             try {
                 func_OnTick(  );
@@ -1350,7 +1350,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling PaintBuildOverlay(  ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PaintBuildOverlay = this->get_override( "PaintBuildOverlay" );
+        PY_OVERRIDE_LOOKUP( func_PaintBuildOverlay, "PaintBuildOverlay" );
         if( func_PaintBuildOverlay.ptr() != Py_None )
             try {
                 func_PaintBuildOverlay(  );
@@ -1384,7 +1384,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling PostChildPaint(  ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PostChildPaint = this->get_override( "PostChildPaint" );
+        PY_OVERRIDE_LOOKUP( func_PostChildPaint, "PostChildPaint" );
         if( func_PostChildPaint.ptr() != Py_None )
             try {
                 func_PostChildPaint(  );
@@ -1414,7 +1414,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetBgColor( color ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetBgColor = this->get_override( "SetBgColor" );
+        PY_OVERRIDE_LOOKUP( func_SetBgColor, "SetBgColor" );
         if( func_SetBgColor.ptr() != Py_None )
             try {
                 func_SetBgColor( color );
@@ -1444,7 +1444,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetBorder( boost::python::ptr(border) ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetBorder = this->get_override( "SetBorder" );
+        PY_OVERRIDE_LOOKUP( func_SetBorder, "SetBorder" );
         if( func_SetBorder.ptr() != Py_None )
             try {
                 func_SetBorder( boost::python::ptr(border) );
@@ -1474,7 +1474,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCursor( cursor ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCursor = this->get_override( "SetCursor" );
+        PY_OVERRIDE_LOOKUP( func_SetCursor, "SetCursor" );
         if( func_SetCursor.ptr() != Py_None )
             try {
                 func_SetCursor( cursor );
@@ -1504,7 +1504,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetDragEnabled( enabled ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetDragEnabled = this->get_override( "SetDragEnabled" );
+        PY_OVERRIDE_LOOKUP( func_SetDragEnabled, "SetDragEnabled" );
         if( func_SetDragEnabled.ptr() != Py_None )
             try {
                 func_SetDragEnabled( enabled );
@@ -1534,7 +1534,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetEnabled( state ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetEnabled = this->get_override( "SetEnabled" );
+        PY_OVERRIDE_LOOKUP( func_SetEnabled, "SetEnabled" );
         if( func_SetEnabled.ptr() != Py_None )
             try {
                 func_SetEnabled( state );
@@ -1564,7 +1564,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetFgColor( color ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetFgColor = this->get_override( "SetFgColor" );
+        PY_OVERRIDE_LOOKUP( func_SetFgColor, "SetFgColor" );
         if( func_SetFgColor.ptr() != Py_None )
             try {
                 func_SetFgColor( color );
@@ -1594,7 +1594,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetKeyBoardInputEnabled( state ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetKeyBoardInputEnabled = this->get_override( "SetKeyBoardInputEnabled" );
+        PY_OVERRIDE_LOOKUP( func_SetKeyBoardInputEnabled, "SetKeyBoardInputEnabled" );
         if( func_SetKeyBoardInputEnabled.ptr() != Py_None )
             try {
                 func_SetKeyBoardInputEnabled( state );
@@ -1624,7 +1624,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetMouseInputEnabled( state ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetMouseInputEnabled = this->get_override( "SetMouseInputEnabled" );
+        PY_OVERRIDE_LOOKUP( func_SetMouseInputEnabled, "SetMouseInputEnabled" );
         if( func_SetMouseInputEnabled.ptr() != Py_None )
             try {
                 func_SetMouseInputEnabled( state );
@@ -1674,7 +1674,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPaintBackgroundEnabled( state ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPaintBackgroundEnabled = this->get_override( "SetPaintBackgroundEnabled" );
+        PY_OVERRIDE_LOOKUP( func_SetPaintBackgroundEnabled, "SetPaintBackgroundEnabled" );
         if( func_SetPaintBackgroundEnabled.ptr() != Py_None )
             try {
                 func_SetPaintBackgroundEnabled( state );
@@ -1704,7 +1704,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPaintBackgroundType( type ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPaintBackgroundType = this->get_override( "SetPaintBackgroundType" );
+        PY_OVERRIDE_LOOKUP( func_SetPaintBackgroundType, "SetPaintBackgroundType" );
         if( func_SetPaintBackgroundType.ptr() != Py_None )
             try {
                 func_SetPaintBackgroundType( type );
@@ -1734,7 +1734,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPaintBorderEnabled( state ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPaintBorderEnabled = this->get_override( "SetPaintBorderEnabled" );
+        PY_OVERRIDE_LOOKUP( func_SetPaintBorderEnabled, "SetPaintBorderEnabled" );
         if( func_SetPaintBorderEnabled.ptr() != Py_None )
             try {
                 func_SetPaintBorderEnabled( state );
@@ -1764,7 +1764,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPaintEnabled( state ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPaintEnabled = this->get_override( "SetPaintEnabled" );
+        PY_OVERRIDE_LOOKUP( func_SetPaintEnabled, "SetPaintEnabled" );
         if( func_SetPaintEnabled.ptr() != Py_None )
             try {
                 func_SetPaintEnabled( state );
@@ -1794,7 +1794,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetParent( newParent ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetParent = this->get_override( "SetParent" );
+        PY_OVERRIDE_LOOKUP( func_SetParent, "SetParent" );
         if( func_SetParent.ptr() != Py_None )
             try {
                 func_SetParent( newParent );
@@ -1824,7 +1824,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetScheme( tag ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetScheme = this->get_override( "SetScheme" );
+        PY_OVERRIDE_LOOKUP( func_SetScheme, "SetScheme" );
         if( func_SetScheme.ptr() != Py_None )
             try {
                 func_SetScheme( tag );
@@ -1854,7 +1854,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetScheme( scheme ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetScheme = this->get_override( "SetScheme" );
+        PY_OVERRIDE_LOOKUP( func_SetScheme, "SetScheme" );
         if( func_SetScheme.ptr() != Py_None )
             try {
                 func_SetScheme( scheme );
@@ -1884,7 +1884,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetVisible( state ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetVisible = this->get_override( "SetVisible" );
+        PY_OVERRIDE_LOOKUP( func_SetVisible, "SetVisible" );
         if( func_SetVisible.ptr() != Py_None )
             try {
                 func_SetVisible( state );
@@ -1916,7 +1916,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
             if( py_log_overrides.GetBool() )
                 Msg("Calling Paint(  ) of Class: vgui::vgui::Panel\n");
             #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-            bp::override func_Paint = this->get_override( "Paint" );
+            PY_OVERRIDE_LOOKUP( func_Paint, "Paint" );
             if( func_Paint.ptr() != Py_None )
                 try {
                     func_Paint(  );
@@ -1956,7 +1956,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
             if( py_log_overrides.GetBool() )
                 Msg("Calling PaintBackground(  ) of Class: vgui::vgui::Frame\n");
             #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-            bp::override func_PaintBackground = this->get_override( "PaintBackground" );
+            PY_OVERRIDE_LOOKUP( func_PaintBackground, "PaintBackground" );
             if( func_PaintBackground.ptr() != Py_None )
                 try {
                     func_PaintBackground(  );
@@ -1995,7 +1995,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
         if( py_log_overrides.GetBool() )
             Msg("Calling InvalidateLayout( layoutNow, reloadScheme ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_InvalidateLayout = this->get_override( "InvalidateLayout" );
+        PY_OVERRIDE_LOOKUP( func_InvalidateLayout, "InvalidateLayout" );
         if( func_InvalidateLayout.ptr() != Py_None )
             try {
                 func_InvalidateLayout( layoutNow, reloadScheme );
@@ -2052,7 +2052,7 @@ struct Frame_wrapper : PyPanel, vgui::Frame, bp::wrapper< vgui::Frame > {
     virtual void SetFlushedByParent( bool bEnabled ) { PyPanel::SetFlushedByParent( bEnabled ); }
 
     virtual void SetParent( ::vgui::Panel * newParent ) {
-        boost::python::override func_SetParent = this->get_override( "SetParent" );
+        PY_OVERRIDE_LOOKUP( func_SetParent, "SetParent" );
         if( func_SetParent.ptr() != Py_None )
             try {
                 func_SetParent( *newParent );
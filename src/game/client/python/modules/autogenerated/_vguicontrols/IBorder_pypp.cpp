@@ -42,7 +42,7 @@ struct IBorder_wrapper : vgui::IBorder, bp::wrapper< vgui::IBorder > {
     }
 
     virtual void ApplySchemeSettings( ::vgui::IScheme * pScheme, ::KeyValues * inResourceData ){
-        bp::override func_ApplySchemeSettings = this->get_override( "ApplySchemeSettings" );
+        PY_OVERRIDE_LOOKUP( func_ApplySchemeSettings, "ApplySchemeSettings" );
         try {
             func_ApplySchemeSettings( boost::python::ptr(pScheme), boost::python::ptr(inResourceData) );
         } catch(bp::error_already_set &) {
@@ -51,7 +51,7 @@ struct IBorder_wrapper : vgui::IBorder, bp::wrapper< vgui::IBorder > {
     }
 
     virtual ::vgui::IBorder::backgroundtype_e GetBackgroundType(  ){
-        bp::override func_GetBackgroundType = this->get_override( "GetBackgroundType" );
+        PY_OVERRIDE_LOOKUP( func_GetBackgroundType, "GetBackgroundType" );
         try {
             return func_GetBackgroundType(  );
         } catch(bp::error_already_set &) {
@@ -61,7 +61,7 @@ struct IBorder_wrapper : vgui::IBorder, bp::wrapper< vgui::IBorder > {
 
     virtual void GetInset( int & left, int & top, int & right, int & bottom ) {
         namespace bpl = boost::python;
-        bpl::override func_GetInset = this->get_override( "GetInset" );
+        PY_OVERRIDE_LOOKUP( func_GetInset, "GetInset" );
         if( func_GetInset.ptr() != Py_None ) {
             bpl::object py_result = bpl::call<bpl::object>( func_GetInset.ptr() );
             left = boost::python::extract< int >( pyplus_conv::get_out_argument( py_result, "left" ) );
@@ -91,7 +91,7 @@ struct IBorder_wrapper : vgui::IBorder, bp::wrapper< vgui::IBorder > {
     }
 
     virtual char const * GetName(  ){
-        bp::override func_GetName = this->get_override( "GetName" );
+        PY_OVERRIDE_LOOKUP( func_GetName, "GetName" );
         try {
             return func_GetName(  );
         } catch(bp::error_already_set &) {
@@ -100,7 +100,7 @@ struct IBorder_wrapper : vgui::IBorder, bp::wrapper< vgui::IBorder > {
     }
 
     virtual void Paint( ::vgui::VPANEL panel ){
-        bp::override func_Paint = this->get_override( "Paint" );
+        PY_OVERRIDE_LOOKUP( func_Paint, "Paint" );
         try {
             func_Paint( panel );
         } catch(bp::error_already_set &) {
@@ -109,7 +109,7 @@ struct IBorder_wrapper : vgui::IBorder, bp::wrapper< vgui::IBorder > {
     }
 
     virtual void Paint( int x0, int y0, int x1, int y1 ){
-        bp::override func_Paint = this->get_override( "Paint" );
+        PY_OVERRIDE_LOOKUP( func_Paint, "Paint" );
         try {
             func_Paint( x0, y0, x1, y1 );
         } catch(bp::error_already_set &) {
@@ -118,7 +118,7 @@ struct IBorder_wrapper : vgui::IBorder, bp::wrapper< vgui::IBorder > {
     }
 
     virtual void Paint( int x0, int y0, int x1, int y1, int breakSide, int breakStart, int breakStop ){
-        bp::override func_Paint = this->get_override( "Paint" );
+        PY_OVERRIDE_LOOKUP( func_Paint, "Paint" );
         try {
             func_Paint( x0, y0, x1, y1, breakSide, breakStart, breakStop );
         } catch(bp::error_already_set &) {
@@ -127,7 +127,7 @@ struct IBorder_wrapper : vgui::IBorder, bp::wrapper< vgui::IBorder > {
     }
 
     virtual bool PaintFirst(  ){
-        bp::override func_PaintFirst = this->get_override( "PaintFirst" );
+        PY_OVERRIDE_LOOKUP( func_PaintFirst, "PaintFirst" );
         try {
             return func_PaintFirst(  );
         } catch(bp::error_already_set &) {
@@ -136,7 +136,7 @@ struct IBorder_wrapper : vgui::IBorder, bp::wrapper< vgui::IBorder > {
     }
 
     virtual void SetInset( int left, int top, int right, int bottom ){
-        bp::override func_SetInset = this->get_override( "SetInset" );
+        PY_OVERRIDE_LOOKUP( func_SetInset, "SetInset" );
         try {
             func_SetInset( left, top, right, bottom );
         } catch(bp::error_already_set &) {
@@ -145,7 +145,7 @@ struct IBorder_wrapper : vgui::IBorder, bp::wrapper< vgui::IBorder > {
     }
 
     virtual void SetName( char const * name ){
-        bp::override func_SetName = this->get_override( "SetName" );
+        PY_OVERRIDE_LOOKUP( func_SetName, "SetName" );
         try {
             func_SetName( name );
         } catch(bp::error_already_set &) {
@@ -42,7 +42,7 @@ struct IImage_wrapper : vgui::IImage, bp::wrapper< vgui::IImage > {
     }
 
     virtual bool Evict(  ){
-        bp::override func_Evict = this->get_override( "Evict" );
+        PY_OVERRIDE_LOOKUP( func_Evict, "Evict" );
         try {
             return func_Evict(  );
         } catch(bp::error_already_set &) {
@@ -52,7 +52,7 @@ struct IImage_wrapper : vgui::IImage, bp::wrapper< vgui::IImage > {
 
     virtual void GetContentSize( int & wide, int & tall ) {
         namespace bpl = boost::python;
-        bpl::override func_GetContentSize = this->get_override( "GetContentSize" );
+        PY_OVERRIDE_LOOKUP( func_GetContentSize, "GetContentSize" );
         if( func_GetContentSize.ptr() != Py_None ) {
             bpl::object py_result = bpl::call<bpl::object>( func_GetContentSize.ptr() );
             wide = boost::python::extract< int >( pyplus_conv::get_out_argument( py_result, "wide" ) );
@@ -78,7 +78,7 @@ struct IImage_wrapper : vgui::IImage, bp::wrapper< vgui::IImage > {
     }
 
     virtual ::vgui::HTexture GetID(  ){
-        bp::override func_GetID = this->get_override( "GetID" );
+        PY_OVERRIDE_LOOKUP( func_GetID, "GetID" );
         try {
             return func_GetID(  );
         } catch(bp::error_already_set &) {
@@ -87,7 +87,7 @@ struct IImage_wrapper : vgui::IImage, bp::wrapper< vgui::IImage > {
     }
 
     virtual int GetNumFrames(  ){
-        bp::override func_GetNumFrames = this->get_override( "GetNumFrames" );
+        PY_OVERRIDE_LOOKUP( func_GetNumFrames, "GetNumFrames" );
         try {
             return func_GetNumFrames(  );
         } catch(bp::error_already_set &) {
@@ -97,7 +97,7 @@ struct IImage_wrapper : vgui::IImage, bp::wrapper< vgui::IImage > {
 
     virtual void GetSize( int & wide, int & tall ) {
         namespace bpl = boost::python;
-        bpl::override func_GetSize = this->get_override( "GetSize" );
+        PY_OVERRIDE_LOOKUP( func_GetSize, "GetSize" );
         if( func_GetSize.ptr() != Py_None ) {
             bpl::object py_result = bpl::call<bpl::object>( func_GetSize.ptr() );
             wide = boost::python::extract< int >( pyplus_conv::get_out_argument( py_result, "wide" ) );
@@ -123,7 +123,7 @@ struct IImage_wrapper : vgui::IImage, bp::wrapper< vgui::IImage > {
     }
 
     virtual void Paint(  ){
-        bp::override func_Paint = this->get_override( "Paint" );
+        PY_OVERRIDE_LOOKUP( func_Paint, "Paint" );
         try {
             func_Paint(  );
         } catch(bp::error_already_set &) {
@@ -132,7 +132,7 @@ struct IImage_wrapper : vgui::IImage, bp::wrapper< vgui::IImage > {
     }
 
     virtual void SetColor( ::Color col ){
-        bp::override func_SetColor = this->get_override( "SetColor" );
+        PY_OVERRIDE_LOOKUP( func_SetColor, "SetColor" );
         try {
             func_SetColor( col );
         } catch(bp::error_already_set &) {
@@ -141,7 +141,7 @@ struct IImage_wrapper : vgui::IImage, bp::wrapper< vgui::IImage > {
     }
 
     virtual void SetFrame( int nFrame ){
-        bp::override func_SetFrame = this->get_override( "SetFrame" );
+        PY_OVERRIDE_LOOKUP( func_SetFrame, "SetFrame" );
         try {
             func_SetFrame( nFrame );
         } catch(bp::error_already_set &) {
@@ -150,7 +150,7 @@ struct IImage_wrapper : vgui::IImage, bp::wrapper< vgui::IImage > {
     }
 
     virtual void SetPos( int x, int y ){
-        bp::override func_SetPos = this->get_override( "SetPos" );
+        PY_OVERRIDE_LOOKUP( func_SetPos, "SetPos" );
         try {
             func_SetPos( x, y );
         } catch(bp::error_already_set &) {
@@ -159,7 +159,7 @@ struct IImage_wrapper : vgui::IImage, bp::wrapper< vgui::IImage > {
     }
 
     virtual void SetRotation( int iRotation ){
-        bp::override func_SetRotation = this->get_override( "SetRotation" );
+        PY_OVERRIDE_LOOKUP( func_SetRotation, "SetRotation" );
         try {
             func_SetRotation( iRotation );
         } catch(bp::error_already_set &) {
@@ -168,7 +168,7 @@ struct IImage_wrapper : vgui::IImage, bp::wrapper< vgui::IImage > {
     }
 
     virtual void SetSize( int wide, int tall ){
-        bp::override func_SetSize = this->get_override( "SetSize" );
+        PY_OVERRIDE_LOOKUP( func_SetSize, "SetSize" );
         try {
             func_SetSize( wide, tall );
         } catch(bp::error_already_set &) {
@@ -112,7 +112,7 @@ struct Image_wrapper : vgui::Image, bp::wrapper< vgui::Image > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Evict(  ) of Class: vgui::Image\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Evict = this->get_override( "Evict" );
+        PY_OVERRIDE_LOOKUP( func_Evict, "Evict" );
         if( func_Evict.ptr() != Py_None )
             try {
                 return func_Evict(  );
@@ -130,7 +130,7 @@ struct Image_wrapper : vgui::Image, bp::wrapper< vgui::Image > {
 
     virtual void GetContentSize( int & wide, int & tall ) {
         namespace bpl = boost::python;
-        bpl::override func_GetContentSize = this->get_override( "GetContentSize" );
+        PY_OVERRIDE_LOOKUP( func_GetContentSize, "GetContentSize" );
         if( func_GetContentSize.ptr() != Py_None ) {
             bpl::object py_result = bpl::call<bpl::object>( func_GetContentSize.ptr() );
             wide = boost::python::extract< int >( pyplus_conv::get_out_argument( py_result, "wide" ) );
@@ -167,7 +167,7 @@ struct Image_wrapper : vgui::Image, bp::wrapper< vgui::Image > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetID(  ) of Class: vgui::Image\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetID = this->get_override( "GetID" );
+        PY_OVERRIDE_LOOKUP( func_GetID, "GetID" );
         if( func_GetID.ptr() != Py_None )
             try {
                 return func_GetID(  );
@@ -197,7 +197,7 @@ struct Image_wrapper : vgui::Image, bp::wrapper< vgui::Image > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetNumFrames(  ) of Class: vgui::Image\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetNumFrames = this->get_override( "GetNumFrames" );
+        PY_OVERRIDE_LOOKUP( func_GetNumFrames, "GetNumFrames" );
         if( func_GetNumFrames.ptr() != Py_None )
             try {
                 return func_GetNumFrames(  );
@@ -215,7 +215,7 @@ struct Image_wrapper : vgui::Image, bp::wrapper< vgui::Image > {
 
     virtual void GetPos( int & x, int & y ) {
         namespace bpl = boost::python;
-        bpl::override func_GetPos = this->get_override( "GetPos" );
+        PY_OVERRIDE_LOOKUP( func_GetPos, "GetPos" );
         if( func_GetPos.ptr() != Py_None ) {
             bpl::object py_result = bpl::call<bpl::object>( func_GetPos.ptr() );
             x = boost::python::extract< int >( pyplus_conv::get_out_argument( py_result, "x" ) );
@@ -240,7 +240,7 @@ struct Image_wrapper : vgui::Image, bp::wrapper< vgui::Image > {
 
     virtual void GetSize( int & wide, int & tall ) {
         namespace bpl = boost::python;
-        bpl::override func_GetSize = this->get_override( "GetSize" );
+        PY_OVERRIDE_LOOKUP( func_GetSize, "GetSize" );
         if( func_GetSize.ptr() != Py_None ) {
             bpl::object py_result = bpl::call<bpl::object>( func_GetSize.ptr() );
             wide = boost::python::extract< int >( pyplus_conv::get_out_argument( py_result, "wide" ) );
@@ -277,7 +277,7 @@ struct Image_wrapper : vgui::Image, bp::wrapper< vgui::Image > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTall(  ) of Class: vgui::Image\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTall = this->get_override( "GetTall" );
+        PY_OVERRIDE_LOOKUP( func_GetTall, "GetTall" );
         if( func_GetTall.ptr() != Py_None )
             try {
                 return func_GetTall(  );
@@ -307,7 +307,7 @@ struct Image_wrapper : vgui::Image, bp::wrapper< vgui::Image > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetWide(  ) of Class: vgui::Image\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetWide = this->get_override( "GetWide" );
+        PY_OVERRIDE_LOOKUP( func_GetWide, "GetWide" );
         if( func_GetWide.ptr() != Py_None )
             try {
                 return func_GetWide(  );
@@ -337,7 +337,7 @@ struct Image_wrapper : vgui::Image, bp::wrapper< vgui::Image > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetFrame( nFrame ) of Class: vgui::Image\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetFrame = this->get_override( "SetFrame" );
+        PY_OVERRIDE_LOOKUP( func_SetFrame, "SetFrame" );
         if( func_SetFrame.ptr() != Py_None )
             try {
                 func_SetFrame( nFrame );
@@ -367,7 +367,7 @@ struct Image_wrapper : vgui::Image, bp::wrapper< vgui::Image > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetRotation( iRotation ) of Class: vgui::Image\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetRotation = this->get_override( "SetRotation" );
+        PY_OVERRIDE_LOOKUP( func_SetRotation, "SetRotation" );
         if( func_SetRotation.ptr() != Py_None )
             try {
                 func_SetRotation( iRotation );
@@ -84,7 +84,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling ApplySchemeSettings( boost::python::ptr(pScheme) ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ApplySchemeSettings = this->get_override( "ApplySchemeSettings" );
+        PY_OVERRIDE_LOOKUP( func_ApplySchemeSettings, "ApplySchemeSettings" );
         if( func_ApplySchemeSettings.ptr() != Py_None )
             try {
                 func_ApplySchemeSettings( boost::python::ptr(pScheme) );
@@ -223,7 +223,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnChildAdded( child ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnChildAdded = this->get_override( "OnChildAdded" );
+        PY_OVERRIDE_LOOKUP( func_OnChildAdded, "OnChildAdded" );
         if( func_OnChildAdded.ptr() != Py_None )
             try {
                 func_OnChildAdded( child );
@@ -253,7 +253,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnCommand( command ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnCommand = this->get_override( "OnCommand" );
+        PY_OVERRIDE_LOOKUP( func_OnCommand, "OnCommand" );
         if( func_OnCommand.ptr() != Py_None )
             try {
                 func_OnCommand( command );
@@ -287,7 +287,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnCursorEntered(  ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnCursorEntered = this->get_override( "OnCursorEntered" );
+        PY_OVERRIDE_LOOKUP( func_OnCursorEntered, "OnCursorEntered" );
         if( func_OnCursorEntered.ptr() != Py_None )
             try {
                 func_OnCursorEntered(  );
@@ -317,7 +317,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnCursorExited(  ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnCursorExited = this->get_override( "OnCursorExited" );
+        PY_OVERRIDE_LOOKUP( func_OnCursorExited, "OnCursorExited" );
         if( func_OnCursorExited.ptr() != Py_None )
             try {
                 func_OnCursorExited(  );
@@ -347,7 +347,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnCursorMoved( x, y ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnCursorMoved = this->get_override( "OnCursorMoved" );
+        PY_OVERRIDE_LOOKUP( func_OnCursorMoved, "OnCursorMoved" );
         if( func_OnCursorMoved.ptr() != Py_None )
             try {
                 func_OnCursorMoved( x, y );
@@ -381,7 +381,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnKeyCodePressed( code ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnKeyCodePressed = this->get_override( "OnKeyCodePressed" );
+        PY_OVERRIDE_LOOKUP( func_OnKeyCodePressed, "OnKeyCodePressed" );
         if( func_OnKeyCodePressed.ptr() != Py_None )
             try {
                 func_OnKeyCodePressed( code );
@@ -411,7 +411,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnKeyCodeReleased( code ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnKeyCodeReleased = this->get_override( "OnKeyCodeReleased" );
+        PY_OVERRIDE_LOOKUP( func_OnKeyCodeReleased, "OnKeyCodeReleased" );
         if( func_OnKeyCodeReleased.ptr() != Py_None )
             try {
                 func_OnKeyCodeReleased( code );
@@ -441,7 +441,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnKeyCodeTyped( code ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnKeyCodeTyped = this->get_override( "OnKeyCodeTyped" );
+        PY_OVERRIDE_LOOKUP( func_OnKeyCodeTyped, "OnKeyCodeTyped" );
         if( func_OnKeyCodeTyped.ptr() != Py_None )
             try {
                 func_OnKeyCodeTyped( code );
@@ -471,7 +471,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnKeyFocusTicked(  ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnKeyFocusTicked = this->get_override( "OnKeyFocusTicked" );
+        PY_OVERRIDE_LOOKUP( func_OnKeyFocusTicked, "OnKeyFocusTicked" );
         if( func_OnKeyFocusTicked.ptr() != Py_None )
             try {
                 func_OnKeyFocusTicked(  );
@@ -501,7 +501,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnKillFocus(  ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnKillFocus = this->get_override( "OnKillFocus" );
+        PY_OVERRIDE_LOOKUP( func_OnKillFocus, "OnKillFocus" );
         if( func_OnKillFocus.ptr() != Py_None )
             try {
                 func_OnKillFocus(  );
@@ -531,7 +531,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnMouseCaptureLost(  ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnMouseCaptureLost = this->get_override( "OnMouseCaptureLost" );
+        PY_OVERRIDE_LOOKUP( func_OnMouseCaptureLost, "OnMouseCaptureLost" );
         if( func_OnMouseCaptureLost.ptr() != Py_None )
             try {
                 func_OnMouseCaptureLost(  );
@@ -561,7 +561,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnMouseDoublePressed( code ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnMouseDoublePressed = this->get_override( "OnMouseDoublePressed" );
+        PY_OVERRIDE_LOOKUP( func_OnMouseDoublePressed, "OnMouseDoublePressed" );
         if( func_OnMouseDoublePressed.ptr() != Py_None )
             try {
                 func_OnMouseDoublePressed( code );
@@ -591,7 +591,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnMouseFocusTicked(  ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnMouseFocusTicked = this->get_override( "OnMouseFocusTicked" );
+        PY_OVERRIDE_LOOKUP( func_OnMouseFocusTicked, "OnMouseFocusTicked" );
         if( func_OnMouseFocusTicked.ptr() != Py_None )
             try {
                 func_OnMouseFocusTicked(  );
@@ -621,7 +621,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnMousePressed( code ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnMousePressed = this->get_override( "OnMousePressed" );
+        PY_OVERRIDE_LOOKUP( func_OnMousePressed, "OnMousePressed" );
         if( func_OnMousePressed.ptr() != Py_None )
             try {
                 func_OnMousePressed( code );
@@ -651,7 +651,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnMouseReleased( code ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnMouseReleased = this->get_override( "OnMouseReleased" );
+        PY_OVERRIDE_LOOKUP( func_OnMouseReleased, "OnMouseReleased" );
         if( func_OnMouseReleased.ptr() != Py_None )
             try {
                 func_OnMouseReleased( code );
@@ -681,7 +681,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnMouseTriplePressed( code ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnMouseTriplePressed = this->get_override( "OnMouseTriplePressed" );
+        PY_OVERRIDE_LOOKUP( func_OnMouseTriplePressed, "OnMouseTriplePressed" );
         if( func_OnMouseTriplePressed.ptr() != Py_None )
             try {
                 func_OnMouseTriplePressed( code );
@@ -711,7 +711,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnMouseWheeled( delta ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnMouseWheeled = this->get_override( "OnMouseWheeled" );
+        PY_OVERRIDE_LOOKUP( func_OnMouseWheeled, "OnMouseWheeled" );
         if( func_OnMouseWheeled.ptr() != Py_None )
             try {
                 func_OnMouseWheeled( delta );
@@ -728,7 +728,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
     }
 
     virtual void OnRequestFocus( ::vgui::VPANEL subFocus, ::vgui::VPANEL defaultPanel ){
-        bp::override func_OnRequestFocus = this->get_override( "OnRequestFocus" );
+        PY_OVERRIDE_LOOKUP( func_OnRequestFocus, "OnRequestFocus" );
         if( func_OnRequestFocus.ptr() != Py_None )
             try {
                 func_OnRequestFocus( subFocus, defaultPanel );
@@ -745,7 +745,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
     }
 
     virtual void OnScreenSizeChanged( int oldwide, int oldtall ){
-        bp::override func_OnScreenSizeChanged = this->get_override( "OnScreenSizeChanged" );
+        PY_OVERRIDE_LOOKUP( func_OnScreenSizeChanged, "OnScreenSizeChanged" );
         if( func_OnScreenSizeChanged.ptr() != Py_None )
             try {
                 func_OnScreenSizeChanged( oldwide, oldtall );
@@ -775,7 +775,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnSetFocus(  ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnSetFocus = this->get_override( "OnSetFocus" );
+        PY_OVERRIDE_LOOKUP( func_OnSetFocus, "OnSetFocus" );
         if( func_OnSetFocus.ptr() != Py_None )
             try {
                 func_OnSetFocus(  );
@@ -805,7 +805,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnSizeChanged( newWide, newTall ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnSizeChanged = this->get_override( "OnSizeChanged" );
+        PY_OVERRIDE_LOOKUP( func_OnSizeChanged, "OnSizeChanged" );
         if( func_OnSizeChanged.ptr() != Py_None )
             try {
                 func_OnSizeChanged( newWide, newTall );
@@ -839,7 +839,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnThink(  ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnThink = this->get_override( "OnThink" );
+        PY_OVERRIDE_LOOKUP( func_OnThink, "OnThink" );
         if( func_OnThink.ptr() != Py_None )
             try {
                 func_OnThink(  );
@@ -869,7 +869,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnTick(  ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnTick = this->get_override( "OnTick" );
+        PY_OVERRIDE_LOOKUP( func_OnTick, "OnTick" );
         if( func_OnTick.ptr() != Py_None )
             try {
                 func_OnTick(  );
@@ -899,7 +899,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling PaintBuildOverlay(  ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PaintBuildOverlay = this->get_override( "PaintBuildOverlay" );
+        PY_OVERRIDE_LOOKUP( func_PaintBuildOverlay, "PaintBuildOverlay" );
         if( func_PaintBuildOverlay.ptr() != Py_None )
             try {
                 func_PaintBuildOverlay(  );
@@ -938,7 +938,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling PerformLayout(  ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PerformLayout = this->get_override( "PerformLayout" );
+        PY_OVERRIDE_LOOKUP( func_PerformLayout, "PerformLayout" );
         if( func_PerformLayout.ptr() != Py_None )
             try {
                 func_PerformLayout(  );
@@ -968,7 +968,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling PostChildPaint(  ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PostChildPaint = this->get_override( "PostChildPaint" );
+        PY_OVERRIDE_LOOKUP( func_PostChildPaint, "PostChildPaint" );
         if( func_PostChildPaint.ptr() != Py_None )
             try {
                 func_PostChildPaint(  );
@@ -1003,7 +1003,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetBgColor( color ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetBgColor = this->get_override( "SetBgColor" );
+        PY_OVERRIDE_LOOKUP( func_SetBgColor, "SetBgColor" );
         if( func_SetBgColor.ptr() != Py_None )
             try {
                 func_SetBgColor( color );
@@ -1033,7 +1033,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetBorder( boost::python::ptr(border) ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetBorder = this->get_override( "SetBorder" );
+        PY_OVERRIDE_LOOKUP( func_SetBorder, "SetBorder" );
         if( func_SetBorder.ptr() != Py_None )
             try {
                 func_SetBorder( boost::python::ptr(border) );
@@ -1063,7 +1063,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCursor( cursor ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCursor = this->get_override( "SetCursor" );
+        PY_OVERRIDE_LOOKUP( func_SetCursor, "SetCursor" );
         if( func_SetCursor.ptr() != Py_None )
             try {
                 func_SetCursor( cursor );
@@ -1093,7 +1093,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetDragEnabled( enabled ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetDragEnabled = this->get_override( "SetDragEnabled" );
+        PY_OVERRIDE_LOOKUP( func_SetDragEnabled, "SetDragEnabled" );
         if( func_SetDragEnabled.ptr() != Py_None )
             try {
                 func_SetDragEnabled( enabled );
@@ -1123,7 +1123,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetEnabled( state ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetEnabled = this->get_override( "SetEnabled" );
+        PY_OVERRIDE_LOOKUP( func_SetEnabled, "SetEnabled" );
         if( func_SetEnabled.ptr() != Py_None )
             try {
                 func_SetEnabled( state );
@@ -1153,7 +1153,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetFgColor( color ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetFgColor = this->get_override( "SetFgColor" );
+        PY_OVERRIDE_LOOKUP( func_SetFgColor, "SetFgColor" );
         if( func_SetFgColor.ptr() != Py_None )
             try {
                 func_SetFgColor( color );
@@ -1183,7 +1183,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetKeyBoardInputEnabled( state ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetKeyBoardInputEnabled = this->get_override( "SetKeyBoardInputEnabled" );
+        PY_OVERRIDE_LOOKUP( func_SetKeyBoardInputEnabled, "SetKeyBoardInputEnabled" );
         if( func_SetKeyBoardInputEnabled.ptr() != Py_None )
             try {
                 func_SetKeyBoardInputEnabled( state );
@@ -1213,7 +1213,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetMouseInputEnabled( state ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetMouseInputEnabled = this->get_override( "SetMouseInputEnabled" );
+        PY_OVERRIDE_LOOKUP( func_SetMouseInputEnabled, "SetMouseInputEnabled" );
         if( func_SetMouseInputEnabled.ptr() != Py_None )
             try {
                 func_SetMouseInputEnabled( state );
@@ -1263,7 +1263,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPaintBackgroundEnabled( state ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPaintBackgroundEnabled = this->get_override( "SetPaintBackgroundEnabled" );
+        PY_OVERRIDE_LOOKUP( func_SetPaintBackgroundEnabled, "SetPaintBackgroundEnabled" );
         if( func_SetPaintBackgroundEnabled.ptr() != Py_None )
             try {
                 func_SetPaintBackgroundEnabled( state );
@@ -1293,7 +1293,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPaintBackgroundType( type ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPaintBackgroundType = this->get_override( "SetPaintBackgroundType" );
+        PY_OVERRIDE_LOOKUP( func_SetPaintBackgroundType, "SetPaintBackgroundType" );
         if( func_SetPaintBackgroundType.ptr() != Py_None )
             try {
                 func_SetPaintBackgroundType( type );
@@ -1323,7 +1323,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPaintBorderEnabled( state ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPaintBorderEnabled = this->get_override( "SetPaintBorderEnabled" );
+        PY_OVERRIDE_LOOKUP( func_SetPaintBorderEnabled, "SetPaintBorderEnabled" );
         if( func_SetPaintBorderEnabled.ptr() != Py_None )
             try {
                 func_SetPaintBorderEnabled( state );
@@ -1353,7 +1353,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPaintEnabled( state ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPaintEnabled = this->get_override( "SetPaintEnabled" );
+        PY_OVERRIDE_LOOKUP( func_SetPaintEnabled, "SetPaintEnabled" );
         if( func_SetPaintEnabled.ptr() != Py_None )
             try {
                 func_SetPaintEnabled( state );
@@ -1383,7 +1383,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetParent( newParent ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetParent = this->get_override( "SetParent" );
+        PY_OVERRIDE_LOOKUP( func_SetParent, "SetParent" );
         if( func_SetParent.ptr() != Py_None )
             try {
                 func_SetParent( newParent );
@@ -1413,7 +1413,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetScheme( tag ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetScheme = this->get_override( "SetScheme" );
+        PY_OVERRIDE_LOOKUP( func_SetScheme, "SetScheme" );
         if( func_SetScheme.ptr() != Py_None )
             try {
                 func_SetScheme( tag );
@@ -1443,7 +1443,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetScheme( scheme ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetScheme = this->get_override( "SetScheme" );
+        PY_OVERRIDE_LOOKUP( func_SetScheme, "SetScheme" );
         if( func_SetScheme.ptr() != Py_None )
             try {
                 func_SetScheme( scheme );
@@ -1473,7 +1473,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetVisible( state ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetVisible = this->get_override( "SetVisible" );
+        PY_OVERRIDE_LOOKUP( func_SetVisible, "SetVisible" );
         if( func_SetVisible.ptr() != Py_None )
             try {
                 func_SetVisible( state );
@@ -1505,7 +1505,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
             if( py_log_overrides.GetBool() )
                 Msg("Calling Paint(  ) of Class: vgui::vgui::Panel\n");
             #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-            bp::override func_Paint = this->get_override( "Paint" );
+            PY_OVERRIDE_LOOKUP( func_Paint, "Paint" );
             if( func_Paint.ptr() != Py_None )
                 try {
                     func_Paint(  );
@@ -1545,7 +1545,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
             if( py_log_overrides.GetBool() )
                 Msg("Calling PaintBackground(  ) of Class: vgui::vgui::Panel\n");
             #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-            bp::override func_PaintBackground = this->get_override( "PaintBackground" );
+            PY_OVERRIDE_LOOKUP( func_PaintBackground, "PaintBackground" );
             if( func_PaintBackground.ptr() != Py_None )
                 try {
                     func_PaintBackground(  );
@@ -1584,7 +1584,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
         if( py_log_overrides.GetBool() )
             Msg("Calling InvalidateLayout( layoutNow, reloadScheme ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_InvalidateLayout = this->get_override( "InvalidateLayout" );
+        PY_OVERRIDE_LOOKUP( func_InvalidateLayout, "InvalidateLayout" );
         if( func_InvalidateLayout.ptr() != Py_None )
             try {
                 func_InvalidateLayout( layoutNow, reloadScheme );
@@ -1641,7 +1641,7 @@ struct Panel_wrapper : PyPanel, vgui::Panel, bp::wrapper< vgui::Panel > {
     virtual void SetFlushedByParent( bool bEnabled ) { PyPanel::SetFlushedByParent( bEnabled ); }
 
     virtual void SetParent( ::vgui::Panel * newParent ) {
-        boost::python::override func_SetParent = this->get_override( "SetParent" );
+        PY_OVERRIDE_LOOKUP( func_SetParent, "SetParent" );
         if( func_SetParent.ptr() != Py_None )
             try {
                 func_SetParent( *newParent );
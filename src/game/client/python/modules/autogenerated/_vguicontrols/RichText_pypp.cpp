@@ -40,7 +40,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
     }
 
     virtual void ApplySchemeSettings( ::vgui::IScheme * pScheme ){
-        bp::override func_ApplySchemeSettings = this->get_override( "ApplySchemeSettings" );
+        PY_OVERRIDE_LOOKUP( func_ApplySchemeSettings, "ApplySchemeSettings" );
         if( func_ApplySchemeSettings.ptr() != Py_None )
             try {
                 func_ApplySchemeSettings( boost::python::ptr(pScheme) );
@@ -73,7 +73,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
     }
 
     virtual void OnCursorEntered(  ){
-        bp::override func_OnCursorEntered = this->get_override( "OnCursorEntered" );
+        PY_OVERRIDE_LOOKUP( func_OnCursorEntered, "OnCursorEntered" );
         if( func_OnCursorEntered.ptr() != Py_None )
             try {
                 func_OnCursorEntered(  );
@@ -90,7 +90,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
     }
 
     virtual void OnCursorExited(  ){
-        bp::override func_OnCursorExited = this->get_override( "OnCursorExited" );
+        PY_OVERRIDE_LOOKUP( func_OnCursorExited, "OnCursorExited" );
         if( func_OnCursorExited.ptr() != Py_None )
             try {
                 func_OnCursorExited(  );
@@ -107,7 +107,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
     }
 
     virtual void OnCursorMoved( int x, int y ){
-        bp::override func_OnCursorMoved = this->get_override( "OnCursorMoved" );
+        PY_OVERRIDE_LOOKUP( func_OnCursorMoved, "OnCursorMoved" );
         if( func_OnCursorMoved.ptr() != Py_None )
             try {
                 func_OnCursorMoved( x, y );
@@ -124,7 +124,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
     }
 
     virtual void OnKeyCodeTyped( ::vgui::KeyCode code ){
-        bp::override func_OnKeyCodeTyped = this->get_override( "OnKeyCodeTyped" );
+        PY_OVERRIDE_LOOKUP( func_OnKeyCodeTyped, "OnKeyCodeTyped" );
         if( func_OnKeyCodeTyped.ptr() != Py_None )
             try {
                 func_OnKeyCodeTyped( code );
@@ -141,7 +141,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
     }
 
     virtual void OnKillFocus(  ){
-        bp::override func_OnKillFocus = this->get_override( "OnKillFocus" );
+        PY_OVERRIDE_LOOKUP( func_OnKillFocus, "OnKillFocus" );
         if( func_OnKillFocus.ptr() != Py_None )
             try {
                 func_OnKillFocus(  );
@@ -158,7 +158,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
     }
 
     virtual void OnMouseCaptureLost(  ){
-        bp::override func_OnMouseCaptureLost = this->get_override( "OnMouseCaptureLost" );
+        PY_OVERRIDE_LOOKUP( func_OnMouseCaptureLost, "OnMouseCaptureLost" );
         if( func_OnMouseCaptureLost.ptr() != Py_None )
             try {
                 func_OnMouseCaptureLost(  );
@@ -175,7 +175,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
     }
 
     virtual void OnMouseDoublePressed( ::vgui::MouseCode code ){
-        bp::override func_OnMouseDoublePressed = this->get_override( "OnMouseDoublePressed" );
+        PY_OVERRIDE_LOOKUP( func_OnMouseDoublePressed, "OnMouseDoublePressed" );
         if( func_OnMouseDoublePressed.ptr() != Py_None )
             try {
                 func_OnMouseDoublePressed( code );
@@ -192,7 +192,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
     }
 
     virtual void OnMouseFocusTicked(  ){
-        bp::override func_OnMouseFocusTicked = this->get_override( "OnMouseFocusTicked" );
+        PY_OVERRIDE_LOOKUP( func_OnMouseFocusTicked, "OnMouseFocusTicked" );
         if( func_OnMouseFocusTicked.ptr() != Py_None )
             try {
                 func_OnMouseFocusTicked(  );
@@ -209,7 +209,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
     }
 
     virtual void OnMousePressed( ::vgui::MouseCode code ){
-        bp::override func_OnMousePressed = this->get_override( "OnMousePressed" );
+        PY_OVERRIDE_LOOKUP( func_OnMousePressed, "OnMousePressed" );
         if( func_OnMousePressed.ptr() != Py_None )
             try {
                 func_OnMousePressed( code );
@@ -226,7 +226,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
     }
 
     virtual void OnMouseReleased( ::vgui::MouseCode code ){
-        bp::override func_OnMouseReleased = this->get_override( "OnMouseReleased" );
+        PY_OVERRIDE_LOOKUP( func_OnMouseReleased, "OnMouseReleased" );
         if( func_OnMouseReleased.ptr() != Py_None )
             try {
                 func_OnMouseReleased( code );
@@ -243,7 +243,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
     }
 
     virtual void OnMouseWheeled( int delta ){
-        bp::override func_OnMouseWheeled = this->get_override( "OnMouseWheeled" );
+        PY_OVERRIDE_LOOKUP( func_OnMouseWheeled, "OnMouseWheeled" );
         if( func_OnMouseWheeled.ptr() != Py_None )
             try {
                 func_OnMouseWheeled( delta );
@@ -260,7 +260,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
     }
 
     virtual void OnSetFocus(  ){
-        bp::override func_OnSetFocus = this->get_override( "OnSetFocus" );
+        PY_OVERRIDE_LOOKUP( func_OnSetFocus, "OnSetFocus" );
         if( func_OnSetFocus.ptr() != Py_None )
             try {
                 func_OnSetFocus(  );
@@ -281,7 +281,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
     }
 
     virtual void OnSizeChanged( int newWide, int newTall ){
-        bp::override func_OnSizeChanged = this->get_override( "OnSizeChanged" );
+        PY_OVERRIDE_LOOKUP( func_OnSizeChanged, "OnSizeChanged" );
         if( func_OnSizeChanged.ptr() != Py_None )
             try {
                 func_OnSizeChanged( newWide, newTall );
@@ -306,7 +306,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
     }
 
     virtual void OnThink(  ){
-        bp::override func_OnThink = this->get_override( "OnThink" );
+        PY_OVERRIDE_LOOKUP( func_OnThink, "OnThink" );
         if( func_OnThink.ptr() != Py_None )
             try {
                 func_OnThink(  );
@@ -327,7 +327,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
     }
 
     virtual void PerformLayout(  ){
-        bp::override func_PerformLayout = this->get_override( "PerformLayout" );
+        PY_OVERRIDE_LOOKUP( func_PerformLayout, "PerformLayout" );
         if( func_PerformLayout.ptr() != Py_None )
             try {
                 func_PerformLayout(  );
@@ -357,7 +357,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetFgColor( color ) of Class: vgui::RichText\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetFgColor = this->get_override( "SetFgColor" );
+        PY_OVERRIDE_LOOKUP( func_SetFgColor, "SetFgColor" );
         if( func_SetFgColor.ptr() != Py_None )
             try {
                 func_SetFgColor( color );
@@ -387,7 +387,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetText( text ) of Class: vgui::RichText\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetText = this->get_override( "SetText" );
+        PY_OVERRIDE_LOOKUP( func_SetText, "SetText" );
         if( func_SetText.ptr() != Py_None )
             try {
                 func_SetText( text );
@@ -417,7 +417,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetText( text ) of Class: vgui::RichText\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetText = this->get_override( "SetText" );
+        PY_OVERRIDE_LOOKUP( func_SetText, "SetText" );
         if( func_SetText.ptr() != Py_None )
             try {
                 func_SetText( text );
@@ -447,7 +447,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetVerticalScrollbar( state ) of Class: vgui::RichText\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetVerticalScrollbar = this->get_override( "SetVerticalScrollbar" );
+        PY_OVERRIDE_LOOKUP( func_SetVerticalScrollbar, "SetVerticalScrollbar" );
         if( func_SetVerticalScrollbar.ptr() != Py_None )
             try {
                 func_SetVerticalScrollbar( state );
@@ -513,7 +513,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling OnChildAdded( child ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnChildAdded = this->get_override( "OnChildAdded" );
+        PY_OVERRIDE_LOOKUP( func_OnChildAdded, "OnChildAdded" );
         if( func_OnChildAdded.ptr() != Py_None )
             try {
                 func_OnChildAdded( child );
@@ -543,7 +543,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling OnCommand( command ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnCommand = this->get_override( "OnCommand" );
+        PY_OVERRIDE_LOOKUP( func_OnCommand, "OnCommand" );
         if( func_OnCommand.ptr() != Py_None )
             try {
                 func_OnCommand( command );
@@ -581,7 +581,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling OnKeyCodePressed( code ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnKeyCodePressed = this->get_override( "OnKeyCodePressed" );
+        PY_OVERRIDE_LOOKUP( func_OnKeyCodePressed, "OnKeyCodePressed" );
         if( func_OnKeyCodePressed.ptr() != Py_None )
             try {
                 func_OnKeyCodePressed( code );
@@ -611,7 +611,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling OnKeyCodeReleased( code ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnKeyCodeReleased = this->get_override( "OnKeyCodeReleased" );
+        PY_OVERRIDE_LOOKUP( func_OnKeyCodeReleased, "OnKeyCodeReleased" );
         if( func_OnKeyCodeReleased.ptr() != Py_None )
             try {
                 func_OnKeyCodeReleased( code );
@@ -641,7 +641,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling OnKeyFocusTicked(  ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnKeyFocusTicked = this->get_override( "OnKeyFocusTicked" );
+        PY_OVERRIDE_LOOKUP( func_OnKeyFocusTicked, "OnKeyFocusTicked" );
         if( func_OnKeyFocusTicked.ptr() != Py_None )
             try {
                 func_OnKeyFocusTicked(  );
@@ -671,7 +671,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling OnMouseTriplePressed( code ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnMouseTriplePressed = this->get_override( "OnMouseTriplePressed" );
+        PY_OVERRIDE_LOOKUP( func_OnMouseTriplePressed, "OnMouseTriplePressed" );
         if( func_OnMouseTriplePressed.ptr() != Py_None )
             try {
                 func_OnMouseTriplePressed( code );
@@ -688,7 +688,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
     }
 
     virtual void OnRequestFocus( ::vgui::VPANEL subFocus, ::vgui::VPANEL defaultPanel ){
-        bp::override func_OnRequestFocus = this->get_override( "OnRequestFocus" );
+        PY_OVERRIDE_LOOKUP( func_OnRequestFocus, "OnRequestFocus" );
         if( func_OnRequestFocus.ptr() != Py_None )
             try {
                 func_OnRequestFocus( subFocus, defaultPanel );
@@ -705,7 +705,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
     }
 
     virtual void OnScreenSizeChanged( int oldwide, int oldtall ){
-        bp::override func_OnScreenSizeChanged = this->get_override( "OnScreenSizeChanged" );
+        PY_OVERRIDE_LOOKUP( func_OnScreenSizeChanged, "OnScreenSizeChanged" );
         if( func_OnScreenSizeChanged.ptr() != Py_None )
             try {
                 func_OnScreenSizeChanged( oldwide, oldtall );
@@ -739,7 +739,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling OnTick(  ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnTick = this->get_override( "OnTick" );
+        PY_OVERRIDE_LOOKUP( func_OnTick, "OnTick" );
         if( func_OnTick.ptr() != Py_None )
             try {
                 func_OnTick(  );
@@ -769,7 +769,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling PaintBuildOverlay(  ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PaintBuildOverlay = this->get_override( "PaintBuildOverlay" );
+        PY_OVERRIDE_LOOKUP( func_PaintBuildOverlay, "PaintBuildOverlay" );
         if( func_PaintBuildOverlay.ptr() != Py_None )
             try {
                 func_PaintBuildOverlay(  );
@@ -803,7 +803,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling PostChildPaint(  ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PostChildPaint = this->get_override( "PostChildPaint" );
+        PY_OVERRIDE_LOOKUP( func_PostChildPaint, "PostChildPaint" );
         if( func_PostChildPaint.ptr() != Py_None )
             try {
                 func_PostChildPaint(  );
@@ -833,7 +833,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetBgColor( color ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetBgColor = this->get_override( "SetBgColor" );
+        PY_OVERRIDE_LOOKUP( func_SetBgColor, "SetBgColor" );
         if( func_SetBgColor.ptr() != Py_None )
             try {
                 func_SetBgColor( color );
@@ -863,7 +863,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetBorder( boost::python::ptr(border) ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetBorder = this->get_override( "SetBorder" );
+        PY_OVERRIDE_LOOKUP( func_SetBorder, "SetBorder" );
         if( func_SetBorder.ptr() != Py_None )
             try {
                 func_SetBorder( boost::python::ptr(border) );
@@ -893,7 +893,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCursor( cursor ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCursor = this->get_override( "SetCursor" );
+        PY_OVERRIDE_LOOKUP( func_SetCursor, "SetCursor" );
         if( func_SetCursor.ptr() != Py_None )
             try {
                 func_SetCursor( cursor );
@@ -923,7 +923,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetDragEnabled( enabled ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetDragEnabled = this->get_override( "SetDragEnabled" );
+        PY_OVERRIDE_LOOKUP( func_SetDragEnabled, "SetDragEnabled" );
         if( func_SetDragEnabled.ptr() != Py_None )
             try {
                 func_SetDragEnabled( enabled );
@@ -953,7 +953,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetEnabled( state ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetEnabled = this->get_override( "SetEnabled" );
+        PY_OVERRIDE_LOOKUP( func_SetEnabled, "SetEnabled" );
         if( func_SetEnabled.ptr() != Py_None )
             try {
                 func_SetEnabled( state );
@@ -983,7 +983,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetKeyBoardInputEnabled( state ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetKeyBoardInputEnabled = this->get_override( "SetKeyBoardInputEnabled" );
+        PY_OVERRIDE_LOOKUP( func_SetKeyBoardInputEnabled, "SetKeyBoardInputEnabled" );
         if( func_SetKeyBoardInputEnabled.ptr() != Py_None )
             try {
                 func_SetKeyBoardInputEnabled( state );
@@ -1013,7 +1013,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetMouseInputEnabled( state ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetMouseInputEnabled = this->get_override( "SetMouseInputEnabled" );
+        PY_OVERRIDE_LOOKUP( func_SetMouseInputEnabled, "SetMouseInputEnabled" );
         if( func_SetMouseInputEnabled.ptr() != Py_None )
             try {
                 func_SetMouseInputEnabled( state );
@@ -1063,7 +1063,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPaintBackgroundEnabled( state ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPaintBackgroundEnabled = this->get_override( "SetPaintBackgroundEnabled" );
+        PY_OVERRIDE_LOOKUP( func_SetPaintBackgroundEnabled, "SetPaintBackgroundEnabled" );
         if( func_SetPaintBackgroundEnabled.ptr() != Py_None )
             try {
                 func_SetPaintBackgroundEnabled( state );
@@ -1093,7 +1093,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPaintBackgroundType( type ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPaintBackgroundType = this->get_override( "SetPaintBackgroundType" );
+        PY_OVERRIDE_LOOKUP( func_SetPaintBackgroundType, "SetPaintBackgroundType" );
         if( func_SetPaintBackgroundType.ptr() != Py_None )
             try {
                 func_SetPaintBackgroundType( type );
@@ -1123,7 +1123,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPaintBorderEnabled( state ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPaintBorderEnabled = this->get_override( "SetPaintBorderEnabled" );
+        PY_OVERRIDE_LOOKUP( func_SetPaintBorderEnabled, "SetPaintBorderEnabled" );
         if( func_SetPaintBorderEnabled.ptr() != Py_None )
             try {
                 func_SetPaintBorderEnabled( state );
@@ -1153,7 +1153,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPaintEnabled( state ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPaintEnabled = this->get_override( "SetPaintEnabled" );
+        PY_OVERRIDE_LOOKUP( func_SetPaintEnabled, "SetPaintEnabled" );
         if( func_SetPaintEnabled.ptr() != Py_None )
             try {
                 func_SetPaintEnabled( state );
@@ -1183,7 +1183,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetParent( newParent ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetParent = this->get_override( "SetParent" );
+        PY_OVERRIDE_LOOKUP( func_SetParent, "SetParent" );
         if( func_SetParent.ptr() != Py_None )
             try {
                 func_SetParent( newParent );
@@ -1213,7 +1213,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetScheme( tag ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetScheme = this->get_override( "SetScheme" );
+        PY_OVERRIDE_LOOKUP( func_SetScheme, "SetScheme" );
         if( func_SetScheme.ptr() != Py_None )
             try {
                 func_SetScheme( tag );
@@ -1243,7 +1243,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetScheme( scheme ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetScheme = this->get_override( "SetScheme" );
+        PY_OVERRIDE_LOOKUP( func_SetScheme, "SetScheme" );
         if( func_SetScheme.ptr() != Py_None )
             try {
                 func_SetScheme( scheme );
@@ -1273,7 +1273,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetVisible( state ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetVisible = this->get_override( "SetVisible" );
+        PY_OVERRIDE_LOOKUP( func_SetVisible, "SetVisible" );
         if( func_SetVisible.ptr() != Py_None )
             try {
                 func_SetVisible( state );
@@ -1305,7 +1305,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
             if( py_log_overrides.GetBool() )
                 Msg("Calling Paint(  ) of Class: vgui::vgui::RichText\n");
             #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-            bp::override func_Paint = this->get_override( "Paint" );
+            PY_OVERRIDE_LOOKUP( func_Paint, "Paint" );
             if( func_Paint.ptr() != Py_None )
                 try {
                     func_Paint(  );
@@ -1345,7 +1345,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
             if( py_log_overrides.GetBool() )
                 Msg("Calling PaintBackground(  ) of Class: vgui::vgui::Panel\n");
             #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-            bp::override func_PaintBackground = this->get_override( "PaintBackground" );
+            PY_OVERRIDE_LOOKUP( func_PaintBackground, "PaintBackground" );
             if( func_PaintBackground.ptr() != Py_None )
                 try {
                     func_PaintBackground(  );
@@ -1384,7 +1384,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
         if( py_log_overrides.GetBool() )
             Msg("Calling InvalidateLayout( layoutNow, reloadScheme ) of Class: vgui::Panel\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_InvalidateLayout = this->get_override( "InvalidateLayout" );
+        PY_OVERRIDE_LOOKUP( func_InvalidateLayout, "InvalidateLayout" );
         if( func_InvalidateLayout.ptr() != Py_None )
             try {
                 func_InvalidateLayout( layoutNow, reloadScheme );
@@ -1441,7 +1441,7 @@ struct RichText_wrapper : PyPanel, vgui::RichText, bp::wrapper< vgui::RichText >
     virtual void SetFlushedByParent( bool bEnabled ) { PyPanel::SetFlushedByParent( bEnabled ); }
 
     virtual void SetParent( ::vgui::Panel * newParent ) {
-        boost::python::override func_SetParent = this->get_override( "SetParent" );
+        PY_OVERRIDE_LOOKUP( func_SetParent, "SetParent" );
         if( func_SetParent.ptr() != Py_None )
             try {
                 func_SetParent( *newParent );
@@ -139,7 +139,7 @@ struct TextImage_wrapper : vgui::TextImage, bp::wrapper< vgui::TextImage > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Evict(  ) of Class: vgui::Image\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Evict = this->get_override( "Evict" );
+        PY_OVERRIDE_LOOKUP( func_Evict, "Evict" );
         if( func_Evict.ptr() != Py_None )
             try {
                 return func_Evict(  );
@@ -169,7 +169,7 @@ struct TextImage_wrapper : vgui::TextImage, bp::wrapper< vgui::TextImage > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetID(  ) of Class: vgui::Image\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetID = this->get_override( "GetID" );
+        PY_OVERRIDE_LOOKUP( func_GetID, "GetID" );
         if( func_GetID.ptr() != Py_None )
             try {
                 return func_GetID(  );
@@ -199,7 +199,7 @@ struct TextImage_wrapper : vgui::TextImage, bp::wrapper< vgui::TextImage > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetNumFrames(  ) of Class: vgui::Image\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetNumFrames = this->get_override( "GetNumFrames" );
+        PY_OVERRIDE_LOOKUP( func_GetNumFrames, "GetNumFrames" );
         if( func_GetNumFrames.ptr() != Py_None )
             try {
                 return func_GetNumFrames(  );
@@ -217,7 +217,7 @@ struct TextImage_wrapper : vgui::TextImage, bp::wrapper< vgui::TextImage > {
 
     virtual void GetPos( int & x, int & y ) {
         namespace bpl = boost::python;
-        bpl::override func_GetPos = this->get_override( "GetPos" );
+        PY_OVERRIDE_LOOKUP( func_GetPos, "GetPos" );
         if( func_GetPos.ptr() != Py_None ) {
             bpl::object py_result = bpl::call<bpl::object>( func_GetPos.ptr() );
             x = boost::python::extract< int >( pyplus_conv::get_out_argument( py_result, "x" ) );
@@ -242,7 +242,7 @@ struct TextImage_wrapper : vgui::TextImage, bp::wrapper< vgui::TextImage > {
 
     virtual void GetSize( int & wide, int & tall ) {
         namespace bpl = boost::python;
-        bpl::override func_GetSize = this->get_override( "GetSize" );
+        PY_OVERRIDE_LOOKUP( func_GetSize, "GetSize" );
         if( func_GetSize.ptr() != Py_None ) {
             bpl::object py_result = bpl::call<bpl::object>( func_GetSize.ptr() );
             wide = boost::python::extract< int >( pyplus_conv::get_out_argument( py_result, "wide" ) );
@@ -279,7 +279,7 @@ struct TextImage_wrapper : vgui::TextImage, bp::wrapper< vgui::TextImage > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTall(  ) of Class: vgui::Image\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTall = this->get_override( "GetTall" );
+        PY_OVERRIDE_LOOKUP( func_GetTall, "GetTall" );
         if( func_GetTall.ptr() != Py_None )
             try {
                 return func_GetTall(  );
@@ -309,7 +309,7 @@ struct TextImage_wrapper : vgui::TextImage, bp::wrapper< vgui::TextImage > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetWide(  ) of Class: vgui::Image\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetWide = this->get_override( "GetWide" );
+        PY_OVERRIDE_LOOKUP( func_GetWide, "GetWide" );
         if( func_GetWide.ptr() != Py_None )
             try {
                 return func_GetWide(  );
@@ -339,7 +339,7 @@ struct TextImage_wrapper : vgui::TextImage, bp::wrapper< vgui::TextImage > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetFrame( nFrame ) of Class: vgui::Image\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetFrame = this->get_override( "SetFrame" );
+        PY_OVERRIDE_LOOKUP( func_SetFrame, "SetFrame" );
         if( func_SetFrame.ptr() != Py_None )
             try {
                 func_SetFrame( nFrame );
@@ -369,7 +369,7 @@ struct TextImage_wrapper : vgui::TextImage, bp::wrapper< vgui::TextImage > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetRotation( iRotation ) of Class: vgui::Image\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetRotation = this->get_override( "SetRotation" );
+        PY_OVERRIDE_LOOKUP( func_SetRotation, "SetRotation" );
         if( func_SetRotation.ptr() != Py_None )
             try {
                 func_SetRotation( iRotation );
@@ -53,7 +53,7 @@ struct Tooltip_wrapper : vgui::Tooltip, bp::wrapper< vgui::Tooltip > {
         if( py_log_overrides.GetBool() )
             Msg("Calling PerformLayout(  ) of Class: vgui::Tooltip\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PerformLayout = this->get_override( "PerformLayout" );
+        PY_OVERRIDE_LOOKUP( func_PerformLayout, "PerformLayout" );
         if( func_PerformLayout.ptr() != Py_None )
             try {
                 func_PerformLayout(  );
@@ -83,7 +83,7 @@ struct Tooltip_wrapper : vgui::Tooltip, bp::wrapper< vgui::Tooltip > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetEnabled( bState ) of Class: vgui::Tooltip\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetEnabled = this->get_override( "SetEnabled" );
+        PY_OVERRIDE_LOOKUP( func_SetEnabled, "SetEnabled" );
         if( func_SetEnabled.ptr() != Py_None )
             try {
                 func_SetEnabled( bState );
@@ -113,7 +113,7 @@ struct Tooltip_wrapper : vgui::Tooltip, bp::wrapper< vgui::Tooltip > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SetText( text ) of Class: vgui::Tooltip\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetText = this->get_override( "SetText" );
+        PY_OVERRIDE_LOOKUP( func_SetText, "SetText" );
         if( func_SetText.ptr() != Py_None )
             try {
                 func_SetText( text );
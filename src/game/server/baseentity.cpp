@@ -781,9 +781,13 @@ CBaseEntity::CBaseEntity( bool bServerOnly )
 		memset(&m_bInFOW, 1, sizeof(bool)*FOWMAXPLAYERS);
 	else
 		memset(&m_bInFOW, 0, sizeof(bool)*FOWMAXPLAYERS);
+	m_iFOWFootprintOwner = -1;
+	m_iFOWFootprintRadius = -1;
+	m_fFOWFootprintEyeZ = 0.0f;
 	DensityMap()->Init(this);
 #ifndef DISABLE_PYTHON
 	m_pyInstance = bp::object();
+	m_bPyNetworkVarsQueued = false;
 #endif // DISABLE_PYTHON
 }
 
@@ -4240,9 +4244,8 @@ void CBaseEntity::SetTransmit( CCheckTransmitInfo *pInfo, bool bAlways )
 	pInfo->m_pTransmitEdict->Set( index );
 
 #ifndef DISABLE_PYTHON
-	// Python networkvars: mark player as transmit
+	// Python networkvars: mark player as transmit. The updates are send after CheckTransmit.
 	m_PyNetworkVarsPlayerTransmitBits.Set( ENTINDEX(pInfo->m_pClientEnt) );
-	PyNetworkVarsUpdateClient(this, ENTINDEX(pInfo->m_pClientEnt));
 #endif // DISABLE_PYTHON
 
 	// HLTV/Replay need to know if this entity is culled by PVS limits
@@ -9028,13 +9031,19 @@ void CBaseEntity::PySendMessage( bp::list msg, bool reliable )
 		return;
 	}
 
+	// Message type and length are written in front of the elements
+	unsigned char data[MAX_ENTITY_MSG_DATA];
+	bf_write buf( "PySendMessage", data, MAX_ENTITY_MSG_DATA - 2 );
+	if( !PyWriteElements( writelist, buf ) )
+	{
+		PyErr_SetString(PyExc_ValueError, "Message too large" );
+		throw boost::python::error_already_set(); 
+	}
+
 	EntityMessageBegin( this, reliable );
 		WRITE_BYTE(BASEENTITY_MSG_PYTHON);
 		WRITE_BYTE(length);
-		for(int i=0; i<writelist.Count(); i++)
-		{
-			PyWriteElement(writelist.Element(i));
-		}
+		WRITE_BITS(data, buf.GetNumBitsWritten());
 	MessageEnd();
 }
 #endif // DISABLE_PYTHON
\ No newline at end of file
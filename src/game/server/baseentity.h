@@ -2029,6 +2029,9 @@ public:
 
 	// This bit vector tells to who we may send data
 	CBitVec<ABSOLUTE_PLAYER_LIMIT> m_PyNetworkVarsPlayerTransmitBits;
+
+	// True if in the list of entities with pending network var updates
+	bool m_bPyNetworkVarsQueued;
 #endif // DISABLE_PYTHON
 
 public:
@@ -2048,6 +2051,12 @@ private:
 	int m_iFOWOldPosX, m_iFOWOldPosY;
 	int m_iFOWPosX, m_iFOWPosY;
 
+	// Tiles revealed by this updater in the incremental fog of war mode
+	CUtlVector< int > m_FOWFootprint;
+	int m_iFOWFootprintOwner;
+	int m_iFOWFootprintRadius;
+	float m_fFOWFootprintEyeZ;
+
 	// Free Python sendprops
 	CNetworkVar( int,		m_iPySendProp1 );
 	CNetworkVar( int,		m_iPySendProp2 );
@@ -2535,6 +2535,11 @@ void CServerGameEnts::CheckTransmit( CCheckTransmitInfo *pInfo, const unsigned s
 		    bIsReplay == ( pInfo->m_pTransmitAlways != NULL) );
 #endif
 
+	// HL2Wars: Entities in the fog of war for the recipient are skipped using the transmit bits of 
+	// the fog of war manager, instead of testing each entity in ShouldTransmit.
+	CBitVec<MAX_EDICTS> fowBlocked;
+	const bool bFOWBlocked = FogOfWarMgr()->ComputeTransmitBlocked( pRecipientPlayer, fowBlocked );
+
 	for ( int i=0; i < nEdicts; i++ )
 	{
 		int iEdict = pEdictIndices[i];
@@ -2577,9 +2582,8 @@ void CServerGameEnts::CheckTransmit( CCheckTransmitInfo *pInfo, const unsigned s
 					break;
 
 #ifndef DISABLE_PYTHON
-				// Python networkvars: mark player as transmit
+				// Python networkvars: mark player as transmit. The updates are send after the loop.
 				pEnt->GetBaseEntity()->m_PyNetworkVarsPlayerTransmitBits.Set( ENTINDEX(pInfo->m_pClientEnt) );
-				PyNetworkVarsUpdateClient(pEnt->GetBaseEntity(), ENTINDEX(pInfo->m_pClientEnt) );
 #endif // DISABLE_PYTHON
 
 				CServerNetworkProperty *pParent = pEnt->GetNetworkParent();
@@ -2598,6 +2602,10 @@ void CServerGameEnts::CheckTransmit( CCheckTransmitInfo *pInfo, const unsigned s
 
 			if ( nFlags == FL_EDICT_FULLCHECK )
 		{
+			// In the fog of war for the recipient
+			if ( bFOWBlocked && fowBlocked.IsBitSet( iEdict ) )
+				continue;
+
 			// do a full ShouldTransmit() check, may return FL_EDICT_CHECKPVS
 			nFlags = pEnt->ShouldTransmit( pInfo );
 
@@ -2680,6 +2688,9 @@ void CServerGameEnts::CheckTransmit( CCheckTransmitInfo *pInfo, const unsigned s
 
 			if ( checkFlags == FL_EDICT_FULLCHECK )
 			{
+				if ( bFOWBlocked && fowBlocked.IsBitSet( checkIndex ) )
+					break;
+
 				// do a full ShouldTransmit() check, may return FL_EDICT_CHECKPVS
 				CBaseEntity *pCheckEntity = check->GetBaseEntity();
 				nFlags = pCheckEntity->ShouldTransmit( pInfo );
@@ -2709,6 +2720,12 @@ void CServerGameEnts::CheckTransmit( CCheckTransmitInfo *pInfo, const unsigned s
 		}
 	}
 
+#ifndef DISABLE_PYTHON
+	// Send the pending python network var updates of the entities transmitted to this client.
+	// Only walks the entities with pending updates, instead of calling into python per entity above.
+	PyNetworkVarsUpdateTransmitted( pInfo );
+#endif // DISABLE_PYTHON
+
 //	Msg("A:%i, N:%i, F: %i, P: %i\n", always, dontSend, fullCheck, PVS );
 }
 
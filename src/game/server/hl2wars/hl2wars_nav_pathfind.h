@@ -25,6 +25,12 @@ public:
 	}
 
 	float operator() ( CNavArea *area, CNavArea *fromArea, const CNavLadder *ladder, const CFuncElevator *elevator, float length )
+	{
+		return (*this)( area, fromArea, ladder, elevator, length, fromArea ? fromArea->GetCostSoFar() : 0.0f );
+	}
+
+	// Used by searches with a CNavPathContext, which passes the cost so far of 'fromArea'
+	float operator() ( CNavArea *area, CNavArea *fromArea, const CNavLadder *ladder, const CFuncElevator *elevator, float length, float fromCostSoFar )
 	{
 		if ( fromArea == NULL )
 		{
@@ -51,7 +57,7 @@ public:
 				dist = ( area->GetCenter() - fromArea->GetCenter() ).Length();
 			}
 
-			float cost = dist + fromArea->GetCostSoFar();
+			float cost = dist + fromCostSoFar;
 
 			// if this is a "crouch" area, add penalty
 			/*if ( area->GetAttributes() & NAV_MESH_CROUCH )
@@ -117,6 +123,9 @@ public:
 		}
 	}
 
+	// Overrides the radius the unit must fit in
+	void SetBoundingRadius( float fBoundingRadius ) { m_fBoundingRadius = fBoundingRadius; }
+
 private:
 	CUnitBase *m_pUnit;
 	float m_fBoundingRadius;
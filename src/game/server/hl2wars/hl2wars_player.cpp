@@ -13,6 +13,7 @@
 #include "unit_base_shared.h"
 #include "predicted_viewmodel.h"
 #include "world.h"
+#include "gamevars_shared.h"
 
 #ifndef DISABLE_PYTHON
 	#include "src_python.h"
@@ -224,6 +225,29 @@ CBaseEntity *GetEntityFromMouseCommand( int idx )
 	return UTIL_EntityByIndex( idx );
 }
 
+//-----------------------------------------------------------------------------
+// Purpose: Units are friendly based on the relationship between the owners,
+//			not on team. Their distance to the shot ray is checked by the lag
+//			compensation itself.
+//-----------------------------------------------------------------------------
+bool CHL2WarsPlayer::WantsLagCompensationOnEntity( const CBaseEntity *entity, const CUserCmd *pCmd, const CBitVec<MAX_EDICTS> *pEntityTransmitBits ) const
+{
+	CBaseEntity *pEnt = const_cast< CBaseEntity * >( entity );
+	if( !pEnt->IsUnit() )
+		return BaseClass::WantsLagCompensationOnEntity( entity, pCmd, pEntityTransmitBits );
+
+	// Friendly units shouldn't be adjusted unless friendly fire is on.
+	int iOwner = const_cast< CHL2WarsPlayer * >( this )->GetOwnerNumber();
+	if( !friendlyfire.GetInt() && GetPlayerRelationShip( iOwner, pEnt->GetOwnerNumber() ) == D_LI )
+		return false;
+
+	// If this unit hasn't been transmitted to us and acked, then don't bother lag compensating it.
+	if( pEntityTransmitBits && !pEntityTransmitBits->Get( entity->entindex() ) )
+		return false;
+
+	return true;
+}
+
 //-----------------------------------------------------------------------------
 // Purpose:
 //-----------------------------------------------------------------------------
@@ -242,16 +266,51 @@ bool CHL2WarsPlayer::ClientCommand( const CCommand &args )
 		ClearSelection();
 		return true;
 	}
+	else if( !Q_stricmp( args[0], "player_selection" ) )
+	{
+		// Packed list of units, see PackEntityList
+		if( atoi(args[1]) )
+			ClearSelection( false );
+
+		CUtlVector< long > units;
+		UnpackEntityList( args[2], units );
+		for( int i = 0; i < units.Count(); i++ )
+		{
+			CBaseEntity *pEnt = DecodeEntity( units[i] );
+			if( pEnt && pEnt->IsAlive() && pEnt->GetIUnit() )
+				pEnt->GetIUnit()->Select( this, false );
+		}
+		ScheduleSelectionChangedSignal();
+		return true;
+	}
+	else if( !Q_stricmp( args[0], "player_group" ) )
+	{
+		// Syncs a group with the client. Only units owned by the player or in the selection can be added.
+		int iGroup = atoi(args[1]);
+		if( iGroup < 0 || iGroup >= PLAYER_MAX_GROUPS )
+			return true;
+
+		if( atoi(args[2]) )
+			ClearGroup( iGroup );
+
+		CUtlVector< long > units;
+		UnpackEntityList( args[3], units );
+		for( int i = 0; i < units.Count(); i++ )
+		{
+			CBaseEntity *pEnt = DecodeEntity( units[i] );
+			if( !pEnt || !pEnt->IsAlive() || !pEnt->GetIUnit() )
+				continue;
+			if( pEnt->GetOwnerNumber() != GetOwnerNumber() && FindUnit( pEnt ) == -1 )
+				continue;
+			if( m_Groups[iGroup].m_Group.Find( pEnt ) == -1 )
+				AddToGroup( iGroup, pEnt );
+		}
+		OnGroupChanged( iGroup );
+		return true;
+	}
 	else if( !Q_stricmp( args[0], "player_addunit" ) )
 	{
-#ifdef CLIENTSENDEHANDLE
-		long iEncodedEHandle = atol(args[1]);
-		int iSerialNum = (iEncodedEHandle >> MAX_EDICT_BITS);
-		int iEntryIndex = iEncodedEHandle & ~(iSerialNum << MAX_EDICT_BITS);
-		EHANDLE pEnt( iEntryIndex, iSerialNum );
-#else
-		CBaseEntity *pEnt = UTIL_EntityByIndex( atoi(args[1]) );
-#endif // CLIENTSENDEHANDLE
+		CBaseEntity *pEnt = DecodeEntity( atol(args[1]) );
 		if( pEnt && pEnt->IsAlive() && pEnt->GetIUnit() )
 			pEnt->GetIUnit()->Select(this);
 			//AddUnit(hEnt);
@@ -261,14 +320,7 @@ bool CHL2WarsPlayer::ClientCommand( const CCommand &args )
 	}
 	else if( !Q_stricmp( args[0], "player_removeunit" ) )
 	{
-#ifdef CLIENTSENDEHANDLE
-		long iEncodedEHandle = atol(args[1]);
-		int iSerialNum = (iEncodedEHandle >> MAX_EDICT_BITS);
-		int iEntryIndex = iEncodedEHandle & ~(iSerialNum << MAX_EDICT_BITS);
-		EHANDLE pEnt( iEntryIndex, iSerialNum );
-#else
-		CBaseEntity *pEnt = UTIL_EntityByIndex( atoi(args[1]) );
-#endif // CLIENTSENDEHANDLE
+		CBaseEntity *pEnt = DecodeEntity( atol(args[1]) );
 		
 		if( pEnt && pEnt->IsAlive() && pEnt->GetIUnit() )
 		{
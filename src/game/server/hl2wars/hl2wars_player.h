@@ -42,6 +42,7 @@ public:
 	virtual int						UpdateTransmitState( void );
 
 	virtual bool					ClientCommand( const CCommand &args );
+	virtual bool					WantsLagCompensationOnEntity( const CBaseEntity *entity, const CUserCmd *pCmd, const CBitVec<MAX_EDICTS> *pEntityTransmitBits ) const;
 
 	virtual void					PreThink( void );
 
@@ -124,6 +125,7 @@ public:
 	void							ClearGroup( int group);
 	void							AddToGroup( int group, CBaseEntity *pUnit );
 	void							MakeCurrentSelectionGroup( int group, bool bClearGroup );
+	void							OnGroupChanged( int group );
 	void							SelectGroup( int group );
 	int								GetGroupNumber( CBaseEntity *pUnit );
 	int								CountGroup( int group );
@@ -14,6 +14,7 @@
 #include "iservervehicle.h"
 #include "tier0/vprof.h"
 #include "unit_base_shared.h"
+#include "ilagcompensationmanager.h"
 
 // memdbgon must be the last include file in a .cpp file!!!
 #include "tier0/memdbgon.h"
@@ -21,6 +22,7 @@
 static CMoveData g_MoveData;
 CMoveData *g_pMoveData = &g_MoveData;
 extern IGameMovement *g_pGameMovement;
+extern ConVar sv_unlag_unitrange;
 
 IPredictionSystem *IPredictionSystem::g_pPredictionSystems = NULL;
 
@@ -223,8 +225,19 @@ void CHL2WarsPlayerMove::RunCommand( CBasePlayer *player, CUserCmd *ucmd, IMoveH
 
 	// let the player drive marine movement here
 	//pWarsPlayer->DriveMarineMovement( ucmd, moveHelper );
-	if( pWarsPlayer->GetControlledUnit() )
-		pWarsPlayer->GetControlledUnit()->GetIUnit()->UserCmd( ucmd );
+	// The controlled unit fires its weapon here, so move back the units near the 
+	// shot ray to where the player saw them. Only when attacking, so the movement
+	// of the unit doesn't collide with rewound units.
+	CBaseEntity *pControlledUnit = pWarsPlayer->GetControlledUnit();
+	if( pControlledUnit )
+	{
+		bool bAttacking = ( ucmd->buttons & ( IN_ATTACK | IN_ATTACK2 ) ) != 0;
+		if( bAttacking )
+			lagcompensation->StartLagCompensation( player, LAG_COMPENSATE_HITBOXES_ALONG_RAY, pControlledUnit->EyePosition(), ucmd->viewangles, sv_unlag_unitrange.GetFloat() );
+		pControlledUnit->GetIUnit()->UserCmd( ucmd );
+		if( bAttacking )
+			lagcompensation->FinishLagCompensation( player );
+	}
 
 	g_pGameMovement->FinishTrackPredictionErrors( player );
 
@@ -11,6 +11,8 @@
 #include "hl2wars_shareddefs.h"
 #include "basegrenade_shared.h"
 #include "unit_navigator.h"
+#include "unit_locomotion.h"
+#include "unit_baseanimstate.h"
 #include "hl2wars_player.h"
 #include "animation.h"
 
@@ -872,3 +874,197 @@ int CUnitBase::TakeHealth( float flHealth, int bitsDamageType )
 		OnFullHealth();
 	return rv;
 }
+
+#ifndef DISABLE_PYTHON
+//-----------------------------------------------------------------------------
+// Purpose: Lets the unit tick system drive the components of this unit.
+//			All components are required, except for the hook. The navigator
+//			is the one set through SetNavigator.
+//-----------------------------------------------------------------------------
+void CUnitBase::SetBatchedTick( boost::python::object movecommand, boost::python::object locomotion, boost::python::object senses, 
+							   boost::python::object animstate, float fTickInterval, boost::python::object hook )
+{
+	DisableBatchedTick();
+
+	try {
+		m_pBatchedMoveCommand = boost::python::extract<UnitBaseMoveCommand *>(movecommand);
+		m_pBatchedLocomotion = boost::python::extract<UnitBaseLocomotion *>(locomotion);
+		m_pBatchedSenses = boost::python::extract<UnitBaseSense *>(senses);
+		m_pBatchedAnimState = boost::python::extract<UnitBaseAnimState *>(animstate);
+	} catch(boost::python::error_already_set &) {
+		PyErr_Print();
+		PyErr_Clear();
+		DisableBatchedTick();
+		return;
+	}
+
+	if( !m_pBatchedMoveCommand || !m_pBatchedLocomotion || !m_pBatchedSenses || !m_pBatchedAnimState )
+	{
+		Warning("#%d: SetBatchedTick requires a move command, locomotion, senses and animstate\n", entindex());
+		DisableBatchedTick();
+		return;
+	}
+
+	m_pyBatchedTickComponents = boost::python::make_tuple( movecommand, locomotion, senses, animstate );
+	m_pyBatchedTickHook = hook;
+	m_fBatchedTickInterval = MAX( fTickInterval, 0.0f );
+	m_fLastBatchedTickTime = gpGlobals->curtime - m_fBatchedTickInterval;
+	m_fNextBatchedTickTime = gpGlobals->curtime;
+	m_bBatchedTick = true;
+}
+#endif // DISABLE_PYTHON
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void CUnitBase::DisableBatchedTick()
+{
+	m_bBatchedTick = false;
+	m_pBatchedMoveCommand = NULL;
+	m_pBatchedLocomotion = NULL;
+	m_pBatchedSenses = NULL;
+	m_pBatchedAnimState = NULL;
+#ifndef DISABLE_PYTHON
+	if( m_pyBatchedTickComponents.ptr() != Py_None || m_pyBatchedTickHook.ptr() != Py_None )
+	{
+		m_pyBatchedTickComponents = boost::python::object();
+		m_pyBatchedTickHook = boost::python::object();
+	}
+#endif // DISABLE_PYTHON
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Runs the native component pipeline of all units with a batched 
+//			tick in one place. Every phase is done for all due units before
+//			the next phase starts and is timed separately in VPROF. 
+//			Python is only entered for the hooks and for components of which 
+//			the Python class overrides the called method.
+//-----------------------------------------------------------------------------
+class CUnitTickSystem : public CAutoGameSystemPerFrame
+{
+public:
+	CUnitTickSystem() : CAutoGameSystemPerFrame( "CUnitTickSystem" ) {}
+
+	virtual void LevelShutdownPostEntity() { m_DueUnits.Purge(); }
+	virtual void FrameUpdatePreEntityThink();
+
+private:
+	// Handles, since Python may remove units immediately during the phases
+	CUtlVector< CHandle< CUnitBase > > m_DueUnits;
+};
+
+static CUnitTickSystem s_UnitTickSystem; // singleton
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void CUnitTickSystem::FrameUpdatePreEntityThink()
+{
+	VPROF_BUDGET( "CUnitTickSystem::FrameUpdatePreEntityThink", VPROF_BUDGETGROUP_UNITS );
+
+	// Collect the units which should tick this frame
+	m_DueUnits.RemoveAll();
+	CUnitBase **ppUnits = g_Unit_Manager.AccessUnits();
+	for( int i = 0; i < g_Unit_Manager.NumUnits(); i++ )
+	{
+		CUnitBase *pUnit = ppUnits[i];
+		if( pUnit->m_bBatchedTick && pUnit->m_fNextBatchedTickTime <= gpGlobals->curtime )
+			m_DueUnits.AddToTail( pUnit );
+	}
+
+	if( m_DueUnits.Count() == 0 )
+		return;
+
+	int nHooks = 0;
+
+	// Python (hooks, enemy events, component overrides) may remove units or disable their batched tick, so each phase tests the unit again
+	{
+		VPROF_BUDGET( "CUnitTickSystem::Sense", VPROF_BUDGETGROUP_UNITS );
+		for( int i = 0; i < m_DueUnits.Count(); i++ )
+		{
+			CUnitBase *pUnit = m_DueUnits[i];
+			if( !pUnit || !pUnit->m_bBatchedTick )
+				continue;
+
+			pUnit->m_pBatchedSenses->PerformSensing();
+
+			// PerformSensing may be overridden in Python
+			pUnit = m_DueUnits[i];
+			if( !pUnit || !pUnit->m_bBatchedTick )
+				continue;
+
+			pUnit->UpdateEnemy( *pUnit->m_pBatchedSenses );
+		}
+	}
+
+#ifndef DISABLE_PYTHON
+	{
+		VPROF_BUDGET( "CUnitTickSystem::Hook", VPROF_BUDGETGROUP_UNITS );
+		for( int i = 0; i < m_DueUnits.Count(); i++ )
+		{
+			CUnitBase *pUnit = m_DueUnits[i];
+			if( !pUnit || !pUnit->m_bBatchedTick || pUnit->m_pyBatchedTickHook.ptr() == Py_None )
+				continue;
+
+			nHooks++;
+			try {
+				// Keep a reference, the hook may remove the unit
+				boost::python::object hook = pUnit->m_pyBatchedTickHook;
+				hook();
+			} catch( boost::python::error_already_set & ) {
+				PyErr_Print();
+				PyErr_Clear();
+			}
+		}
+	}
+#endif // DISABLE_PYTHON
+
+	{
+		VPROF_BUDGET( "CUnitTickSystem::Navigate", VPROF_BUDGETGROUP_UNITS );
+		for( int i = 0; i < m_DueUnits.Count(); i++ )
+		{
+			CUnitBase *pUnit = m_DueUnits[i];
+			if( !pUnit || !pUnit->m_bBatchedTick )
+				continue;
+
+			UnitBaseMoveCommand &mv = *pUnit->m_pBatchedMoveCommand;
+			mv.interval = gpGlobals->curtime - pUnit->m_fLastBatchedTickTime;
+			if( pUnit->m_pNavigator )
+				pUnit->m_pNavigator->Update( mv );
+		}
+	}
+
+	{
+		VPROF_BUDGET( "CUnitTickSystem::Move", VPROF_BUDGETGROUP_UNITS );
+		for( int i = 0; i < m_DueUnits.Count(); i++ )
+		{
+			CUnitBase *pUnit = m_DueUnits[i];
+			if( !pUnit || !pUnit->m_bBatchedTick )
+				continue;
+
+			pUnit->m_pBatchedLocomotion->PerformMovement( *pUnit->m_pBatchedMoveCommand );
+		}
+	}
+
+	{
+		VPROF_BUDGET( "CUnitTickSystem::Animate", VPROF_BUDGETGROUP_UNITS );
+		for( int i = 0; i < m_DueUnits.Count(); i++ )
+		{
+			CUnitBase *pUnit = m_DueUnits[i];
+			if( !pUnit || !pUnit->m_bBatchedTick )
+				continue;
+
+			pUnit->m_pBatchedAnimState->Update( pUnit->m_fEyeYaw, pUnit->m_fEyePitch );
+
+			pUnit = m_DueUnits[i];
+			if( !pUnit )
+				continue;
+
+			pUnit->m_fLastBatchedTickTime = gpGlobals->curtime;
+			pUnit->m_fNextBatchedTickTime = gpGlobals->curtime + pUnit->m_fBatchedTickInterval;
+		}
+	}
+
+	VPROF_INCREMENT_COUNTER( "UnitTick: units", m_DueUnits.Count() );
+	VPROF_INCREMENT_COUNTER( "UnitTick: python hooks", nHooks );
+}
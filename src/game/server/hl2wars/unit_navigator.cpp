@@ -12,7 +12,8 @@
 //				a different path is generated (drop down height, climb/jump support, etc).
 //				SetGoal can be used to set a new path. Furthermore the current path can be
 //				saved in Python by storing the path object. This can then be restored using
-//				SetPath.
+//				SetPath. Paths of new goals are queued and built at the end of the frame
+//				within a time budget (see unit_path_async).
 //
 // Local Obstacle Avoidance + Goal Updating:
 //			Because of the high number of units this is done using density/flow fields.
@@ -49,6 +50,7 @@
 #include "nav_mesh.h"
 #include "nav_pathfind.h"
 #include "hl2wars_nav_pathfind.h"
+#include "hl2wars_player.h"
 
 #ifndef DISABLE_PYTHON
 	#include "src_python.h"
@@ -96,6 +98,13 @@ ConVar unit_position_check("unit_position_check", "0.5");
 
 ConVar unit_allow_cached_paths("unit_allow_cached_paths", "1");
 
+ConVar unit_path_async("unit_path_async", "1", FCVAR_CHEAT, "Queue path requests of new goals. The queued requests are built at the end of the frame, spread over frames within a time budget.");
+ConVar unit_path_async_budget_us("unit_path_async_budget_us", "2000", FCVAR_CHEAT, "Time budget in microseconds per frame for building queued path requests. Remaining requests are built in the next frame.", true, 0.0f, false, 0.0f);
+
+ConVar unit_grouppath("unit_grouppath", "1", FCVAR_CHEAT, "Share the nav area route between units ordered together.");
+ConVar unit_grouppath_maxdist("unit_grouppath_maxdist", "1024", FCVAR_CHEAT, "Units further away than this from the center of the group don't share the group route.");
+ConVar unit_grouppath_lifetime("unit_grouppath_lifetime", "2.0", FCVAR_CHEAT, "Time in seconds a group route can be shared after being built.");
+
 static ConVar unit_navigator_debug("unit_navigator_debug", "0", 0, "Prints debug information about the unit navigator");
 static ConVar unit_navigator_debug_inrange("unit_navigator_debug_inrange", "0", 0, "Prints debug information for in range checks");
 
@@ -166,13 +175,192 @@ UnitBaseWaypoint *	UnitBaseWaypoint::GetLast()
 	return pCurr;
 }
 
+//-----------------------------------------------------------------------------
+// Purpose: Builds the paths of new goals at the end of the frame. Requests are
+//			built in order within a time budget, so a move order for many units
+//			does not build all paths in the same frame.
+//-----------------------------------------------------------------------------
+class CUnitPathQueue : public CAutoGameSystemPerFrame
+{
+public:
+	CUnitPathQueue() : CAutoGameSystemPerFrame( "CUnitPathQueue" ) 
+	{
+		ResetStats();
+	}
+
+	virtual void LevelShutdownPostEntity();
+	virtual void FrameUpdatePostEntityThink();
+
+	void Enqueue( UnitBaseNavigator *pNavigator );
+	void Remove( UnitBaseNavigator *pNavigator );
+
+	void ResetStats();
+	void PrintStats();
+
+private:
+	CUtlLinkedList< UnitBaseNavigator *, int > m_Requests;
+
+	// Stats
+	int m_iPeakDepth;
+	int m_iTotalEnqueued;
+	int m_iTotalResolved;
+	int m_iTotalFailed;
+	int m_iDeferredFrames;
+	double m_fTotalWaitTime;
+	double m_fMaxWaitTime;
+	double m_fTotalBuildTime;
+	double m_fMaxFrameBuildTime;
+};
+
+static CUnitPathQueue s_UnitPathQueue; // singleton
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void CUnitPathQueue::LevelShutdownPostEntity()
+{
+	FOR_EACH_LL( m_Requests, i )
+	{
+		m_Requests[i]->m_iPathRequestIndex = -1;
+		m_Requests[i]->m_bPathPending = false;
+	}
+	m_Requests.Purge();
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void CUnitPathQueue::Enqueue( UnitBaseNavigator *pNavigator )
+{
+	pNavigator->m_bPathPending = true;
+	pNavigator->m_fPathRequestTime = gpGlobals->curtime;
+
+	// Already queued requests keep their place and build the latest goal
+	if( pNavigator->m_iPathRequestIndex != -1 )
+		return;
+
+	pNavigator->m_iPathRequestIndex = m_Requests.AddToTail( pNavigator );
+
+	m_iTotalEnqueued++;
+	m_iPeakDepth = MAX( m_iPeakDepth, m_Requests.Count() );
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void CUnitPathQueue::Remove( UnitBaseNavigator *pNavigator )
+{
+	pNavigator->m_bPathPending = false;
+
+	if( pNavigator->m_iPathRequestIndex == -1 )
+		return;
+
+	m_Requests.Remove( pNavigator->m_iPathRequestIndex );
+	pNavigator->m_iPathRequestIndex = -1;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void CUnitPathQueue::FrameUpdatePostEntityThink()
+{
+	VPROF_BUDGET( "CUnitPathQueue::FrameUpdatePostEntityThink", VPROF_BUDGETGROUP_UNITS );
+
+	if( m_Requests.Count() == 0 )
+		return;
+
+	VPROF_INCREMENT_COUNTER( "UnitPathQueue: depth", m_Requests.Count() );
+
+	double fStartTime = Plat_FloatTime();
+	double fBudget = unit_path_async_budget_us.GetFloat() / 1000000.0;
+	int nResolved = 0;
+
+	while( m_Requests.Count() > 0 )
+	{
+		UnitBaseNavigator *pNavigator = m_Requests[m_Requests.Head()];
+		Remove( pNavigator );
+
+		// Unit might have been removed in the meantime
+		if( !pNavigator->m_hPathRequestOuter.Get() )
+			continue;
+
+		float fWaitTime = gpGlobals->curtime - pNavigator->m_fPathRequestTime;
+		m_fTotalWaitTime += fWaitTime;
+		m_fMaxWaitTime = MAX( m_fMaxWaitTime, fWaitTime );
+
+		// Note: may dispatch OnNavFailed, which can queue a new request
+		if( !pNavigator->ResolvePendingPath() )
+			m_iTotalFailed++;
+		nResolved++;
+
+		// Always resolve at least one request per frame
+		if( Plat_FloatTime() - fStartTime > fBudget )
+			break;
+	}
+
+	double fBuildTime = Plat_FloatTime() - fStartTime;
+	m_fTotalBuildTime += fBuildTime;
+	m_fMaxFrameBuildTime = MAX( m_fMaxFrameBuildTime, fBuildTime );
+	m_iTotalResolved += nResolved;
+	if( m_Requests.Count() > 0 )
+		m_iDeferredFrames++;
+
+	VPROF_INCREMENT_COUNTER( "UnitPathQueue: resolved", nResolved );
+	VPROF_INCREMENT_COUNTER( "UnitPathQueue: deferred", m_Requests.Count() );
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void CUnitPathQueue::ResetStats()
+{
+	m_iPeakDepth = 0;
+	m_iTotalEnqueued = 0;
+	m_iTotalResolved = 0;
+	m_iTotalFailed = 0;
+	m_iDeferredFrames = 0;
+	m_fTotalWaitTime = 0.0;
+	m_fMaxWaitTime = 0.0;
+	m_fTotalBuildTime = 0.0;
+	m_fMaxFrameBuildTime = 0.0;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void CUnitPathQueue::PrintStats()
+{
+	Msg( "Path queue: %d pending, peak depth %d\n", m_Requests.Count(), m_iPeakDepth );
+	Msg( "\tEnqueued: %d, resolved: %d, failed: %d\n", m_iTotalEnqueued, m_iTotalResolved, m_iTotalFailed );
+	Msg( "\tFrames with deferred requests: %d\n", m_iDeferredFrames );
+	if( m_iTotalResolved > 0 )
+	{
+		Msg( "\tWait time: avg %.3f s, max %.3f s\n", m_fTotalWaitTime / m_iTotalResolved, m_fMaxWaitTime );
+		Msg( "\tBuild time: avg %.3f ms per request, max %.3f ms per frame\n", 
+			(m_fTotalBuildTime / m_iTotalResolved) * 1000.0, m_fMaxFrameBuildTime * 1000.0 );
+	}
+}
+
+CON_COMMAND_F( unit_path_queue_stats, "Prints the stats of the path request queue.\n\tArguments: [reset]", FCVAR_CHEAT )
+{
+	if( !UTIL_IsCommandIssuedByServerAdmin() )
+		return;
+
+	s_UnitPathQueue.PrintStats();
+	if( args.ArgC() > 1 && !Q_stricmp( args[1], "reset" ) )
+		s_UnitPathQueue.ResetStats();
+}
+
 #ifndef DISABLE_PYTHON
 //-----------------------------------------------------------------------------
 // 
 //-----------------------------------------------------------------------------
 UnitBaseNavigator::UnitBaseNavigator( boost::python::object outer )
-		: UnitComponent(outer)
+		: UnitComponent(outer), m_iPathRequestIndex(-1), m_bPathPending(false), m_fPathRequestTime(0.0f),
+		m_bGroupOrder(false)
 {
+	m_hPathRequestOuter = m_pOuter;
+
 	SetPath( boost::python::object() );
 	Reset();
 
@@ -186,6 +374,11 @@ UnitBaseNavigator::UnitBaseNavigator( boost::python::object outer )
 }
 #endif // DISABLE_PYTHON
 
+UnitBaseNavigator::~UnitBaseNavigator()
+{
+	s_UnitPathQueue.Remove( this );
+}
+
 //-----------------------------------------------------------------------------
 // Purpose: Clear variables
 //-----------------------------------------------------------------------------
@@ -615,75 +808,100 @@ void UnitBaseNavigator::RegenerateConsiderList( Vector &vPathDir, CheckGoalStatu
 
 	if( GoalStatus == CHS_NOGOAL )
 	{
-		m_pOuter->GetVectors(&m_vTestDirections[m_iUsedTestDirections], NULL, NULL); // Just use forward as start dir
-		m_vTestPositions[m_iUsedTestDirections] = origin + m_vTestDirections[m_iUsedTestDirections] * fRadius;
-		for( i=0; i<m_iConsiderSize; i++ )
-		{
-			if( !m_ConsiderList[i].m_pEnt ) 
-				continue;
-			m_ConsiderList[i].positions[m_iUsedTestDirections].m_fDensity = ComputeEntityDensity(m_vTestPositions[m_iUsedTestDirections], m_ConsiderList[i].m_pEnt);
-		}	
-		m_iUsedTestDirections += 1;
+		m_pOuter->GetVectors(&m_vTestDirections[0], NULL, NULL); // Just use forward as start dir
+		m_vTestPositions[0] = origin + m_vTestDirections[0] * fRadius;
 
 		// Full circle scan
-		for( j = 0; j < 7; j++ )
+		for( j = 1; j < 8; j++ )
 		{
-			VectorYawRotate(m_vTestDirections[m_iUsedTestDirections-1], 45.0f, m_vTestDirections[m_iUsedTestDirections]);
-			m_vTestPositions[m_iUsedTestDirections] = origin + m_vTestDirections[m_iUsedTestDirections] * fRadius;
-
-			for( i=0; i<m_iConsiderSize; i++ )
-			{
-				if( !m_ConsiderList[i].m_pEnt ) 
-					continue;
-				m_ConsiderList[i].positions[m_iUsedTestDirections].m_fDensity = ComputeEntityDensity(m_vTestPositions[m_iUsedTestDirections], m_ConsiderList[i].m_pEnt);
-			}	
-
-			m_iUsedTestDirections += 1;
+			VectorYawRotate(m_vTestDirections[j-1], 45.0f, m_vTestDirections[j]);
+			m_vTestPositions[j] = origin + m_vTestDirections[j] * fRadius;
 		}
+
+		ComputeConsiderDensities( 8 );
+		m_iUsedTestDirections = 8;
 	}
 	else
 	{
 		// Compute density path direction
-		m_vTestDirections[m_iUsedTestDirections] = vPathDir;
-		m_vTestPositions[m_iUsedTestDirections] = origin + m_vTestDirections[m_iUsedTestDirections] * fRadius;
-		float fTotalDensity = 0.0f;
-		for( i=0; i<m_iConsiderSize; i++ )
-		{
-			if( !m_ConsiderList[i].m_pEnt ) 
-				continue;
-			m_ConsiderList[i].positions[m_iUsedTestDirections].m_fDensity = ComputeEntityDensity(m_vTestPositions[m_iUsedTestDirections], m_ConsiderList[i].m_pEnt);
-			fTotalDensity += m_ConsiderList[i].positions[m_iUsedTestDirections].m_fDensity;
-		}	
+		m_vTestDirections[0] = vPathDir;
+		m_vTestPositions[0] = origin + m_vTestDirections[0] * fRadius;
 
 		// Half circle scan with mid at waypoint direction
 		// Scan starts in the middle, alternating between the two different directions
-		// Scan breaks early if fTotalDensity is very low for the scanned direction.
+		// The densities of all directions are computed at once, which is cheaper than computing them one by one.
 		float fRotate = 45.0f;
+		for( j = 1; j < 5; j++ )
+		{
+			VectorYawRotate(m_vTestDirections[j-1], fRotate, m_vTestDirections[j]);
+			m_vTestPositions[j] = origin + m_vTestDirections[j] * fRadius;
+
+			fRotate *= -1;
+			if( fRotate < 0.0 )
+				fRotate -= 45.0f;
+			else
+				fRotate += 45.0f;
+		}
+
+		ComputeConsiderDensities( 5 );
+
+		// Scan breaks early if fTotalDensity is very low for the scanned direction.
+		float fTotalDensity = 0.0f;
+		for( i=0; i<m_iConsiderSize; i++ )
+			fTotalDensity += m_ConsiderList[i].positions[0].m_fDensity;
+
 		j = 0;
 		while( j < 4 && (m_Seeds.Count() || fTotalDensity > 0.01f) )
 		{
-			m_iUsedTestDirections += 1;
 			j++;
 
-			VectorYawRotate(m_vTestDirections[m_iUsedTestDirections-1], fRotate, m_vTestDirections[m_iUsedTestDirections]);
-			m_vTestPositions[m_iUsedTestDirections] = origin + m_vTestDirections[m_iUsedTestDirections] * fRadius;
 			fTotalDensity = 0.0f;
 			for( i=0; i<m_iConsiderSize; i++ )
-			{
-				if( !m_ConsiderList[i].m_pEnt ) 
-					continue;
-				m_ConsiderList[i].positions[m_iUsedTestDirections].m_fDensity = ComputeEntityDensity(m_vTestPositions[m_iUsedTestDirections], m_ConsiderList[i].m_pEnt);
-				fTotalDensity += m_ConsiderList[i].positions[m_iUsedTestDirections].m_fDensity;
-			}
+				fTotalDensity += m_ConsiderList[i].positions[j].m_fDensity;
+		}
 
-			fRotate *= -1;
-			if( fRotate < 0.0 )
-				fRotate -= 45.0f;
-			else
-				fRotate += 45.0f;
+		m_iUsedTestDirections = j + 1;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Computes the density of all considered entities at the first 
+//			iNumPositions test positions. The test positions are evaluated
+//			four at a time against the density weights of each entity.
+//-----------------------------------------------------------------------------
+void UnitBaseNavigator::ComputeConsiderDensities( int iNumPositions )
+{
+	VPROF_BUDGET( "UnitBaseNavigator::ComputeConsiderDensities", VPROF_BUDGETGROUP_UNITS );
+
+	Assert( iNumPositions <= MAX_TESTDIRECTIONS );
+
+	// Test positions as separate arrays, padded to a multiple of four
+	float fPosX[MAX_TESTDIRECTIONS];
+	float fPosY[MAX_TESTDIRECTIONS];
+	float fDensities[MAX_TESTDIRECTIONS];
+	int iPaddedPositions = ( iNumPositions + 3 ) & ~3;
+	int i, j;
+	for( j = 0; j < iPaddedPositions; j++ )
+	{
+		const Vector &vPos = m_vTestPositions[MIN( j, iNumPositions - 1 )];
+		fPosX[j] = vPos.x;
+		fPosY[j] = vPos.y;
+	}
+
+	CBaseEntity *pEnt;
+	for( i = 0; i < m_iConsiderSize; i++ )
+	{
+		pEnt = m_ConsiderList[i].m_pEnt;
+		if( !pEnt ) 
+		{
+			for( j = 0; j < iNumPositions; j++ )
+				m_ConsiderList[i].positions[j].m_fDensity = 0.0f;
+			continue;
 		}
 
-		m_iUsedTestDirections += 1;
+		pEnt->DensityMap()->GetMultiple( fPosX, fPosY, fDensities, iPaddedPositions );
+		for( j = 0; j < iNumPositions; j++ )
+			m_ConsiderList[i].positions[j].m_fDensity = fDensities[j];
 	}
 }
 
@@ -1027,6 +1245,14 @@ CheckGoalStatus_t UnitBaseNavigator::UpdateGoalAndPath( UnitBaseMoveCommand &Mov
 	m_iConsiderSize = 0;
 	m_iUsedTestDirections = 0;
 
+	// Path is still queued. Just avoid other units until it's built.
+	if( m_bPathPending )
+	{
+		vPathDir = vec3_origin;
+		RegenerateConsiderList( vPathDir, CHS_NOGOAL );
+		return CHS_NOGOAL;
+	}
+
 	// In case we have an target ent
 	if( GetPath()->m_iGoalType == GOALTYPE_TARGETENT || GetPath()->m_iGoalType == GOALTYPE_TARGETENT_INRANGE )
 	{
@@ -1682,7 +1908,8 @@ bool UnitBaseNavigator::TestRoute( const Vector &vStartPos, const Vector &vEndPo
 
 // Goals
 //-----------------------------------------------------------------------------
-// Purpose: 
+// Purpose: Returns false if no path could be found. If the request was queued,
+//			returns true and IsPathPending() tells the result is not known yet.
 //-----------------------------------------------------------------------------
 bool UnitBaseNavigator::SetGoal( Vector &destination, float goaltolerance, int goalflags, bool avoidenemies )
 {
@@ -1776,7 +2003,8 @@ bool UnitBaseNavigator::SetVectorGoal( const Vector &dir, float targetDist, floa
 
 // Path finding
 //-----------------------------------------------------------------------------
-// Purpose: Creates, builds and finds a new path.
+// Purpose: Creates, builds and finds a new path. Returns true without a route
+//			if the request is queued, see IsPathPending.
 //-----------------------------------------------------------------------------
 bool UnitBaseNavigator::FindPath(int goaltype, const Vector &vDestination, float fGoalTolerance, int iGoalFlags, float fMinRange, float fMaxRange)
 {
@@ -1848,6 +2076,21 @@ bool UnitBaseNavigator::FindPath(int goaltype, const Vector &vDestination, float
 	GetPath()->m_fMinRange = 0.0f; //fMinRange; // TODO: Add support for minimum range.
 	GetPath()->m_fMaxRange = fMaxRange;
 
+	// Remember if the goal is part of a group order, so the route can be shared
+	m_bGroupOrder = UnitGroupPathCache()->IsGroupOrderActive();
+	if( m_bGroupOrder )
+		m_vGroupOrderCentroid = UnitGroupPathCache()->GetGroupOrderCentroid();
+
+	// Let the path queue build the path at the end of the frame
+	if( unit_path_async.GetBool() && !(iGoalFlags & GF_DIRECTPATH) &&
+			goaltype != GOALTYPE_NONE && goaltype != GOALTYPE_INVALID )
+	{
+		NavDbgMsg("#%d UnitNavigator: Queued path request\n", GetOuter()->entindex());
+		GetPath()->SetWaypoint(NULL);
+		s_UnitPathQueue.Enqueue( this );
+		return true;
+	}
+
 	if( GetPath()->m_iGoalType == GOALTYPE_POSITION ||
 			GetPath()->m_iGoalType == GOALTYPE_TARGETENT )
 		return DoFindPathToPos();
@@ -1858,6 +2101,32 @@ bool UnitBaseNavigator::FindPath(int goaltype, const Vector &vDestination, float
 	return false;
 }
 
+//-----------------------------------------------------------------------------
+// Purpose: Builds the path of a queued request. Dispatches OnNavFailed if no
+//			path could be built, like FindPath would have returned false.
+//-----------------------------------------------------------------------------
+bool UnitBaseNavigator::ResolvePendingPath()
+{
+	VPROF_BUDGET( "UnitBaseNavigator::ResolvePendingPath", VPROF_BUDGETGROUP_UNITS );
+
+	m_bPathPending = false;
+
+	bool bResult = false;
+	if( GetPath()->m_iGoalType == GOALTYPE_POSITION ||
+			GetPath()->m_iGoalType == GOALTYPE_TARGETENT )
+		bResult = DoFindPathToPos();
+	else if( GetPath()->m_iGoalType == GOALTYPE_POSITION_INRANGE ||
+			GetPath()->m_iGoalType == GOALTYPE_TARGETENT_INRANGE )
+		bResult = DoFindPathToPosInRange();
+
+	if( !bResult )
+	{
+		NavDbgMsg("#%d UnitNavigator: Queued path request failed\n", GetOuter()->entindex());
+		DispatchOnNavFailed();
+	}
+	return bResult;
+}
+
 //-----------------------------------------------------------------------------
 // Purpose: Finds a path to the goal position.
 //-----------------------------------------------------------------------------
@@ -2287,9 +2556,22 @@ UnitBaseWaypoint *UnitBaseNavigator::BuildNavAreaPath( const Vector &vGoalPos )
 	}
 	else
 	{
-		UnitShortestPathCost costFunc(m_pOuter);
-		NavAreaBuildPath<UnitShortestPathCost>(startArea, goalArea, &vGoalPos, costFunc, &closestArea);
+		// The path of a group order shares the group route. Later recomputations don't.
+		closestArea = NULL;
+		if( m_bGroupOrder && unit_grouppath.GetBool() && startArea && goalArea )
+		{
+			closestArea = UnitGroupPathCache()->BuildPath( m_pOuter, startArea, goalArea, vGoalPos, m_vGroupOrderCentroid );
+			if( closestArea )
+				NavDbgMsg("#%d BuildNavAreaPath: Using group path\n", GetOuter()->entindex());
+		}
+
+		if( !closestArea )
+		{
+			UnitShortestPathCost costFunc(m_pOuter);
+			NavAreaBuildPath<UnitShortestPathCost>(startArea, goalArea, &vGoalPos, costFunc, &closestArea);
+		}
 	}
+	m_bGroupOrder = false;
 
 	if (closestArea)
 	{
@@ -2337,6 +2619,9 @@ UnitBaseWaypoint *UnitBaseNavigator::BuildRoute()
 //-----------------------------------------------------------------------------
 void UnitBaseNavigator::SetPath( boost::python::object path )
 {
+	// Cancel any queued path request of the old path
+	s_UnitPathQueue.Remove( this );
+
 	if( path.ptr() == Py_None )
 	{
 		// Install the default path object
@@ -2486,3 +2771,385 @@ void UnitBaseNavigator::DrawDebugInfo()
 	m_pOuter->EntityText( 4, UTIL_VarArgs("Threshold: %f\n", THRESHOLD), 0, 255, 0, 0, 255 );
 	m_pOuter->EntityText( 5, UTIL_VarArgs("DiscomfortWeight: %f\n", m_fDiscomfortWeight), 0, 255, 0, 0, 255 );
 }
+
+//-----------------------------------------------------------------------------
+// Group path cache
+//-----------------------------------------------------------------------------
+#define GROUPPATH_HULLSTEP 16.0f
+#define GROUPPATH_MAXENTRIES 16
+
+static CUnitGroupPathCache s_UnitGroupPathCache; // singleton
+CUnitGroupPathCache *UnitGroupPathCache()
+{
+	return &s_UnitGroupPathCache;
+}
+
+// Search state of the group path searches, separate from the state on the nav areas
+static CNavPathContext s_GroupPathContext;
+
+//-----------------------------------------------------------------------------
+// Purpose: Clears the group path cache on level shutdown. The cache itself is
+//			not a game system, so the benchmark can use a local cache.
+//-----------------------------------------------------------------------------
+class CUnitGroupPathCacheSystem : public CAutoGameSystem
+{
+public:
+	CUnitGroupPathCacheSystem() : CAutoGameSystem( "CUnitGroupPathCacheSystem" ) {}
+
+	virtual void LevelShutdownPreEntity()
+	{
+		UnitGroupPathCache()->Clear();
+		s_GroupPathContext.Purge();
+	}
+};
+static CUnitGroupPathCacheSystem s_UnitGroupPathCacheSystem;
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+CUnitGroupPathCache::CUnitGroupPathCache() : m_bGroupOrderActive(false)
+{
+	ResetStats();
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+CUnitGroupPathCache::~CUnitGroupPathCache()
+{
+	Clear();
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Paths requested between begin and end are part of the same group.
+//-----------------------------------------------------------------------------
+void CUnitGroupPathCache::BeginGroupOrder( const Vector &vCentroid )
+{
+	m_bGroupOrderActive = true;
+	m_vGroupOrderCentroid = vCentroid;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void CUnitGroupPathCache::EndGroupOrder()
+{
+	m_bGroupOrderActive = false;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void CUnitGroupPathCache::Clear()
+{
+	m_GroupPaths.PurgeAndDeleteElements();
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Finds a group route that is still valid. Removes expired routes.
+//-----------------------------------------------------------------------------
+CUnitGroupPathCache::grouppath_t *CUnitGroupPathCache::FindGroupPath( CNavArea *pCenterArea, CNavArea *pGoalArea, int iHullClass, CUnitBase *pUnit )
+{
+	grouppath_t *pFound = NULL;
+	for( int i = m_GroupPaths.Count() - 1; i >= 0; i-- )
+	{
+		grouppath_t *pGroupPath = m_GroupPaths[i];
+		if( pGroupPath->m_fCreateTime + unit_grouppath_lifetime.GetFloat() < gpGlobals->curtime )
+		{
+			delete pGroupPath;
+			m_GroupPaths.Remove( i );
+			continue;
+		}
+
+		if( pGroupPath->m_iCenterAreaID == (int)pCenterArea->GetID() && 
+			pGroupPath->m_iGoalAreaID == (int)pGoalArea->GetID() &&
+			pGroupPath->m_iHullClass == iHullClass &&
+			pGroupPath->m_fMaxClimbHeight == pUnit->m_fMaxClimbHeight &&
+			pGroupPath->m_fSaveDrop == pUnit->m_fSaveDrop )
+		{
+			pFound = pGroupPath;
+		}
+	}
+	return pFound;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Builds a new group route from the center area to the goal. 
+//			The route is built for the largest radius of the hull class, so
+//			it's valid for all units in the class. If the goal can't be reached,
+//			the route is not stored, but marked partial.
+//-----------------------------------------------------------------------------
+CUnitGroupPathCache::grouppath_t *CUnitGroupPathCache::CreateGroupPath( CNavArea *pCenterArea, CNavArea *pGoalArea, int iHullClass, 
+																	  CUnitBase *pUnit, const Vector &vGoalPos )
+{
+	CNavArea *pClosestArea = NULL;
+	UnitShortestPathCost costFunc( pUnit );
+	costFunc.SetBoundingRadius( iHullClass * GROUPPATH_HULLSTEP );
+	NavAreaBuildPath( s_GroupPathContext, pCenterArea, pGoalArea, &vGoalPos, costFunc, &pClosestArea );
+	if( !pClosestArea )
+		return NULL;
+
+	if( m_GroupPaths.Count() >= GROUPPATH_MAXENTRIES )
+	{
+		// Oldest route is at the head
+		delete m_GroupPaths[0];
+		m_GroupPaths.Remove( 0 );
+	}
+
+	grouppath_t *pGroupPath = new grouppath_t;
+	pGroupPath->m_iCenterAreaID = pCenterArea->GetID();
+	pGroupPath->m_iGoalAreaID = pGoalArea->GetID();
+	pGroupPath->m_iHullClass = iHullClass;
+	pGroupPath->m_fMaxClimbHeight = pUnit->m_fMaxClimbHeight;
+	pGroupPath->m_fSaveDrop = pUnit->m_fSaveDrop;
+	pGroupPath->m_fCreateTime = gpGlobals->curtime;
+	pGroupPath->m_bPartial = pClosestArea != pGoalArea;
+	m_GroupPaths.AddToTail( pGroupPath );
+
+	// Each unit should find its own closest area, so don't share the route
+	if( pGroupPath->m_bPartial )
+		return pGroupPath;
+
+	// Store the route from the center area to the goal area
+	for( CNavArea *pArea = pClosestArea; pArea; pArea = s_GroupPathContext.GetParent( pArea ) )
+	{
+		pGroupPath->m_Areas.AddToHead( pArea );
+		pGroupPath->m_How.AddToHead( s_GroupPathContext.GetParentHow( pArea ) );
+	}
+
+	return pGroupPath;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Builds the route for an unit of a group order. The route consists 
+//			of the route from the start area to the group route (the prefix),
+//			followed by the remainder of the group route.
+//-----------------------------------------------------------------------------
+CNavArea *CUnitGroupPathCache::BuildPath( CUnitBase *pUnit, CNavArea *pStartArea, CNavArea *pGoalArea, 
+										const Vector &vGoalPos, const Vector &vCentroid )
+{
+	VPROF_BUDGET( "CUnitGroupPathCache::BuildPath", VPROF_BUDGETGROUP_UNITS );
+
+	double fStartTime = Plat_FloatTime();
+
+	float fMaxDist = unit_grouppath_maxdist.GetFloat();
+	if( (pUnit->GetAbsOrigin() - vCentroid).Length2DSqr() > fMaxDist * fMaxDist )
+	{
+		m_iNotShared++;
+		return NULL;
+	}
+
+	CNavArea *pCenterArea = TheNavMesh->GetNavArea( vCentroid );
+	if( !pCenterArea || pCenterArea->IsBlocked() ) pCenterArea = TheNavMesh->GetNearestNavArea( vCentroid );
+	if( !pCenterArea )
+	{
+		m_iNotShared++;
+		return NULL;
+	}
+
+	int iHullClass = (int)ceil( pUnit->CollisionProp()->BoundingRadius2D() / GROUPPATH_HULLSTEP );
+	grouppath_t *pGroupPath = FindGroupPath( pCenterArea, pGoalArea, iHullClass, pUnit );
+	if( pGroupPath )
+	{
+		m_iHits++;
+	}
+	else
+	{
+		m_iMisses++;
+		pGroupPath = CreateGroupPath( pCenterArea, pGoalArea, iHullClass, pUnit, vGoalPos );
+		if( !pGroupPath )
+		{
+			m_fBuildTime += Plat_FloatTime() - fStartTime;
+			return NULL;
+		}
+	}
+
+	if( pGroupPath->m_bPartial )
+	{
+		m_iNotShared++;
+		m_fBuildTime += Plat_FloatTime() - fStartTime;
+		return NULL;
+	}
+
+	// Build the prefix from the start area to the center area, unless the start area is on the route already
+	CUtlVectorFixedGrowable< CNavArea *, 32 > prefixAreas;
+	CUtlVectorFixedGrowable< NavTraverseType, 32 > prefixHow;
+	NavTraverseType joinHow = NUM_TRAVERSE_TYPES;
+	int iJoin = pGroupPath->m_Areas.Find( pStartArea );
+	if( iJoin == -1 )
+	{
+		m_iPrefixSearches++;
+
+		CNavArea *pPrefixEnd = NULL;
+		UnitShortestPathCost costFunc( pUnit );
+		NavAreaBuildPath( s_GroupPathContext, pStartArea, pCenterArea, NULL, costFunc, &pPrefixEnd, fMaxDist * 2.0f );
+		if( pPrefixEnd != pCenterArea )
+		{
+			// Can't reach the group route (in time), so build a normal path
+			m_iNotShared++;
+			m_fBuildTime += Plat_FloatTime() - fStartTime;
+			return NULL;
+		}
+
+		for( CNavArea *pArea = pCenterArea; pArea; pArea = s_GroupPathContext.GetParent( pArea ) )
+		{
+			prefixAreas.AddToHead( pArea );
+			prefixHow.AddToHead( s_GroupPathContext.GetParentHow( pArea ) );
+		}
+
+		// Join the group route at the first area of the prefix on the route
+		int i;
+		for( i = 0; i < prefixAreas.Count(); i++ )
+		{
+			iJoin = pGroupPath->m_Areas.Find( prefixAreas[i] );
+			if( iJoin != -1 )
+				break;
+		}
+		Assert( iJoin != -1 && i > 0 );
+		if( iJoin == -1 || i == 0 )
+		{
+			m_iNotShared++;
+			m_fBuildTime += Plat_FloatTime() - fStartTime;
+			return NULL;
+		}
+		joinHow = prefixHow[i];
+		prefixAreas.RemoveMultipleFromTail( prefixAreas.Count() - i );
+		prefixHow.RemoveMultipleFromTail( prefixHow.Count() - i );
+	}
+
+	// The parents of the last cached path will be overwritten
+	CNavArea::SetCachedPath( CUtlSymbol(""), -1, -1, -1 );
+
+	// Set the route as parents, so the route can be read like after NavAreaBuildPath
+	CNavArea *pPrevArea = NULL;
+	int i;
+	for( i = 0; i < prefixAreas.Count(); i++ )
+	{
+		prefixAreas[i]->SetParent( pPrevArea, prefixHow[i] );
+		pPrevArea = prefixAreas[i];
+	}
+	pGroupPath->m_Areas[iJoin]->SetParent( pPrevArea, joinHow );
+	pPrevArea = pGroupPath->m_Areas[iJoin];
+	for( i = iJoin + 1; i < pGroupPath->m_Areas.Count(); i++ )
+	{
+		pGroupPath->m_Areas[i]->SetParent( pPrevArea, pGroupPath->m_How[i] );
+		pPrevArea = pGroupPath->m_Areas[i];
+	}
+
+	m_fBuildTime += Plat_FloatTime() - fStartTime;
+	return pPrevArea;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void CUnitGroupPathCache::ResetStats()
+{
+	m_iHits = 0;
+	m_iMisses = 0;
+	m_iNotShared = 0;
+	m_iPrefixSearches = 0;
+	m_fBuildTime = 0.0;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void CUnitGroupPathCache::PrintStats()
+{
+	int iLookups = m_iHits + m_iMisses;
+	Msg( "Group path cache: %d routes\n", m_GroupPaths.Count() );
+	Msg( "\tHits: %d, misses: %d, hit rate: %.1f%%\n", m_iHits, m_iMisses, iLookups > 0 ? (m_iHits / (float)iLookups) * 100.0f : 0.0f );
+	Msg( "\tNot shared: %d, prefix searches: %d\n", m_iNotShared, m_iPrefixSearches );
+	Msg( "\tBuild time: %.3f ms\n", m_fBuildTime * 1000.0 );
+}
+
+CON_COMMAND_F( unit_grouppath_stats, "Prints the stats of the group path cache.\n\tArguments: [reset]", FCVAR_CHEAT )
+{
+	if( !UTIL_IsCommandIssuedByServerAdmin() )
+		return;
+
+	UnitGroupPathCache()->PrintStats();
+	if( args.ArgC() > 1 && !Q_stricmp( args[1], "reset" ) )
+		UnitGroupPathCache()->ResetStats();
+}
+
+CON_COMMAND_F( unit_grouppath_benchmark, "Measures the cost of building the nav area routes of a group move order, with and without the group path cache. "
+			  "The first selected unit is used as template for the units, which are spread around it. The goal is the nav area furthest away.\n\tArguments: [units] [spread]", FCVAR_CHEAT )
+{
+	if( !UTIL_IsCommandIssuedByServerAdmin() )
+		return;
+
+	CHL2WarsPlayer *pPlayer = ToHL2WarsPlayer( UTIL_GetCommandClient() );
+	CBaseEntity *pEnt = pPlayer && pPlayer->CountUnits() > 0 ? pPlayer->GetUnit(0) : NULL;
+	CUnitBase *pUnit = pEnt ? pEnt->MyUnitPointer() : NULL;
+	if( !pUnit )
+	{
+		Warning( "unit_grouppath_benchmark: select an unit first\n" );
+		return;
+	}
+	if( TheNavAreas.Count() == 0 )
+	{
+		Warning( "unit_grouppath_benchmark: no navigation mesh loaded\n" );
+		return;
+	}
+
+	int iUnits = args.ArgC() > 1 ? MAX( atoi( args[1] ), 1 ) : 200;
+	float fSpread = args.ArgC() > 2 ? atof( args[2] ) : 256.0f;
+	const Vector &vCentroid = pUnit->GetAbsOrigin();
+
+	// Goal is the area furthest away
+	CNavArea *pGoalArea = NULL;
+	float fBestDist = -1.0f;
+	FOR_EACH_VEC( TheNavAreas, i )
+	{
+		float fDist = ( TheNavAreas[i]->GetCenter() - vCentroid ).LengthSqr();
+		if( fDist > fBestDist )
+		{
+			fBestDist = fDist;
+			pGoalArea = TheNavAreas[i];
+		}
+	}
+	Vector vGoalPos = pGoalArea->GetCenter();
+
+	// Start areas of the units
+	CUtlVector< CNavArea * > startAreas;
+	startAreas.EnsureCapacity( iUnits );
+	for( int i = 0; i < iUnits; i++ )
+	{
+		Vector vPos = vCentroid + Vector( RandomFloat( -fSpread, fSpread ), RandomFloat( -fSpread, fSpread ), 0.0f );
+		CNavArea *pArea = TheNavMesh->GetNearestNavArea( vPos );
+		startAreas.AddToTail( pArea ? pArea : pGoalArea );
+	}
+
+	// Each unit searches the full route
+	CNavArea *pClosestArea;
+	double fStartTime = Plat_FloatTime();
+	for( int i = 0; i < iUnits; i++ )
+	{
+		UnitShortestPathCost costFunc( pUnit );
+		NavAreaBuildPath( startAreas[i], pGoalArea, &vGoalPos, costFunc, &pClosestArea );
+	}
+	double fFullTime = Plat_FloatTime() - fStartTime;
+
+	// Units share the group route. Units that can't, search the full route.
+	// Uses its own cache, so the routes and stats of the game are kept.
+	CUnitGroupPathCache cache;
+	fStartTime = Plat_FloatTime();
+	for( int i = 0; i < iUnits; i++ )
+	{
+		if( !cache.BuildPath( pUnit, startAreas[i], pGoalArea, vGoalPos, vCentroid ) )
+		{
+			UnitShortestPathCost costFunc( pUnit );
+			NavAreaBuildPath( startAreas[i], pGoalArea, &vGoalPos, costFunc, &pClosestArea );
+		}
+	}
+	double fGroupTime = Plat_FloatTime() - fStartTime;
+
+	CNavArea::SetCachedPath( CUtlSymbol(""), -1, -1, -1 );
+
+	Msg( "Group order of %d units (spread %.0f) to area %d:\n", iUnits, fSpread, pGoalArea->GetID() );
+	Msg( "\tFull routes: %.3f ms (%.4f ms per unit)\n", fFullTime * 1000.0, ( fFullTime * 1000.0 ) / iUnits );
+	Msg( "\tGroup route: %.3f ms (%.4f ms per unit)\n", fGroupTime * 1000.0, ( fGroupTime * 1000.0 ) / iUnits );
+	cache.PrintStats();
+}
@@ -304,10 +304,12 @@ class UnitBaseNavigator : public UnitComponent
 	DECLARE_CLASS(UnitBaseNavigator, UnitComponent);
 public:
 	friend class CUnitBase;
+	friend class CUnitPathQueue;
 
 #ifndef DISABLE_PYTHON
 	UnitBaseNavigator( boost::python::object outer );
 #endif // DISABLE_PYTHON
+	~UnitBaseNavigator();
 
 	// Core
 	virtual void		Reset();
@@ -330,6 +332,7 @@ public:
 
 	float				ComputeDensityAndAvgVelocity( int iPos, Vector *pAvgVelocity );
 	float				ComputeEntityDensity( const Vector &vPos, CBaseEntity *pEnt );
+	void				ComputeConsiderDensities( int iNumPositions );
 
 	float				ComputeUnitCost( int iPos, Vector *pFinalVelocity, CheckGoalStatus_t GoalStatus, 
 								UnitBaseMoveCommand &MoveCommand, Vector &vPathDir, float &fGoalDist );
@@ -350,6 +353,9 @@ public:
 	virtual bool		TestRoute( const Vector &vStartPos, const Vector &vEndPos );
 
 	// Goals
+	// With unit_path_async, these return true if the path request was queued. 
+	// IsPathPending() is true until the request is resolved at the end of the
+	// frame; a failed request then dispatches OnNavFailed.
 	virtual bool		SetGoal( Vector &destination, float goaltolerance=64.0f, int goalflags=0, bool avoidenemies=true );
 	virtual bool		SetGoalTarget( CBaseEntity *pTarget, float goaltolerance=64.0f, int goalflags=0, bool avoidenemies=true );
 	virtual bool		SetGoalInRange( Vector &destination, float maxrange, float minrange=0.0f, float goaltolerance=0.0f, int goalflags=0, bool avoidenemies=true );
@@ -362,6 +368,8 @@ public:
 	virtual bool		FindPath( int goaltype, const Vector &vDestination, float fGoalTolerance, int goalflags=0, float fMinRange=0.0f, float fMaxRange=0.0f );
 	virtual bool		DoFindPathToPos();
 	virtual bool		DoFindPathToPosInRange();
+	bool				IsPathPending() { return m_bPathPending; }
+	bool				ResolvePendingPath();
 
 	// Route buiding
 	virtual UnitBaseWaypoint *	BuildLocalPath( const Vector &pos );
@@ -420,6 +428,16 @@ private:
 	boost::python::object m_refPath;
 #endif // DISABLE_PYTHON
 
+	// Path request queue
+	EHANDLE m_hPathRequestOuter;
+	int m_iPathRequestIndex;
+	bool m_bPathPending;
+	float m_fPathRequestTime;
+
+	// Group order in which the path was requested
+	bool m_bGroupOrder;
+	Vector m_vGroupOrderCentroid;
+
 	// Position checking
 	float m_fNextLastPositionCheck;
 	float m_fLastPathRecomputation;
@@ -516,5 +534,92 @@ inline void UnitBaseNavigator::SetFacingTargetPos( Vector &vFacingTargetPos )
 	m_bFacingFaceTarget = false;
 }
 
+//-----------------------------------------------------------------------------
+// Purpose: Shares the nav area route between units ordered together. The route
+//			is built once from the nav area at the center of the group. Each unit
+//			only searches the part from its own nav area to this route.
+//-----------------------------------------------------------------------------
+class CUnitGroupPathCache
+{
+public:
+	CUnitGroupPathCache();
+	~CUnitGroupPathCache();
+
+	// Group orders
+	void				BeginGroupOrder( const Vector &vCentroid );
+	void				EndGroupOrder();
+	bool				IsGroupOrderActive() { return m_bGroupOrderActive; }
+	const Vector &		GetGroupOrderCentroid() { return m_vGroupOrderCentroid; }
+
+	// Sets the route as parents on the nav areas, like NavAreaBuildPath. Returns the
+	// last area of the route or NULL if the route could not be shared.
+	CNavArea *			BuildPath( CUnitBase *pUnit, CNavArea *pStartArea, CNavArea *pGoalArea, 
+								const Vector &vGoalPos, const Vector &vCentroid );
+
+	void				Clear();
+	void				ResetStats();
+	void				PrintStats();
+
+private:
+	struct grouppath_t
+	{
+		// Key
+		int m_iCenterAreaID;
+		int m_iGoalAreaID;
+		int m_iHullClass;
+		float m_fMaxClimbHeight;
+		float m_fSaveDrop;
+
+		float m_fCreateTime;
+		bool m_bPartial; // Goal not reachable, only remembered so the group doesn't search it again
+		CUtlVector< CNavArea * > m_Areas; // From the center area to the goal
+		CUtlVector< NavTraverseType > m_How;
+	};
+
+	grouppath_t *		FindGroupPath( CNavArea *pCenterArea, CNavArea *pGoalArea, int iHullClass, CUnitBase *pUnit );
+	grouppath_t *		CreateGroupPath( CNavArea *pCenterArea, CNavArea *pGoalArea, int iHullClass, CUnitBase *pUnit, const Vector &vGoalPos );
+
+private:
+	bool m_bGroupOrderActive;
+	Vector m_vGroupOrderCentroid;
+
+	CUtlVector< grouppath_t * > m_GroupPaths;
+
+	// Stats
+	int m_iHits;
+	int m_iMisses;
+	int m_iNotShared;
+	int m_iPrefixSearches;
+	double m_fBuildTime;
+};
+
+extern CUnitGroupPathCache *UnitGroupPathCache();
+
+//-----------------------------------------------------------------------------
+// Purpose: Ends the group order when going out of scope, so an exception 
+//			thrown by an order doesn't leave the group order active.
+//-----------------------------------------------------------------------------
+class CUnitGroupOrderScope
+{
+public:
+	CUnitGroupOrderScope() : m_bActive(false) {}
+	~CUnitGroupOrderScope() { End(); }
+
+	void Begin( const Vector &vCentroid ) 
+	{ 
+		UnitGroupPathCache()->BeginGroupOrder( vCentroid ); 
+		m_bActive = true;
+	}
+	void End()
+	{
+		if( !m_bActive )
+			return;
+		UnitGroupPathCache()->EndGroupOrder();
+		m_bActive = false;
+	}
+
+private:
+	bool m_bActive;
+};
 
 #endif // UNIT_NAVIGATOR_H
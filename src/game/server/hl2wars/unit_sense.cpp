@@ -12,18 +12,291 @@
 // memdbgon must be the last include file in a .cpp file!!!
 #include "tier0/memdbgon.h"
 
+ConVar unit_sense_usegrid("unit_sense_usegrid", "1", FCVAR_CHEAT, "Use the unit grid of the unit manager to find the units in sense range, instead of testing all units.");
+ConVar unit_sense_scheduler("unit_sense_scheduler", "1", FCVAR_CHEAT, "Let the sense scheduler perform the sensing of all units at the end of the frame, spread over frames within a time budget.");
+ConVar unit_sense_budget_us("unit_sense_budget_us", "2000", FCVAR_CHEAT, "Time budget in microseconds per frame for the sense scheduler. Remaining units are sensed in the next frame.", true, 0.0f, false, 0.0f);
+
+// Candidates from the unit grid. Sensing only runs on the main thread.
+static CUtlVector< CUnitBase * > s_SenseCandidates;
+
+// Sense requests are dropped from the scheduler when no longer done for this long (e.g. the unit died)
+#define SENSE_REQUEST_TIMEOUT 2.0f
+
+//-----------------------------------------------------------------------------
+// Purpose: Snapshot of the positions and owners of all units, stored as 
+//			separate arrays and ordered by the cells of the unit grid.
+//-----------------------------------------------------------------------------
+class CUnitSenseSnapshot
+{
+public:
+	void Build();
+
+	// Collects the snapshot indices and squared distances of the units within fDistance of vOrigin
+	int CollectInRange( const Vector &vOrigin, float fDistance, CUtlVector< int > &indices, CUtlVector< float > &distances ) const;
+
+	CUtlVector< float > m_PosX;
+	CUtlVector< float > m_PosY;
+	CUtlVector< float > m_PosZ;
+	CUtlVector< int > m_Owners;
+	CUtlVector< CUnitBase * > m_Units;
+
+	// Range of each grid cell in the arrays above
+	int m_CellStart[UNITGRID_SIZE*UNITGRID_SIZE+1];
+
+	mutable CUtlVector< float > m_Scratch;
+};
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void CUnitSenseSnapshot::Build()
+{
+	g_Unit_Manager.UpdateGrid();
+	const CUnitSpatialGrid &grid = g_Unit_Manager.GetGrid();
+
+	int n = grid.Count();
+	m_PosX.SetCount( n );
+	m_PosY.SetCount( n );
+	m_PosZ.SetCount( n );
+	m_Owners.SetCount( n );
+	m_Units.SetCount( n );
+	m_Scratch.SetCount( n );
+
+	int i, iCell, iCount = 0;
+	for( iCell = 0; iCell < UNITGRID_SIZE*UNITGRID_SIZE; iCell++ )
+	{
+		m_CellStart[iCell] = iCount;
+
+		const CUtlVector< UnitGridEntry_t > &cell = grid.GetCell( iCell );
+		for( i = 0; i < cell.Count(); i++ )
+		{
+			CUnitBase *pUnit = cell[i].m_pUnit;
+			const Vector &vPos = pUnit->GetAbsOrigin();
+			m_PosX[iCount] = vPos.x;
+			m_PosY[iCount] = vPos.y;
+			m_PosZ[iCount] = vPos.z;
+			m_Owners[iCount] = pUnit->GetOwnerNumber();
+			m_Units[iCount] = pUnit;
+			iCount++;
+		}
+	}
+	m_CellStart[UNITGRID_SIZE*UNITGRID_SIZE] = iCount;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+int CUnitSenseSnapshot::CollectInRange( const Vector &vOrigin, float fDistance, CUtlVector< int > &indices, CUtlVector< float > &distances ) const
+{
+	indices.RemoveAll();
+	distances.RemoveAll();
+
+	int iMinX, iMinY, iMaxX, iMaxY, x, y, i, iStart, iEnd;
+	const CUnitSpatialGrid &grid = g_Unit_Manager.GetGrid();
+	float fPadded = fDistance + UNITGRID_TOLERANCE;
+	grid.ComputeCell( vOrigin - Vector( fPadded, fPadded, 0 ), iMinX, iMinY );
+	grid.ComputeCell( vOrigin + Vector( fPadded, fPadded, 0 ), iMaxX, iMaxY );
+
+	const float ox = vOrigin.x, oy = vOrigin.y, oz = vOrigin.z;
+	const float fDistSqr = fDistance * fDistance;
+	const float *pX = m_PosX.Base();
+	const float *pY = m_PosY.Base();
+	const float *pZ = m_PosZ.Base();
+	float *pDist = m_Scratch.Base();
+
+	for( y = iMinY; y <= iMaxY; y++ )
+	{
+		// Cells of a row are contiguous in the arrays
+		iStart = m_CellStart[iMinX + y * UNITGRID_SIZE];
+		iEnd = m_CellStart[iMaxX + y * UNITGRID_SIZE + 1];
+
+		// Straight loop over the arrays, so the compiler can vectorize it
+		for( i = iStart; i < iEnd; i++ )
+		{
+			float dx = pX[i] - ox;
+			float dy = pY[i] - oy;
+			float dz = pZ[i] - oz;
+			pDist[i] = dx * dx + dy * dy + dz * dz;
+		}
+
+		for( i = iStart; i < iEnd; i++ )
+		{
+			if( pDist[i] > fDistSqr )
+				continue;
+			indices.AddToTail( i );
+			distances.AddToTail( pDist[i] );
+		}
+	}
+	return indices.Count();
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Performs the sensing of all units at the end of the frame. Units
+//			are processed round-robin within a time budget, so many units 
+//			spawned at the same time don't all sense in the same frame.
+//-----------------------------------------------------------------------------
+class CUnitSenseScheduler : public CAutoGameSystemPerFrame
+{
+public:
+	CUnitSenseScheduler() : CAutoGameSystemPerFrame( "CUnitSenseScheduler" ), m_iCursor(0) {}
+
+	virtual void LevelShutdownPostEntity();
+	virtual void FrameUpdatePostEntityThink();
+
+	void Register( UnitBaseSense *pSense );
+	void Unregister( UnitBaseSense *pSense );
+
+private:
+	CUtlVector< UnitBaseSense * > m_Senses;
+	int m_iCursor;
+
+	CUnitSenseSnapshot m_Snapshot;
+};
+
+static CUnitSenseScheduler s_UnitSenseScheduler; // singleton
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void CUnitSenseScheduler::LevelShutdownPostEntity()
+{
+	for( int i = 0; i < m_Senses.Count(); i++ )
+		m_Senses[i]->m_iSchedulerIndex = -1;
+	m_Senses.Purge();
+	m_iCursor = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void CUnitSenseScheduler::Register( UnitBaseSense *pSense )
+{
+	if( pSense->m_iSchedulerIndex != -1 )
+		return;
+
+	pSense->m_iSchedulerIndex = m_Senses.AddToTail( pSense );
+
+	// Spread the first sensing over the sense rate, so units created together don't share the same phase
+	pSense->m_fNextSenseTime = gpGlobals->curtime + RandomFloat( 0.0f, pSense->m_fSenseRate );
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void CUnitSenseScheduler::Unregister( UnitBaseSense *pSense )
+{
+	int idx = pSense->m_iSchedulerIndex;
+	if( idx == -1 )
+		return;
+
+	m_Senses.FastRemove( idx );
+	if( idx < m_Senses.Count() )
+		m_Senses[idx]->m_iSchedulerIndex = idx;
+	pSense->m_iSchedulerIndex = -1;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void CUnitSenseScheduler::FrameUpdatePostEntityThink()
+{
+	VPROF_BUDGET( "CUnitSenseScheduler::FrameUpdatePostEntityThink", VPROF_BUDGETGROUP_UNITS );
+
+	if( !unit_sense_scheduler.GetBool() || m_Senses.Count() == 0 )
+		return;
+
+	double fStartTime = Plat_FloatTime();
+	double fBudget = unit_sense_budget_us.GetFloat() / 1000000.0;
+	bool bSnapshotBuilt = false;
+	bool bOverBudget = false;
+	int iResumeCursor = -1;
+	int nSensed = 0, nDeferred = 0;
+
+	// Visit every registered sense once, starting where the last frame stopped
+	int nVisit = m_Senses.Count();
+	while( nVisit > 0 && m_Senses.Count() > 0 )
+	{
+		if( m_iCursor >= m_Senses.Count() )
+			m_iCursor = 0;
+
+		UnitBaseSense *pSense = m_Senses[m_iCursor];
+		CUnitBase *pOuter = pSense->m_hSchedulerOuter.Get() ? pSense->GetOuter() : NULL;
+		if( !pOuter || gpGlobals->curtime - pSense->m_fLastSenseRequestTime > SENSE_REQUEST_TIMEOUT )
+		{
+			// Removing moves the last sense to the cursor
+			Unregister( pSense );
+			nVisit--;
+			continue;
+		}
+
+		nVisit--;
+		if( pSense->m_fNextSenseTime <= gpGlobals->curtime )
+		{
+			if( bOverBudget )
+			{
+				nDeferred++;
+			}
+			else
+			{
+				if( !bSnapshotBuilt )
+				{
+					m_Snapshot.Build();
+					bSnapshotBuilt = true;
+				}
+
+				int iDistance = pSense->m_fSenseDistance == -1 ? pOuter->GetViewDistance() : pSense->m_fSenseDistance;
+				pSense->LookForUnits( iDistance, &m_Snapshot );
+				pSense->m_fNextSenseTime = gpGlobals->curtime + pSense->m_fSenseRate;
+				nSensed++;
+
+				// Always sense at least one unit per frame
+				if( Plat_FloatTime() - fStartTime > fBudget )
+				{
+					bOverBudget = true;
+					iResumeCursor = m_iCursor + 1;
+				}
+			}
+		}
+		m_iCursor++;
+	}
+
+	// Continue with the first deferred sense in the next frame
+	if( iResumeCursor != -1 )
+		m_iCursor = iResumeCursor;
+
+	VPROF_INCREMENT_COUNTER( "UnitSense: sensed", nSensed );
+	VPROF_INCREMENT_COUNTER( "UnitSense: deferred", nDeferred );
+	VPROF_INCREMENT_COUNTER( "UnitSense: registered", m_Senses.Count() );
+}
+
 #ifndef DISABLE_PYTHON
 UnitBaseSense::UnitBaseSense( boost::python::object outer ) : 
 	UnitComponent(outer), m_fSenseDistance(-1), m_bUseLimitedViewCone(false), 
-	m_fSenseRate(0.4f), m_fNextSenseTime(0.0f), m_bTestLOS(false)
+	m_fSenseRate(0.4f), m_fNextSenseTime(0.0f), m_bTestLOS(false),
+	m_iSchedulerIndex(-1), m_fLastSenseRequestTime(0.0f)
 {
 	m_SeenEnemies.EnsureCapacity(512);
 	m_SeenOther.EnsureCapacity(512);
+
+	m_hSchedulerOuter = m_pOuter;
 }
 #endif // DISABLE_PYTHON
 
+UnitBaseSense::~UnitBaseSense()
+{
+	s_UnitSenseScheduler.Unregister( this );
+}
+
 void UnitBaseSense::PerformSensing()
 {
+	if( unit_sense_scheduler.GetBool() )
+	{
+		// Sensing is done by the scheduler, at the end of the frame
+		m_fLastSenseRequestTime = gpGlobals->curtime;
+		s_UnitSenseScheduler.Register( this );
+		return;
+	}
+
 	if( m_fNextSenseTime > gpGlobals->curtime )
 		return;
 
@@ -37,8 +310,18 @@ void UnitBaseSense::PerformSensing()
 
 void UnitBaseSense::ForcePerformSensing()
 {
-	m_fNextSenseTime = 0.0f;
-	PerformSensing();
+	if( unit_sense_scheduler.GetBool() )
+	{
+		m_fLastSenseRequestTime = gpGlobals->curtime;
+		s_UnitSenseScheduler.Register( this );
+	}
+
+	if( m_fSenseDistance == -1 )
+		Look( GetOuter()->GetViewDistance() );
+	else
+		Look( m_fSenseDistance );
+
+	m_fNextSenseTime = gpGlobals->curtime + m_fSenseRate;
 }
 
 void UnitBaseSense::Look( int iDistance )
@@ -80,7 +363,96 @@ bool UnitBaseSense::TestUnit( CUnitBase *pUnit )
 	return true;
 }
 
-int UnitBaseSense::LookForUnits( int iDistance )
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void UnitBaseSense::AddSeenUnit( CBaseEntity *pOther, float otherDist, bool bEnemy, float &fBestEnemyDist, int &iBestAttackPriority )
+{
+	if( bEnemy )
+	{
+		m_SeenEnemies.AddToTail();
+		m_SeenEnemies.Tail().entity = pOther;
+		m_SeenEnemies.Tail().distancesqr = otherDist;
+
+		// Test if best nearest enemy
+		int iAttackPriority = pOther->GetIUnit()->GetAttackPriority();
+		if( iAttackPriority > iBestAttackPriority 
+			|| (iAttackPriority == iBestAttackPriority && otherDist < fBestEnemyDist) )
+		{
+			fBestEnemyDist = otherDist;
+			m_NearestEnemy = pOther;
+			iBestAttackPriority = iAttackPriority;
+		}
+	}
+	else
+	{
+		m_SeenOther.AddToTail();
+		m_SeenOther.Tail().entity = pOther;
+		m_SeenOther.Tail().distancesqr = otherDist;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Looks for units using the snapshot of the sense scheduler. The 
+//			distance and relationship tests are done in batches over the 
+//			candidates, before the per unit tests.
+//-----------------------------------------------------------------------------
+static CUtlVector< int > s_SenseIndices;
+static CUtlVector< float > s_SenseDistances;
+static CUtlVector< unsigned char > s_SenseHates;
+
+void UnitBaseSense::LookForUnitsBatched( const CUnitSenseSnapshot &snapshot, const Vector &origin, int iDistance, 
+										float &fBestEnemyDist, int &iBestAttackPriority )
+{
+	int i, n;
+	n = snapshot.CollectInRange( origin, iDistance, s_SenseIndices, s_SenseDistances );
+	if( n == 0 )
+		return;
+
+	// Relationships. Without relationships to specific entities, this is a lookup in the row of our owner.
+	s_SenseHates.SetCount( n );
+	const int *pIndices = s_SenseIndices.Base();
+	unsigned char *pHates = s_SenseHates.Base();
+	if( GetOuter()->m_Relationship.Count() == 0 )
+	{
+		int iOwner = GetOuter()->GetOwnerNumber();
+		if( iOwner < 0 || iOwner >= MAX_PLAYERS )
+		{
+			memset( pHates, 0, n );
+		}
+		else
+		{
+			const Disposition_t *pRelations = g_playerrelationships[iOwner];
+			const int *pOwners = snapshot.m_Owners.Base();
+			for( i = 0; i < n; i++ )
+			{
+				int iOtherOwner = pOwners[pIndices[i]];
+				pHates[i] = ( iOtherOwner >= 0 && iOtherOwner < MAX_PLAYERS && pRelations[iOtherOwner] == D_HT );
+			}
+		}
+	}
+	else
+	{
+		for( i = 0; i < n; i++ )
+			pHates[i] = ( m_pOuter->IRelationType( snapshot.m_Units[pIndices[i]] ) == D_HT );
+	}
+
+	// Per unit tests
+	const float *pDistances = s_SenseDistances.Base();
+	for( i = 0; i < n; i++ )
+	{
+		CUnitBase *pOther = snapshot.m_Units[pIndices[i]];
+		if( !TestEntity( pOther ) || !TestUnit( pOther ) )
+			continue;
+
+		AddSeenUnit( pOther, pDistances[i], pHates[i] != 0, fBestEnemyDist, iBestAttackPriority );
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+int UnitBaseSense::LookForUnits( int iDistance, const CUnitSenseSnapshot *pSnapshot )
 {
 	int i;
 	float distSqr, otherDist;
@@ -89,7 +461,7 @@ int UnitBaseSense::LookForUnits( int iDistance )
 	CBaseEntity *pEntOther;
 
 	float fBestEnemyDist = MAX_COORD_FLOAT*MAX_COORD_FLOAT;
-	int iAttackPriority, iBestAttackPriority;
+	int iBestAttackPriority;
 
 	m_NearestEnemy = NULL;
 	iBestAttackPriority = -666;
@@ -101,39 +473,37 @@ int UnitBaseSense::LookForUnits( int iDistance )
 	distSqr = iDistance * iDistance;
 
 	// First check units
-	CUnitBase **ppUnits = g_Unit_Manager.AccessUnits();
-	for ( i = 0; i < g_Unit_Manager.NumUnits(); i++ )
+	if( pSnapshot )
 	{
-		pOther = ppUnits[i];
-
-		otherDist = origin.DistToSqr(pOther->GetAbsOrigin());
-		if( otherDist > distSqr )
-			continue;
-
-		if( !TestEntity( pOther ) || !TestUnit( pOther ) )
-			continue;
-
-		if( m_pOuter->IRelationType( pOther ) == D_HT )
+		LookForUnitsBatched( *pSnapshot, origin, iDistance, fBestEnemyDist, iBestAttackPriority );
+	}
+	else
+	{
+		CUnitBase **ppUnits;
+		int nUnits;
+		if( unit_sense_usegrid.GetBool() )
 		{
-			m_SeenEnemies.AddToTail();
-			m_SeenEnemies.Tail().entity = pOther;
-			m_SeenEnemies.Tail().distancesqr = otherDist;
-
-			// Test if best nearest enemy
-			iAttackPriority = pOther->GetAttackPriority();
-			if( iAttackPriority > iBestAttackPriority 
-				|| (iAttackPriority == iBestAttackPriority && otherDist < fBestEnemyDist) )
-			{
-				fBestEnemyDist = otherDist;
-				m_NearestEnemy = pOther;
-				iBestAttackPriority = iAttackPriority;
-			}
+			nUnits = g_Unit_Manager.FindUnitsInRadius( s_SenseCandidates, origin, iDistance );
+			ppUnits = s_SenseCandidates.Base();
 		}
 		else
 		{
-			m_SeenOther.AddToTail();
-			m_SeenOther.Tail().entity = pOther;
-			m_SeenOther.Tail().distancesqr = otherDist;
+			nUnits = g_Unit_Manager.NumUnits();
+			ppUnits = g_Unit_Manager.AccessUnits();
+		}
+
+		for ( i = 0; i < nUnits; i++ )
+		{
+			pOther = ppUnits[i];
+
+			otherDist = origin.DistToSqr(pOther->GetAbsOrigin());
+			if( otherDist > distSqr )
+				continue;
+
+			if( !TestEntity( pOther ) || !TestUnit( pOther ) )
+				continue;
+
+			AddSeenUnit( pOther, otherDist, m_pOuter->IRelationType( pOther ) == D_HT, fBestEnemyDist, iBestAttackPriority );
 		}
 	}
 
@@ -149,28 +519,7 @@ int UnitBaseSense::LookForUnits( int iDistance )
 		if( otherDist > distSqr )
 			continue;
 
-		if( m_pOuter->IRelationType( pFuncOther ) == D_HT )
-		{
-			m_SeenEnemies.AddToTail();
-			m_SeenEnemies.Tail().entity = pFuncOther;
-			m_SeenEnemies.Tail().distancesqr = otherDist;
-
-			// Test if best nearest enemy
-			iAttackPriority = pFuncOther->GetAttackPriority();
-			if( iAttackPriority > iBestAttackPriority 
-				|| (iAttackPriority == iBestAttackPriority && otherDist < fBestEnemyDist) )
-			{
-				fBestEnemyDist = otherDist;
-				m_NearestEnemy = pFuncOther;
-				iBestAttackPriority = iAttackPriority;
-			}
-		}
-		else
-		{
-			m_SeenOther.AddToTail();
-			m_SeenOther.Tail().entity = pFuncOther;
-			m_SeenOther.Tail().distancesqr = otherDist;
-		}
+		AddSeenUnit( pFuncOther, otherDist, m_pOuter->IRelationType( pFuncOther ) == D_HT, fBestEnemyDist, iBestAttackPriority );
 	}
 
 	// Then check for special relations
@@ -287,4 +636,111 @@ bp::list UnitBaseSense::PyGetOthers( const char *unittype )
 	}
 	return units;
 }
-#endif // DISABLE_PYTHON
\ No newline at end of file
+#endif // DISABLE_PYTHON
+
+//-----------------------------------------------------------------------------
+// Purpose: Benchmark of a full sensing pass on synthetic units, comparing 
+//			testing all units against querying the unit grid.
+//-----------------------------------------------------------------------------
+struct SenseBenchmarkUnit_t
+{
+	Vector m_vPos;
+	int m_iOwner;
+};
+
+class CSenseBenchmarkCollector
+{
+public:
+	CSenseBenchmarkCollector( int iSelf, const SenseBenchmarkUnit_t &unit, float fDistSqr ) 
+		: m_iSelf(iSelf), m_Unit(unit), m_fDistSqr(fDistSqr), m_nEnemies(0), m_nOthers(0) {}
+
+	bool operator() ( const UnitGridEntry_t &entry )
+	{
+		if( entry.m_iHandle == m_iSelf || m_Unit.m_vPos.DistToSqr( entry.m_vPos ) > m_fDistSqr )
+			return true;
+
+		if( entry.m_iOwner != m_Unit.m_iOwner )
+			m_nEnemies++;
+		else
+			m_nOthers++;
+		return true;
+	}
+
+	int m_iSelf;
+	const SenseBenchmarkUnit_t &m_Unit;
+	float m_fDistSqr;
+	int m_nEnemies;
+	int m_nOthers;
+};
+
+CON_COMMAND_F( unit_sense_benchmark, "Measures a sensing pass over synthetic units, testing all units versus the unit grid.\n\tArguments: <units> [sense distance] [passes]", FCVAR_CHEAT )
+{
+	if ( !UTIL_IsCommandIssuedByServerAdmin() )
+		return;
+
+	int nUnits = args.ArgC() > 1 ? atoi( args[1] ) : 1000;
+	float fSenseDistance = args.ArgC() > 2 ? atof( args[2] ) : 1024.0f;
+	int nPasses = args.ArgC() > 3 ? atoi( args[3] ) : 5;
+	nUnits = clamp( nUnits, 1, 32768 );
+	nPasses = MAX( nPasses, 1 );
+
+	int i, j, pass;
+	float fDistSqr = fSenseDistance * fSenseDistance;
+
+	// Spread the units with about one unit per 128x128 area, over 8 hostile owners
+	float fHalfSize = MIN( sqrt( (float)nUnits ) * 128.0f, (float)FOW_WORLDSIZE ) / 2.0f;
+	CUtlVector< SenseBenchmarkUnit_t > units;
+	units.SetCount( nUnits );
+	for( i = 0; i < nUnits; i++ )
+	{
+		units[i].m_vPos = Vector( RandomFloat( -fHalfSize, fHalfSize ), RandomFloat( -fHalfSize, fHalfSize ), 0.0f );
+		units[i].m_iOwner = 2 + (i % 8);
+	}
+
+	// Test all units
+	int nBruteSeen = 0;
+	double fStartTime = Plat_FloatTime();
+	for( pass = 0; pass < nPasses; pass++ )
+	{
+		nBruteSeen = 0;
+		for( i = 0; i < nUnits; i++ )
+		{
+			for( j = 0; j < nUnits; j++ )
+			{
+				if( i == j || units[i].m_vPos.DistToSqr( units[j].m_vPos ) > fDistSqr )
+					continue;
+				nBruteSeen++;
+			}
+		}
+	}
+	double fBruteTime = ( Plat_FloatTime() - fStartTime ) / nPasses;
+
+	// Unit grid. Handles match the unit indices, since the grid is empty.
+	CUnitSpatialGrid *pGrid = new CUnitSpatialGrid();
+	fStartTime = Plat_FloatTime();
+	for( i = 0; i < nUnits; i++ )
+		pGrid->Insert( NULL, units[i].m_vPos, units[i].m_iOwner );
+	double fBuildTime = Plat_FloatTime() - fStartTime;
+
+	int nGridSeen = 0;
+	fStartTime = Plat_FloatTime();
+	for( pass = 0; pass < nPasses; pass++ )
+	{
+		nGridSeen = 0;
+		for( i = 0; i < nUnits; i++ )
+		{
+			CSenseBenchmarkCollector collector( i, units[i], fDistSqr );
+			pGrid->ForAllInRadius( collector, units[i].m_vPos, fSenseDistance );
+			nGridSeen += collector.m_nEnemies + collector.m_nOthers;
+		}
+	}
+	double fGridTime = ( Plat_FloatTime() - fStartTime ) / nPasses;
+
+	delete pGrid;
+
+	Msg( "unit_sense_benchmark: %d units, sense distance %.0f, %d passes\n", nUnits, fSenseDistance, nPasses );
+	Msg( "\tall units: %.3f ms per pass (%d seen)\n", fBruteTime * 1000.0, nBruteSeen );
+	Msg( "\tunit grid: %.3f ms per pass (%d seen), build %.3f ms\n", fGridTime * 1000.0, nGridSeen, fBuildTime * 1000.0 );
+	if( nBruteSeen != nGridSeen )
+		Warning( "unit_sense_benchmark: results differ!\n" );
+}
@@ -13,15 +13,19 @@
 
 #include "unit_component.h"
 
+class CUnitSenseSnapshot;
+
 // Sensing class
 class UnitBaseSense : public UnitComponent
 {
 public:
 	friend class CUnitBase;
+	friend class CUnitSenseScheduler;
 
 #ifndef DISABLE_PYTHON
 	UnitBaseSense( boost::python::object outer );
 #endif // DISABLE_PYTHON
+	~UnitBaseSense();
 
 	void PerformSensing();
 	void ForcePerformSensing();
@@ -57,7 +61,11 @@ public:
 	CBaseEntity *GetNearestEnemy();
 
 private:
-	int 			LookForUnits( int iDistance );
+	int 			LookForUnits( int iDistance, const CUnitSenseSnapshot *pSnapshot = NULL );
+	void			LookForUnitsBatched( const CUnitSenseSnapshot &snapshot, const Vector &origin, int iDistance, 
+							float &fBestEnemyDist, int &iBestAttackPriority );
+	void			AddSeenUnit( CBaseEntity *pOther, float otherDist, bool bEnemy, 
+							float &fBestEnemyDist, int &iBestAttackPriority );
 
 public:
 	float m_fSenseDistance;
@@ -76,6 +84,11 @@ private:
 	float m_fViewCone;
 	float m_fNextSenseTime;
 	bool m_bTestLOS;
+
+	// Sense scheduler
+	EHANDLE m_hSchedulerOuter;
+	int m_iSchedulerIndex;
+	float m_fLastSenseRequestTime;
 };
 
 // Inlines
@@ -14,6 +14,11 @@
 #include "BaseAnimatingOverlay.h"
 #include "tier0/vprof.h"
 
+#ifdef HL2WARS_DLL
+	#include "unit_base_shared.h"
+	#include "hl2wars_player.h"
+#endif // HL2WARS_DLL
+
 // memdbgon must be the last include file in a .cpp file!!!
 #include "tier0/memdbgon.h"
 
@@ -40,6 +45,12 @@ ConVar sv_unlag_fixstuck( "sv_unlag_fixstuck", "0", FCVAR_DEVELOPMENTONLY, "Disa
 
 ConVar sv_lagpushticks( "sv_lagpushticks", "0", FCVAR_DEVELOPMENTONLY, "Push computed lag compensation amount by this many ticks." );
 
+#ifdef HL2WARS_DLL
+ConVar sv_unlag_units( "sv_unlag_units", "1", FCVAR_CHEAT, "Enables lag compensation of units for players directly controlling a unit." );
+ConVar sv_unlag_unitrange( "sv_unlag_unitrange", "4096", FCVAR_CHEAT, "Range of the shot ray along which units are lag compensated." );
+ConVar sv_unlag_unitmaxspeed( "sv_unlag_unitmaxspeed", "300", FCVAR_CHEAT, "Assumed maximum speed of units, used to find the units which could have been near the shot ray." );
+#endif // HL2WARS_DLL
+
 static CLagCompensationManager g_LagCompensationManager( "CLagCompensationManager" );
 ILagCompensationManager *lagcompensation = &g_LagCompensationManager;
 
@@ -140,7 +151,7 @@ void CLagCompensationManager::FrameUpdatePostEntityThink()
 	
 	VPROF_BUDGET( "FrameUpdatePostEntityThink", "CLagCompensationManager" );
 
-	CUtlRBTree< CBaseEntity * > rbEntityList( 0, 0, DefLessFunc( CBaseEntity * ) );
+	m_RecordEntities.RemoveAll();
 
 	// Add active players
 	for ( int i = 1; i <= gpGlobals->maxClients; i++ )
@@ -151,10 +162,7 @@ void CLagCompensationManager::FrameUpdatePostEntityThink()
 			continue;
 		}
 
-		if ( rbEntityList.Find( pPlayer ) == rbEntityList.InvalidIndex() )
-		{
-			rbEntityList.Insert( pPlayer );
-		}
+		m_RecordEntities.AddToTail( pPlayer );
 	}
 
 	// Add any additional entities
@@ -164,16 +172,17 @@ void CLagCompensationManager::FrameUpdatePostEntityThink()
 		if ( !pAddEntity )
 			continue;
 
-		if ( rbEntityList.Find( pAddEntity ) == rbEntityList.InvalidIndex() )
-		{
-			rbEntityList.Insert( pAddEntity );
-		}
+		// Players are only few, so a linear search is fine here
+		if ( pAddEntity->IsPlayer() && m_RecordEntities.Find( pAddEntity ) != m_RecordEntities.InvalidIndex() )
+			continue;
+
+		m_RecordEntities.AddToTail( pAddEntity );
 	}
 
 	// Now record the actual history information
-	for ( int i = rbEntityList.FirstInorder(); i != rbEntityList.InvalidIndex(); i = rbEntityList.NextInorder( i  ) )
+	for ( int i = 0; i < m_RecordEntities.Count(); i++ )
 	{
-		CBaseEntity *pEntity = rbEntityList[ i ];
+		CBaseEntity *pEntity = m_RecordEntities[ i ];
 
 		EHANDLE eh;
 		eh = pEntity;
@@ -189,6 +198,10 @@ void CLagCompensationManager::FrameUpdatePostEntityThink()
 
 		RecordDataIntoTrack( pEntity, &ld->m_LagRecords, true );
 	}
+
+#ifdef HL2WARS_DLL
+	RecordUnits();
+#endif // HL2WARS_DLL
 }
 
 //-----------------------------------------------------------------------------
@@ -232,6 +245,9 @@ void CLagCompensationManager::StartLagCompensation( CBasePlayer *player, LagComp
 	}
 
 	m_bNeedToRestore = false;
+#ifdef HL2WARS_DLL
+	m_UnitLagRestoreSlots.RemoveAll();
+#endif // HL2WARS_DLL
 
 	m_pCurrentPlayer = player;
 	
@@ -322,6 +338,16 @@ void CLagCompensationManager::StartLagCompensation( CBasePlayer *player, LagComp
 		// Move entity back in time and remember that fact
 		ld->m_bRestoreEntity = BacktrackEntity( pEntity, flTargetTime, &ld->m_LagRecords, &ld->m_RestoreData, &ld->m_ChangeData, true );
 	}
+
+#ifdef HL2WARS_DLL
+	// Units are only moved back when the shot ray is known
+	if ( weaponRange > 0.0f )
+	{
+		Vector forward;
+		AngleVectors( weaponAngles, &forward );
+		BacktrackUnitsAlongRay( player, cmd, flTargetTime, weaponPos, weaponPos + forward * weaponRange, pEntityTransmitBits );
+	}
+#endif // HL2WARS_DLL
 }
 
 bool CLagCompensationManager::BacktrackEntity( CBaseEntity *entity, float flTargetTime, LagRecordList *track, LagRecord *restore, LagRecord *change, bool wantsAnims )
@@ -689,6 +715,10 @@ void CLagCompensationManager::FinishLagCompensation( CBasePlayer *player )
 	if ( !m_bNeedToRestore )
 		return; // no entity was changed at all
 
+#ifdef HL2WARS_DLL
+	RestoreUnits();
+#endif // HL2WARS_DLL
+
 	// Iterate all active entities
 	FOR_EACH_MAP( m_CompensatedEntities, i )
 	{
@@ -857,3 +887,377 @@ void CLagCompensationManager::RestoreEntityFromRecords( CBaseEntity *entity, Lag
 		entity->SetSimulationTime( restore->m_flSimulationTime );
 	}
 }
+
+#ifdef HL2WARS_DLL
+//-----------------------------------------------------------------------------
+// Purpose: Unit history. Each unit gets a slot in the pool, containing a 
+//			ring buffer of UNIT_LAG_RECORDS records. Slots are reused, so
+//			recording does not allocate once the pool is large enough.
+//-----------------------------------------------------------------------------
+void CLagCompensationManager::ClearUnitHistory()
+{
+	memset( m_UnitLagSlots, 0xFF, sizeof(m_UnitLagSlots) );
+	m_UnitLagTracks.Purge();
+	m_UnitLagRecords.Purge();
+	m_UnitLagFreeSlots.Purge();
+	m_UnitLagRestoreSlots.Purge();
+	m_UnitLagCandidates.Purge();
+}
+
+int CLagCompensationManager::AllocUnitSlot( CBaseEntity *entity )
+{
+	int iSlot;
+	if ( m_UnitLagFreeSlots.Count() > 0 )
+	{
+		iSlot = m_UnitLagFreeSlots.Tail();
+		m_UnitLagFreeSlots.RemoveMultipleFromTail( 1 );
+	}
+	else
+	{
+		iSlot = m_UnitLagTracks.AddToTail();
+		m_UnitLagRecords.AddMultipleToTail( UNIT_LAG_RECORDS );
+	}
+
+	UnitLagTrack &track = m_UnitLagTracks[ iSlot ];
+	track.m_hUnit = entity;
+	track.m_iHead = 0;
+	track.m_nCount = 0;
+	track.m_iLastTick = -1;
+	track.m_bRestoreEntity = false;
+
+	m_UnitLagSlots[ entity->entindex() ] = iSlot;
+	return iSlot;
+}
+
+void CLagCompensationManager::FreeUnitSlot( int iSlot )
+{
+	UnitLagTrack &track = m_UnitLagTracks[ iSlot ];
+	int iEntIndex = track.m_hUnit.GetEntryIndex();
+	if ( m_UnitLagSlots[ iEntIndex ] == iSlot )
+		m_UnitLagSlots[ iEntIndex ] = -1;
+
+	track.m_hUnit = NULL;
+	track.m_nCount = 0;
+	m_UnitLagFreeSlots.AddToTail( iSlot );
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Records all units of the unit manager, and frees the slots of 
+//			units which are gone.
+//-----------------------------------------------------------------------------
+void CLagCompensationManager::RecordUnits()
+{
+	if ( !sv_unlag_units.GetBool() )
+	{
+		if ( m_UnitLagTracks.Count() )
+			ClearUnitHistory();
+		return;
+	}
+
+	VPROF_BUDGET( "RecordUnits", "CLagCompensationManager" );
+
+	int i;
+	CUnitBase **ppUnits = g_Unit_Manager.AccessUnits();
+	for ( i = 0; i < g_Unit_Manager.NumUnits(); i++ )
+	{
+		CUnitBase *pUnit = ppUnits[ i ];
+		int iEntIndex = pUnit->entindex();
+		if ( iEntIndex < 0 || iEntIndex >= MAX_EDICTS )
+			continue;
+
+		int iSlot = m_UnitLagSlots[ iEntIndex ];
+		if ( iSlot == -1 || m_UnitLagTracks[ iSlot ].m_hUnit.Get() != pUnit )
+		{
+			// Slot still belongs to a removed entity with the same index
+			if ( iSlot != -1 )
+				FreeUnitSlot( iSlot );
+			iSlot = AllocUnitSlot( pUnit );
+		}
+
+		RecordUnitIntoTrack( pUnit, iSlot );
+	}
+
+	// Free the slots of units which were not recorded this tick
+	for ( i = 0; i < m_UnitLagTracks.Count(); i++ )
+	{
+		UnitLagTrack &track = m_UnitLagTracks[ i ];
+		if ( track.m_hUnit.IsValid() && track.m_iLastTick != gpGlobals->tickcount )
+			FreeUnitSlot( i );
+	}
+}
+
+void CLagCompensationManager::RecordUnitIntoTrack( CBaseEntity *entity, int iSlot )
+{
+	UnitLagTrack &track = m_UnitLagTracks[ iSlot ];
+	track.m_iLastTick = gpGlobals->tickcount;
+
+	// Drop the oldest records that are too old
+	float flDeadtime = gpGlobals->curtime - sv_maxunlag.GetFloat();
+	while ( track.m_nCount > 0 && GetUnitLagRecord( iSlot, track.m_nCount - 1 ).m_flSimulationTime < flDeadtime )
+	{
+		track.m_nCount--;
+	}
+
+	// Don't add new entry for same or older time
+	if ( track.m_nCount > 0 && GetUnitLagRecord( iSlot, 0 ).m_flSimulationTime >= entity->GetSimulationTime() )
+		return;
+
+	// Overwrites the oldest record when the ring is full
+	track.m_iHead = ( track.m_iHead + 1 ) % UNIT_LAG_RECORDS;
+	track.m_nCount = MIN( track.m_nCount + 1, UNIT_LAG_RECORDS );
+
+	UnitLagRecord &record = GetUnitLagRecord( iSlot, 0 );
+	record.m_fFlags = entity->IsAlive() ? LC_ALIVE : 0;
+	record.m_flSimulationTime	= entity->GetSimulationTime();
+	record.m_vecAngles			= entity->GetAbsAngles();
+	record.m_vecOrigin			= entity->GetAbsOrigin();
+	record.m_vecMaxs			= entity->WorldAlignMaxs();
+	record.m_vecMins			= entity->WorldAlignMins();
+
+	CBaseAnimating *pAnimating = entity->GetBaseAnimating();
+	if ( pAnimating )
+	{
+		record.m_masterSequence = pAnimating->GetSequence();
+		record.m_masterCycle = pAnimating->GetCycle();
+	}
+	else
+	{
+		record.m_masterSequence = 0;
+		record.m_masterCycle = 0.0f;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Moves back the units which could have been near the shot ray at 
+//			the target time. Candidates come from the unit grid, so units 
+//			away from the ray are never touched.
+//-----------------------------------------------------------------------------
+void CLagCompensationManager::BacktrackUnitsAlongRay( CBasePlayer *player, const CUserCmd *cmd, float flTargetTime, const Vector &vStart, const Vector &vEnd, const CBitVec<MAX_EDICTS> *pEntityTransmitBits )
+{
+	if ( !sv_unlag_units.GetBool() || m_UnitLagTracks.Count() == 0 )
+		return;
+
+	VPROF_BUDGET( "BacktrackUnitsAlongRay", "CLagCompensationManager" );
+
+	// Maximum distance a unit could have moved within max lag compensation time
+	float maxDistance = 1.5f * sv_unlag_unitmaxspeed.GetFloat() * sv_maxunlag.GetFloat();
+
+	Vector vMins, vMaxs;
+	VectorMin( vStart, vEnd, vMins );
+	VectorMax( vStart, vEnd, vMaxs );
+	Vector vPad( maxDistance, maxDistance, maxDistance );
+	g_Unit_Manager.FindUnitsInBox( m_UnitLagCandidates, vMins - vPad, vMaxs + vPad );
+
+	CHL2WarsPlayer *pWarsPlayer = ToHL2WarsPlayer( player );
+	CBaseEntity *pControlledUnit = pWarsPlayer ? pWarsPlayer->GetControlledUnit() : NULL;
+
+	for ( int i = 0; i < m_UnitLagCandidates.Count(); i++ )
+	{
+		CUnitBase *pUnit = m_UnitLagCandidates[ i ];
+
+		// Don't lag compensate the unit doing the shooting
+		if ( pUnit == pControlledUnit )
+			continue;
+
+		int iEntIndex = pUnit->entindex();
+		if ( iEntIndex < 0 || iEntIndex >= MAX_EDICTS )
+			continue;
+
+		// Skips friendly units and units not yet transmitted to us and acked
+		if ( !player->WantsLagCompensationOnEntity( pUnit, cmd, pEntityTransmitBits ) )
+			continue;
+
+		int iSlot = m_UnitLagSlots[ iEntIndex ];
+		if ( iSlot == -1 || m_UnitLagTracks[ iSlot ].m_hUnit.Get() != pUnit )
+			continue;
+
+		if ( CalcDistanceToLineSegment( pUnit->WorldSpaceCenter(), vStart, vEnd ) > maxDistance + pUnit->BoundingRadius() )
+			continue;
+
+		if ( BacktrackUnit( pUnit, flTargetTime, iSlot ) )
+		{
+			m_UnitLagTracks[ iSlot ].m_bRestoreEntity = true;
+			m_UnitLagRestoreSlots.AddToTail( iSlot );
+		}
+	}
+	m_UnitLagCandidates.RemoveAll();
+}
+
+bool CLagCompensationManager::BacktrackUnit( CBaseEntity *entity, float flTargetTime, int iSlot )
+{
+	UnitLagTrack &track = m_UnitLagTracks[ iSlot ];
+	if ( track.m_nCount <= 0 )
+		return false;
+
+	UnitLagRecord *prevRecord = NULL;
+	UnitLagRecord *record = NULL;
+
+	Vector prevOrg = entity->GetAbsOrigin();
+
+	// Walk the history from new to old, looking for any invalidating event
+	for ( int iAge = 0; iAge < track.m_nCount; iAge++ )
+	{
+		prevRecord = record;
+		record = &GetUnitLagRecord( iSlot, iAge );
+
+		if ( !(record->m_fFlags & LC_ALIVE) )
+		{
+			// entity must be alive, lost track
+			return false;
+		}
+
+		Vector delta = record->m_vecOrigin - prevOrg;
+		if ( delta.LengthSqr() > LAG_COMPENSATION_TELEPORTED_DISTANCE_SQR )
+		{
+			// lost track, too much difference
+			return false;
+		}
+
+		if ( record->m_flSimulationTime <= flTargetTime )
+			break;
+
+		prevOrg = record->m_vecOrigin;
+	}
+
+	Vector org, mins, maxs;
+	QAngle ang;
+	float frac = 0.0f;
+	if ( prevRecord && 
+		 (record->m_flSimulationTime < flTargetTime) &&
+		 (record->m_flSimulationTime < prevRecord->m_flSimulationTime) )
+	{
+		// Interpolate between the records around the target time
+		frac = ( flTargetTime - record->m_flSimulationTime ) / 
+			( prevRecord->m_flSimulationTime - record->m_flSimulationTime );
+
+		ang  = Lerp( frac, record->m_vecAngles, prevRecord->m_vecAngles );
+		org  = Lerp( frac, record->m_vecOrigin, prevRecord->m_vecOrigin  );
+		mins = Lerp( frac, record->m_vecMins, prevRecord->m_vecMins  );
+		maxs = Lerp( frac, record->m_vecMaxs, prevRecord->m_vecMaxs );
+	}
+	else
+	{
+		ang  = record->m_vecAngles;
+		org  = record->m_vecOrigin;
+		mins = record->m_vecMins;
+		maxs = record->m_vecMaxs;
+	}
+
+	UnitLagRecord *restore = &track.m_RestoreData;
+	UnitLagRecord *change = &track.m_ChangeData;
+	int flags = 0;
+
+	// Always remember the pristine simulation time in case we need to restore it.
+	restore->m_flSimulationTime = entity->GetSimulationTime();
+
+	QAngle angdiff = entity->GetAbsAngles() - ang;
+	if ( angdiff.LengthSqr() > LAG_COMPENSATION_EPS_SQR )
+	{
+		flags |= LC_ANGLES_CHANGED;
+		restore->m_vecAngles = entity->GetAbsAngles();
+		entity->SetAbsAngles( ang );
+		change->m_vecAngles = ang;
+	}
+
+	if ( ( mins != entity->WorldAlignMins() ) ||
+		 ( maxs != entity->WorldAlignMaxs() ) )
+	{
+		flags |= LC_SIZE_CHANGED;
+		restore->m_vecMins = entity->WorldAlignMins() ;
+		restore->m_vecMaxs = entity->WorldAlignMaxs();
+		entity->SetSize( mins, maxs );
+		change->m_vecMins = mins;
+		change->m_vecMaxs = maxs;
+	}
+
+	// Note, do origin at end since it causes a relink into the k/d tree
+	Vector orgdiff = entity->GetAbsOrigin() - org;
+	if ( orgdiff.LengthSqr() > LAG_COMPENSATION_EPS_SQR )
+	{
+		flags |= LC_ORIGIN_CHANGED;
+		restore->m_vecOrigin = entity->GetAbsOrigin();
+		entity->SetAbsOrigin( org );
+		change->m_vecOrigin = org;
+	}
+
+	CBaseAnimating *pAnimating = entity->GetBaseAnimating();
+	if ( m_lagCompensationType != LAG_COMPENSATE_BOUNDS && pAnimating )
+	{
+		flags |= LC_ANIMATION_CHANGED;
+		restore->m_masterSequence = pAnimating->GetSequence();
+		restore->m_masterCycle = pAnimating->GetCycle();
+
+		pAnimating->SetSequence( record->m_masterSequence );
+		if ( frac > 0.0f && record->m_masterSequence == prevRecord->m_masterSequence && record->m_masterCycle <= prevRecord->m_masterCycle )
+			pAnimating->SetCycle( Lerp( frac, record->m_masterCycle, prevRecord->m_masterCycle ) );
+		else
+			pAnimating->SetCycle( record->m_masterCycle );
+	}
+
+	if ( !flags )
+		return false; // we didn't change anything
+
+	if ( sv_lagflushbonecache.GetBool() && (flags & LC_ANIMATION_CHANGED) )
+		pAnimating->InvalidateBoneCache();
+
+	m_bNeedToRestore = true;
+	restore->m_fFlags = flags;
+	change->m_fFlags = flags;
+
+	if( sv_showlagcompensation.GetInt() == 1 && pAnimating )
+	{
+		pAnimating->DrawServerHitboxes(4, true);
+	}
+
+	return true;
+}
+
+void CLagCompensationManager::RestoreUnits()
+{
+	for ( int i = 0; i < m_UnitLagRestoreSlots.Count(); i++ )
+	{
+		UnitLagTrack &track = m_UnitLagTracks[ m_UnitLagRestoreSlots[ i ] ];
+		if ( !track.m_bRestoreEntity )
+			continue;
+		track.m_bRestoreEntity = false;
+
+		CBaseEntity *pEntity = track.m_hUnit.Get();
+		if ( !pEntity )
+			continue;
+
+		UnitLagRecord *restore = &track.m_RestoreData;
+		UnitLagRecord *change = &track.m_ChangeData;
+
+		if ( ( restore->m_fFlags & LC_SIZE_CHANGED ) && 
+				pEntity->WorldAlignMins() == change->m_vecMins && pEntity->WorldAlignMaxs() == change->m_vecMaxs )
+		{
+			pEntity->SetSize( restore->m_vecMins, restore->m_vecMaxs );
+		}
+
+		if ( ( restore->m_fFlags & LC_ANGLES_CHANGED ) && pEntity->GetAbsAngles() == change->m_vecAngles )
+		{
+			pEntity->SetAbsAngles( restore->m_vecAngles );
+		}
+
+		if ( restore->m_fFlags & LC_ORIGIN_CHANGED )
+		{
+			// If it moved really far, just leave the entity in the new spot!!!
+			Vector delta = pEntity->GetAbsOrigin() - change->m_vecOrigin;
+			if ( delta.LengthSqr() < LAG_COMPENSATION_TELEPORTED_DISTANCE_SQR )
+			{
+				RestoreEntityTo( pEntity, restore->m_vecOrigin + delta );
+			}
+		}
+
+		CBaseAnimating *pAnimating = pEntity->GetBaseAnimating();
+		if ( ( restore->m_fFlags & LC_ANIMATION_CHANGED ) && pAnimating )
+		{
+			pAnimating->SetSequence( restore->m_masterSequence );
+			pAnimating->SetCycle( restore->m_masterCycle );
+		}
+
+		pEntity->SetSimulationTime( restore->m_flSimulationTime );
+	}
+	m_UnitLagRestoreSlots.RemoveAll();
+}
+#endif // HL2WARS_DLL
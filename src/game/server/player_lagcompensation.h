@@ -107,6 +107,31 @@ public:
 
 typedef CUtlFixedLinkedList< LagRecord > LagRecordList;
 
+#ifdef HL2WARS_DLL
+class CUnitBase;
+
+// Number of records in the history of each unit. Covers sv_maxunlag up to 64 ticks per second.
+#define UNIT_LAG_RECORDS 64
+
+//-----------------------------------------------------------------------------
+// Purpose: Compact lag record for units. Units only record the master 
+//			sequence, since there can be thousands of them.
+//-----------------------------------------------------------------------------
+struct UnitLagRecord
+{
+	float					m_flSimulationTime;
+	int						m_fFlags;
+
+	Vector					m_vecOrigin;
+	QAngle					m_vecAngles;
+	Vector					m_vecMins;
+	Vector					m_vecMaxs;
+
+	int						m_masterSequence;
+	float					m_masterCycle;
+};
+#endif // HL2WARS_DLL
+
 //-----------------------------------------------------------------------------
 class CLagCompensationManager : public CAutoGameSystemPerFrame, public ILagCompensationManager
 {
@@ -119,6 +144,9 @@ public:
 		m_bNeedToRestore = false;
 		m_weaponRange = 0.0f;
 		m_isCurrentlyDoingCompensation = false;
+#ifdef HL2WARS_DLL
+		memset( m_UnitLagSlots, 0xFF, sizeof(m_UnitLagSlots) );
+#endif // HL2WARS_DLL
 	}
 
 	// IServerSystem stuff
@@ -148,6 +176,16 @@ public:
 	void RecordDataIntoTrack( CBaseEntity *entity, LagRecordList *track, bool wantsAnims );
 	bool BacktrackEntity( CBaseEntity *entity, float flTargetTime, LagRecordList *track, LagRecord *restore, LagRecord *change, bool wantsAnims );
 	void RestoreEntityFromRecords( CBaseEntity *entity, LagRecord *restore, LagRecord *change, bool wantsAnims );
+
+#ifdef HL2WARS_DLL
+	// Units are recorded into a ring buffer per unit, in one contiguous pool.
+	void RecordUnits();
+	void RecordUnitIntoTrack( CBaseEntity *entity, int iSlot );
+	// Moves back the units near the shot ray from vStart to vEnd
+	void BacktrackUnitsAlongRay( CBasePlayer *player, const CUserCmd *cmd, float flTargetTime, const Vector &vStart, const Vector &vEnd, const CBitVec<MAX_EDICTS> *pEntityTransmitBits );
+	bool BacktrackUnit( CBaseEntity *entity, float flTargetTime, int iSlot );
+	void RestoreUnits();
+#endif // HL2WARS_DLL
 private:
 
 
@@ -158,6 +196,10 @@ private:
 			delete m_CompensatedEntities[ i ];
 		}
 		m_CompensatedEntities.Purge();
+		m_RecordEntities.Purge();
+#ifdef HL2WARS_DLL
+		ClearUnitHistory();
+#endif // HL2WARS_DLL
 	}
 
 	struct EntityLagData
@@ -179,6 +221,43 @@ private:
 
 	CUtlMap< EHANDLE, EntityLagData * > m_CompensatedEntities;
 
+	// Entities recorded this frame. Kept around to avoid rebuilding a tree each frame.
+	CUtlVector< CBaseEntity * > m_RecordEntities;
+
+#ifdef HL2WARS_DLL
+	void ClearUnitHistory();
+	int AllocUnitSlot( CBaseEntity *entity );
+	void FreeUnitSlot( int iSlot );
+
+	// Record iAge ticks back in the history of the unit in the slot. 0 is the newest record.
+	UnitLagRecord &GetUnitLagRecord( int iSlot, int iAge )
+	{
+		const UnitLagTrack &track = m_UnitLagTracks[iSlot];
+		return m_UnitLagRecords[ iSlot * UNIT_LAG_RECORDS + ( track.m_iHead - iAge + UNIT_LAG_RECORDS ) % UNIT_LAG_RECORDS ];
+	}
+
+	struct UnitLagTrack
+	{
+		EHANDLE			m_hUnit;
+		int				m_iHead;		// Ring buffer index of the newest record
+		int				m_nCount;		// Number of valid records
+		int				m_iLastTick;	// Last tick the unit was recorded
+
+		// True if lag compensation altered the unit
+		bool			m_bRestoreEntity;
+		UnitLagRecord	m_RestoreData;
+		UnitLagRecord	m_ChangeData;
+	};
+
+	// Slot of each entity index in the pool, or -1
+	short					m_UnitLagSlots[MAX_EDICTS];
+	CUtlVector< UnitLagTrack > m_UnitLagTracks;
+	CUtlVector< UnitLagRecord > m_UnitLagRecords;	// UNIT_LAG_RECORDS records per slot
+	CUtlVector< int >		m_UnitLagFreeSlots;
+	CUtlVector< int >		m_UnitLagRestoreSlots;	// Slots backtracked by the current compensation
+	CUtlVector< CUnitBase * > m_UnitLagCandidates;
+#endif // HL2WARS_DLL
+
 	// True if at least one entity was changed
 	bool					m_bNeedToRestore;
 	CBasePlayer				*m_pCurrentPlayer;	// The player we are doing lag compensation for
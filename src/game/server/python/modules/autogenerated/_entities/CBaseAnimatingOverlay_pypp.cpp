@@ -69,7 +69,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling Activate(  ) of Class: CBaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Activate = this->get_override( "Activate" );
+        PY_OVERRIDE_LOOKUP( func_Activate, "Activate" );
         if( func_Activate.ptr() != Py_None )
             try {
                 func_Activate(  );
@@ -99,7 +99,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling CanBecomeRagdoll(  ) of Class: CBaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_CanBecomeRagdoll = this->get_override( "CanBecomeRagdoll" );
+        PY_OVERRIDE_LOOKUP( func_CanBecomeRagdoll, "CanBecomeRagdoll" );
         if( func_CanBecomeRagdoll.ptr() != Py_None )
             try {
                 return func_CanBecomeRagdoll(  );
@@ -129,7 +129,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling ComputeWorldSpaceSurroundingBox( boost::python::ptr(pWorldMins), boost::python::ptr(pWorldMaxs) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ComputeWorldSpaceSurroundingBox = this->get_override( "ComputeWorldSpaceSurroundingBox" );
+        PY_OVERRIDE_LOOKUP( func_ComputeWorldSpaceSurroundingBox, "ComputeWorldSpaceSurroundingBox" );
         if( func_ComputeWorldSpaceSurroundingBox.ptr() != Py_None )
             try {
                 func_ComputeWorldSpaceSurroundingBox( boost::python::ptr(pWorldMins), boost::python::ptr(pWorldMaxs) );
@@ -159,7 +159,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling CreateVPhysics(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_CreateVPhysics = this->get_override( "CreateVPhysics" );
+        PY_OVERRIDE_LOOKUP( func_CreateVPhysics, "CreateVPhysics" );
         if( func_CreateVPhysics.ptr() != Py_None )
             try {
                 return func_CreateVPhysics(  );
@@ -189,7 +189,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling DeathNotice( boost::python::ptr(pVictim) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_DeathNotice = this->get_override( "DeathNotice" );
+        PY_OVERRIDE_LOOKUP( func_DeathNotice, "DeathNotice" );
         if( func_DeathNotice.ptr() != Py_None )
             try {
                 func_DeathNotice( boost::python::ptr(pVictim) );
@@ -219,7 +219,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling DoImpactEffect( boost::ref(tr), nDamageType ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_DoImpactEffect = this->get_override( "DoImpactEffect" );
+        PY_OVERRIDE_LOOKUP( func_DoImpactEffect, "DoImpactEffect" );
         if( func_DoImpactEffect.ptr() != Py_None )
             try {
                 func_DoImpactEffect( boost::ref(tr), nDamageType );
@@ -249,7 +249,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling DrawDebugGeometryOverlays(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_DrawDebugGeometryOverlays = this->get_override( "DrawDebugGeometryOverlays" );
+        PY_OVERRIDE_LOOKUP( func_DrawDebugGeometryOverlays, "DrawDebugGeometryOverlays" );
         if( func_DrawDebugGeometryOverlays.ptr() != Py_None )
             try {
                 func_DrawDebugGeometryOverlays(  );
@@ -279,7 +279,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling DrawDebugTextOverlays(  ) of Class: CBaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_DrawDebugTextOverlays = this->get_override( "DrawDebugTextOverlays" );
+        PY_OVERRIDE_LOOKUP( func_DrawDebugTextOverlays, "DrawDebugTextOverlays" );
         if( func_DrawDebugTextOverlays.ptr() != Py_None )
             try {
                 return func_DrawDebugTextOverlays(  );
@@ -309,7 +309,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling EndTouch( boost::python::ptr(pOther) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_EndTouch = this->get_override( "EndTouch" );
+        PY_OVERRIDE_LOOKUP( func_EndTouch, "EndTouch" );
         if( func_EndTouch.ptr() != Py_None )
             try {
                 func_EndTouch( boost::python::ptr(pOther) );
@@ -339,7 +339,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling Event_Killed( boost::ref(info) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Event_Killed = this->get_override( "Event_Killed" );
+        PY_OVERRIDE_LOOKUP( func_Event_Killed, "Event_Killed" );
         if( func_Event_Killed.ptr() != Py_None )
             try {
                 func_Event_Killed( boost::ref(info) );
@@ -369,7 +369,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling Event_KilledOther( boost::python::ptr(pVictim), boost::ref(info) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Event_KilledOther = this->get_override( "Event_KilledOther" );
+        PY_OVERRIDE_LOOKUP( func_Event_KilledOther, "Event_KilledOther" );
         if( func_Event_KilledOther.ptr() != Py_None )
             try {
                 func_Event_KilledOther( boost::python::ptr(pVictim), boost::ref(info) );
@@ -399,7 +399,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling GetIMouse(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetIMouse = this->get_override( "GetIMouse" );
+        PY_OVERRIDE_LOOKUP( func_GetIMouse, "GetIMouse" );
         if( func_GetIMouse.ptr() != Py_None )
             try {
                 return func_GetIMouse(  );
@@ -429,7 +429,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTracerType(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTracerType = this->get_override( "GetTracerType" );
+        PY_OVERRIDE_LOOKUP( func_GetTracerType, "GetTracerType" );
         if( func_GetTracerType.ptr() != Py_None )
             try {
                 return func_GetTracerType(  );
@@ -459,7 +459,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling KeyValue( szKeyName, szValue ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_KeyValue = this->get_override( "KeyValue" );
+        PY_OVERRIDE_LOOKUP( func_KeyValue, "KeyValue" );
         if( func_KeyValue.ptr() != Py_None )
             try {
                 return func_KeyValue( szKeyName, szValue );
@@ -489,7 +489,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling KeyValue( szKeyName, flValue ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_KeyValue = this->get_override( "KeyValue" );
+        PY_OVERRIDE_LOOKUP( func_KeyValue, "KeyValue" );
         if( func_KeyValue.ptr() != Py_None )
             try {
                 return func_KeyValue( szKeyName, flValue );
@@ -519,7 +519,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling KeyValue( szKeyName, nValue ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_KeyValue = this->get_override( "KeyValue" );
+        PY_OVERRIDE_LOOKUP( func_KeyValue, "KeyValue" );
         if( func_KeyValue.ptr() != Py_None )
             try {
                 return func_KeyValue( szKeyName, nValue );
@@ -549,7 +549,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling KeyValue( szKeyName, boost::ref(vecValue) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_KeyValue = this->get_override( "KeyValue" );
+        PY_OVERRIDE_LOOKUP( func_KeyValue, "KeyValue" );
         if( func_KeyValue.ptr() != Py_None )
             try {
                 return func_KeyValue( szKeyName, boost::ref(vecValue) );
@@ -579,7 +579,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling MakeTracer( boost::ref(vecTracerSrc), boost::ref(tr), iTracerType ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_MakeTracer = this->get_override( "MakeTracer" );
+        PY_OVERRIDE_LOOKUP( func_MakeTracer, "MakeTracer" );
         if( func_MakeTracer.ptr() != Py_None )
             try {
                 func_MakeTracer( boost::ref(vecTracerSrc), boost::ref(tr), iTracerType );
@@ -609,7 +609,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling ModifyOrAppendCriteria( boost::ref(set) ) of Class: CBaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ModifyOrAppendCriteria = this->get_override( "ModifyOrAppendCriteria" );
+        PY_OVERRIDE_LOOKUP( func_ModifyOrAppendCriteria, "ModifyOrAppendCriteria" );
         if( func_ModifyOrAppendCriteria.ptr() != Py_None )
             try {
                 func_ModifyOrAppendCriteria( boost::ref(set) );
@@ -639,7 +639,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling OnChangeOwnerNumber( old_owner_number ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnChangeOwnerNumber = this->get_override( "OnChangeOwnerNumber" );
+        PY_OVERRIDE_LOOKUP( func_OnChangeOwnerNumber, "OnChangeOwnerNumber" );
         if( func_OnChangeOwnerNumber.ptr() != Py_None )
             try {
                 func_OnChangeOwnerNumber( old_owner_number );
@@ -669,7 +669,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling OnSequenceSet( nOldSequence ) of Class: CBaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnSequenceSet = this->get_override( "OnSequenceSet" );
+        PY_OVERRIDE_LOOKUP( func_OnSequenceSet, "OnSequenceSet" );
         if( func_OnSequenceSet.ptr() != Py_None )
             try {
                 func_OnSequenceSet( nOldSequence );
@@ -699,7 +699,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling OnTakeDamage( boost::ref(info) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnTakeDamage = this->get_override( "OnTakeDamage" );
+        PY_OVERRIDE_LOOKUP( func_OnTakeDamage, "OnTakeDamage" );
         if( func_OnTakeDamage.ptr() != Py_None )
             try {
                 return func_OnTakeDamage( boost::ref(info) );
@@ -729,7 +729,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling PassesDamageFilter( boost::ref(info) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PassesDamageFilter = this->get_override( "PassesDamageFilter" );
+        PY_OVERRIDE_LOOKUP( func_PassesDamageFilter, "PassesDamageFilter" );
         if( func_PassesDamageFilter.ptr() != Py_None )
             try {
                 return func_PassesDamageFilter( boost::ref(info) );
@@ -759,7 +759,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling PostClientActive(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PostClientActive = this->get_override( "PostClientActive" );
+        PY_OVERRIDE_LOOKUP( func_PostClientActive, "PostClientActive" );
         if( func_PostClientActive.ptr() != Py_None )
             try {
                 func_PostClientActive(  );
@@ -789,7 +789,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling PostConstructor( szClassname ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PostConstructor = this->get_override( "PostConstructor" );
+        PY_OVERRIDE_LOOKUP( func_PostConstructor, "PostConstructor" );
         if( func_PostConstructor.ptr() != Py_None )
             try {
                 func_PostConstructor( szClassname );
@@ -819,7 +819,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling Precache(  ) of Class: CBaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Precache = this->get_override( "Precache" );
+        PY_OVERRIDE_LOOKUP( func_Precache, "Precache" );
         if( func_Precache.ptr() != Py_None )
             try {
                 func_Precache(  );
@@ -836,7 +836,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
     }
 
     virtual void PyOnNewModel(  ){
-        bp::override func_OnNewModel = this->get_override( "OnNewModel" );
+        PY_OVERRIDE_LOOKUP( func_OnNewModel, "OnNewModel" );
         if( func_OnNewModel.ptr() != Py_None )
             try {
                 func_OnNewModel(  );
@@ -866,7 +866,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling Spawn(  ) of Class: CBaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Spawn = this->get_override( "Spawn" );
+        PY_OVERRIDE_LOOKUP( func_Spawn, "Spawn" );
         if( func_Spawn.ptr() != Py_None )
             try {
                 func_Spawn(  );
@@ -896,7 +896,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling StartTouch( boost::python::ptr(pOther) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_StartTouch = this->get_override( "StartTouch" );
+        PY_OVERRIDE_LOOKUP( func_StartTouch, "StartTouch" );
         if( func_StartTouch.ptr() != Py_None )
             try {
                 func_StartTouch( boost::python::ptr(pOther) );
@@ -926,7 +926,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling StopLoopingSounds(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_StopLoopingSounds = this->get_override( "StopLoopingSounds" );
+        PY_OVERRIDE_LOOKUP( func_StopLoopingSounds, "StopLoopingSounds" );
         if( func_StopLoopingSounds.ptr() != Py_None )
             try {
                 func_StopLoopingSounds(  );
@@ -960,7 +960,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling UpdateOnRemove(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_UpdateOnRemove = this->get_override( "UpdateOnRemove" );
+        PY_OVERRIDE_LOOKUP( func_UpdateOnRemove, "UpdateOnRemove" );
         if( func_UpdateOnRemove.ptr() != Py_None )
             try {
                 func_UpdateOnRemove(  );
@@ -990,7 +990,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling UpdateTransmitState(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_UpdateTransmitState = this->get_override( "UpdateTransmitState" );
+        PY_OVERRIDE_LOOKUP( func_UpdateTransmitState, "UpdateTransmitState" );
         if( func_UpdateTransmitState.ptr() != Py_None )
             try {
                 return func_UpdateTransmitState(  );
@@ -1020,7 +1020,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
         if( py_log_overrides.GetBool() )
             Msg("Calling VPhysicsCollision( index, boost::python::ptr(pEvent) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_VPhysicsCollision = this->get_override( "VPhysicsCollision" );
+        PY_OVERRIDE_LOOKUP( func_VPhysicsCollision, "VPhysicsCollision" );
         if( func_VPhysicsCollision.ptr() != Py_None )
             try {
                 func_VPhysicsCollision( index, boost::python::ptr(pEvent) );
@@ -1070,7 +1070,7 @@ struct CBaseAnimatingOverlay_wrapper : CBaseAnimatingOverlay, bp::wrapper< CBase
                 if( py_log_overrides.GetBool() )
                     Msg("Calling TestCollision( boost::ref(ray), mask, boost::ref(trace) ) of Class: CBaseAnimatingOverlay\n");
                 #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-                bp::override func_TestCollision = this->get_override( "TestCollision" );
+                PY_OVERRIDE_LOOKUP( func_TestCollision, "TestCollision" );
                 if( func_TestCollision.ptr() != Py_None )
                     try {
                         return func_TestCollision( PyRay_t(ray), mask, boost::ref(trace) );
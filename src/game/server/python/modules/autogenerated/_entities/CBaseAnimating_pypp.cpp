@@ -78,7 +78,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Activate(  ) of Class: CBaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Activate = this->get_override( "Activate" );
+        PY_OVERRIDE_LOOKUP( func_Activate, "Activate" );
         if( func_Activate.ptr() != Py_None )
             try {
                 func_Activate(  );
@@ -108,7 +108,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling CanBecomeRagdoll(  ) of Class: CBaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_CanBecomeRagdoll = this->get_override( "CanBecomeRagdoll" );
+        PY_OVERRIDE_LOOKUP( func_CanBecomeRagdoll, "CanBecomeRagdoll" );
         if( func_CanBecomeRagdoll.ptr() != Py_None )
             try {
                 return func_CanBecomeRagdoll(  );
@@ -138,7 +138,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling DrawDebugTextOverlays(  ) of Class: CBaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_DrawDebugTextOverlays = this->get_override( "DrawDebugTextOverlays" );
+        PY_OVERRIDE_LOOKUP( func_DrawDebugTextOverlays, "DrawDebugTextOverlays" );
         if( func_DrawDebugTextOverlays.ptr() != Py_None )
             try {
                 return func_DrawDebugTextOverlays(  );
@@ -196,7 +196,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling ModifyOrAppendCriteria( boost::ref(set) ) of Class: CBaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ModifyOrAppendCriteria = this->get_override( "ModifyOrAppendCriteria" );
+        PY_OVERRIDE_LOOKUP( func_ModifyOrAppendCriteria, "ModifyOrAppendCriteria" );
         if( func_ModifyOrAppendCriteria.ptr() != Py_None )
             try {
                 func_ModifyOrAppendCriteria( boost::ref(set) );
@@ -226,7 +226,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnSequenceSet( nOldSequence ) of Class: CBaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnSequenceSet = this->get_override( "OnSequenceSet" );
+        PY_OVERRIDE_LOOKUP( func_OnSequenceSet, "OnSequenceSet" );
         if( func_OnSequenceSet.ptr() != Py_None )
             try {
                 func_OnSequenceSet( nOldSequence );
@@ -256,7 +256,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Precache(  ) of Class: CBaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Precache = this->get_override( "Precache" );
+        PY_OVERRIDE_LOOKUP( func_Precache, "Precache" );
         if( func_Precache.ptr() != Py_None )
             try {
                 func_Precache(  );
@@ -273,7 +273,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
     }
 
     virtual void PyOnNewModel(  ){
-        bp::override func_OnNewModel = this->get_override( "OnNewModel" );
+        PY_OVERRIDE_LOOKUP( func_OnNewModel, "OnNewModel" );
         if( func_OnNewModel.ptr() != Py_None )
             try {
                 func_OnNewModel(  );
@@ -303,7 +303,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Spawn(  ) of Class: CBaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Spawn = this->get_override( "Spawn" );
+        PY_OVERRIDE_LOOKUP( func_Spawn, "Spawn" );
         if( func_Spawn.ptr() != Py_None )
             try {
                 func_Spawn(  );
@@ -333,7 +333,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling ComputeWorldSpaceSurroundingBox( boost::python::ptr(pWorldMins), boost::python::ptr(pWorldMaxs) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ComputeWorldSpaceSurroundingBox = this->get_override( "ComputeWorldSpaceSurroundingBox" );
+        PY_OVERRIDE_LOOKUP( func_ComputeWorldSpaceSurroundingBox, "ComputeWorldSpaceSurroundingBox" );
         if( func_ComputeWorldSpaceSurroundingBox.ptr() != Py_None )
             try {
                 func_ComputeWorldSpaceSurroundingBox( boost::python::ptr(pWorldMins), boost::python::ptr(pWorldMaxs) );
@@ -363,7 +363,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling CreateVPhysics(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_CreateVPhysics = this->get_override( "CreateVPhysics" );
+        PY_OVERRIDE_LOOKUP( func_CreateVPhysics, "CreateVPhysics" );
         if( func_CreateVPhysics.ptr() != Py_None )
             try {
                 return func_CreateVPhysics(  );
@@ -393,7 +393,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling DeathNotice( boost::python::ptr(pVictim) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_DeathNotice = this->get_override( "DeathNotice" );
+        PY_OVERRIDE_LOOKUP( func_DeathNotice, "DeathNotice" );
         if( func_DeathNotice.ptr() != Py_None )
             try {
                 func_DeathNotice( boost::python::ptr(pVictim) );
@@ -423,7 +423,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling DoImpactEffect( boost::ref(tr), nDamageType ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_DoImpactEffect = this->get_override( "DoImpactEffect" );
+        PY_OVERRIDE_LOOKUP( func_DoImpactEffect, "DoImpactEffect" );
         if( func_DoImpactEffect.ptr() != Py_None )
             try {
                 func_DoImpactEffect( boost::ref(tr), nDamageType );
@@ -453,7 +453,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling DrawDebugGeometryOverlays(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_DrawDebugGeometryOverlays = this->get_override( "DrawDebugGeometryOverlays" );
+        PY_OVERRIDE_LOOKUP( func_DrawDebugGeometryOverlays, "DrawDebugGeometryOverlays" );
         if( func_DrawDebugGeometryOverlays.ptr() != Py_None )
             try {
                 func_DrawDebugGeometryOverlays(  );
@@ -483,7 +483,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling EndTouch( boost::python::ptr(pOther) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_EndTouch = this->get_override( "EndTouch" );
+        PY_OVERRIDE_LOOKUP( func_EndTouch, "EndTouch" );
         if( func_EndTouch.ptr() != Py_None )
             try {
                 func_EndTouch( boost::python::ptr(pOther) );
@@ -513,7 +513,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Event_Killed( boost::ref(info) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Event_Killed = this->get_override( "Event_Killed" );
+        PY_OVERRIDE_LOOKUP( func_Event_Killed, "Event_Killed" );
         if( func_Event_Killed.ptr() != Py_None )
             try {
                 func_Event_Killed( boost::ref(info) );
@@ -543,7 +543,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Event_KilledOther( boost::python::ptr(pVictim), boost::ref(info) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Event_KilledOther = this->get_override( "Event_KilledOther" );
+        PY_OVERRIDE_LOOKUP( func_Event_KilledOther, "Event_KilledOther" );
         if( func_Event_KilledOther.ptr() != Py_None )
             try {
                 func_Event_KilledOther( boost::python::ptr(pVictim), boost::ref(info) );
@@ -573,7 +573,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetIMouse(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetIMouse = this->get_override( "GetIMouse" );
+        PY_OVERRIDE_LOOKUP( func_GetIMouse, "GetIMouse" );
         if( func_GetIMouse.ptr() != Py_None )
             try {
                 return func_GetIMouse(  );
@@ -603,7 +603,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTracerType(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTracerType = this->get_override( "GetTracerType" );
+        PY_OVERRIDE_LOOKUP( func_GetTracerType, "GetTracerType" );
         if( func_GetTracerType.ptr() != Py_None )
             try {
                 return func_GetTracerType(  );
@@ -633,7 +633,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling KeyValue( szKeyName, szValue ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_KeyValue = this->get_override( "KeyValue" );
+        PY_OVERRIDE_LOOKUP( func_KeyValue, "KeyValue" );
         if( func_KeyValue.ptr() != Py_None )
             try {
                 return func_KeyValue( szKeyName, szValue );
@@ -663,7 +663,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling KeyValue( szKeyName, flValue ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_KeyValue = this->get_override( "KeyValue" );
+        PY_OVERRIDE_LOOKUP( func_KeyValue, "KeyValue" );
         if( func_KeyValue.ptr() != Py_None )
             try {
                 return func_KeyValue( szKeyName, flValue );
@@ -693,7 +693,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling KeyValue( szKeyName, nValue ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_KeyValue = this->get_override( "KeyValue" );
+        PY_OVERRIDE_LOOKUP( func_KeyValue, "KeyValue" );
         if( func_KeyValue.ptr() != Py_None )
             try {
                 return func_KeyValue( szKeyName, nValue );
@@ -723,7 +723,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling KeyValue( szKeyName, boost::ref(vecValue) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_KeyValue = this->get_override( "KeyValue" );
+        PY_OVERRIDE_LOOKUP( func_KeyValue, "KeyValue" );
         if( func_KeyValue.ptr() != Py_None )
             try {
                 return func_KeyValue( szKeyName, boost::ref(vecValue) );
@@ -753,7 +753,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling MakeTracer( boost::ref(vecTracerSrc), boost::ref(tr), iTracerType ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_MakeTracer = this->get_override( "MakeTracer" );
+        PY_OVERRIDE_LOOKUP( func_MakeTracer, "MakeTracer" );
         if( func_MakeTracer.ptr() != Py_None )
             try {
                 func_MakeTracer( boost::ref(vecTracerSrc), boost::ref(tr), iTracerType );
@@ -783,7 +783,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnChangeOwnerNumber( old_owner_number ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnChangeOwnerNumber = this->get_override( "OnChangeOwnerNumber" );
+        PY_OVERRIDE_LOOKUP( func_OnChangeOwnerNumber, "OnChangeOwnerNumber" );
         if( func_OnChangeOwnerNumber.ptr() != Py_None )
             try {
                 func_OnChangeOwnerNumber( old_owner_number );
@@ -813,7 +813,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnTakeDamage( boost::ref(info) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnTakeDamage = this->get_override( "OnTakeDamage" );
+        PY_OVERRIDE_LOOKUP( func_OnTakeDamage, "OnTakeDamage" );
         if( func_OnTakeDamage.ptr() != Py_None )
             try {
                 return func_OnTakeDamage( boost::ref(info) );
@@ -843,7 +843,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling PassesDamageFilter( boost::ref(info) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PassesDamageFilter = this->get_override( "PassesDamageFilter" );
+        PY_OVERRIDE_LOOKUP( func_PassesDamageFilter, "PassesDamageFilter" );
         if( func_PassesDamageFilter.ptr() != Py_None )
             try {
                 return func_PassesDamageFilter( boost::ref(info) );
@@ -873,7 +873,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling PostClientActive(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PostClientActive = this->get_override( "PostClientActive" );
+        PY_OVERRIDE_LOOKUP( func_PostClientActive, "PostClientActive" );
         if( func_PostClientActive.ptr() != Py_None )
             try {
                 func_PostClientActive(  );
@@ -903,7 +903,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling PostConstructor( szClassname ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PostConstructor = this->get_override( "PostConstructor" );
+        PY_OVERRIDE_LOOKUP( func_PostConstructor, "PostConstructor" );
         if( func_PostConstructor.ptr() != Py_None )
             try {
                 func_PostConstructor( szClassname );
@@ -933,7 +933,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling StartTouch( boost::python::ptr(pOther) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_StartTouch = this->get_override( "StartTouch" );
+        PY_OVERRIDE_LOOKUP( func_StartTouch, "StartTouch" );
         if( func_StartTouch.ptr() != Py_None )
             try {
                 func_StartTouch( boost::python::ptr(pOther) );
@@ -963,7 +963,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling StopLoopingSounds(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_StopLoopingSounds = this->get_override( "StopLoopingSounds" );
+        PY_OVERRIDE_LOOKUP( func_StopLoopingSounds, "StopLoopingSounds" );
         if( func_StopLoopingSounds.ptr() != Py_None )
             try {
                 func_StopLoopingSounds(  );
@@ -997,7 +997,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling UpdateOnRemove(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_UpdateOnRemove = this->get_override( "UpdateOnRemove" );
+        PY_OVERRIDE_LOOKUP( func_UpdateOnRemove, "UpdateOnRemove" );
         if( func_UpdateOnRemove.ptr() != Py_None )
             try {
                 func_UpdateOnRemove(  );
@@ -1027,7 +1027,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling UpdateTransmitState(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_UpdateTransmitState = this->get_override( "UpdateTransmitState" );
+        PY_OVERRIDE_LOOKUP( func_UpdateTransmitState, "UpdateTransmitState" );
         if( func_UpdateTransmitState.ptr() != Py_None )
             try {
                 return func_UpdateTransmitState(  );
@@ -1057,7 +1057,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
         if( py_log_overrides.GetBool() )
             Msg("Calling VPhysicsCollision( index, boost::python::ptr(pEvent) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_VPhysicsCollision = this->get_override( "VPhysicsCollision" );
+        PY_OVERRIDE_LOOKUP( func_VPhysicsCollision, "VPhysicsCollision" );
         if( func_VPhysicsCollision.ptr() != Py_None )
             try {
                 func_VPhysicsCollision( index, boost::python::ptr(pEvent) );
@@ -1107,7 +1107,7 @@ struct CBaseAnimating_wrapper : CBaseAnimating, bp::wrapper< CBaseAnimating > {
                 if( py_log_overrides.GetBool() )
                     Msg("Calling TestCollision( boost::ref(ray), mask, boost::ref(trace) ) of Class: CBaseAnimating\n");
                 #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-                bp::override func_TestCollision = this->get_override( "TestCollision" );
+                PY_OVERRIDE_LOOKUP( func_TestCollision, "TestCollision" );
                 if( func_TestCollision.ptr() != Py_None )
                     try {
                         return func_TestCollision( PyRay_t(ray), mask, boost::ref(trace) );
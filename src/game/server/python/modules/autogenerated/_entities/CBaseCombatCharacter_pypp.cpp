@@ -76,7 +76,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling CorpseGib( boost::ref(info) ) of Class: CBaseCombatCharacter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_CorpseGib = this->get_override( "CorpseGib" );
+        PY_OVERRIDE_LOOKUP( func_CorpseGib, "CorpseGib" );
         if( func_CorpseGib.ptr() != Py_None )
             try {
                 return func_CorpseGib( boost::ref(info) );
@@ -106,7 +106,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling Event_Gibbed( boost::ref(info) ) of Class: CBaseCombatCharacter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Event_Gibbed = this->get_override( "Event_Gibbed" );
+        PY_OVERRIDE_LOOKUP( func_Event_Gibbed, "Event_Gibbed" );
         if( func_Event_Gibbed.ptr() != Py_None )
             try {
                 return func_Event_Gibbed( boost::ref(info) );
@@ -136,7 +136,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling Event_Killed( boost::ref(info) ) of Class: CBaseCombatCharacter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Event_Killed = this->get_override( "Event_Killed" );
+        PY_OVERRIDE_LOOKUP( func_Event_Killed, "Event_Killed" );
         if( func_Event_Killed.ptr() != Py_None )
             try {
                 func_Event_Killed( boost::ref(info) );
@@ -166,7 +166,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling OnTakeDamage( boost::ref(info) ) of Class: CBaseCombatCharacter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnTakeDamage = this->get_override( "OnTakeDamage" );
+        PY_OVERRIDE_LOOKUP( func_OnTakeDamage, "OnTakeDamage" );
         if( func_OnTakeDamage.ptr() != Py_None )
             try {
                 return func_OnTakeDamage( boost::ref(info) );
@@ -196,7 +196,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling OnTakeDamage_Alive( boost::ref(info) ) of Class: CBaseCombatCharacter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnTakeDamage_Alive = this->get_override( "OnTakeDamage_Alive" );
+        PY_OVERRIDE_LOOKUP( func_OnTakeDamage_Alive, "OnTakeDamage_Alive" );
         if( func_OnTakeDamage_Alive.ptr() != Py_None )
             try {
                 return func_OnTakeDamage_Alive( boost::ref(info) );
@@ -226,7 +226,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling Precache(  ) of Class: CBaseCombatCharacter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Precache = this->get_override( "Precache" );
+        PY_OVERRIDE_LOOKUP( func_Precache, "Precache" );
         if( func_Precache.ptr() != Py_None )
             try {
                 func_Precache(  );
@@ -256,7 +256,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldGib( boost::ref(info) ) of Class: CBaseCombatCharacter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldGib = this->get_override( "ShouldGib" );
+        PY_OVERRIDE_LOOKUP( func_ShouldGib, "ShouldGib" );
         if( func_ShouldGib.ptr() != Py_None )
             try {
                 return func_ShouldGib( boost::ref(info) );
@@ -286,7 +286,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling Spawn(  ) of Class: CBaseCombatCharacter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Spawn = this->get_override( "Spawn" );
+        PY_OVERRIDE_LOOKUP( func_Spawn, "Spawn" );
         if( func_Spawn.ptr() != Py_None )
             try {
                 func_Spawn(  );
@@ -316,7 +316,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling UpdateOnRemove(  ) of Class: CBaseCombatCharacter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_UpdateOnRemove = this->get_override( "UpdateOnRemove" );
+        PY_OVERRIDE_LOOKUP( func_UpdateOnRemove, "UpdateOnRemove" );
         if( func_UpdateOnRemove.ptr() != Py_None )
             try {
                 func_UpdateOnRemove(  );
@@ -346,7 +346,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling Weapon_Drop( boost::python::ptr(pWeapon), boost::python::ptr(pvecTarget), boost::python::ptr(pVelocity) ) of Class: CBaseCombatCharacter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Weapon_Drop = this->get_override( "Weapon_Drop" );
+        PY_OVERRIDE_LOOKUP( func_Weapon_Drop, "Weapon_Drop" );
         if( func_Weapon_Drop.ptr() != Py_None )
             try {
                 func_Weapon_Drop( boost::python::ptr(pWeapon), boost::python::ptr(pvecTarget), boost::python::ptr(pVelocity) );
@@ -376,7 +376,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling Weapon_Equip( boost::python::ptr(pWeapon) ) of Class: CBaseCombatCharacter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Weapon_Equip = this->get_override( "Weapon_Equip" );
+        PY_OVERRIDE_LOOKUP( func_Weapon_Equip, "Weapon_Equip" );
         if( func_Weapon_Equip.ptr() != Py_None )
             try {
                 func_Weapon_Equip( boost::python::ptr(pWeapon) );
@@ -406,7 +406,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling Weapon_Switch( boost::python::ptr(pWeapon), viewmodelindex ) of Class: CBaseCombatCharacter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Weapon_Switch = this->get_override( "Weapon_Switch" );
+        PY_OVERRIDE_LOOKUP( func_Weapon_Switch, "Weapon_Switch" );
         if( func_Weapon_Switch.ptr() != Py_None )
             try {
                 return func_Weapon_Switch( boost::python::ptr(pWeapon), viewmodelindex );
@@ -436,7 +436,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling Activate(  ) of Class: CBaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Activate = this->get_override( "Activate" );
+        PY_OVERRIDE_LOOKUP( func_Activate, "Activate" );
         if( func_Activate.ptr() != Py_None )
             try {
                 func_Activate(  );
@@ -466,7 +466,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling CanBecomeRagdoll(  ) of Class: CBaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_CanBecomeRagdoll = this->get_override( "CanBecomeRagdoll" );
+        PY_OVERRIDE_LOOKUP( func_CanBecomeRagdoll, "CanBecomeRagdoll" );
         if( func_CanBecomeRagdoll.ptr() != Py_None )
             try {
                 return func_CanBecomeRagdoll(  );
@@ -496,7 +496,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling ComputeWorldSpaceSurroundingBox( boost::python::ptr(pWorldMins), boost::python::ptr(pWorldMaxs) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ComputeWorldSpaceSurroundingBox = this->get_override( "ComputeWorldSpaceSurroundingBox" );
+        PY_OVERRIDE_LOOKUP( func_ComputeWorldSpaceSurroundingBox, "ComputeWorldSpaceSurroundingBox" );
         if( func_ComputeWorldSpaceSurroundingBox.ptr() != Py_None )
             try {
                 func_ComputeWorldSpaceSurroundingBox( boost::python::ptr(pWorldMins), boost::python::ptr(pWorldMaxs) );
@@ -526,7 +526,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling CreateVPhysics(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_CreateVPhysics = this->get_override( "CreateVPhysics" );
+        PY_OVERRIDE_LOOKUP( func_CreateVPhysics, "CreateVPhysics" );
         if( func_CreateVPhysics.ptr() != Py_None )
             try {
                 return func_CreateVPhysics(  );
@@ -556,7 +556,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling DeathNotice( boost::python::ptr(pVictim) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_DeathNotice = this->get_override( "DeathNotice" );
+        PY_OVERRIDE_LOOKUP( func_DeathNotice, "DeathNotice" );
         if( func_DeathNotice.ptr() != Py_None )
             try {
                 func_DeathNotice( boost::python::ptr(pVictim) );
@@ -586,7 +586,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling DoImpactEffect( boost::ref(tr), nDamageType ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_DoImpactEffect = this->get_override( "DoImpactEffect" );
+        PY_OVERRIDE_LOOKUP( func_DoImpactEffect, "DoImpactEffect" );
         if( func_DoImpactEffect.ptr() != Py_None )
             try {
                 func_DoImpactEffect( boost::ref(tr), nDamageType );
@@ -616,7 +616,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling DrawDebugGeometryOverlays(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_DrawDebugGeometryOverlays = this->get_override( "DrawDebugGeometryOverlays" );
+        PY_OVERRIDE_LOOKUP( func_DrawDebugGeometryOverlays, "DrawDebugGeometryOverlays" );
         if( func_DrawDebugGeometryOverlays.ptr() != Py_None )
             try {
                 func_DrawDebugGeometryOverlays(  );
@@ -646,7 +646,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling DrawDebugTextOverlays(  ) of Class: CBaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_DrawDebugTextOverlays = this->get_override( "DrawDebugTextOverlays" );
+        PY_OVERRIDE_LOOKUP( func_DrawDebugTextOverlays, "DrawDebugTextOverlays" );
         if( func_DrawDebugTextOverlays.ptr() != Py_None )
             try {
                 return func_DrawDebugTextOverlays(  );
@@ -676,7 +676,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling EndTouch( boost::python::ptr(pOther) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_EndTouch = this->get_override( "EndTouch" );
+        PY_OVERRIDE_LOOKUP( func_EndTouch, "EndTouch" );
         if( func_EndTouch.ptr() != Py_None )
             try {
                 func_EndTouch( boost::python::ptr(pOther) );
@@ -706,7 +706,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling Event_KilledOther( boost::python::ptr(pVictim), boost::ref(info) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Event_KilledOther = this->get_override( "Event_KilledOther" );
+        PY_OVERRIDE_LOOKUP( func_Event_KilledOther, "Event_KilledOther" );
         if( func_Event_KilledOther.ptr() != Py_None )
             try {
                 func_Event_KilledOther( boost::python::ptr(pVictim), boost::ref(info) );
@@ -736,7 +736,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling GetIMouse(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetIMouse = this->get_override( "GetIMouse" );
+        PY_OVERRIDE_LOOKUP( func_GetIMouse, "GetIMouse" );
         if( func_GetIMouse.ptr() != Py_None )
             try {
                 return func_GetIMouse(  );
@@ -766,7 +766,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTracerType(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTracerType = this->get_override( "GetTracerType" );
+        PY_OVERRIDE_LOOKUP( func_GetTracerType, "GetTracerType" );
         if( func_GetTracerType.ptr() != Py_None )
             try {
                 return func_GetTracerType(  );
@@ -796,7 +796,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling KeyValue( szKeyName, szValue ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_KeyValue = this->get_override( "KeyValue" );
+        PY_OVERRIDE_LOOKUP( func_KeyValue, "KeyValue" );
         if( func_KeyValue.ptr() != Py_None )
             try {
                 return func_KeyValue( szKeyName, szValue );
@@ -826,7 +826,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling KeyValue( szKeyName, flValue ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_KeyValue = this->get_override( "KeyValue" );
+        PY_OVERRIDE_LOOKUP( func_KeyValue, "KeyValue" );
         if( func_KeyValue.ptr() != Py_None )
             try {
                 return func_KeyValue( szKeyName, flValue );
@@ -856,7 +856,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling KeyValue( szKeyName, nValue ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_KeyValue = this->get_override( "KeyValue" );
+        PY_OVERRIDE_LOOKUP( func_KeyValue, "KeyValue" );
         if( func_KeyValue.ptr() != Py_None )
             try {
                 return func_KeyValue( szKeyName, nValue );
@@ -886,7 +886,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling KeyValue( szKeyName, boost::ref(vecValue) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_KeyValue = this->get_override( "KeyValue" );
+        PY_OVERRIDE_LOOKUP( func_KeyValue, "KeyValue" );
         if( func_KeyValue.ptr() != Py_None )
             try {
                 return func_KeyValue( szKeyName, boost::ref(vecValue) );
@@ -916,7 +916,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling MakeTracer( boost::ref(vecTracerSrc), boost::ref(tr), iTracerType ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_MakeTracer = this->get_override( "MakeTracer" );
+        PY_OVERRIDE_LOOKUP( func_MakeTracer, "MakeTracer" );
         if( func_MakeTracer.ptr() != Py_None )
             try {
                 func_MakeTracer( boost::ref(vecTracerSrc), boost::ref(tr), iTracerType );
@@ -946,7 +946,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling ModifyOrAppendCriteria( boost::ref(set) ) of Class: CBaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ModifyOrAppendCriteria = this->get_override( "ModifyOrAppendCriteria" );
+        PY_OVERRIDE_LOOKUP( func_ModifyOrAppendCriteria, "ModifyOrAppendCriteria" );
         if( func_ModifyOrAppendCriteria.ptr() != Py_None )
             try {
                 func_ModifyOrAppendCriteria( boost::ref(set) );
@@ -976,7 +976,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling OnChangeOwnerNumber( old_owner_number ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnChangeOwnerNumber = this->get_override( "OnChangeOwnerNumber" );
+        PY_OVERRIDE_LOOKUP( func_OnChangeOwnerNumber, "OnChangeOwnerNumber" );
         if( func_OnChangeOwnerNumber.ptr() != Py_None )
             try {
                 func_OnChangeOwnerNumber( old_owner_number );
@@ -1006,7 +1006,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling OnSequenceSet( nOldSequence ) of Class: CBaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnSequenceSet = this->get_override( "OnSequenceSet" );
+        PY_OVERRIDE_LOOKUP( func_OnSequenceSet, "OnSequenceSet" );
         if( func_OnSequenceSet.ptr() != Py_None )
             try {
                 func_OnSequenceSet( nOldSequence );
@@ -1036,7 +1036,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling PassesDamageFilter( boost::ref(info) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PassesDamageFilter = this->get_override( "PassesDamageFilter" );
+        PY_OVERRIDE_LOOKUP( func_PassesDamageFilter, "PassesDamageFilter" );
         if( func_PassesDamageFilter.ptr() != Py_None )
             try {
                 return func_PassesDamageFilter( boost::ref(info) );
@@ -1066,7 +1066,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling PostClientActive(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PostClientActive = this->get_override( "PostClientActive" );
+        PY_OVERRIDE_LOOKUP( func_PostClientActive, "PostClientActive" );
         if( func_PostClientActive.ptr() != Py_None )
             try {
                 func_PostClientActive(  );
@@ -1096,7 +1096,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling PostConstructor( szClassname ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PostConstructor = this->get_override( "PostConstructor" );
+        PY_OVERRIDE_LOOKUP( func_PostConstructor, "PostConstructor" );
         if( func_PostConstructor.ptr() != Py_None )
             try {
                 func_PostConstructor( szClassname );
@@ -1113,7 +1113,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
     }
 
     virtual void PyOnNewModel(  ){
-        bp::override func_OnNewModel = this->get_override( "OnNewModel" );
+        PY_OVERRIDE_LOOKUP( func_OnNewModel, "OnNewModel" );
         if( func_OnNewModel.ptr() != Py_None )
             try {
                 func_OnNewModel(  );
@@ -1143,7 +1143,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling StartTouch( boost::python::ptr(pOther) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_StartTouch = this->get_override( "StartTouch" );
+        PY_OVERRIDE_LOOKUP( func_StartTouch, "StartTouch" );
         if( func_StartTouch.ptr() != Py_None )
             try {
                 func_StartTouch( boost::python::ptr(pOther) );
@@ -1173,7 +1173,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling StopLoopingSounds(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_StopLoopingSounds = this->get_override( "StopLoopingSounds" );
+        PY_OVERRIDE_LOOKUP( func_StopLoopingSounds, "StopLoopingSounds" );
         if( func_StopLoopingSounds.ptr() != Py_None )
             try {
                 func_StopLoopingSounds(  );
@@ -1207,7 +1207,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling UpdateTransmitState(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_UpdateTransmitState = this->get_override( "UpdateTransmitState" );
+        PY_OVERRIDE_LOOKUP( func_UpdateTransmitState, "UpdateTransmitState" );
         if( func_UpdateTransmitState.ptr() != Py_None )
             try {
                 return func_UpdateTransmitState(  );
@@ -1237,7 +1237,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
         if( py_log_overrides.GetBool() )
             Msg("Calling VPhysicsCollision( index, boost::python::ptr(pEvent) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_VPhysicsCollision = this->get_override( "VPhysicsCollision" );
+        PY_OVERRIDE_LOOKUP( func_VPhysicsCollision, "VPhysicsCollision" );
         if( func_VPhysicsCollision.ptr() != Py_None )
             try {
                 func_VPhysicsCollision( index, boost::python::ptr(pEvent) );
@@ -1287,7 +1287,7 @@ struct CBaseCombatCharacter_wrapper : CBaseCombatCharacter, bp::wrapper< CBaseCo
                 if( py_log_overrides.GetBool() )
                     Msg("Calling TestCollision( boost::ref(ray), mask, boost::ref(trace) ) of Class: CBaseCombatCharacter\n");
                 #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-                bp::override func_TestCollision = this->get_override( "TestCollision" );
+                PY_OVERRIDE_LOOKUP( func_TestCollision, "TestCollision" );
                 if( func_TestCollision.ptr() != Py_None )
                     try {
                         return func_TestCollision( PyRay_t(ray), mask, boost::ref(trace) );
@@ -76,7 +76,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling CustomCanBeSeen( boost::python::ptr(pUnit) ) of Class: CUnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_CustomCanBeSeen = this->get_override( "CustomCanBeSeen" );
+        PY_OVERRIDE_LOOKUP( func_CustomCanBeSeen, "CustomCanBeSeen" );
         if( func_CustomCanBeSeen.ptr() != Py_None )
             try {
                 return func_CustomCanBeSeen( boost::python::ptr(pUnit) );
@@ -106,7 +106,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling DoImpactEffect( boost::ref(tr), nDamageType ) of Class: CUnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_DoImpactEffect = this->get_override( "DoImpactEffect" );
+        PY_OVERRIDE_LOOKUP( func_DoImpactEffect, "DoImpactEffect" );
         if( func_DoImpactEffect.ptr() != Py_None )
             try {
                 func_DoImpactEffect( boost::ref(tr), nDamageType );
@@ -136,7 +136,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetIMouse(  ) of Class: CUnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetIMouse = this->get_override( "GetIMouse" );
+        PY_OVERRIDE_LOOKUP( func_GetIMouse, "GetIMouse" );
         if( func_GetIMouse.ptr() != Py_None )
             try {
                 return func_GetIMouse(  );
@@ -166,7 +166,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTracerType(  ) of Class: CUnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTracerType = this->get_override( "GetTracerType" );
+        PY_OVERRIDE_LOOKUP( func_GetTracerType, "GetTracerType" );
         if( func_GetTracerType.ptr() != Py_None )
             try {
                 return func_GetTracerType(  );
@@ -196,7 +196,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling KeyValue( szKeyName, szValue ) of Class: CUnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_KeyValue = this->get_override( "KeyValue" );
+        PY_OVERRIDE_LOOKUP( func_KeyValue, "KeyValue" );
         if( func_KeyValue.ptr() != Py_None )
             try {
                 return func_KeyValue( szKeyName, szValue );
@@ -226,7 +226,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling MakeTracer( boost::ref(vecTracerSrc), boost::ref(tr), iTracerType ) of Class: CUnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_MakeTracer = this->get_override( "MakeTracer" );
+        PY_OVERRIDE_LOOKUP( func_MakeTracer, "MakeTracer" );
         if( func_MakeTracer.ptr() != Py_None )
             try {
                 func_MakeTracer( boost::ref(vecTracerSrc), boost::ref(tr), iTracerType );
@@ -256,7 +256,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnButtonsChanged( buttonsMask, buttonsChanged ) of Class: CUnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnButtonsChanged = this->get_override( "OnButtonsChanged" );
+        PY_OVERRIDE_LOOKUP( func_OnButtonsChanged, "OnButtonsChanged" );
         if( func_OnButtonsChanged.ptr() != Py_None )
             try {
                 func_OnButtonsChanged( buttonsMask, buttonsChanged );
@@ -286,7 +286,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnFullHealth(  ) of Class: CUnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnFullHealth = this->get_override( "OnFullHealth" );
+        PY_OVERRIDE_LOOKUP( func_OnFullHealth, "OnFullHealth" );
         if( func_OnFullHealth.ptr() != Py_None )
             try {
                 func_OnFullHealth(  );
@@ -316,7 +316,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnLostFullHealth(  ) of Class: CUnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnLostFullHealth = this->get_override( "OnLostFullHealth" );
+        PY_OVERRIDE_LOOKUP( func_OnLostFullHealth, "OnLostFullHealth" );
         if( func_OnLostFullHealth.ptr() != Py_None )
             try {
                 func_OnLostFullHealth(  );
@@ -346,7 +346,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnTakeDamage( boost::ref(info) ) of Class: CUnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnTakeDamage = this->get_override( "OnTakeDamage" );
+        PY_OVERRIDE_LOOKUP( func_OnTakeDamage, "OnTakeDamage" );
         if( func_OnTakeDamage.ptr() != Py_None )
             try {
                 return func_OnTakeDamage( boost::ref(info) );
@@ -376,7 +376,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnUnitTypeChanged( old_unit_type ) of Class: CUnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnUnitTypeChanged = this->get_override( "OnUnitTypeChanged" );
+        PY_OVERRIDE_LOOKUP( func_OnUnitTypeChanged, "OnUnitTypeChanged" );
         if( func_OnUnitTypeChanged.ptr() != Py_None )
             try {
                 func_OnUnitTypeChanged( old_unit_type );
@@ -406,7 +406,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling PassesDamageFilter( boost::ref(info) ) of Class: CUnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PassesDamageFilter = this->get_override( "PassesDamageFilter" );
+        PY_OVERRIDE_LOOKUP( func_PassesDamageFilter, "PassesDamageFilter" );
         if( func_PassesDamageFilter.ptr() != Py_None )
             try {
                 return func_PassesDamageFilter( boost::ref(info) );
@@ -436,7 +436,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling UpdateOnRemove(  ) of Class: CUnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_UpdateOnRemove = this->get_override( "UpdateOnRemove" );
+        PY_OVERRIDE_LOOKUP( func_UpdateOnRemove, "UpdateOnRemove" );
         if( func_UpdateOnRemove.ptr() != Py_None )
             try {
                 func_UpdateOnRemove(  );
@@ -466,7 +466,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling UserCmd( boost::python::ptr(pCmd) ) of Class: CUnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_UserCmd = this->get_override( "UserCmd" );
+        PY_OVERRIDE_LOOKUP( func_UserCmd, "UserCmd" );
         if( func_UserCmd.ptr() != Py_None )
             try {
                 func_UserCmd( boost::python::ptr(pCmd) );
@@ -496,7 +496,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Weapon_Equip( boost::python::ptr(pWeapon) ) of Class: CUnitBase\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Weapon_Equip = this->get_override( "Weapon_Equip" );
+        PY_OVERRIDE_LOOKUP( func_Weapon_Equip, "Weapon_Equip" );
         if( func_Weapon_Equip.ptr() != Py_None )
             try {
                 func_Weapon_Equip( boost::python::ptr(pWeapon) );
@@ -526,7 +526,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Activate(  ) of Class: CBaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Activate = this->get_override( "Activate" );
+        PY_OVERRIDE_LOOKUP( func_Activate, "Activate" );
         if( func_Activate.ptr() != Py_None )
             try {
                 func_Activate(  );
@@ -556,7 +556,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling CanBecomeRagdoll(  ) of Class: CBaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_CanBecomeRagdoll = this->get_override( "CanBecomeRagdoll" );
+        PY_OVERRIDE_LOOKUP( func_CanBecomeRagdoll, "CanBecomeRagdoll" );
         if( func_CanBecomeRagdoll.ptr() != Py_None )
             try {
                 return func_CanBecomeRagdoll(  );
@@ -586,7 +586,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling ComputeWorldSpaceSurroundingBox( boost::python::ptr(pWorldMins), boost::python::ptr(pWorldMaxs) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ComputeWorldSpaceSurroundingBox = this->get_override( "ComputeWorldSpaceSurroundingBox" );
+        PY_OVERRIDE_LOOKUP( func_ComputeWorldSpaceSurroundingBox, "ComputeWorldSpaceSurroundingBox" );
         if( func_ComputeWorldSpaceSurroundingBox.ptr() != Py_None )
             try {
                 func_ComputeWorldSpaceSurroundingBox( boost::python::ptr(pWorldMins), boost::python::ptr(pWorldMaxs) );
@@ -616,7 +616,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling CorpseGib( boost::ref(info) ) of Class: CBaseCombatCharacter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_CorpseGib = this->get_override( "CorpseGib" );
+        PY_OVERRIDE_LOOKUP( func_CorpseGib, "CorpseGib" );
         if( func_CorpseGib.ptr() != Py_None )
             try {
                 return func_CorpseGib( boost::ref(info) );
@@ -646,7 +646,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling CreateVPhysics(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_CreateVPhysics = this->get_override( "CreateVPhysics" );
+        PY_OVERRIDE_LOOKUP( func_CreateVPhysics, "CreateVPhysics" );
         if( func_CreateVPhysics.ptr() != Py_None )
             try {
                 return func_CreateVPhysics(  );
@@ -676,7 +676,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling DeathNotice( boost::python::ptr(pVictim) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_DeathNotice = this->get_override( "DeathNotice" );
+        PY_OVERRIDE_LOOKUP( func_DeathNotice, "DeathNotice" );
         if( func_DeathNotice.ptr() != Py_None )
             try {
                 func_DeathNotice( boost::python::ptr(pVictim) );
@@ -706,7 +706,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling DrawDebugGeometryOverlays(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_DrawDebugGeometryOverlays = this->get_override( "DrawDebugGeometryOverlays" );
+        PY_OVERRIDE_LOOKUP( func_DrawDebugGeometryOverlays, "DrawDebugGeometryOverlays" );
         if( func_DrawDebugGeometryOverlays.ptr() != Py_None )
             try {
                 func_DrawDebugGeometryOverlays(  );
@@ -736,7 +736,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling DrawDebugTextOverlays(  ) of Class: CBaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_DrawDebugTextOverlays = this->get_override( "DrawDebugTextOverlays" );
+        PY_OVERRIDE_LOOKUP( func_DrawDebugTextOverlays, "DrawDebugTextOverlays" );
         if( func_DrawDebugTextOverlays.ptr() != Py_None )
             try {
                 return func_DrawDebugTextOverlays(  );
@@ -766,7 +766,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling EndTouch( boost::python::ptr(pOther) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_EndTouch = this->get_override( "EndTouch" );
+        PY_OVERRIDE_LOOKUP( func_EndTouch, "EndTouch" );
         if( func_EndTouch.ptr() != Py_None )
             try {
                 func_EndTouch( boost::python::ptr(pOther) );
@@ -796,7 +796,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Event_Gibbed( boost::ref(info) ) of Class: CBaseCombatCharacter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Event_Gibbed = this->get_override( "Event_Gibbed" );
+        PY_OVERRIDE_LOOKUP( func_Event_Gibbed, "Event_Gibbed" );
         if( func_Event_Gibbed.ptr() != Py_None )
             try {
                 return func_Event_Gibbed( boost::ref(info) );
@@ -826,7 +826,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Event_Killed( boost::ref(info) ) of Class: CBaseCombatCharacter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Event_Killed = this->get_override( "Event_Killed" );
+        PY_OVERRIDE_LOOKUP( func_Event_Killed, "Event_Killed" );
         if( func_Event_Killed.ptr() != Py_None )
             try {
                 func_Event_Killed( boost::ref(info) );
@@ -856,7 +856,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Event_KilledOther( boost::python::ptr(pVictim), boost::ref(info) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Event_KilledOther = this->get_override( "Event_KilledOther" );
+        PY_OVERRIDE_LOOKUP( func_Event_KilledOther, "Event_KilledOther" );
         if( func_Event_KilledOther.ptr() != Py_None )
             try {
                 func_Event_KilledOther( boost::python::ptr(pVictim), boost::ref(info) );
@@ -886,7 +886,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling KeyValue( szKeyName, flValue ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_KeyValue = this->get_override( "KeyValue" );
+        PY_OVERRIDE_LOOKUP( func_KeyValue, "KeyValue" );
         if( func_KeyValue.ptr() != Py_None )
             try {
                 return func_KeyValue( szKeyName, flValue );
@@ -916,7 +916,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling KeyValue( szKeyName, nValue ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_KeyValue = this->get_override( "KeyValue" );
+        PY_OVERRIDE_LOOKUP( func_KeyValue, "KeyValue" );
         if( func_KeyValue.ptr() != Py_None )
             try {
                 return func_KeyValue( szKeyName, nValue );
@@ -946,7 +946,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling KeyValue( szKeyName, boost::ref(vecValue) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_KeyValue = this->get_override( "KeyValue" );
+        PY_OVERRIDE_LOOKUP( func_KeyValue, "KeyValue" );
         if( func_KeyValue.ptr() != Py_None )
             try {
                 return func_KeyValue( szKeyName, boost::ref(vecValue) );
@@ -976,7 +976,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling ModifyOrAppendCriteria( boost::ref(set) ) of Class: CBaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ModifyOrAppendCriteria = this->get_override( "ModifyOrAppendCriteria" );
+        PY_OVERRIDE_LOOKUP( func_ModifyOrAppendCriteria, "ModifyOrAppendCriteria" );
         if( func_ModifyOrAppendCriteria.ptr() != Py_None )
             try {
                 func_ModifyOrAppendCriteria( boost::ref(set) );
@@ -1006,7 +1006,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnChangeOwnerNumber( old_owner_number ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnChangeOwnerNumber = this->get_override( "OnChangeOwnerNumber" );
+        PY_OVERRIDE_LOOKUP( func_OnChangeOwnerNumber, "OnChangeOwnerNumber" );
         if( func_OnChangeOwnerNumber.ptr() != Py_None )
             try {
                 func_OnChangeOwnerNumber( old_owner_number );
@@ -1036,7 +1036,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnSequenceSet( nOldSequence ) of Class: CBaseAnimating\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnSequenceSet = this->get_override( "OnSequenceSet" );
+        PY_OVERRIDE_LOOKUP( func_OnSequenceSet, "OnSequenceSet" );
         if( func_OnSequenceSet.ptr() != Py_None )
             try {
                 func_OnSequenceSet( nOldSequence );
@@ -1066,7 +1066,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnTakeDamage_Alive( boost::ref(info) ) of Class: CBaseCombatCharacter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnTakeDamage_Alive = this->get_override( "OnTakeDamage_Alive" );
+        PY_OVERRIDE_LOOKUP( func_OnTakeDamage_Alive, "OnTakeDamage_Alive" );
         if( func_OnTakeDamage_Alive.ptr() != Py_None )
             try {
                 return func_OnTakeDamage_Alive( boost::ref(info) );
@@ -1096,7 +1096,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling PostClientActive(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PostClientActive = this->get_override( "PostClientActive" );
+        PY_OVERRIDE_LOOKUP( func_PostClientActive, "PostClientActive" );
         if( func_PostClientActive.ptr() != Py_None )
             try {
                 func_PostClientActive(  );
@@ -1126,7 +1126,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling PostConstructor( szClassname ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PostConstructor = this->get_override( "PostConstructor" );
+        PY_OVERRIDE_LOOKUP( func_PostConstructor, "PostConstructor" );
         if( func_PostConstructor.ptr() != Py_None )
             try {
                 func_PostConstructor( szClassname );
@@ -1156,7 +1156,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Precache(  ) of Class: CBaseCombatCharacter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Precache = this->get_override( "Precache" );
+        PY_OVERRIDE_LOOKUP( func_Precache, "Precache" );
         if( func_Precache.ptr() != Py_None )
             try {
                 func_Precache(  );
@@ -1173,7 +1173,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
     }
 
     virtual void PyOnNewModel(  ){
-        bp::override func_OnNewModel = this->get_override( "OnNewModel" );
+        PY_OVERRIDE_LOOKUP( func_OnNewModel, "OnNewModel" );
         if( func_OnNewModel.ptr() != Py_None )
             try {
                 func_OnNewModel(  );
@@ -1203,7 +1203,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldGib( boost::ref(info) ) of Class: CBaseCombatCharacter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldGib = this->get_override( "ShouldGib" );
+        PY_OVERRIDE_LOOKUP( func_ShouldGib, "ShouldGib" );
         if( func_ShouldGib.ptr() != Py_None )
             try {
                 return func_ShouldGib( boost::ref(info) );
@@ -1233,7 +1233,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Spawn(  ) of Class: CBaseCombatCharacter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Spawn = this->get_override( "Spawn" );
+        PY_OVERRIDE_LOOKUP( func_Spawn, "Spawn" );
         if( func_Spawn.ptr() != Py_None )
             try {
                 func_Spawn(  );
@@ -1263,7 +1263,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling StartTouch( boost::python::ptr(pOther) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_StartTouch = this->get_override( "StartTouch" );
+        PY_OVERRIDE_LOOKUP( func_StartTouch, "StartTouch" );
         if( func_StartTouch.ptr() != Py_None )
             try {
                 func_StartTouch( boost::python::ptr(pOther) );
@@ -1293,7 +1293,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling StopLoopingSounds(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_StopLoopingSounds = this->get_override( "StopLoopingSounds" );
+        PY_OVERRIDE_LOOKUP( func_StopLoopingSounds, "StopLoopingSounds" );
         if( func_StopLoopingSounds.ptr() != Py_None )
             try {
                 func_StopLoopingSounds(  );
@@ -1323,7 +1323,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling UpdateTransmitState(  ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_UpdateTransmitState = this->get_override( "UpdateTransmitState" );
+        PY_OVERRIDE_LOOKUP( func_UpdateTransmitState, "UpdateTransmitState" );
         if( func_UpdateTransmitState.ptr() != Py_None )
             try {
                 return func_UpdateTransmitState(  );
@@ -1353,7 +1353,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling VPhysicsCollision( index, boost::python::ptr(pEvent) ) of Class: CBaseEntity\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_VPhysicsCollision = this->get_override( "VPhysicsCollision" );
+        PY_OVERRIDE_LOOKUP( func_VPhysicsCollision, "VPhysicsCollision" );
         if( func_VPhysicsCollision.ptr() != Py_None )
             try {
                 func_VPhysicsCollision( index, boost::python::ptr(pEvent) );
@@ -1383,7 +1383,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Weapon_Drop( boost::python::ptr(pWeapon), boost::python::ptr(pvecTarget), boost::python::ptr(pVelocity) ) of Class: CBaseCombatCharacter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Weapon_Drop = this->get_override( "Weapon_Drop" );
+        PY_OVERRIDE_LOOKUP( func_Weapon_Drop, "Weapon_Drop" );
         if( func_Weapon_Drop.ptr() != Py_None )
             try {
                 func_Weapon_Drop( boost::python::ptr(pWeapon), boost::python::ptr(pvecTarget), boost::python::ptr(pVelocity) );
@@ -1413,7 +1413,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
         if( py_log_overrides.GetBool() )
             Msg("Calling Weapon_Switch( boost::python::ptr(pWeapon), viewmodelindex ) of Class: CBaseCombatCharacter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Weapon_Switch = this->get_override( "Weapon_Switch" );
+        PY_OVERRIDE_LOOKUP( func_Weapon_Switch, "Weapon_Switch" );
         if( func_Weapon_Switch.ptr() != Py_None )
             try {
                 return func_Weapon_Switch( boost::python::ptr(pWeapon), viewmodelindex );
@@ -1463,7 +1463,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
                 if( py_log_overrides.GetBool() )
                     Msg("Calling TestCollision( boost::ref(ray), mask, boost::ref(trace) ) of Class: CUnitBase\n");
                 #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-                bp::override func_TestCollision = this->get_override( "TestCollision" );
+                PY_OVERRIDE_LOOKUP( func_TestCollision, "TestCollision" );
                 if( func_TestCollision.ptr() != Py_None )
                     try {
                         return func_TestCollision( PyRay_t(ray), mask, boost::ref(trace) );
@@ -1480,7 +1480,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
             }
 
     virtual bool IsSelectableByPlayer( ::CHL2WarsPlayer * pPlayer, ::boost::python::object target_selection=boost::python::object() ) {
-        boost::python::override func_IsSelectableByPlayer = this->get_override( "IsSelectableByPlayer" );
+        PY_OVERRIDE_LOOKUP( func_IsSelectableByPlayer, "IsSelectableByPlayer" );
         if( func_IsSelectableByPlayer.ptr() != Py_None )
             try {
                 return func_IsSelectableByPlayer( pPlayer ? pPlayer->GetPyHandle() : bp::object(), target_selection );
@@ -1497,7 +1497,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
     }
 
     virtual void Select( ::CHL2WarsPlayer * pPlayer, bool bTriggerOnSel=true ) {
-        boost::python::override func_Select = this->get_override( "Select" );
+        PY_OVERRIDE_LOOKUP( func_Select, "Select" );
         if( func_Select.ptr() != Py_None )
             try {
                 func_Select( pPlayer ? pPlayer->GetPyHandle() : bp::object(), bTriggerOnSel );
@@ -1514,7 +1514,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
     }
 
     virtual void OnSelected( ::CHL2WarsPlayer * pPlayer ) {
-        boost::python::override func_OnSelected = this->get_override( "OnSelected" );
+        PY_OVERRIDE_LOOKUP( func_OnSelected, "OnSelected" );
         if( func_OnSelected.ptr() != Py_None )
             try {
                 func_OnSelected( pPlayer ? pPlayer->GetPyHandle() : bp::object() );
@@ -1531,7 +1531,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
     }
 
     virtual void OnDeSelected( ::CHL2WarsPlayer * pPlayer ) {
-        boost::python::override func_OnDeSelected = this->get_override( "OnDeSelected" );
+        PY_OVERRIDE_LOOKUP( func_OnDeSelected, "OnDeSelected" );
         if( func_OnDeSelected.ptr() != Py_None )
             try {
                 func_OnDeSelected( pPlayer ? pPlayer->GetPyHandle() : bp::object() );
@@ -1548,7 +1548,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
     }
 
     virtual void Order( ::CHL2WarsPlayer * pPlayer ) {
-        boost::python::override func_Order = this->get_override( "Order" );
+        PY_OVERRIDE_LOOKUP( func_Order, "Order" );
         if( func_Order.ptr() != Py_None )
             try {
                 func_Order( pPlayer ? pPlayer->GetPyHandle() : bp::object() );
@@ -1565,7 +1565,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
     }
 
     virtual void OnUserControl( ::CHL2WarsPlayer * pPlayer ) {
-        boost::python::override func_OnUserControl = this->get_override( "OnUserControl" );
+        PY_OVERRIDE_LOOKUP( func_OnUserControl, "OnUserControl" );
         if( func_OnUserControl.ptr() != Py_None )
             try {
                 func_OnUserControl( pPlayer ? pPlayer->GetPyHandle() : bp::object() );
@@ -1582,7 +1582,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
     }
 
     virtual void OnUserLeftControl( ::CHL2WarsPlayer * pPlayer ) {
-        boost::python::override func_OnUserLeftControl = this->get_override( "OnUserLeftControl" );
+        PY_OVERRIDE_LOOKUP( func_OnUserLeftControl, "OnUserLeftControl" );
         if( func_OnUserLeftControl.ptr() != Py_None )
             try {
                 func_OnUserLeftControl( pPlayer ? pPlayer->GetPyHandle() : bp::object() );
@@ -1599,7 +1599,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
     }
 
     virtual bool CanUserControl( ::CHL2WarsPlayer * pPlayer ) {
-        boost::python::override func_CanUserControl = this->get_override( "CanUserControl" );
+        PY_OVERRIDE_LOOKUP( func_CanUserControl, "CanUserControl" );
         if( func_CanUserControl.ptr() != Py_None )
             try {
                 return func_CanUserControl( pPlayer ? pPlayer->GetPyHandle() : bp::object() );
@@ -1616,7 +1616,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
     }
 
     virtual void OnClickLeftPressed( ::CHL2WarsPlayer * player ) {
-        boost::python::override func_OnClickLeftPressed = this->get_override( "OnClickLeftPressed" );
+        PY_OVERRIDE_LOOKUP( func_OnClickLeftPressed, "OnClickLeftPressed" );
         if( func_OnClickLeftPressed.ptr() != Py_None )
             try {
                 func_OnClickLeftPressed( player ? player->GetPyHandle() : bp::object() );
@@ -1633,7 +1633,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
     }
 
     virtual void OnClickRightPressed( ::CHL2WarsPlayer * player ) {
-        boost::python::override func_OnClickRightPressed = this->get_override( "OnClickRightPressed" );
+        PY_OVERRIDE_LOOKUP( func_OnClickRightPressed, "OnClickRightPressed" );
         if( func_OnClickRightPressed.ptr() != Py_None )
             try {
                 func_OnClickRightPressed( player ? player->GetPyHandle() : bp::object() );
@@ -1650,7 +1650,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
     }
 
     virtual void OnClickLeftReleased( ::CHL2WarsPlayer * player ) {
-        boost::python::override func_OnClickLeftReleased = this->get_override( "OnClickLeftReleased" );
+        PY_OVERRIDE_LOOKUP( func_OnClickLeftReleased, "OnClickLeftReleased" );
         if( func_OnClickLeftReleased.ptr() != Py_None )
             try {
                 func_OnClickLeftReleased( player ? player->GetPyHandle() : bp::object() );
@@ -1667,7 +1667,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
     }
 
     virtual void OnClickRightReleased( ::CHL2WarsPlayer * player ) {
-        boost::python::override func_OnClickRightReleased = this->get_override( "OnClickRightReleased" );
+        PY_OVERRIDE_LOOKUP( func_OnClickRightReleased, "OnClickRightReleased" );
         if( func_OnClickRightReleased.ptr() != Py_None )
             try {
                 func_OnClickRightReleased( player ? player->GetPyHandle() : bp::object() );
@@ -1684,7 +1684,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
     }
 
     virtual void OnClickLeftDoublePressed( ::CHL2WarsPlayer * player ) {
-        boost::python::override func_OnClickLeftDoublePressed = this->get_override( "OnClickLeftDoublePressed" );
+        PY_OVERRIDE_LOOKUP( func_OnClickLeftDoublePressed, "OnClickLeftDoublePressed" );
         if( func_OnClickLeftDoublePressed.ptr() != Py_None )
             try {
                 func_OnClickLeftDoublePressed( player ? player->GetPyHandle() : bp::object() );
@@ -1701,7 +1701,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
     }
 
     virtual void OnClickRightDoublePressed( ::CHL2WarsPlayer * player ) {
-        boost::python::override func_OnClickRightDoublePressed = this->get_override( "OnClickRightDoublePressed" );
+        PY_OVERRIDE_LOOKUP( func_OnClickRightDoublePressed, "OnClickRightDoublePressed" );
         if( func_OnClickRightDoublePressed.ptr() != Py_None )
             try {
                 func_OnClickRightDoublePressed( player ? player->GetPyHandle() : bp::object() );
@@ -1718,7 +1718,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
     }
 
     virtual void OnCursorEntered( ::CHL2WarsPlayer * player ) {
-        boost::python::override func_OnCursorEntered = this->get_override( "OnCursorEntered" );
+        PY_OVERRIDE_LOOKUP( func_OnCursorEntered, "OnCursorEntered" );
         if( func_OnCursorEntered.ptr() != Py_None )
             try {
                 func_OnCursorEntered( player ? player->GetPyHandle() : bp::object() );
@@ -1735,7 +1735,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
     }
 
     virtual void OnCursorExited( ::CHL2WarsPlayer * player ) {
-        boost::python::override func_OnCursorExited = this->get_override( "OnCursorExited" );
+        PY_OVERRIDE_LOOKUP( func_OnCursorExited, "OnCursorExited" );
         if( func_OnCursorExited.ptr() != Py_None )
             try {
                 func_OnCursorExited( player ? player->GetPyHandle() : bp::object() );
@@ -1752,7 +1752,7 @@ struct CUnitBase_wrapper : CUnitBase, bp::wrapper< CUnitBase > {
     }
 
     virtual float EnemyDistance( ::CBaseEntity * pEnemy, bool bConsiderSizeUnit=true ) {
-        boost::python::override func_EnemyDistance = this->get_override( "EnemyDistance" );
+        PY_OVERRIDE_LOOKUP( func_EnemyDistance, "EnemyDistance" );
         if( func_EnemyDistance.ptr() != Py_None )
             try {
                 return func_EnemyDistance( pEnemy ? pEnemy->GetPyHandle() : bp::object() );
@@ -1855,6 +1855,15 @@ void register_CUnitBase_class(){
                 , default_CustomCanBeSeen_function_type(&CUnitBase_wrapper::default_CustomCanBeSeen)
                 , ( bp::arg("pUnit")=bp::object() ) );
         
+        }
+        { //::CUnitBase::DisableBatchedTick
+        
+            typedef void ( ::CUnitBase::*DisableBatchedTick_function_type )(  ) ;
+            
+            CUnitBase_exposer.def( 
+                "DisableBatchedTick"
+                , DisableBatchedTick_function_type( &::CUnitBase::DisableBatchedTick ) );
+        
         }
         { //::CUnitBase::DoImpactEffect
         
@@ -2064,6 +2073,15 @@ void register_CUnitBase_class(){
                 , IRelationType_function_type( &::CUnitBase::IRelationType )
                 , ( bp::arg("pTarget") ) );
         
+        }
+        { //::CUnitBase::IsBatchedTickEnabled
+        
+            typedef bool ( ::CUnitBase::*IsBatchedTickEnabled_function_type )(  ) ;
+            
+            CUnitBase_exposer.def( 
+                "IsBatchedTickEnabled"
+                , IsBatchedTickEnabled_function_type( &::CUnitBase::IsBatchedTickEnabled ) );
+        
         }
         { //::CUnitBase::IsClimbing
         
@@ -2242,6 +2260,16 @@ void register_CUnitBase_class(){
                 , SetAnimEventMap_function_type( &::CUnitBase::SetAnimEventMap )
                 , ( bp::arg("animeventmap") ) );
         
+        }
+        { //::CUnitBase::SetBatchedTick
+        
+            typedef void ( ::CUnitBase::*SetBatchedTick_function_type )( ::boost::python::object,::boost::python::object,::boost::python::object,::boost::python::object,float,::boost::python::object ) ;
+            
+            CUnitBase_exposer.def( 
+                "SetBatchedTick"
+                , SetBatchedTick_function_type( &::CUnitBase::SetBatchedTick )
+                , ( bp::arg("movecommand"), bp::arg("locomotion"), bp::arg("senses"), bp::arg("animstate"), bp::arg("fTickInterval")=1.00000001490116119384765625e-1f, bp::arg("hook")=bp::object() ) );
+        
         }
         { //::CUnitBase::SetCanBeSeen
         
@@ -2745,6 +2745,7 @@ void CBaseEntity::AddFOWFlags( int flags )
 		}
 	}
 
+	FogOfWarMgr()->UpdateTransmitBits( this );
 	DispatchUpdateTransmitState();
 }
 
@@ -2779,6 +2780,7 @@ void CBaseEntity::RemoveFOWFlags( int flags )
 		}
 	}
 
+	FogOfWarMgr()->UpdateTransmitBits( this );
 	DispatchUpdateTransmitState();
 }
 
@@ -2813,6 +2815,7 @@ void CBaseEntity::RecalculateFOWFlags()
 		}
 	}
 
+	FogOfWarMgr()->UpdateTransmitBits( this );
 	DispatchUpdateTransmitState();
 }
 #endif // CLIENT_DLL
@@ -6,26 +6,16 @@
 //=============================================================================//
 #include "cbase.h"
 #include "density_weight_map.h"
+#include "mathlib/ssemath.h"
 
 // memdbgon must be the last include file in a .cpp file!!!
 #include "tier0/memdbgon.h"
 
-#define GRIDHSIZE 1.0f // 2.0f // Multiplied by sigma, defines the size of the computed density field
-#define MAP_TILE_SIZE 8.0f // 4.0f // Tilesize of the above grid
-
 #ifndef CLIENT_DLL
 void OnDensityConVarChanged( IConVar *var, const char *pOldValue, float flOldValue )
 {
-	CBaseEntity *pEnt = gEntList.FirstEnt();
-	while( pEnt )
-	{
-		const Vector& vMins = pEnt->CollisionProp()->OBBMins();
-		const Vector& vMaxs = pEnt->CollisionProp()->OBBMaxs();
-		pEnt->DensityMap()->RecalculateWeights(vMins, vMaxs);
-
-		//pEnt->DensityMap()->OnCollisionSizeChanged();
-		pEnt = gEntList.NextEnt( pEnt );
-	}
+	// Entities with the same density type and hull share their table, so only rebuild the unique tables
+	DensityWeightsMap::RebuildAllTables();
 }
 #endif // CLIENT_DLL
 
@@ -43,11 +33,96 @@ void OnDensityConVarChanged( IConVar *var, const char *pOldValue, float flOldVal
 	ConVar unit_density_eclipse_sigma_scale("unit_density_eclipse_sigma_scale", "0.3", FCVAR_REPLICATED, "Change sigma");
 #endif // CLIENT_DLL
 
+//-----------------------------------------------------------------------------
+// Shared weight tables
+//-----------------------------------------------------------------------------
+static CUtlVector< DensityWeightsTable_t * > s_DensityWeightsTables;
+
+//-----------------------------------------------------------------------------
+// Purpose: Returns a table for the type and hull, with a reference added.
+//-----------------------------------------------------------------------------
+static DensityWeightsTable_t *AcquireDensityWeightsTable( int iType, float fRadius, const Vector &vMins, const Vector &vMaxs )
+{
+	// Only the key of the type matters
+	if( iType != DENSITY_GAUSSIAN )
+		fRadius = 0.0f;
+	Vector2D vMins2D = iType == DENSITY_GAUSSIANECLIPSE ? vMins.AsVector2D() : vec2_origin;
+	Vector2D vMaxs2D = iType == DENSITY_GAUSSIANECLIPSE ? vMaxs.AsVector2D() : vec2_origin;
+
+	DensityWeightsTable_t *pTable;
+	for( int i = 0; i < s_DensityWeightsTables.Count(); i++ )
+	{
+		pTable = s_DensityWeightsTables[i];
+		if( pTable->m_iType == iType && pTable->m_fRadius == fRadius && 
+			pTable->m_vMins == vMins2D && pTable->m_vMaxs == vMaxs2D )
+		{
+			pTable->m_iRefCount++;
+			return pTable;
+		}
+	}
+
+	pTable = new DensityWeightsTable_t;
+	pTable->m_iType = iType;
+	pTable->m_fRadius = fRadius;
+	pTable->m_vMins = vMins2D;
+	pTable->m_vMaxs = vMaxs2D;
+	pTable->m_iRefCount = 1;
+	pTable->m_pWeights = NULL;
+	pTable->Fill();
+	s_DensityWeightsTables.AddToTail( pTable );
+	return pTable;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+static void ReleaseDensityWeightsTable( DensityWeightsTable_t *pTable )
+{
+	pTable->m_iRefCount--;
+	if( pTable->m_iRefCount > 0 )
+		return;
+
+	s_DensityWeightsTables.FindAndFastRemove( pTable );
+	pTable->Free();
+	delete pTable;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void DensityWeightsMap::RebuildAllTables()
+{
+	for( int i = 0; i < s_DensityWeightsTables.Count(); i++ )
+		s_DensityWeightsTables[i]->Fill();
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+int DensityWeightsMap::GetTableCount()
+{
+	return s_DensityWeightsTables.Count();
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+int DensityWeightsMap::GetTableMemoryUsage()
+{
+	int iMemory = 0;
+	for( int i = 0; i < s_DensityWeightsTables.Count(); i++ )
+	{
+		const DensityWeightsTable_t *pTable = s_DensityWeightsTables[i];
+		iMemory += sizeof( DensityWeightsTable_t ) + pTable->m_iSizeX * pTable->m_iSizeY * sizeof( float );
+	}
+	return iMemory;
+}
+
 //-----------------------------------------------------------------------------
 // Purpose: 
 //-----------------------------------------------------------------------------
 DensityWeightsMap::DensityWeightsMap() 
-		: m_pOuter(NULL), m_pWeights(NULL), m_iSizeX(0), m_iSizeY(0), m_iType(DENSITY_NONE)
+		: m_pOuter(NULL), m_pTable(NULL), m_iType(DENSITY_NONE)
 {
 	m_vMins = vec3_origin;
 	m_vMaxs = vec3_origin;
@@ -74,14 +149,10 @@ void DensityWeightsMap::Init( CBaseEntity *pOuter )
 //-----------------------------------------------------------------------------
 void DensityWeightsMap::Destroy()
 {
-	int i;
-	if( m_pWeights )
+	if( m_pTable )
 	{
-		for(i=0; i<m_iSizeX; i++)
-			free(m_pWeights[i]);
-		free(m_pWeights);
-		m_pWeights = NULL;
-		m_iSizeX = m_iSizeY = 0;
+		ReleaseDensityWeightsTable( m_pTable );
+		m_pTable = NULL;
 	}
 }
 
@@ -110,73 +181,75 @@ void DensityWeightsMap::OnCollisionSizeChanged()
 //-----------------------------------------------------------------------------
 // Purpose: 
 //-----------------------------------------------------------------------------
-#define USELERP
 float DensityWeightsMap::Get( const Vector &vPos )
 {
-	Vector vTranslated;
-	
+	// No table for DENSITY_NONE or zero sized entities
+	if( !m_pTable )
+		return 0.0f;
 
-#ifdef USELERP
-	float x, y;
-	int xlow, xhigh, ylow, yhigh;
-	switch( m_iType )
-	{
-	case DENSITY_NONE:
-		{
-			return 0.0f;
-		}
-		break;
-	case DENSITY_GAUSSIAN:
-	default:
-		{
-			x =  ((vPos.x - m_pOuter->GetAbsOrigin().x)/MAP_TILE_SIZE) + m_iHalfSizeX;
-			y =  ((vPos.y - m_pOuter->GetAbsOrigin().y)/MAP_TILE_SIZE) + m_iHalfSizeY;
-		}
-		break;
-	};
+	const Vector &vOrigin = m_pOuter->GetAbsOrigin();
+	return m_pTable->Lookup( vPos.x - vOrigin.x, vPos.y - vOrigin.y );
+}
 
-	xlow = floor(x);
-	xhigh = ceil(x);
-	ylow = floor(y);
-	yhigh = ceil(y);
+//-----------------------------------------------------------------------------
+// Purpose: Densities at multiple positions, four positions per SSE operation.
+//			iCount must be a multiple of four. Same results as Get.
+//-----------------------------------------------------------------------------
+void DensityWeightsMap::GetMultiple( const float *pPosX, const float *pPosY, float *pDensities, int iCount )
+{
+	Assert( ( iCount % 4 ) == 0 );
 
-	if( xlow < 0 || ylow < 0 || xhigh >= m_iSizeX || yhigh >= m_iSizeY )
-		return 0.0f;
+	if( !m_pTable )
+	{
+		memset( pDensities, 0, iCount * sizeof(float) );
+		return;
+	}
 
-	return Lerp<float>(sqrt(pow(x - xlow, 2) + pow(y - ylow, 2)), m_pWeights[xlow][ylow], m_pWeights[xhigh][yhigh]);
-#else
-	// Read out density for the given position
-	// If outside our field, return zero (too far away).
-	int x, y;
-	switch( m_iType )
+	const DensityWeightsTable_t *pTable = m_pTable;
+	const Vector &vOrigin = m_pOuter->GetAbsOrigin();
+	const fltx4 fl4InvTileSize = ReplicateX4( 1.0f / MAP_TILE_SIZE );
+	const fltx4 fl4OriginX = ReplicateX4( vOrigin.x );
+	const fltx4 fl4OriginY = ReplicateX4( vOrigin.y );
+	const fltx4 fl4HalfSizeX = ReplicateX4( (float)pTable->m_iHalfSizeX );
+	const fltx4 fl4HalfSizeY = ReplicateX4( (float)pTable->m_iHalfSizeY );
+
+	fltx4 fl4X, fl4Y, fl4XLow, fl4YLow, fl4Low, fl4High, fl4FracX, fl4FracY;
+	int i, j, xlow, ylow, xhigh, yhigh;
+	for( i = 0; i < iCount; i += 4 )
 	{
-	case DENSITY_NONE:
-		{
-			return 0.0f;
-		}
-		break;
-	case DENSITY_GAUSSIANECLIPSE:
-		{
-			vTranslated = vPos - m_pOuter->GetAbsOrigin();
-			VectorYawRotate(vTranslated, -m_pOuter->GetAbsAngles()[YAW], vTranslated);
-			x =  (int)floor(((vTranslated.x + m_fXOffset)/unit_density_eclipse_tile_res.GetFloat()) + m_iHalfSizeX + 0.5f);
-			y =  (int)floor(((vTranslated.y + m_fYOffset)/unit_density_eclipse_tile_res.GetFloat()) + m_iHalfSizeY + 0.5f);	
-		}
-		break;
-	case DENSITY_GAUSSIAN:
-	default:
+		// Tile space positions
+		fl4X = AddSIMD( MulSIMD( SubSIMD( LoadUnalignedSIMD( pPosX + i ), fl4OriginX ), fl4InvTileSize ), fl4HalfSizeX );
+		fl4Y = AddSIMD( MulSIMD( SubSIMD( LoadUnalignedSIMD( pPosY + i ), fl4OriginY ), fl4InvTileSize ), fl4HalfSizeY );
+
+		// Gather the weights of the tiles at or below and at or above the positions.
+		// Positions outside the table get zero weights, so they result in a zero density.
+		fl4Low = fl4High = fl4XLow = fl4YLow = Four_Zeros;
+		for( j = 0; j < 4; j++ )
 		{
-			x =  (int)floor(((vPos.x - m_pOuter->GetAbsOrigin().x)/MAP_TILE_SIZE) + m_iHalfSizeX + 0.5f);
-			y =  (int)floor(((vPos.y - m_pOuter->GetAbsOrigin().y)/MAP_TILE_SIZE) + m_iHalfSizeY + 0.5f);
+			float x = SubFloat( fl4X, j );
+			float y = SubFloat( fl4Y, j );
+			if( x < 0.0f || y < 0.0f )
+				continue;
+
+			xlow = (int)x;
+			ylow = (int)y;
+			xhigh = xlow + ( x != xlow );
+			yhigh = ylow + ( y != ylow );
+			if( xhigh >= pTable->m_iSizeX || yhigh >= pTable->m_iSizeY )
+				continue;
+
+			SubFloat( fl4XLow, j ) = xlow;
+			SubFloat( fl4YLow, j ) = ylow;
+			SubFloat( fl4Low, j ) = pTable->m_pWeights[xlow * pTable->m_iSizeY + ylow];
+			SubFloat( fl4High, j ) = pTable->m_pWeights[xhigh * pTable->m_iSizeY + yhigh];
 		}
-		break;
-	}
 
-	if( x < 0 || y < 0 || x >= m_iSizeX || y >= m_iSizeY )
-		return 0.0f;
-
-	return m_pWeights[x][y];
-#endif // USELERP
+		// Interpolate on the distance to the tile at or below
+		fl4FracX = SubSIMD( fl4X, fl4XLow );
+		fl4FracY = SubSIMD( fl4Y, fl4YLow );
+		fltx4 fl4T = SqrtSIMD( AddSIMD( MulSIMD( fl4FracX, fl4FracX ), MulSIMD( fl4FracY, fl4FracY ) ) );
+		StoreUnalignedSIMD( pDensities + i, AddSIMD( fl4Low, MulSIMD( SubSIMD( fl4High, fl4Low ), fl4T ) ) );
+	}
 }
 
 //-----------------------------------------------------------------------------
@@ -188,18 +261,36 @@ void DensityWeightsMap::RecalculateWeights( const Vector &vMins, const Vector &v
 	m_vMins = vMins;
 	m_vMaxs = vMaxs;
 
-	// Clear old map
+	// Release old table
 	Destroy();
 
+	if( m_iType != DENSITY_GAUSSIAN && m_iType != DENSITY_GAUSSIANECLIPSE )
+	{
+		if( m_iType != DENSITY_NONE )
+		{
+			Assert(0);
+			Warning("DensityWeightsMap: Unknown density type!\n");
+		}
+		return;
+	}
+
 	// Don't allow to generate if size is zero
-	if( m_pOuter->CollisionProp()->BoundingRadius2D() == 0 )
+	float fRadius = m_pOuter->CollisionProp()->BoundingRadius2D();
+	if( fRadius == 0 )
 		return;
 
-	// Fill
+	m_pTable = AcquireDensityWeightsTable( m_iType, fRadius, vMins, vMaxs );
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void DensityWeightsTable_t::Fill()
+{
+	Free();
+
 	switch( m_iType )
 	{
-	case DENSITY_NONE:
-		break;
 	case DENSITY_GAUSSIAN:
 		FillGaussian();
 		break;
@@ -208,7 +299,6 @@ void DensityWeightsMap::RecalculateWeights( const Vector &vMins, const Vector &v
 		break;
 	default:
 		Assert(0);
-		Warning("DensityWeightsMap: Unknown density type!\n");
 		break;
 	}
 }
@@ -216,27 +306,36 @@ void DensityWeightsMap::RecalculateWeights( const Vector &vMins, const Vector &v
 //-----------------------------------------------------------------------------
 // Purpose: 
 //-----------------------------------------------------------------------------
-void DensityWeightsMap::FillGaussian()
+void DensityWeightsTable_t::Free()
+{
+	if( m_pWeights )
+	{
+		free( m_pWeights );
+		m_pWeights = NULL;
+	}
+	m_iSizeX = m_iSizeY = 0;
+	m_iHalfSizeX = m_iHalfSizeY = 0;
+	m_fXOffset = m_fYOffset = 0.0f;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void DensityWeightsTable_t::FillGaussian()
 {
 	int i, j;
 	float x, y;
 
 	// Calculate sigma and grid size
-	float fSigma = m_pOuter->CollisionProp()->BoundingRadius2D()*0.6f;
+	float fSigma = m_fRadius*0.6f;
 	m_iHalfSizeX = m_iHalfSizeY = int(fSigma*GRIDHSIZE);
 	m_iSizeX = m_iSizeY = m_iHalfSizeX*2+1;
+	m_fTileRes = MAP_TILE_SIZE;
 
 	Assert( m_iSizeX > 0 && m_iSizeY > 0 && m_iSizeX < MAX_COORD_INTEGER && m_iSizeY < MAX_COORD_INTEGER );
 
-	//Msg("Mins: %f %f %f, Maxs: %f %f %f\n", m_vMins.x, m_vMins.y, m_vMins.z, m_vMaxs.x, m_vMaxs.y, m_vMaxs.z);
-	//Msg("%s Radius: %f, Sigma: %f, halfsize: %d %d, size: %d %d\n", m_pOuter->GetClassname(), m_pOuter->CollisionProp()->BoundingRadius2D(), fSigma, m_iHalfSizeX, m_iHalfSizeY, m_iSizeX, m_iSizeY);
-
 	// Allocate the grid
-	m_pWeights = (float **)malloc(m_iSizeX*sizeof(float*));
-	for(i=0; i<m_iSizeX; i++)
-	{
-		m_pWeights[i] = (float *)malloc(m_iSizeY*sizeof(float));
-	}
+	m_pWeights = (float *)malloc(m_iSizeX*m_iSizeY*sizeof(float));
 
 	// Calculate the weights
 	for(i=0; i<m_iSizeX; i++)
@@ -245,7 +344,7 @@ void DensityWeightsMap::FillGaussian()
 		{
 			x = (i-m_iHalfSizeX)*MAP_TILE_SIZE;
 			y = (j-m_iHalfSizeY)*MAP_TILE_SIZE;
-			m_pWeights[i][j] = exp( -(((x*x) + (y*y))/(2.0f*(fSigma*fSigma))) );
+			m_pWeights[i*m_iSizeY + j] = exp( -(((x*x) + (y*y))/(2.0f*(fSigma*fSigma))) );
 		}
 	}
 }
@@ -263,7 +362,7 @@ float gaussian2d_ellipse(float x, float y, float theta, float sigmax, float sigm
 //-----------------------------------------------------------------------------
 // Purpose: 
 //-----------------------------------------------------------------------------
-void DensityWeightsMap::FillGaussianEclipse()
+void DensityWeightsTable_t::FillGaussianEclipse()
 {
 	int i, j;
 	float x, y;
@@ -283,35 +382,29 @@ void DensityWeightsMap::FillGaussianEclipse()
 	sigmay = yhsize*unit_density_eclipse_sigma_scale.GetFloat();//0.37f;
 
 	// Allocate
-	float fMultiple = 32.0/unit_density_eclipse_tile_res.GetFloat();
+	m_fTileRes = unit_density_eclipse_tile_res.GetFloat();
+	float fMultiple = 32.0/m_fTileRes;
 	m_iHalfSizeX = (int)(xhsize*fMultiple);
 	m_iHalfSizeY = (int)(yhsize*fMultiple);
 	m_iSizeX = m_iHalfSizeX*2+1;
 	m_iSizeY = m_iHalfSizeY*2+1;
 
-	//Msg("Mins: %f %f %f, Maxs: %f %f %f\n", m_vMins.x, m_vMins.y, m_vMins.z, m_vMaxs.x, m_vMaxs.y, m_vMaxs.z);
-	//Msg("halfsize: %d %d, size: %d %d. Sigmax: %f, Sigmay: %f, xoffset: %f, yoffset: %f\n", m_iHalfSizeX, m_iHalfSizeY, m_iSizeX, m_iSizeY, sigmax, sigmay, xoffset, yoffset);
-
-	m_pWeights = (float **)malloc(m_iSizeX*sizeof(float*));
-	for(i=0; i<m_iSizeX; i++)
-	{
-		m_pWeights[i] = (float *)malloc(m_iSizeY*sizeof(float));
-	}
+	m_pWeights = (float *)malloc(m_iSizeX*m_iSizeY*sizeof(float));
 
 	// Fill
 	for(i=0; i<m_iSizeX; i++)
 	{
 		for(j=0; j<m_iSizeY; j++)
 		{
-			x = (i-m_iHalfSizeX)*unit_density_eclipse_tile_res.GetFloat() - xoffset;
-			y = (j-m_iHalfSizeY)*unit_density_eclipse_tile_res.GetFloat() - yoffset;
+			x = (i-m_iHalfSizeX)*m_fTileRes - xoffset;
+			y = (j-m_iHalfSizeY)*m_fTileRes - yoffset;
 
 			#define BLOAT -2.0f
 			if( x-BLOAT > m_vMins.x && x+BLOAT < m_vMaxs.x && y-BLOAT > m_vMins.y && y+BLOAT < m_vMaxs.y )
-				m_pWeights[i][j]= 1.0f - (fabs(x)/(xhsize*unit_density_eclipse_inside_scale.GetFloat())) - 
+				m_pWeights[i*m_iSizeY + j]= 1.0f - (fabs(x)/(xhsize*unit_density_eclipse_inside_scale.GetFloat())) - 
 				(fabs(y)/(yhsize*unit_density_eclipse_inside_scale.GetFloat()));
 			else
-				m_pWeights[i][j] = gaussian2d_ellipse(x, y, 0, sigmax, sigmay);
+				m_pWeights[i*m_iSizeY + j] = gaussian2d_ellipse(x, y, 0, sigmax, sigmay);
 		}
 	}
 }
@@ -328,12 +421,15 @@ void DensityWeightsMap::DebugPrintWeights()
 	if( vMins != m_vMins || vMaxs != m_vMaxs )
 		RecalculateWeights(vMins, vMaxs);
 
+	if( !m_pTable )
+		return;
+
 	int i, j;
-	for(i=0; i<m_iSizeX; i++)
+	for(i=0; i<m_pTable->m_iSizeX; i++)
 	{
-		for(j=0; j<m_iSizeY; j++)
+		for(j=0; j<m_pTable->m_iSizeY; j++)
 		{
-			Msg("%f\t", m_pWeights[i][j]);
+			Msg("%f\t", m_pTable->m_pWeights[i*m_pTable->m_iSizeY + j]);
 		}
 		Msg("\n");
 	}
@@ -350,4 +446,116 @@ CON_COMMAND( density_weights_test, "" )
 	map.Init(pUnit);
 	map.DebugPrintWeights();
 }
-*/
\ No newline at end of file
+*/
+
+#ifndef CLIENT_DLL
+//-----------------------------------------------------------------------------
+// Purpose: Benchmark of density lookups and memory usage on synthetic units, 
+//			comparing a table per unit against the shared tables.
+//-----------------------------------------------------------------------------
+static float LegacyDensityLookup( float **pWeights, int iSizeX, int iSizeY, int iHalfSizeX, int iHalfSizeY, float fDeltaX, float fDeltaY )
+{
+	float x = (fDeltaX/MAP_TILE_SIZE) + iHalfSizeX;
+	float y = (fDeltaY/MAP_TILE_SIZE) + iHalfSizeY;
+	int xlow = floor(x);
+	int xhigh = ceil(x);
+	int ylow = floor(y);
+	int yhigh = ceil(y);
+	if( xlow < 0 || ylow < 0 || xhigh >= iSizeX || yhigh >= iSizeY )
+		return 0.0f;
+	return Lerp<float>(sqrt(pow(x - xlow, 2) + pow(y - ylow, 2)), pWeights[xlow][ylow], pWeights[xhigh][yhigh]);
+}
+
+CON_COMMAND_F( unit_density_benchmark, "Measures density lookups and memory usage of the density weights for synthetic units, a table per unit versus shared tables.\n\tArguments: [units] [lookups per unit]", FCVAR_CHEAT )
+{
+	if ( !UTIL_IsCommandIssuedByServerAdmin() )
+		return;
+
+	int nUnits = args.ArgC() > 1 ? atoi( args[1] ) : 1000;
+	int nLookups = args.ArgC() > 2 ? atoi( args[2] ) : 1000;
+	nUnits = clamp( nUnits, 1, 65536 );
+	nLookups = MAX( nLookups, 1 );
+
+	// A few unit types, each with their own hull
+	static const float s_fRadii[] = { 13.0f, 18.0f, 24.0f, 32.0f, 48.0f, 72.0f };
+	const int nTypes = ARRAYSIZE( s_fRadii );
+
+	int i, j, x, y;
+
+	// A table per unit, allocated per row
+	int iLegacyMemory = 0;
+	CUtlVector< DensityWeightsTable_t > legacyParams;
+	CUtlVector< float ** > legacyWeights;
+	legacyParams.SetCount( nUnits );
+	legacyWeights.SetCount( nUnits );
+	for( i = 0; i < nUnits; i++ )
+	{
+		DensityWeightsTable_t &params = legacyParams[i];
+		params.m_iType = DENSITY_GAUSSIAN;
+		params.m_fRadius = s_fRadii[i % nTypes];
+		params.m_pWeights = NULL;
+		params.Fill();
+
+		legacyWeights[i] = (float **)malloc( params.m_iSizeX * sizeof(float *) );
+		for( x = 0; x < params.m_iSizeX; x++ )
+		{
+			legacyWeights[i][x] = (float *)malloc( params.m_iSizeY * sizeof(float) );
+			for( y = 0; y < params.m_iSizeY; y++ )
+				legacyWeights[i][x][y] = params.m_pWeights[x * params.m_iSizeY + y];
+		}
+		iLegacyMemory += params.m_iSizeX * sizeof(float *) + params.m_iSizeX * params.m_iSizeY * sizeof(float);
+		params.Free();
+	}
+
+	// Shared tables
+	int nTablesBefore = DensityWeightsMap::GetTableCount();
+	int iMemoryBefore = DensityWeightsMap::GetTableMemoryUsage();
+	CUtlVector< DensityWeightsTable_t * > tables;
+	tables.SetCount( nUnits );
+	for( i = 0; i < nUnits; i++ )
+		tables[i] = AcquireDensityWeightsTable( DENSITY_GAUSSIAN, s_fRadii[i % nTypes], vec3_origin, vec3_origin );
+	int nTables = DensityWeightsMap::GetTableCount() - nTablesBefore;
+	int iSharedMemory = DensityWeightsMap::GetTableMemoryUsage() - iMemoryBefore + nUnits * sizeof(DensityWeightsTable_t *);
+
+	// Random offsets within the range of the largest hull
+	CUtlVector< Vector2D > offsets;
+	offsets.SetCount( nLookups );
+	for( j = 0; j < nLookups; j++ )
+		offsets[j].Init( RandomFloat( -64.0f, 64.0f ), RandomFloat( -64.0f, 64.0f ) );
+
+	float fLegacySum = 0.0f;
+	double fStartTime = Plat_FloatTime();
+	for( i = 0; i < nUnits; i++ )
+	{
+		const DensityWeightsTable_t &params = legacyParams[i];
+		for( j = 0; j < nLookups; j++ )
+			fLegacySum += LegacyDensityLookup( legacyWeights[i], params.m_iSizeX, params.m_iSizeY, params.m_iHalfSizeX, params.m_iHalfSizeY, offsets[j].x, offsets[j].y );
+	}
+	double fLegacyTime = Plat_FloatTime() - fStartTime;
+
+	float fSharedSum = 0.0f;
+	fStartTime = Plat_FloatTime();
+	for( i = 0; i < nUnits; i++ )
+	{
+		const DensityWeightsTable_t *pTable = tables[i];
+		for( j = 0; j < nLookups; j++ )
+			fSharedSum += pTable->Lookup( offsets[j].x, offsets[j].y );
+	}
+	double fSharedTime = Plat_FloatTime() - fStartTime;
+
+	for( i = 0; i < nUnits; i++ )
+	{
+		for( x = 0; x < legacyParams[i].m_iSizeX; x++ )
+			free( legacyWeights[i][x] );
+		free( legacyWeights[i] );
+		ReleaseDensityWeightsTable( tables[i] );
+	}
+
+	int nTotalLookups = nUnits * nLookups;
+	Msg( "unit_density_benchmark: %d units, %d lookups per unit\n", nUnits, nLookups );
+	Msg( "\ttable per unit: %.3f ms (%.2f ns per lookup), %d KB\n", fLegacyTime * 1000.0, fLegacyTime * 1e9 / nTotalLookups, iLegacyMemory / 1024 );
+	Msg( "\tshared tables: %.3f ms (%.2f ns per lookup), %d KB in %d tables\n", fSharedTime * 1000.0, fSharedTime * 1e9 / nTotalLookups, iSharedMemory / 1024, nTables );
+	if( fabs( fLegacySum - fSharedSum ) > 0.001f * MAX( 1.0f, fabs( fLegacySum ) ) )
+		Warning( "unit_density_benchmark: results differ (%f vs %f)!\n", fLegacySum, fSharedSum );
+}
+#endif // CLIENT_DLL
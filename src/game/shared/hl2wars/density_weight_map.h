@@ -9,6 +9,11 @@
 #define DENSITY_WEIGHT_MAP_H
 #pragma once
 
+#include "mathlib/vector2d.h"
+
+#define GRIDHSIZE 1.0f // 2.0f // Multiplied by sigma, defines the size of the computed density field
+#define MAP_TILE_SIZE 8.0f // 4.0f // Tilesize of the above grid
+
 enum density_type_t
 {
 	DENSITY_GAUSSIAN = 0, // Use a 2d gaussian function. Sigma based on BoundingRadius.
@@ -16,6 +21,32 @@ enum density_type_t
 	DENSITY_NONE,
 };
 
+//-----------------------------------------------------------------------------
+// Weights table, shared between all entities with the same density type,
+// hull size and tile resolution. Weights are stored contiguous, row per x.
+//-----------------------------------------------------------------------------
+struct DensityWeightsTable_t
+{
+	// Key
+	int m_iType;
+	float m_fRadius; // DENSITY_GAUSSIAN
+	Vector2D m_vMins, m_vMaxs; // DENSITY_GAUSSIANECLIPSE
+
+	int m_iRefCount;
+
+	float *m_pWeights;
+	int m_iSizeX, m_iSizeY;
+	int m_iHalfSizeX, m_iHalfSizeY;
+	float m_fXOffset, m_fYOffset;
+	float m_fTileRes;
+
+	float Lookup( float fDeltaX, float fDeltaY ) const;
+	void Fill();
+	void FillGaussian();
+	void FillGaussianEclipse();
+	void Free();
+};
+
 class DensityWeightsMap
 {
 public:
@@ -28,24 +59,25 @@ public:
 	int GetType();
 	void OnCollisionSizeChanged();
 	float Get( const Vector &vPos );
-	int GetSizeX() { return m_iSizeX; }
-	int GetSizeY() { return m_iSizeY; }
+	void GetMultiple( const float *pPosX, const float *pPosY, float *pDensities, int iCount );
+	int GetSizeX() { return m_pTable ? m_pTable->m_iSizeX : 0; }
+	int GetSizeY() { return m_pTable ? m_pTable->m_iSizeY : 0; }
 
 	void RecalculateWeights( const Vector &vMins, const Vector &vMaxs );
-	void FillGaussian();
-	void FillGaussianEclipse();
 
 	void DebugPrintWeights();
 
+	// Shared tables
+	static void RebuildAllTables();
+	static int GetTableCount();
+	static int GetTableMemoryUsage();
+
 private:
 	CBaseEntity *m_pOuter;
 	Vector m_vMins, m_vMaxs;
 	int m_iType;
 
-	float **m_pWeights;
-	int m_iSizeX, m_iSizeY;
-	int m_iHalfSizeX, m_iHalfSizeY;
-	float m_fXOffset, m_fYOffset;
+	DensityWeightsTable_t *m_pTable;
 };
 
 inline int DensityWeightsMap::GetType()
@@ -53,4 +85,33 @@ inline int DensityWeightsMap::GetType()
 	return m_iType;
 }
 
+//-----------------------------------------------------------------------------
+// Purpose: Density at the offset from the center of the entity. Linear 
+//			interpolation between the tile at or below the position and the
+//			tile at or above the position.
+//-----------------------------------------------------------------------------
+inline float DensityWeightsTable_t::Lookup( float fDeltaX, float fDeltaY ) const
+{
+	float x = ( fDeltaX * ( 1.0f / MAP_TILE_SIZE ) ) + m_iHalfSizeX;
+	float y = ( fDeltaY * ( 1.0f / MAP_TILE_SIZE ) ) + m_iHalfSizeY;
+
+	// Negative positions are outside, so truncating is the same as flooring
+	if( x < 0.0f || y < 0.0f )
+		return 0.0f;
+
+	int xlow = (int)x;
+	int ylow = (int)y;
+	float fx = x - xlow;
+	float fy = y - ylow;
+	int xhigh = xlow + ( fx != 0.0f );
+	int yhigh = ylow + ( fy != 0.0f );
+
+	if( xhigh >= m_iSizeX || yhigh >= m_iSizeY )
+		return 0.0f;
+
+	float fLow = m_pWeights[xlow * m_iSizeY + ylow];
+	float fHigh = m_pWeights[xhigh * m_iSizeY + yhigh];
+	return fLow + ( fHigh - fLow ) * FastSqrt( fx * fx + fy * fy );
+}
+
 #endif // DENSITY_WEIGHT_MAP_H
\ No newline at end of file
@@ -10,6 +10,9 @@
 #include "unit_base_shared.h"
 #include "tier0/vprof.h"
 #include "utlbuffer.h"
+#include "vstdlib/jobthread.h"
+#include "tier1/lzss.h"
+#include "checksum_crc.h"
 #include <algorithm>
 
 #if defined( CLIENT_DLL )
@@ -27,11 +30,40 @@
 
 #include <filesystem.h>
 
+#if defined( CLIENT_DLL ) && !defined( _X360 )
+	#include <emmintrin.h>
+#endif // CLIENT_DLL
+
 // memdbgon must be the last include file in a .cpp file!!!
 #include "tier0/memdbgon.h"
 
 // Increment this to force rebuilding all heightmaps
-#define	 HEIGHTMAP_VERSION_NUMBER	2
+#define	 HEIGHTMAP_VERSION_NUMBER	3
+#define	 HEIGHTMAP_ID				(('H'<<24)|('W'<<16)|('O'<<8)|('F'))
+
+// Size of the bsp header (ident, version, lump directory and map revision). Crc'ed 
+// with the file size to detect recompiled maps.
+#define	 HEIGHTMAP_MAPHEADER_SIZE	1036
+
+//-----------------------------------------------------------------------------
+// Height map file layout. The header is followed by m_nDataSize bytes of heights,
+// quantized to 16 bits and optionally lzss compressed.
+//-----------------------------------------------------------------------------
+struct FOWHeightMapHeader_t
+{
+	int				m_iId;
+	int				m_iVersion;
+	int				m_iMapVersion;
+	unsigned int	m_MapCRC;
+	int				m_nGridSize;
+	int				m_nTileSize;
+	float			m_fMinHeight;
+	float			m_fHeightScale; // World units per quantization step
+	unsigned char	m_bHasHeightMap;
+	unsigned char	m_bCompressed;
+	unsigned char	m_Pad[2];
+	unsigned int	m_nDataSize;
+};
 
 // #define FOW_USE_PROCTEX
 
@@ -44,6 +76,8 @@ ConVar sv_fogofwar_shadowcast( "sv_fogofwar_shadowcast", "1", FCVAR_CHEAT | FCVA
 ConVar g_debug_fogofwar( "g_debug_fogofwar", "0", FCVAR_CHEAT | FCVAR_REPLICATED );
 
 ConVar sv_fogofwar_tilesize( "sv_fogofwar_tilesize", "64", FCVAR_CHEAT | FCVAR_REPLICATED, "Tile size of the fog of war. Lower values result in a more detailed fog of war, but at more expense. Must be a power of 2." );
+ConVar sv_fogofwar_heightmap_async( "sv_fogofwar_heightmap_async", "1", FCVAR_CHEAT | FCVAR_REPLICATED, "Generate a missing or out of date height map over multiple frames, using a flat height map until done." );
+ConVar sv_fogofwar_heightmap_budget( "sv_fogofwar_heightmap_budget", "4", FCVAR_CHEAT | FCVAR_REPLICATED, "Time in milliseconds per frame spent on generating the height map." );
 
 // Split update rate on the server and client
 // Client will have an higher update rate to make it visually look better
@@ -69,6 +103,12 @@ ConVar sv_fogofwar_tilesize( "sv_fogofwar_tilesize", "64", FCVAR_CHEAT | FCVAR_R
 #else
 	ConVar sv_fogofwar_updaterate( "sv_fogofwar_updaterate", "0.2", FCVAR_GAMEDLL, "Rate at which the fog of war logic updates." );
 	#define FOW_UPDATERATE sv_fogofwar_updaterate.GetFloat()
+
+	ConVar sv_fogofwar_incremental( "sv_fogofwar_incremental", "1", FCVAR_GAMEDLL, "Only recompute the fog of war of updaters which changed tile or view distance, instead of clearing and recomputing the whole grid." );
+	ConVar sv_fogofwar_threaded( "sv_fogofwar_threaded", "1", FCVAR_GAMEDLL, "Shadow cast the updaters of each owner in parallel on the thread pool." );
+	ConVar sv_fogofwar_transmitbits( "sv_fogofwar_transmitbits", "1", FCVAR_GAMEDLL, "Skip the entities in the fog of war in bulk in CheckTransmit, using the transmit bits per owner, instead of testing each entity." );
+	ConVar sv_fogofwar_heightmap_compress( "sv_fogofwar_heightmap_compress", "1", FCVAR_GAMEDLL, "Compress the saved height map." );
+	ConVar sv_fogofwar_summary( "sv_fogofwar_summary", "1", FCVAR_GAMEDLL, "Use the visibility summary per block of tiles to skip unchanged regions in UpdateVisibility and to answer the box queries." );
 #endif
 
 //-----------------------------------------------------------------------------
@@ -149,10 +189,23 @@ CFogOfWarMgr::CFogOfWarMgr()
 	m_nGridSize = -1;
 	m_nTileSize = -1;
 	m_bHeightMapLoaded = false;
+	m_bGeneratingHeightMap = false;
+	m_iHeightMapGenColumn = 0;
+	m_nHeightMapGenFrames = 0;
+	m_fHeightMapGenZ = 0.0f;
+	m_fHeightMapGenStartTime = 0.0;
 
 #ifdef CLIENT_DLL
 	m_pTextureRegen = new CFOWTextureRegen();
 	m_bRenderingFOW = false;
+#else
+	m_bNeedsFullRebuild = true;
+	m_bIncrementalShadowCast = false;
+	memset( m_OwnerVisibilityMask, 0, sizeof(m_OwnerVisibilityMask) );
+	m_iDirtyMinX = m_iDirtyMinY = INT_MAX;
+	m_iDirtyMaxX = m_iDirtyMaxY = -1;
+	m_nBlockGridSize = 0;
+	m_bAllBlocksChanged = true;
 #endif // CLIENT_DLL
 }
 
@@ -222,6 +275,11 @@ void CFogOfWarMgr::LevelInitPreEntity()
 #else
 	for( int i = 0; i < MAX_PLAYERS; i++ )
 		ResetToKnown( i );
+
+	m_TransmitFogEntities.ClearAll();
+	m_TransmitHiddenEntities.ClearAll();
+	for( int i = 0; i < FOWMAXPLAYERS; i++ )
+		m_TransmitVisible[i].ClearAll();
 #endif // CLIENT_DLL
 }
 
@@ -236,10 +294,7 @@ void CFogOfWarMgr::LevelInitPostEntity()
 
 	LoadHeightMap();
 	if( !m_bHeightMapLoaded )
-	{
-		CalculateHeightMap();
-		SaveHeightMap();
-	}
+		BuildHeightMap();
 
 	if( sv_fogofwar.GetBool() )
 	{
@@ -267,6 +322,60 @@ bool CFogOfWarMgr::CanCalculateHeightMap()
 	return GetMapBoundaryList() != NULL;
 }
 
+//-----------------------------------------------------------------------------
+// Purpose: Returns the z from which the height map traces start.
+//-----------------------------------------------------------------------------
+float CFogOfWarMgr::ComputeHeightMapTraceZ()
+{
+	float z = -MAX_COORD_FLOAT;
+	for( CBaseFuncMapBoundary *pEnt = GetMapBoundaryList(); pEnt != NULL; pEnt = pEnt->m_pNext )
+	{
+		Vector mins, maxs;
+		pEnt->GetMapBoundary( mins, maxs );
+
+		z = MAX(z, maxs.z);
+	}
+	return z;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Traces the height of a single tile
+//-----------------------------------------------------------------------------
+float CFogOfWarMgr::CalculateTileHeight( int x, int y, float z )
+{
+	float tilez = 0.0f;
+	Vector start, end;
+	trace_t tr;
+
+	start = ComputeWorldPosition( x, y );
+	start.z = z - 16.0f;
+	end = start + Vector( 0, 0, -1 ) * MAX_TRACE_LENGTH;
+	//UTIL_TraceHull( start, end, -Vector(m_nTileSize, m_nTileSize, 8.0f), Vector(m_nTileSize, m_nTileSize, 8.0f),
+	//	MASK_SOLID_BRUSHONLY, NULL, COLLISION_GROUP_NONE, &tr );
+
+	// Use four trace lines and average the result
+	UTIL_TraceLine( start, end, MASK_SOLID_BRUSHONLY, NULL, COLLISION_GROUP_NONE, &tr );
+	tilez += tr.endpos.z;
+
+	start.x += m_nTileSize;
+	end.x += m_nTileSize;
+	UTIL_TraceLine( start, end, MASK_SOLID_BRUSHONLY, NULL, COLLISION_GROUP_NONE, &tr );
+	tilez += tr.endpos.z;
+
+	start.y += m_nTileSize;
+	end.y += m_nTileSize;
+	UTIL_TraceLine( start, end, MASK_SOLID_BRUSHONLY, NULL, COLLISION_GROUP_NONE, &tr );
+	tilez += tr.endpos.z;
+
+	start.x -= m_nTileSize;
+	end.x -= m_nTileSize;
+	UTIL_TraceLine( start, end, MASK_SOLID_BRUSHONLY, NULL, COLLISION_GROUP_NONE, &tr );
+	tilez += tr.endpos.z;
+
+	//Msg("start: %f %f %f, end: %f %f %f, x: %d, y: %d, end: %f\n", x, y, tr.endpos.z);
+	return tilez / 4.0f;
+}
+
 //-----------------------------------------------------------------------------
 // Purpose: Calculates a height map for the fog of war
 //-----------------------------------------------------------------------------
@@ -279,55 +388,16 @@ void CFogOfWarMgr::CalculateHeightMap()
 		return;
 	}
 
-	float z = -MAX_COORD_FLOAT;
 	if( CanCalculateHeightMap() )
 	{
 		double fStartTime = Plat_FloatTime();
 
-		for( CBaseFuncMapBoundary *pEnt = GetMapBoundaryList(); pEnt != NULL; pEnt = pEnt->m_pNext )
-		{
-			Vector mins, maxs;
-			pEnt->GetMapBoundary( mins, maxs );
-
-			z = MAX(z, maxs.z);
-		}
-
-		float tilez;
-		Vector start, end;
-		trace_t tr;
+		float z = ComputeHeightMapTraceZ();
 		for( int x = 0; x < m_nGridSize; x++ )
 		{
 			for( int y = 0; y < m_nGridSize; y++ )
 			{
-				tilez = 0.0f;
-
-				start = ComputeWorldPosition( x, y );
-				start.z = z - 16.0f;
-				end = start + Vector( 0, 0, -1 ) * MAX_TRACE_LENGTH;
-				//UTIL_TraceHull( start, end, -Vector(m_nTileSize, m_nTileSize, 8.0f), Vector(m_nTileSize, m_nTileSize, 8.0f),
-				//	MASK_SOLID_BRUSHONLY, NULL, COLLISION_GROUP_NONE, &tr );
-
-				// Use four trace lines and average the result
-				UTIL_TraceLine( start, end, MASK_SOLID_BRUSHONLY, NULL, COLLISION_GROUP_NONE, &tr );
-				tilez += tr.endpos.z;
-
-				start.x += m_nTileSize;
-				end.x += m_nTileSize;
-				UTIL_TraceLine( start, end, MASK_SOLID_BRUSHONLY, NULL, COLLISION_GROUP_NONE, &tr );
-				tilez += tr.endpos.z;
-
-				start.y += m_nTileSize;
-				end.y += m_nTileSize;
-				UTIL_TraceLine( start, end, MASK_SOLID_BRUSHONLY, NULL, COLLISION_GROUP_NONE, &tr );
-				tilez += tr.endpos.z;
-
-				start.x -= m_nTileSize;
-				end.x -= m_nTileSize;
-				UTIL_TraceLine( start, end, MASK_SOLID_BRUSHONLY, NULL, COLLISION_GROUP_NONE, &tr );
-				tilez += tr.endpos.z;
-
-				//Msg("start: %f %f %f, end: %f %f %f, x: %d, y: %d, end: %f\n", x, y, tr.endpos.z);
-				m_TileHeights[FOWINDEX(x, y)] = tilez / 4.0f;
+				m_TileHeights[FOWINDEX(x, y)] = CalculateTileHeight( x, y, z );
 			}
 		}
 
@@ -348,6 +418,145 @@ void CFogOfWarMgr::CalculateHeightMap()
 	m_bHeightMapLoaded = true;
 }
 
+//-----------------------------------------------------------------------------
+// Purpose: Builds the height map when no valid one could be loaded. Either 
+//			directly, or over multiple frames (saved when done).
+//-----------------------------------------------------------------------------
+void CFogOfWarMgr::BuildHeightMap()
+{
+	CancelHeightMapGeneration();
+
+	if( sv_fogofwar_heightmap_async.GetBool() && CanCalculateHeightMap() )
+	{
+		StartHeightMapGeneration();
+		return;
+	}
+
+	CalculateHeightMap();
+	SaveHeightMap();
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Starts generating the height map. The level starts with a flat
+//			height map, like maps without boundaries.
+//-----------------------------------------------------------------------------
+void CFogOfWarMgr::StartHeightMapGeneration()
+{
+	Assert( m_TileHeights.Count() == m_nGridSize * m_nGridSize );
+	if( m_TileHeights.Count() !=  m_nGridSize * m_nGridSize )
+	{
+		Warning("StartHeightMapGeneration: invalid tileheights size\n");
+		return;
+	}
+
+	m_TileHeights.FillWithValue( -MAX_COORD_FLOAT );
+	m_GeneratingTileHeights.SetCount( m_TileHeights.Count() );
+	m_HeightModifications.RemoveAll();
+
+	m_fHeightMapGenZ = ComputeHeightMapTraceZ();
+	m_iHeightMapGenColumn = 0;
+	m_nHeightMapGenFrames = 0;
+	m_fHeightMapGenStartTime = Plat_FloatTime();
+	m_bGeneratingHeightMap = true;
+
+	DevMsg("CFogOfWarMgr: Generating height map over multiple frames\n");
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Generates columns of the height map until the frame budget is used.
+//			When done the height map is swapped in, saved and the modifications
+//			made in the meantime are applied again.
+//-----------------------------------------------------------------------------
+void CFogOfWarMgr::UpdateHeightMapGeneration()
+{
+	VPROF_BUDGET( "CFogOfWarMgr::UpdateHeightMapGeneration", VPROF_BUDGETGROUP_FOGOFWAR );
+
+	double fStartTime = Plat_FloatTime();
+	double fBudget = sv_fogofwar_heightmap_budget.GetFloat() / 1000.0;
+	int i, y;
+
+	m_nHeightMapGenFrames++;
+
+	// Always generate at least one column per frame
+	while( m_iHeightMapGenColumn < m_nGridSize )
+	{
+		for( y = 0; y < m_nGridSize; y++ )
+			m_GeneratingTileHeights[FOWINDEX(m_iHeightMapGenColumn, y)] = CalculateTileHeight( m_iHeightMapGenColumn, y, m_fHeightMapGenZ );
+		m_iHeightMapGenColumn++;
+
+		if( Plat_FloatTime() - fStartTime > fBudget )
+			break;
+	}
+
+	if( m_iHeightMapGenColumn < m_nGridSize )
+		return;
+
+	m_bGeneratingHeightMap = false;
+	m_TileHeights.Swap( m_GeneratingTileHeights );
+	m_GeneratingTileHeights.Purge();
+	m_bHeightMapLoaded = true;
+
+	Msg("CFogOfWarMgr: Generated height map in %f seconds (%d frames)\n", Plat_FloatTime() - m_fHeightMapGenStartTime, m_nHeightMapGenFrames);
+
+	// Save the height map of the map itself, before applying the modifications of this game
+	SaveHeightMap();
+
+	for( i = 0; i < m_HeightModifications.Count(); i++ )
+		m_TileHeights[m_HeightModifications[i].m_iTile] = m_HeightModifications[i].m_fHeight;
+	m_HeightModifications.Purge();
+
+#ifndef CLIENT_DLL
+	// Line of sight of the existing footprints changed
+	m_bNeedsFullRebuild = true;
+#endif // CLIENT_DLL
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void CFogOfWarMgr::CancelHeightMapGeneration()
+{
+	if( !m_bGeneratingHeightMap )
+		return;
+
+	m_bGeneratingHeightMap = false;
+	m_GeneratingTileHeights.Purge();
+	m_HeightModifications.Purge();
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Crc of the bsp header and size of the current map. Changes when 
+//			the map is recompiled.
+//-----------------------------------------------------------------------------
+static CRC32_t ComputeHeightMapMapCRC()
+{
+	char szMapFilename[MAX_PATH];
+#ifdef CLIENT_DLL
+	Q_strncpy( szMapFilename, engine->GetLevelName(), sizeof(szMapFilename) );
+#else
+	Q_snprintf( szMapFilename, sizeof(szMapFilename), "maps/%s.bsp", STRING( gpGlobals->mapname ) );
+#endif // CLIENT_DLL
+
+	CRC32_t crc;
+	CRC32_Init( &crc );
+
+	FileHandle_t fh = filesystem->Open( szMapFilename, "rb", "GAME" );
+	if( fh )
+	{
+		unsigned char header[HEIGHTMAP_MAPHEADER_SIZE];
+		int nRead = filesystem->Read( header, sizeof(header), fh );
+		unsigned int nSize = filesystem->Size( fh );
+		filesystem->Close( fh );
+
+		if( nRead > 0 )
+			CRC32_ProcessBuffer( &crc, header, nRead );
+		CRC32_ProcessBuffer( &crc, &nSize, sizeof(nSize) );
+	}
+
+	CRC32_Final( &crc );
+	return crc;
+}
+
 //-----------------------------------------------------------------------------
 // Purpose: 
 //-----------------------------------------------------------------------------
@@ -361,37 +570,71 @@ void CFogOfWarMgr::SaveHeightMap()
 	Q_strncat( szNrpFilename, "mapheightfielddata.bin", sizeof( szNrpFilename ), COPY_ALL_CHARACTERS );
 	Msg("Saving height map to %s\n", szNrpFilename);
 
-	CUtlBuffer buf;
-
 	// ---------------------------
-	// Save the version number
+	// Fill in the header
 	// ---------------------------
-	buf.PutInt(HEIGHTMAP_VERSION_NUMBER);
-	buf.PutInt(gpGlobals->mapversion);
-
-	// -------------------------------
-	// Store grid size
-	// -------------------------------
-	buf.PutInt( m_nGridSize );
+	FOWHeightMapHeader_t header;
+	Q_memset( &header, 0, sizeof(header) );
+	header.m_iId = HEIGHTMAP_ID;
+	header.m_iVersion = HEIGHTMAP_VERSION_NUMBER;
+	header.m_iMapVersion = gpGlobals->mapversion;
+	header.m_MapCRC = ComputeHeightMapMapCRC();
+	header.m_nGridSize = m_nGridSize;
+	header.m_nTileSize = m_nTileSize;
 
-	// -------------------------------
-	// Store if we have a height map
-	// -------------------------------
 	bool bHasHeightMap = CanCalculateHeightMap();
-	buf.PutChar( (char)bHasHeightMap );
+	header.m_bHasHeightMap = bHasHeightMap;
 
+	// ---------------------------
+	// Quantize the heightmap
+	// ---------------------------
+	CUtlVector< unsigned short > heights;
+	unsigned char *pCompressed = NULL;
 	if( bHasHeightMap )
 	{
-		// ---------------------------
-		// Save heightmap
-		// ---------------------------
-		int i;
-		for ( i = 0; i < m_nGridSize*m_nGridSize; i++)
+		int i, nTiles = m_nGridSize*m_nGridSize;
+		float fMinHeight = m_TileHeights[0];
+		float fMaxHeight = m_TileHeights[0];
+		for( i = 1; i < nTiles; i++ )
+		{
+			fMinHeight = MIN( fMinHeight, m_TileHeights[i] );
+			fMaxHeight = MAX( fMaxHeight, m_TileHeights[i] );
+		}
+		header.m_fMinHeight = fMinHeight;
+		header.m_fHeightScale = ( fMaxHeight - fMinHeight ) / 65535.0f;
+
+		heights.SetCount( nTiles );
+		for( i = 0; i < nTiles; i++ )
 		{
-			buf.PutFloat( m_TileHeights[i] );
+			if( header.m_fHeightScale > 0.0f )
+				heights[i] = (unsigned short)clamp( ( ( m_TileHeights[i] - fMinHeight ) / header.m_fHeightScale ) + 0.5f, 0.0f, 65535.0f );
+			else
+				heights[i] = 0;
+		}
+		header.m_nDataSize = nTiles * sizeof(unsigned short);
+
+		// Heights of neighbouring tiles are mostly the same. Stored uncompressed if it does not get smaller.
+		if( sv_fogofwar_heightmap_compress.GetBool() )
+		{
+			CLZSS lzss;
+			unsigned int nCompressedSize = 0;
+			pCompressed = lzss.Compress( (unsigned char *)heights.Base(), header.m_nDataSize, &nCompressedSize );
+			if( pCompressed )
+			{
+				header.m_bCompressed = 1;
+				header.m_nDataSize = nCompressedSize;
+			}
 		}
 	}
 
+	CUtlBuffer buf;
+	buf.Put( &header, sizeof(header) );
+	if( bHasHeightMap )
+		buf.Put( pCompressed ? pCompressed : (unsigned char *)heights.Base(), header.m_nDataSize );
+
+	if( pCompressed )
+		free( pCompressed );
+
 	// -------------------------------
 	// Write the file out
 	// -------------------------------
@@ -405,6 +648,7 @@ void CFogOfWarMgr::SaveHeightMap()
 	filesystem->Write( buf.Base(), buf.TellPut(), fh );
 	filesystem->Close(fh);
 
+	DevMsg("CFogOfWarMgr: Saved height map (%d bytes%s)\n", buf.TellPut(), header.m_bCompressed ? ", compressed" : "");
 #endif // CLIENT_DLL
 }
 
@@ -426,7 +670,7 @@ void CFogOfWarMgr::LoadHeightMap()
 	Q_strncat( szNrpFilename, "mapheightfielddata.bin", sizeof( szNrpFilename ), COPY_ALL_CHARACTERS );
 	double fStartTime = Plat_FloatTime();
 
-	// Read file
+	// Read file in one call
 	CUtlBuffer buf;
 	if ( !filesystem->ReadFile( szNrpFilename, "game", buf ) )
 	{
@@ -435,58 +679,81 @@ void CFogOfWarMgr::LoadHeightMap()
 	}
 
 	// ---------------------------
-	// Check the version number
+	// Check the header
 	// ---------------------------
-	if ( buf.GetChar() == 'V' && buf.GetChar() == 'e' && buf.GetChar() == 'r' )
+	if ( buf.TellPut() < (int)sizeof(FOWHeightMapHeader_t) )
 	{
 		DevMsg( "Height map %s is out of date\n", szNrpFilename );
 		return;
 	}
 
-	buf.SeekGet( CUtlBuffer::SEEK_HEAD, 0 );
-
-	int version = buf.GetInt();
-	if ( version != HEIGHTMAP_VERSION_NUMBER)
+	const FOWHeightMapHeader_t *pHeader = (const FOWHeightMapHeader_t *)buf.Base();
+	if ( pHeader->m_iId != HEIGHTMAP_ID || pHeader->m_iVersion != HEIGHTMAP_VERSION_NUMBER )
 	{
 		DevMsg( "Height map %s is out of date\n", szNrpFilename );
 		return;
 	}
 
-	
 #ifndef CLIENT_DLL // FIXME
-	int mapversion = buf.GetInt();
-	if ( mapversion != gpGlobals->mapversion )
+	if ( pHeader->m_iMapVersion != gpGlobals->mapversion )
 	{
 		DevMsg( "Height map %s is out of date (map version changed)\n", szNrpFilename );
 		return;
 	}
-#else
-	buf.GetInt();
 #endif // CLIENT_DLL
 
+	if ( pHeader->m_MapCRC != ComputeHeightMapMapCRC() )
+	{
+		DevMsg( "Height map %s is out of date (map changed)\n", szNrpFilename );
+		return;
+	}
+
 	// ---------------------------
 	// Check grid size
 	// ---------------------------
-	int gridsize = buf.GetInt();
-	if( gridsize != m_nGridSize )
+	int gridsize = pHeader->m_nGridSize;
+	if( gridsize != m_nGridSize || pHeader->m_nTileSize != m_nTileSize )
 	{
 		DevMsg( "Height map %s is out of date (grid size changed %d -> %d)\n", szNrpFilename, gridsize, m_nGridSize );
 		return;
 	}
 
-	// ---------------------------
-	// Check if we have a height map
-	// ---------------------------
-	int i;
-	bool bHasHeightMap = (bool)buf.GetChar();
-
 	// ---------------------------
 	// Load heightmap
 	// ---------------------------
-	if( bHasHeightMap )
+	if( pHeader->m_bHasHeightMap )
 	{
-		for ( i = 0; i < gridsize*gridsize; i++)
-			m_TileHeights[i] = buf.GetFloat();
+		int i, nTiles = gridsize*gridsize;
+		unsigned int nHeightsSize = nTiles * sizeof(unsigned short);
+		unsigned char *pData = (unsigned char *)buf.Base() + sizeof(FOWHeightMapHeader_t);
+		if( sizeof(FOWHeightMapHeader_t) + pHeader->m_nDataSize > (unsigned int)buf.TellPut() )
+		{
+			Warning( "Height map %s is corrupt\n", szNrpFilename );
+			return;
+		}
+
+		CUtlVector< unsigned short > uncompressed;
+		const unsigned short *pHeights = (const unsigned short *)pData;
+		if( pHeader->m_bCompressed )
+		{
+			CLZSS lzss;
+			uncompressed.SetCount( nTiles );
+			if( lzss.GetActualSize( pData ) != nHeightsSize || 
+				lzss.SafeUncompress( pData, (unsigned char *)uncompressed.Base(), nHeightsSize ) != nHeightsSize )
+			{
+				Warning( "Height map %s is corrupt\n", szNrpFilename );
+				return;
+			}
+			pHeights = uncompressed.Base();
+		}
+		else if( pHeader->m_nDataSize != nHeightsSize )
+		{
+			Warning( "Height map %s is corrupt\n", szNrpFilename );
+			return;
+		}
+
+		for ( i = 0; i < nTiles; i++ )
+			m_TileHeights[i] = pHeader->m_fMinHeight + pHeights[i] * pHeader->m_fHeightScale;
 	}
 	else
 	{
@@ -504,7 +771,19 @@ void CFogOfWarMgr::ModifyHeightAtTile( int x, int y, float fHeight )
 {
 	int idx = FOWINDEX(x, y);
 	if( m_TileHeights.IsValidIndex( idx ) )
+	{
 		m_TileHeights[idx] = fHeight;
+		if( m_bGeneratingHeightMap )
+		{
+			HeightModification_t &modification = m_HeightModifications[m_HeightModifications.AddToTail()];
+			modification.m_iTile = idx;
+			modification.m_fHeight = fHeight;
+		}
+#ifndef CLIENT_DLL
+		// Line of sight of the existing footprints might have changed
+		m_bNeedsFullRebuild = true;
+#endif // CLIENT_DLL
+	}
 }
 
 //-----------------------------------------------------------------------------
@@ -562,6 +841,7 @@ float CFogOfWarMgr::GetHeightAtPoint( const Vector &vPoint )
 void CFogOfWarMgr::LevelShutdownPostEntity()
 {
 	m_bActive = false;
+	CancelHeightMapGeneration();
 }
 
 //-----------------------------------------------------------------------------
@@ -583,6 +863,8 @@ void CFogOfWarMgr::PreClientUpdate()
 {
 	if( !m_bActive )
 		return;
+	if( m_bGeneratingHeightMap )
+		UpdateHeightMapGeneration();
 	UpdateShared();
 }
 #endif // CLIENT_DLL
@@ -618,9 +900,26 @@ void CFogOfWarMgr::AllocateFogOfWar()
 
 	m_FogOfWar.SetCount( m_nGridSize*m_nGridSize );
 	m_TileHeights.SetCount( m_nGridSize*m_nGridSize );
+#ifndef CLIENT_DLL
+	m_TileOwnerBits.SetCount( m_nGridSize*m_nGridSize );
+	m_bNeedsFullRebuild = true;
+
+	m_nBlockGridSize = ( m_nGridSize + FOWBLOCK_SIZE - 1 ) >> FOWBLOCK_SHIFT;
+	m_BlockVisibleAny.SetCount( m_nBlockGridSize*m_nBlockGridSize );
+	m_BlockVisibleAll.SetCount( m_nBlockGridSize*m_nBlockGridSize );
+	m_BlockChanged.SetCount( m_nBlockGridSize*m_nBlockGridSize );
+	m_BlockVisibleAny.FillWithValue( FOWHIDDEN_MASK );
+	m_BlockVisibleAll.FillWithValue( FOWHIDDEN_MASK );
+	m_BlockChanged.FillWithValue( 0 );
+	m_bAllBlocksChanged = true;
+#endif // CLIENT_DLL
 
 	if( m_bActive )
-		CalculateHeightMap();
+	{
+		LoadHeightMap();
+		if( !m_bHeightMapLoaded )
+			BuildHeightMap();
+	}
 
 #ifdef CLIENT_DLL
 #if FOW_USE_PROCTEX
@@ -661,8 +960,19 @@ void CFogOfWarMgr::DeallocateFogOfWar()
 {
 	VPROF_BUDGET( "CFogOfWarMgr::DeallocateFogOfWar", VPROF_BUDGETGROUP_FOGOFWAR );
 
+	CancelHeightMapGeneration();
+
 	m_FogOfWar.Purge();
 	m_TileHeights.Purge();
+#ifndef CLIENT_DLL
+	m_TileOwnerBits.Purge();
+	for( int i = 0; i < FOWMAXPLAYERS; i++ )
+		m_TileRefCounts[i].Purge();
+	m_BlockVisibleAny.Purge();
+	m_BlockVisibleAll.Purge();
+	m_BlockChanged.Purge();
+	m_nBlockGridSize = 0;
+#endif // CLIENT_DLL
 
 #ifdef CLIENT_DLL
 #if FOW_USE_PROCTEX
@@ -777,6 +1087,8 @@ void CFogOfWarMgr::Update( float frametime )
 
 	VPROF_BUDGET( "CFogOfWarMgr::Update", VPROF_BUDGETGROUP_FOGOFWAR );
 
+	if( m_bGeneratingHeightMap )
+		UpdateHeightMapGeneration();
 	UpdateShared();
 
 #ifndef FOW_USE_PROCTEX
@@ -794,6 +1106,79 @@ void CFogOfWarMgr::Update( float frametime )
 #endif // FOW_USE_PROCTEX
 }
 
+//-----------------------------------------------------------------------------
+// Purpose: Moves one row of the fow texture towards the fog of war state.
+//			Extends iMinX and iMaxX with the changed tiles. Returns true if any
+//			tile of the row changed.
+//			Processes 16 tiles at a time using saturating adds and subtracts,
+//			which gives the same result as clamping to FOWCLEAR_MASK and 
+//			FOWHIDDEN_MASK.
+//-----------------------------------------------------------------------------
+static bool ConvergeFogOfWarRow( const unsigned char *pFow, unsigned char *pImage, int iCount, 
+								unsigned char deltaIn, unsigned char deltaOut, int &iMinX, int &iMaxX )
+{
+	int x = 0;
+	int iRowMinX = -1;
+	int iRowMaxX = -1;
+
+#if !defined( _X360 )
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i in = _mm_set1_epi8( (char)deltaIn );
+	const __m128i out = _mm_set1_epi8( (char)deltaOut );
+	for( ; x + 16 <= iCount; x += 16 )
+	{
+		__m128i fow = _mm_loadu_si128( (const __m128i *)( pFow + x ) );
+		__m128i image = _mm_loadu_si128( (const __m128i *)( pImage + x ) );
+
+		// Tiles with the fow state above or below the texture value
+		__m128i notAbove = _mm_cmpeq_epi8( _mm_subs_epu8( fow, image ), zero );
+		__m128i notBelow = _mm_cmpeq_epi8( _mm_subs_epu8( image, fow ), zero );
+		__m128i same = _mm_and_si128( notAbove, notBelow );
+		int iChanged = ~_mm_movemask_epi8( same ) & 0xFFFF;
+		if( iChanged == 0 )
+			continue;
+
+		__m128i result = _mm_or_si128( 
+			_mm_or_si128( _mm_andnot_si128( notAbove, _mm_adds_epu8( image, out ) ),
+						  _mm_andnot_si128( notBelow, _mm_subs_epu8( image, in ) ) ),
+			_mm_and_si128( same, image ) );
+		_mm_storeu_si128( (__m128i *)( pImage + x ), result );
+
+		if( iRowMinX == -1 )
+		{
+			int i = 0;
+			while( !( iChanged & (1 << i) ) ) i++;
+			iRowMinX = x + i;
+		}
+		int i = 15;
+		while( !( iChanged & (1 << i) ) ) i--;
+		iRowMaxX = x + i;
+	}
+#endif // _X360
+
+	// Remainder
+	for( ; x < iCount; x++ )
+	{
+		if( pFow[x] > pImage[x] )
+			pImage[x] = MIN( FOWCLEAR_MASK, pImage[x] + deltaOut );
+		else if( pFow[x] < pImage[x] )
+			pImage[x] = MAX( FOWHIDDEN_MASK, pImage[x] - deltaIn );
+		else
+			continue;
+
+		if( iRowMinX == -1 )
+			iRowMinX = x;
+		iRowMaxX = x;
+	}
+
+	if( iRowMaxX == -1 )
+		return false;
+
+	iMinX = MIN( iMinX, iRowMinX );
+	iMaxX = MAX( iMaxX, iRowMaxX );
+	return true;
+}
+
 #if FOW_USE_PROCTEX
 //-----------------------------------------------------------------------------
 // Purpose:
@@ -808,39 +1193,25 @@ void CFogOfWarMgr::UpdateTexture( bool bConverge, float fTime )
 	if( bConverge )
 	{
 		// Update target fow values on the client (to make it look visually good)
-		char deltaIn = MIN(255,MAX(1, cl_fogofwar_convergespeed_in.GetFloat() * fTime)); 
-		char deltaOut = MIN(255,MAX(1, cl_fogofwar_convergespeed_out.GetFloat() * fTime)); 
+		unsigned char deltaIn = MIN(255,MAX(1, cl_fogofwar_convergespeed_in.GetFloat() * fTime)); 
+		unsigned char deltaOut = MIN(255,MAX(1, cl_fogofwar_convergespeed_out.GetFloat() * fTime)); 
 
-		int x, y, idx;
+		int y;
 		int iMinX = m_nGridSize + 1;
 		int iMaxX = -1;
 		int iMinY = m_nGridSize + 1;
 		int iMaxY = -1;
 
-		FOWSIZE_TYPE *fowData = m_FogOfWar.Base();
+		const FOWSIZE_TYPE *fowData = m_FogOfWar.Base();
 		FOWSIZE_TYPE *imageData = m_FogOfWarTextureData.Base();
 
-		for( x = 0; x < m_nGridSize; x++ )
+		// Rows are contiguous (see FOWINDEX)
+		for( y = 0; y < m_nGridSize; y++ )
 		{
-			for( y = 0; y < m_nGridSize; y++ )
+			if( ConvergeFogOfWarRow( fowData + y * m_nGridSize, imageData + y * m_nGridSize, m_nGridSize, deltaIn, deltaOut, iMinX, iMaxX ) )
 			{
-				idx = FOWINDEX(x, y);
-				if( fowData[idx] > imageData[idx] )
-				{
-					imageData[idx] = MIN( FOWCLEAR_MASK, imageData[idx] + deltaOut );
-					iMinX = MIN( iMinX, x );
-					iMaxX = MAX( iMaxX, x );
-					iMinY = MIN( iMinY, y );
-					iMaxY = MAX( iMaxY, y );
-				}
-				else if( fowData[idx] < imageData[idx] )
-				{
-					imageData[idx] = MAX( FOWHIDDEN_MASK, imageData[idx] - deltaIn );
-					iMinX = MIN( iMinX, x );
-					iMaxX = MAX( iMaxX, x );
-					iMinY = MIN( iMinY, y );
-					iMaxY = MAX( iMaxY, y );
-				}
+				iMinY = MIN( iMinY, y );
+				iMaxY = y;
 			}
 		}
 
@@ -875,6 +1246,100 @@ void CFogOfWarMgr::UpdateTexture( bool bConverge, float fTime )
 }
 #endif
 
+//-----------------------------------------------------------------------------
+// Purpose: The convergence loop before it was row based, for the benchmark.
+//-----------------------------------------------------------------------------
+static void ConvergeFogOfWarColumns( const unsigned char *fowData, unsigned char *imageData, int iGridSize, 
+									unsigned char deltaIn, unsigned char deltaOut, int &iMinX, int &iMaxX, int &iMinY, int &iMaxY )
+{
+	int x, y, idx;
+	for( x = 0; x < iGridSize; x++ )
+	{
+		for( y = 0; y < iGridSize; y++ )
+		{
+			idx = x + y * iGridSize;
+			if( fowData[idx] > imageData[idx] )
+			{
+				imageData[idx] = MIN( FOWCLEAR_MASK, imageData[idx] + deltaOut );
+				iMinX = MIN( iMinX, x );
+				iMaxX = MAX( iMaxX, x );
+				iMinY = MIN( iMinY, y );
+				iMaxY = MAX( iMaxY, y );
+			}
+			else if( fowData[idx] < imageData[idx] )
+			{
+				imageData[idx] = MAX( FOWHIDDEN_MASK, imageData[idx] - deltaIn );
+				iMinX = MIN( iMinX, x );
+				iMaxX = MAX( iMaxX, x );
+				iMinY = MIN( iMinY, y );
+				iMaxY = MAX( iMaxY, y );
+			}
+		}
+	}
+}
+
+CON_COMMAND_F( cl_fogofwar_converge_benchmark, "Measures the fow texture convergence for grid sizes 256, 512 and 1024 on synthetic data, per column versus per row.\n\tArguments: [iterations]", FCVAR_CHEAT )
+{
+	int iIterations = args.ArgC() > 1 ? MAX( atoi( args[1] ), 1 ) : 20;
+	const unsigned char deltaIn = 32, deltaOut = 64;
+
+	for( int iGridSize = 256; iGridSize <= 1024; iGridSize *= 2 )
+	{
+		int iTiles = iGridSize * iGridSize;
+		CUtlVector< unsigned char > fowData, imageColumns, imageRows;
+		fowData.SetCount( iTiles );
+		imageColumns.SetCount( iTiles );
+		imageRows.SetCount( iTiles );
+
+		// Fog of war with some clear circles, like around units
+		fowData.FillWithValue( FOWHIDDEN_MASK );
+		for( int i = 0; i < 64; i++ )
+		{
+			int cx = RandomInt( 0, iGridSize - 1 );
+			int cy = RandomInt( 0, iGridSize - 1 );
+			int r = RandomInt( 4, iGridSize / 16 );
+			for( int y = MAX( cy - r, 0 ); y <= MIN( cy + r, iGridSize - 1 ); y++ )
+				for( int x = MAX( cx - r, 0 ); x <= MIN( cx + r, iGridSize - 1 ); x++ )
+					if( (x - cx) * (x - cx) + (y - cy) * (y - cy) <= r * r )
+						fowData[x + y * iGridSize] = FOWCLEAR_MASK;
+		}
+
+		double fColumnTime = 0.0, fRowTime = 0.0;
+		bool bSame = true;
+		for( int i = 0; i < iIterations; i++ )
+		{
+			// Start each iteration from a partially converged texture
+			for( int j = 0; j < iTiles; j++ )
+				imageColumns[j] = imageRows[j] = ( j * 31 + i ) & 0xFF;
+
+			int iMinX1 = iGridSize + 1, iMaxX1 = -1, iMinY1 = iGridSize + 1, iMaxY1 = -1;
+			double fStartTime = Plat_FloatTime();
+			ConvergeFogOfWarColumns( fowData.Base(), imageColumns.Base(), iGridSize, deltaIn, deltaOut, iMinX1, iMaxX1, iMinY1, iMaxY1 );
+			fColumnTime += Plat_FloatTime() - fStartTime;
+
+			int iMinX2 = iGridSize + 1, iMaxX2 = -1, iMinY2 = iGridSize + 1, iMaxY2 = -1;
+			fStartTime = Plat_FloatTime();
+			for( int y = 0; y < iGridSize; y++ )
+			{
+				if( ConvergeFogOfWarRow( fowData.Base() + y * iGridSize, imageRows.Base() + y * iGridSize, iGridSize, deltaIn, deltaOut, iMinX2, iMaxX2 ) )
+				{
+					iMinY2 = MIN( iMinY2, y );
+					iMaxY2 = y;
+				}
+			}
+			fRowTime += Plat_FloatTime() - fStartTime;
+
+			if( iMinX1 != iMinX2 || iMaxX1 != iMaxX2 || iMinY1 != iMinY2 || iMaxY1 != iMaxY2 ||
+				V_memcmp( imageColumns.Base(), imageRows.Base(), iTiles ) != 0 )
+				bSame = false;
+		}
+
+		Msg( "Grid %4d: per column %.3f ms, per row %.3f ms (%.1fx)%s\n", iGridSize, 
+			( fColumnTime * 1000.0 ) / iIterations, ( fRowTime * 1000.0 ) / iIterations, 
+			fRowTime > 0.0 ? fColumnTime / fRowTime : 0.0, bSame ? "" : " RESULTS DIFFER!" );
+	}
+}
+
 static inline bool SetMaterialVarFloat( IMaterial* pMat, const char* pVarName, float flValue )
 {
 	Assert( pMat != NULL );
@@ -1223,6 +1688,15 @@ void CFogOfWarMgr::UpdateShared()
 
 	m_bWasFogofwarOn = true;
 
+#ifndef CLIENT_DLL
+	if( sv_fogofwar_incremental.GetBool() )
+	{
+		UpdateIncremental();
+		UpdateVisibility();
+		return;
+	}
+#endif // CLIENT_DLL
+
 	// Generate fog at the old positions of the units
 	// Memset will do the same. Might be a bit slower when there are hardly units.
 	// But we can avoid switching between lists this way and having to lookup the relationship table.
@@ -1250,13 +1724,39 @@ void CFogOfWarMgr::UpdateShared()
 
 	// Remove the fog at the new positions
 #ifndef CLIENT_DLL
-	for( FOWListInfo *pFOWList=m_pFogUpdaterListHead; pFOWList; pFOWList=pFOWList->m_pNext )
+	if( sv_fogofwar_threaded.GetBool() )
 	{
-		if( pFOWList->m_iOwnerNumber < 0 || 
-			pFOWList->m_iOwnerNumber >= FOWMAXPLAYERS )
-			continue;
+		ResetShadowCastJobs();
+
+		for( FOWListInfo *pFOWList=m_pFogUpdaterListHead; pFOWList; pFOWList=pFOWList->m_pNext )
+		{
+			if( pFOWList->m_iOwnerNumber < 0 || 
+				pFOWList->m_iOwnerNumber >= FOWMAXPLAYERS )
+				continue;
+
+			for( i=0; i<pFOWList->m_EntityList.Count(); i++ )
+			{
+				pEnt = pFOWList->m_EntityList.Element(i);
+				if( !pEnt )
+					continue;
+
+				AddShadowCaster( pFOWList->m_iOwnerNumber, pEnt, pEnt->GetViewDistance() / m_nTileSize, pEnt->EyePosition().z + 16.0f );
+			}
+		}
+
+		RunShadowCastJobs();
+		MergeShadowCastJobs();
+	}
+	else
+	{
+		for( FOWListInfo *pFOWList=m_pFogUpdaterListHead; pFOWList; pFOWList=pFOWList->m_pNext )
+		{
+			if( pFOWList->m_iOwnerNumber < 0 || 
+				pFOWList->m_iOwnerNumber >= FOWMAXPLAYERS )
+				continue;
 
-		ClearNewPositions(pFOWList, pFOWList->m_iOwnerNumber);
+			ClearNewPositions(pFOWList, pFOWList->m_iOwnerNumber);
+		}
 	}
 #else
 	for( FOWListInfo *pFOWList=m_pFogUpdaterListHead; pFOWList; pFOWList=pFOWList->m_pNext )
@@ -1272,6 +1772,10 @@ void CFogOfWarMgr::UpdateShared()
 	}
 #endif // CLIENT_DLL
 
+#ifndef CLIENT_DLL
+	RebuildBlockSummary();
+#endif // CLIENT_DLL
+
 #ifdef CLIENT_DLL
 	EndRenderFow();
 #endif // CLIENT_DLL
@@ -1294,6 +1798,14 @@ void CFogOfWarMgr::UpdateShared()
 void CFogOfWarMgr::ClearFogOfWarTo( FOWSIZE_TYPE state )
 {
 	m_FogOfWar.FillWithValue( state );
+#ifndef CLIENT_DLL
+	// Footprints no longer match the grid
+	m_bNeedsFullRebuild = true;
+
+	m_BlockVisibleAny.FillWithValue( state );
+	m_BlockVisibleAll.FillWithValue( state );
+	m_bAllBlocksChanged = true;
+#endif // CLIENT_DLL
 }
 
 //-----------------------------------------------------------------------------
@@ -1330,6 +1842,510 @@ void CFogOfWarMgr::ClearNewPositions( FOWListInfo *pFOWList, int iOwner, bool bC
 	}
 }
 
+// Octant transforms used by the shadow casting
+const static int ShadowCastMult[4][8] = {
+	{1,  0,  0,  1, -1,  0,  0, -1},
+	{0,  1,  1,  0,  0, -1, -1,  0},
+	{0,  1, -1,  0,  0, -1,  1,  0},
+	{1,  0,  0, -1, -1,  0,  0,  1},
+};
+
+#ifndef CLIENT_DLL
+//-----------------------------------------------------------------------------
+// Purpose: Incremental version of the update. Only updaters which changed tile,
+//			radius or eye height release their old footprint and acquire a new one.
+//			The grid is then recomposed within the dirty rect.
+//-----------------------------------------------------------------------------
+void CFogOfWarMgr::UpdateIncremental()
+{
+	VPROF_BUDGET( "CFogOfWarMgr::UpdateIncremental", VPROF_BUDGETGROUP_FOGOFWAR );
+
+	int i, k, radius, iOwner;
+	float eyez;
+	CBaseEntity *pEnt;
+
+	if( m_bNeedsFullRebuild || m_bIncrementalShadowCast != sv_fogofwar_shadowcast.GetBool() )
+		ResetIncremental();
+
+	// Relationship changes only require recomposing the grid, the footprints stay valid
+	bool bRecomposeAll = false;
+	for( k = 0; k < FOWMAXPLAYERS; k++ )
+	{
+		FOWSIZE_TYPE visMask = CalculatePlayerVisibilityMask( k );
+		if( visMask != m_OwnerVisibilityMask[k] )
+		{
+			m_OwnerVisibilityMask[k] = visMask;
+			bRecomposeAll = true;
+		}
+	}
+
+	// Release the footprints of changed updaters and collect them per owner
+	ResetShadowCastJobs();
+
+	int nRecast = 0;
+	for( FOWListInfo *pFOWList=m_pFogUpdaterListHead; pFOWList; pFOWList=pFOWList->m_pNext )
+	{
+		iOwner = pFOWList->m_iOwnerNumber;
+
+		for( i=0; i<pFOWList->m_EntityList.Count(); i++ )
+		{
+			pEnt = pFOWList->m_EntityList.Element(i);
+			if( !pEnt )
+				continue;
+
+			pEnt->m_iFOWOldPosX = pEnt->m_iFOWPosX;
+			pEnt->m_iFOWOldPosY = pEnt->m_iFOWPosY;
+			ComputeFOWPosition( pEnt->GetAbsOrigin(), pEnt->m_iFOWPosX, pEnt->m_iFOWPosY );
+
+			if( iOwner < 0 || iOwner >= FOWMAXPLAYERS )
+				continue;
+
+			radius = pEnt->GetViewDistance() / m_nTileSize;
+			eyez = pEnt->EyePosition().z + 16.0f;
+
+			if( pEnt->m_iFOWFootprintOwner == iOwner && 
+				pEnt->m_iFOWPosX == pEnt->m_iFOWOldPosX && pEnt->m_iFOWPosY == pEnt->m_iFOWOldPosY &&
+				pEnt->m_iFOWFootprintRadius == radius && pEnt->m_fFOWFootprintEyeZ == eyez )
+				continue;
+
+			ReleaseFootprint( pEnt );
+			pEnt->m_iFOWFootprintRadius = radius;
+			pEnt->m_fFOWFootprintEyeZ = eyez;
+			AddShadowCaster( iOwner, pEnt, radius, eyez, &pEnt->m_FOWFootprint );
+			nRecast++;
+		}
+	}
+
+	// Compute the new footprints and add the references
+	RunShadowCastJobs();
+
+	for( i = 0; i < m_ActiveShadowCastJobs.Count(); i++ )
+	{
+		FOWShadowCastJob_t *pJob = m_ActiveShadowCastJobs[i];
+		for( k = 0; k < pJob->m_Casters.Count(); k++ )
+			AcquireFootprint( pJob->m_Casters[k].m_pEnt, pJob->m_iOwner );
+	}
+
+	if( g_debug_fogofwar.GetInt() > 1 )
+	{
+		Msg("CFogOfWarMgr: incremental update recasted %d updaters, dirty rect %d %d %d %d%s\n", nRecast, 
+			m_iDirtyMinX, m_iDirtyMinY, m_iDirtyMaxX, m_iDirtyMaxY, bRecomposeAll ? " (recompose all)" : "" );
+	}
+
+	if( bRecomposeAll )
+		ComposeFogOfWar( 0, 0, m_nGridSize - 1, m_nGridSize - 1 );
+	else if( m_iDirtyMaxX != -1 )
+		ComposeFogOfWar( m_iDirtyMinX, m_iDirtyMinY, m_iDirtyMaxX, m_iDirtyMaxY );
+
+	m_iDirtyMinX = m_iDirtyMinY = INT_MAX;
+	m_iDirtyMaxX = m_iDirtyMaxY = -1;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Throws away all footprints and reference counts. All updaters will
+//			be recasted in the next incremental update.
+//-----------------------------------------------------------------------------
+void CFogOfWarMgr::ResetIncremental()
+{
+	VPROF_BUDGET( "CFogOfWarMgr::ResetIncremental", VPROF_BUDGETGROUP_FOGOFWAR );
+
+	int i;
+	CBaseEntity *pEnt;
+
+	for( i = 0; i < FOWMAXPLAYERS; i++ )
+		m_TileRefCounts[i].Purge();
+	m_TileOwnerBits.FillWithValue( 0 );
+	m_FogOfWar.FillWithValue( FOWHIDDEN_MASK );
+	m_BlockVisibleAny.FillWithValue( FOWHIDDEN_MASK );
+	m_BlockVisibleAll.FillWithValue( FOWHIDDEN_MASK );
+	m_bAllBlocksChanged = true;
+	memset( m_OwnerVisibilityMask, 0, sizeof(m_OwnerVisibilityMask) );
+
+	for( FOWListInfo *pFOWList=m_pFogUpdaterListHead; pFOWList; pFOWList=pFOWList->m_pNext )
+	{
+		for( i=0; i<pFOWList->m_EntityList.Count(); i++ )
+		{
+			pEnt = pFOWList->m_EntityList.Element(i);
+			if( !pEnt )
+				continue;
+
+			pEnt->m_FOWFootprint.RemoveAll();
+			pEnt->m_iFOWFootprintOwner = -1;
+			pEnt->m_iFOWFootprintRadius = -1;
+		}
+	}
+
+	m_iDirtyMinX = m_iDirtyMinY = INT_MAX;
+	m_iDirtyMaxX = m_iDirtyMaxY = -1;
+
+	m_bIncrementalShadowCast = sv_fogofwar_shadowcast.GetBool();
+	m_bNeedsFullRebuild = false;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Computes the tiles revealed from the given tile. Only reads the 
+//			height map, so it's safe to call from the shadow cast jobs.
+//-----------------------------------------------------------------------------
+void CFogOfWarMgr::ComputeFootprint( int x0, int y0, int radius, float eyez, CUtlVector< int > &litTiles )
+{
+	litTiles.RemoveAll();
+
+	if( sv_fogofwar_shadowcast.GetBool() )
+	{
+		// Own tile is always lit
+		if( x0 >= 0 && x0 < m_nGridSize && y0 >= 0 && y0 < m_nGridSize )
+			litTiles.AddToTail( FOWINDEX(x0, y0) );
+
+		CUtlVector< FowPos_t > EndPos;
+		for( int oct = 0; oct < 8; oct++ )
+		{
+			ShadowCast( x0, y0, 1, 1.0f, 0.0f, radius,
+					ShadowCastMult[0][oct], ShadowCastMult[1][oct],
+					ShadowCastMult[2][oct], ShadowCastMult[3][oct], FOWHIDDEN_MASK, eyez, EndPos, &litTiles );
+		}
+		return;
+	}
+
+	// Filled circle with the spans of the midpoint circle in UpdateFogOfWarState, so 
+	// the threaded and serial updates reveal the same tiles. All spans are centered 
+	// on x0, so only the widest span of each row is kept.
+	int i, x, y, ty, x1, x2;
+	CUtlVectorFixedGrowable< int, 128 > widths;
+	widths.SetCount( 2 * radius + 1 );
+	for( i = 0; i < widths.Count(); i++ )
+		widths[i] = -1;
+
+	int f = 1 - radius;
+	int ddF_x = 1;
+	int ddF_y = -2 * radius;
+	x = 0;
+	y = radius;
+
+	widths[radius] = radius;
+
+	while( x < y )
+	{
+		if( f >= 0 )
+		{
+			y -= 1;
+			ddF_y += 2;
+			f += ddF_y;
+		}
+		x += 1;
+		ddF_x += 2;
+		f += ddF_x;
+
+		widths[radius + y] = MAX( widths[radius + y], x );
+		widths[radius - y] = MAX( widths[radius - y], x );
+		widths[radius + x] = MAX( widths[radius + x], y );
+		widths[radius - x] = MAX( widths[radius - x], y );
+	}
+
+	for( i = 0; i < widths.Count(); i++ )
+	{
+		ty = y0 - radius + i;
+		if( widths[i] < 0 || ty < 0 || ty >= m_nGridSize )
+			continue;
+
+		x1 = MAX( 0, x0 - widths[i] );
+		x2 = MIN( m_nGridSize - 1, x0 + widths[i] );
+		for( x = x1; x <= x2; x++ )
+			litTiles.AddToTail( FOWINDEX(x, ty) );
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void CFogOfWarMgr::ResetShadowCastJobs()
+{
+	for( int i = 0; i < FOWMAXPLAYERS; i++ )
+	{
+		m_ShadowCastJobs[i].m_iOwner = i;
+		m_ShadowCastJobs[i].m_Casters.RemoveAll();
+		m_ShadowCastJobs[i].m_bUsesPlane = false;
+	}
+	m_ActiveShadowCastJobs.RemoveAll();
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Adds an updater to the job of the owner. Must be called from the
+//			main thread.
+//-----------------------------------------------------------------------------
+void CFogOfWarMgr::AddShadowCaster( int iOwner, CBaseEntity *pEnt, int radius, float eyez, CUtlVector< int > *pFootprint )
+{
+	Assert( iOwner >= 0 && iOwner < FOWMAXPLAYERS );
+
+	FOWShadowCastJob_t &job = m_ShadowCastJobs[iOwner];
+	if( job.m_Casters.Count() == 0 )
+		m_ActiveShadowCastJobs.AddToTail( &job );
+
+	FOWCaster_t &caster = job.m_Casters[job.m_Casters.AddToTail()];
+	caster.m_pEnt = pEnt;
+	caster.m_iX = pEnt->m_iFOWPosX;
+	caster.m_iY = pEnt->m_iFOWPosY;
+	caster.m_iRadius = radius;
+	caster.m_fEyeZ = eyez;
+	caster.m_pFootprint = pFootprint;
+	if( !pFootprint )
+		job.m_bUsesPlane = true;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Runs the jobs of all owners with updaters. 
+//-----------------------------------------------------------------------------
+void CFogOfWarMgr::RunShadowCastJobs()
+{
+	VPROF_BUDGET( "CFogOfWarMgr::RunShadowCastJobs", VPROF_BUDGETGROUP_FOGOFWAR );
+
+	if( m_ActiveShadowCastJobs.Count() == 0 )
+		return;
+
+	if( sv_fogofwar_threaded.GetBool() && m_ActiveShadowCastJobs.Count() > 1 )
+	{
+		ParallelProcess( m_ActiveShadowCastJobs.Base(), m_ActiveShadowCastJobs.Count(), this, &CFogOfWarMgr::ProcessShadowCastJob );
+	}
+	else
+	{
+		for( int i = 0; i < m_ActiveShadowCastJobs.Count(); i++ )
+			ProcessShadowCastJob( m_ActiveShadowCastJobs[i] );
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Shadow casts all updaters of one owner. Only writes to the job and
+//			to the footprints of the casters of this job.
+//-----------------------------------------------------------------------------
+void CFogOfWarMgr::ProcessShadowCastJob( FOWShadowCastJob_t *&pJob )
+{
+	int i, j, idx;
+
+	// In incremental mode all casters have a footprint, so the plane is not needed
+	uint32 *pPlane = NULL;
+	if( pJob->m_bUsesPlane )
+	{
+		pJob->m_VisiblePlane.SetCount( ( m_nGridSize*m_nGridSize + 31 ) >> 5 );
+		pJob->m_VisiblePlane.FillWithValue( 0 );
+		pPlane = pJob->m_VisiblePlane.Base();
+	}
+
+	for( i = 0; i < pJob->m_Casters.Count(); i++ )
+	{
+		FOWCaster_t &caster = pJob->m_Casters[i];
+		if( caster.m_pFootprint )
+		{
+			ComputeFootprint( caster.m_iX, caster.m_iY, caster.m_iRadius, caster.m_fEyeZ, *caster.m_pFootprint );
+			continue;
+		}
+
+		ComputeFootprint( caster.m_iX, caster.m_iY, caster.m_iRadius, caster.m_fEyeZ, pJob->m_LitTiles );
+		for( j = 0; j < pJob->m_LitTiles.Count(); j++ )
+		{
+			idx = pJob->m_LitTiles[j];
+			pPlane[idx >> 5] |= ( 1u << ( idx & 31 ) );
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Ors the bit plane of each job into the grid, using the visibility 
+//			mask of the owner.
+//-----------------------------------------------------------------------------
+void CFogOfWarMgr::MergeShadowCastJobs()
+{
+	VPROF_BUDGET( "CFogOfWarMgr::MergeShadowCastJobs", VPROF_BUDGETGROUP_FOGOFWAR );
+
+	int i, w, bit, nWords;
+	uint32 word;
+	FOWSIZE_TYPE *pFogOfWar = m_FogOfWar.Base();
+
+	for( i = 0; i < m_ActiveShadowCastJobs.Count(); i++ )
+	{
+		FOWShadowCastJob_t *pJob = m_ActiveShadowCastJobs[i];
+		if( !pJob->m_bUsesPlane )
+			continue;
+
+		FOWSIZE_TYPE visMask = CalculatePlayerVisibilityMask( pJob->m_iOwner );
+		const uint32 *pWords = pJob->m_VisiblePlane.Base();
+		nWords = pJob->m_VisiblePlane.Count();
+		for( w = 0; w < nWords; w++ )
+		{
+			// Most of the grid is usually not visible
+			word = pWords[w];
+			for( bit = 0; word != 0; bit++, word >>= 1 )
+			{
+				if( word & 1 )
+					pFogOfWar[(w << 5) + bit] |= visMask;
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Adds a reference for each tile in the footprint for the given owner.
+//-----------------------------------------------------------------------------
+void CFogOfWarMgr::AcquireFootprint( CBaseEntity *pEnt, int iOwner )
+{
+	CUtlVector< unsigned short > &refCounts = m_TileRefCounts[iOwner];
+	if( refCounts.Count() != m_nGridSize*m_nGridSize )
+	{
+		// Allocated on demand, most maps don't use all owners
+		refCounts.SetCount( m_nGridSize*m_nGridSize );
+		refCounts.FillWithValue( 0 );
+	}
+
+	FOWSIZE_TYPE ownerBit = (1 << iOwner);
+	unsigned short *pRefCounts = refCounts.Base();
+	FOWSIZE_TYPE *pOwnerBits = m_TileOwnerBits.Base();
+
+	int idx;
+	for( int i = 0; i < pEnt->m_FOWFootprint.Count(); i++ )
+	{
+		idx = pEnt->m_FOWFootprint[i];
+		if( pRefCounts[idx]++ == 0 )
+		{
+			pOwnerBits[idx] |= ownerBit;
+			MarkTileDirty( idx % m_nGridSize, idx / m_nGridSize );
+		}
+	}
+
+	pEnt->m_iFOWFootprintOwner = iOwner;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Removes the references added by AcquireFootprint.
+//-----------------------------------------------------------------------------
+void CFogOfWarMgr::ReleaseFootprint( CBaseEntity *pEnt )
+{
+	int iOwner = pEnt->m_iFOWFootprintOwner;
+	if( iOwner >= 0 && iOwner < FOWMAXPLAYERS && 
+		m_TileRefCounts[iOwner].Count() == m_nGridSize*m_nGridSize && m_TileOwnerBits.Count() == m_nGridSize*m_nGridSize )
+	{
+		FOWSIZE_TYPE ownerBit = (1 << iOwner);
+		unsigned short *pRefCounts = m_TileRefCounts[iOwner].Base();
+		FOWSIZE_TYPE *pOwnerBits = m_TileOwnerBits.Base();
+
+		int idx;
+		for( int i = 0; i < pEnt->m_FOWFootprint.Count(); i++ )
+		{
+			idx = pEnt->m_FOWFootprint[i];
+			Assert( pRefCounts[idx] > 0 );
+			if( --pRefCounts[idx] == 0 )
+			{
+				pOwnerBits[idx] &= ~ownerBit;
+				MarkTileDirty( idx % m_nGridSize, idx / m_nGridSize );
+			}
+		}
+	}
+
+	pEnt->m_FOWFootprint.RemoveAll();
+	pEnt->m_iFOWFootprintOwner = -1;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void CFogOfWarMgr::MarkTileDirty( int x, int y )
+{
+	m_iDirtyMinX = MIN( m_iDirtyMinX, x );
+	m_iDirtyMaxX = MAX( m_iDirtyMaxX, x );
+	m_iDirtyMinY = MIN( m_iDirtyMinY, y );
+	m_iDirtyMaxY = MAX( m_iDirtyMaxY, y );
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Translates the owner bits of the tiles in the rect to the visibility
+//			bits of the fog of war grid (i.e. allies see the tiles of each other).
+//-----------------------------------------------------------------------------
+void CFogOfWarMgr::ComposeFogOfWar( int iMinX, int iMinY, int iMaxX, int iMaxY )
+{
+	VPROF_BUDGET( "CFogOfWarMgr::ComposeFogOfWar", VPROF_BUDGETGROUP_FOGOFWAR );
+
+	int x, y, k, idx;
+	FOWSIZE_TYPE ownerBits, visMask;
+	const FOWSIZE_TYPE *pOwnerBits = m_TileOwnerBits.Base();
+	FOWSIZE_TYPE *pFogOfWar = m_FogOfWar.Base();
+	unsigned char *pBlockChanged = m_BlockChanged.Base();
+
+	for( y = iMinY; y <= iMaxY; y++ )
+	{
+		idx = y * m_nGridSize + iMinX;
+		for( x = iMinX; x <= iMaxX; x++, idx++ )
+		{
+			visMask = FOWHIDDEN_MASK;
+			for( k = 0, ownerBits = pOwnerBits[idx]; ownerBits != 0; k++, ownerBits >>= 1 )
+			{
+				if( ownerBits & 1 )
+					visMask |= m_OwnerVisibilityMask[k];
+			}
+			if( pFogOfWar[idx] != visMask )
+			{
+				pFogOfWar[idx] = visMask;
+				pBlockChanged[(x >> FOWBLOCK_SHIFT) + (y >> FOWBLOCK_SHIFT) * m_nBlockGridSize] = 1;
+			}
+		}
+	}
+
+	UpdateBlockSummary( iMinX, iMinY, iMaxX, iMaxY );
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Recomputes the owners seeing any and all tiles of the blocks 
+//			overlapping the tile rect.
+//-----------------------------------------------------------------------------
+void CFogOfWarMgr::UpdateBlockSummary( int iMinX, int iMinY, int iMaxX, int iMaxY )
+{
+	VPROF_BUDGET( "CFogOfWarMgr::UpdateBlockSummary", VPROF_BUDGETGROUP_FOGOFWAR );
+
+	int bx, by, x, y, iEndX, iEndY, bidx;
+	FOWSIZE_TYPE visAny, visAll;
+	const FOWSIZE_TYPE *pFogOfWar = m_FogOfWar.Base();
+	const FOWSIZE_TYPE *pRow;
+
+	iMinX = MAX( iMinX, 0 ) >> FOWBLOCK_SHIFT;
+	iMinY = MAX( iMinY, 0 ) >> FOWBLOCK_SHIFT;
+	iMaxX = MIN( iMaxX, m_nGridSize - 1 ) >> FOWBLOCK_SHIFT;
+	iMaxY = MIN( iMaxY, m_nGridSize - 1 ) >> FOWBLOCK_SHIFT;
+
+	for( by = iMinY; by <= iMaxY; by++ )
+	{
+		iEndY = MIN( (by + 1) << FOWBLOCK_SHIFT, m_nGridSize );
+		for( bx = iMinX; bx <= iMaxX; bx++ )
+		{
+			iEndX = MIN( (bx + 1) << FOWBLOCK_SHIFT, m_nGridSize );
+			visAny = FOWHIDDEN_MASK;
+			visAll = FOWCLEAR_MASK;
+			for( y = by << FOWBLOCK_SHIFT; y < iEndY; y++ )
+			{
+				pRow = pFogOfWar + y * m_nGridSize;
+				for( x = bx << FOWBLOCK_SHIFT; x < iEndX; x++ )
+				{
+					visAny |= pRow[x];
+					visAll &= pRow[x];
+				}
+			}
+
+			bidx = bx + by * m_nBlockGridSize;
+			m_BlockVisibleAny[bidx] = visAny;
+			m_BlockVisibleAll[bidx] = visAll;
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Recomputes the whole summary after the grid was written directly
+//			(i.e. the non incremental update).
+//-----------------------------------------------------------------------------
+void CFogOfWarMgr::RebuildBlockSummary()
+{
+	if( m_nBlockGridSize <= 0 )
+		return;
+
+	UpdateBlockSummary( 0, 0, m_nGridSize - 1, m_nGridSize - 1 );
+	m_bAllBlocksChanged = true;
+}
+#endif // CLIENT_DLL
+
 //-----------------------------------------------------------------------------
 // Purpose: Calculates visiblity mask for the specified owner/player (i.e. can see allies).
 //-----------------------------------------------------------------------------
@@ -1394,7 +2410,8 @@ void CFogOfWarMgr::UpdateFogOfWarState( int x0, int y0, int radius, FOWSIZE_TYPE
 // Purpose: See DoShadowCasting.
 //-----------------------------------------------------------------------------
 void CFogOfWarMgr::ShadowCast( int cx, int cy, int row, float start, float end,
-								int radius, int xx, int xy, int yx, int yy, FOWSIZE_TYPE mask, float eyez, CUtlVector< FowPos_t > &EndPos )
+								int radius, int xx, int xy, int yx, int yy, FOWSIZE_TYPE mask, float eyez, CUtlVector< FowPos_t > &EndPos,
+								CUtlVector< int > *pLitTiles )
 {
 	if( start < end )
 		return;
@@ -1429,11 +2446,19 @@ void CFogOfWarMgr::ShadowCast( int cx, int cy, int row, float start, float end,
 				int sqrdist =  dx*dx + dy*dy;
 				if( sqrdist < radius_squared )
 				{
+					if( pLitTiles )
+					{
+						if( X >= 0 && X < m_nGridSize && Y >= 0 && Y < m_nGridSize )
+							pLitTiles->AddToTail( FOWINDEX(X, Y) );
+					}
+					else
+					{
 #ifdef CLIENT_DLL
-					m_FogOfWar[FOWINDEX(X, Y)] = FOWCLEAR_MASK;
+						m_FogOfWar[FOWINDEX(X, Y)] = FOWCLEAR_MASK;
 #else
-					m_FogOfWar[FOWINDEX(X, Y)] |= mask;
+						m_FogOfWar[FOWINDEX(X, Y)] |= mask;
 #endif // CLIENT_DLL
+					}
 				}
 				else
 				{
@@ -1471,7 +2496,7 @@ void CFogOfWarMgr::ShadowCast( int cx, int cy, int row, float start, float end,
                         // This is a blocking square, start a child scan:
                         blocked = true;
                         ShadowCast(cx, cy, j+1, start, l_slope,
-                                         radius, xx, xy, yx, yy, mask, eyez, EndPos );
+                                         radius, xx, xy, yx, yy, mask, eyez, EndPos, pLitTiles );
                         new_start = r_slope;
 					}
 				}
@@ -1485,13 +2510,6 @@ void CFogOfWarMgr::ShadowCast( int cx, int cy, int row, float start, float end,
 	}
 }
 
-const static int ShadowCastMult[4][8] = {
-	{1,  0,  0,  1, -1,  0,  0, -1},
-	{0,  1,  1,  0,  0, -1, -1,  0},
-	{0,  1, -1,  0,  0, -1,  1,  0},
-	{1,  0,  0, -1, -1,  0,  0,  1},
-};
-
 ConVar fow_test_printendpos("fow_test_printendpos", "0", FCVAR_CHEAT|FCVAR_REPLICATED);
 ConVar fow_test_singleoct("fow_test_singleoct", "-1", FCVAR_CHEAT|FCVAR_REPLICATED);
 
@@ -1514,16 +2532,24 @@ int FowPointSort( FowPos_t const *a, FowPos_t const *b )
 // Purpose: Performs shadow casting.
 // Based on: http://roguebasin.roguelikedevelopment.org/index.php?title=FOV_using_recursive_shadowcasting
 //-----------------------------------------------------------------------------
-void CFogOfWarMgr::DoShadowCasting( CBaseEntity *pEnt, int radius, FOWSIZE_TYPE mask )
+void CFogOfWarMgr::DoShadowCasting( CBaseEntity *pEnt, int radius, FOWSIZE_TYPE mask, CUtlVector< int > *pLitTiles )
 {
 	// Own tile is always lit
 	int X = pEnt->m_iFOWPosX;
 	int Y = pEnt->m_iFOWPosY;
+	if( pLitTiles )
+	{
+		if( X >= 0 && X < m_nGridSize && Y >= 0 && Y < m_nGridSize )
+			pLitTiles->AddToTail( FOWINDEX(X, Y) );
+	}
+	else
+	{
 #ifdef CLIENT_DLL
-					m_FogOfWar[FOWINDEX(X, Y)] = FOWCLEAR_MASK;
+		m_FogOfWar[FOWINDEX(X, Y)] = FOWCLEAR_MASK;
 #else
-					m_FogOfWar[FOWINDEX(X, Y)] |= mask;
+		m_FogOfWar[FOWINDEX(X, Y)] |= mask;
 #endif // CLIENT_DLL
+	}
 
 	CUtlVector< FowPos_t > EndPos;
 
@@ -1535,7 +2561,7 @@ void CFogOfWarMgr::DoShadowCasting( CBaseEntity *pEnt, int radius, FOWSIZE_TYPE
 		{
 			ShadowCast( X, Y, 1, 1.0f, 0.0f, radius,
 					ShadowCastMult[0][oct], ShadowCastMult[1][oct],
-					ShadowCastMult[2][oct], ShadowCastMult[3][oct], mask, pEnt->EyePosition().z + 16.0f, EndPos );
+					ShadowCastMult[2][oct], ShadowCastMult[3][oct], mask, pEnt->EyePosition().z + 16.0f, EndPos, pLitTiles );
 		}
 	}
 	else
@@ -1543,7 +2569,7 @@ void CFogOfWarMgr::DoShadowCasting( CBaseEntity *pEnt, int radius, FOWSIZE_TYPE
 		int oct = fow_test_singleoct.GetInt();
 		ShadowCast( X, Y, 1, 1.0f, 0.0f, radius,
 				ShadowCastMult[0][oct], ShadowCastMult[1][oct],
-				ShadowCastMult[2][oct], ShadowCastMult[3][oct], mask, pEnt->EyePosition().z + 16.0f, EndPos );
+				ShadowCastMult[2][oct], ShadowCastMult[3][oct], mask, pEnt->EyePosition().z + 16.0f, EndPos, pLitTiles );
 	}
 
 #ifdef CLIENT_DLL
@@ -1588,6 +2614,10 @@ void CFogOfWarMgr::UpdateVisibility()
 	C_HL2WarsPlayer *pPlayer = C_HL2WarsPlayer::GetLocalHL2WarsPlayer();
 	if( !pPlayer )
 		return;
+#else
+	// Entities can only change status if they changed tile or a tile in their block changed
+	bool bUseSummary = sv_fogofwar_summary.GetBool() && !m_bAllBlocksChanged && m_BlockChanged.Count() > 0;
+	int nSkipped = 0;
 #endif // CLIENT_DLL
 
 	// Update all entities that are affected by the fog of war
@@ -1625,6 +2655,7 @@ void CFogOfWarMgr::UpdateVisibility()
 			pEnt->UpdateVisibility();
 #else
 			memset( pEnt->m_bInFOW, false, FOWMAXPLAYERS*sizeof(bool) );
+			UpdateTransmitBits( pEnt );
 			pEnt->DispatchUpdateTransmitState();
 #endif // CLIENT_DLL
 			continue;
@@ -1678,22 +2709,43 @@ void CFogOfWarMgr::UpdateVisibility()
 			}
 		}
 #else
-		bool bNeedsUpdateTransmitState = false;
-		for( int j=0; j<FOWMAXPLAYERS; j++ )
+		if( bUseSummary && pEnt->m_iFOWPosX == pEnt->m_iFOWOldPosX && pEnt->m_iFOWPosY == pEnt->m_iFOWOldPosY &&
+			!m_BlockChanged[GetBlockIndex( pEnt->m_iFOWPosX, pEnt->m_iFOWPosY )] )
 		{
-			infow = (m_FogOfWar[FOWINDEX(pEnt->m_iFOWPosX, pEnt->m_iFOWPosY)] & (1 << j)) == 0;
-			if( infow != pEnt->IsInFOW(j) )
+			nSkipped++;
+			continue;
+		}
+
+		FOWSIZE_TYPE changedMask = ComputeVisibilityChange( pEnt );
+		if( changedMask != 0 )
+		{
+			for( int j=0; j<FOWMAXPLAYERS; j++ )
 			{
+				if( (changedMask & (1 << j)) == 0 )
+					continue;
+
+				infow = !pEnt->m_bInFOW[j];
 				if( g_debug_fogofwar.GetBool() )
 					Msg("#%d Ent %s changed to fow status %d for owner %d (tile: %d %d)\n", pEnt->entindex(), pEnt->GetClassname(), infow, j, pEnt->m_iFOWPosX, pEnt->m_iFOWPosY);
 				pEnt->m_bInFOW[j] = infow;
-				bNeedsUpdateTransmitState = true;
 			}
+
+			UpdateTransmitBits( pEnt );
+
+			// The transmit state does not depend on the fow status, CheckTransmit reads the transmit bits
+			if( !sv_fogofwar_transmitbits.GetBool() )
+				pEnt->DispatchUpdateTransmitState();
 		}
-		if( bNeedsUpdateTransmitState )
-			pEnt->DispatchUpdateTransmitState();
 #endif // CLIENT_DLL
 	}
+
+#ifndef CLIENT_DLL
+	if( m_BlockChanged.Count() > 0 )
+		memset( m_BlockChanged.Base(), 0, m_BlockChanged.Count() );
+	m_bAllBlocksChanged = false;
+
+	VPROF_INCREMENT_COUNTER( "FOW: UpdateVisibility skipped", nSkipped );
+#endif // CLIENT_DLL
 }
 
 //-----------------------------------------------------------------------------
@@ -1726,7 +2778,11 @@ void CFogOfWarMgr::RemoveFogUpdater(int owner, CBaseEntity *pEnt )
 	int radius;
 	radius = pEnt->GetViewDistance() / m_nTileSize;
 
-	// NOTE: Fog of war array is always reset completely, so no need to hide the fog
+	// NOTE: Fog of war array is always reset completely in the non incremental mode, so no need to hide the fog.
+	//		 In the incremental mode the tiles revealed by this entity are released and recomposed next update.
+#ifndef CLIENT_DLL
+	ReleaseFootprint( pEnt );
+#endif // CLIENT_DLL
 
 	FOWRemoveEntity(&m_pFogUpdaterListHead, owner, pEnt); 
 }
@@ -1741,6 +2797,9 @@ void CFogOfWarMgr::AddFogEntity(CBaseEntity *pEnt)
 		m_FogEntities.AddToTail(pEnt);
 		pEnt->m_iFOWPosX = pEnt->m_iFOWPosY = -1;
 	}
+#ifndef CLIENT_DLL
+	UpdateTransmitBits( pEnt );
+#endif // CLIENT_DLL
 }
 
 //-----------------------------------------------------------------------------
@@ -1749,7 +2808,417 @@ void CFogOfWarMgr::AddFogEntity(CBaseEntity *pEnt)
 void CFogOfWarMgr::RemoveFogEntity(CBaseEntity *pEnt )
 {
 	m_FogEntities.FindAndRemove(pEnt);
+#ifndef CLIENT_DLL
+	ClearTransmitBits( pEnt->entindex() );
+#endif // CLIENT_DLL
+}
+
+#ifndef CLIENT_DLL
+//-----------------------------------------------------------------------------
+// Purpose: Returns the owners for which the fow status of the entity differs 
+//			from the fog of war at its tile.
+//-----------------------------------------------------------------------------
+FOWSIZE_TYPE CFogOfWarMgr::ComputeVisibilityChange( CBaseEntity *pEnt )
+{
+	int x, y, j;
+	if( pEnt->m_iFOWPosX == -1 )
+		ComputeFOWPosition( pEnt->GetAbsOrigin(), x, y );
+	else
+	{
+		x = pEnt->m_iFOWPosX;
+		y = pEnt->m_iFOWPosY;
+	}
+	x = clamp( x, 0, m_nGridSize - 1 );
+	y = clamp( y, 0, m_nGridSize - 1 );
+
+	FOWSIZE_TYPE oldMask = FOWHIDDEN_MASK;
+	for( j = 0; j < FOWMAXPLAYERS; j++ )
+	{
+		if( !pEnt->m_bInFOW[j] )
+			oldMask |= ( 1 << j );
+	}
+	return m_FogOfWar[FOWINDEX(x, y)] ^ oldMask;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Computes for each entity the owners for which the entity will change
+//			fow status in the next UpdateVisibility. Returns the number of
+//			entities which change.
+//-----------------------------------------------------------------------------
+int CFogOfWarMgr::ComputeVisibilityChanges( CBaseEntity * const *pEnts, int iCount, FOWSIZE_TYPE *pChangedMasks )
+{
+	int i, nChanged = 0;
+
+	if( m_nGridSize <= 0 )
+	{
+		memset( pChangedMasks, 0, iCount * sizeof(FOWSIZE_TYPE) );
+		return 0;
+	}
+
+	for( i = 0; i < iCount; i++ )
+	{
+		pChangedMasks[i] = pEnts[i] ? ComputeVisibilityChange( pEnts[i] ) : FOWHIDDEN_MASK;
+		if( pChangedMasks[i] != 0 )
+			nChanged++;
+	}
+	return nChanged;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Computes for each point the owners seeing it.
+//-----------------------------------------------------------------------------
+void CFogOfWarMgr::ComputeVisibleMasks( const Vector *pPoints, int iCount, FOWSIZE_TYPE *pVisibleMasks )
+{
+	int i, x, y;
+
+	if( m_nGridSize <= 0 )
+	{
+		memset( pVisibleMasks, 0, iCount * sizeof(FOWSIZE_TYPE) );
+		return;
+	}
+
+	for( i = 0; i < iCount; i++ )
+	{
+		ComputeFOWPosition( pPoints[i], x, y );
+		x = clamp( x, 0, m_nGridSize - 1 );
+		y = clamp( y, 0, m_nGridSize - 1 );
+		pVisibleMasks[i] = m_FogOfWar[FOWINDEX(x, y)];
+	}
+}
+
+#ifndef DISABLE_PYTHON
+//-----------------------------------------------------------------------------
+// Purpose: Python version of ComputeVisibleMasks. Takes a sequence of points
+//			and returns a list with the mask of owners seeing each point.
+//-----------------------------------------------------------------------------
+bp::list CFogOfWarMgr::PyComputeVisibleMasks( bp::object points )
+{
+	int i, iCount = bp::len( points );
+
+	CUtlVector< Vector > vecPoints;
+	vecPoints.SetCount( iCount );
+	for( i = 0; i < iCount; i++ )
+		vecPoints[i] = bp::extract< Vector >( points[i] );
+
+	CUtlVector< FOWSIZE_TYPE > masks;
+	masks.SetCount( iCount );
+	ComputeVisibleMasks( vecPoints.Base(), iCount, masks.Base() );
+
+	bp::list result;
+	for( i = 0; i < iCount; i++ )
+		result.append( (int)masks[i] );
+	return result;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Python version of ComputeVisibilityChanges. Takes a sequence of 
+//			entities (None is allowed) and returns a list with the mask of 
+//			owners for which each entity changes fow status.
+//-----------------------------------------------------------------------------
+bp::list CFogOfWarMgr::PyComputeVisibilityChanges( bp::object entities )
+{
+	int i, iCount = bp::len( entities );
+
+	CUtlVector< CBaseEntity * > ents;
+	ents.SetCount( iCount );
+	for( i = 0; i < iCount; i++ )
+		ents[i] = bp::extract< CBaseEntity * >( entities[i] );
+
+	CUtlVector< FOWSIZE_TYPE > masks;
+	masks.SetCount( iCount );
+	ComputeVisibilityChanges( ents.Base(), iCount, masks.Base() );
+
+	bp::list result;
+	for( i = 0; i < iCount; i++ )
+		result.append( (int)masks[i] );
+	return result;
+}
+#endif // DISABLE_PYTHON
+
+//-----------------------------------------------------------------------------
+// Purpose: Returns true if any tile in the box is visible to the owner.
+//-----------------------------------------------------------------------------
+bool CFogOfWarMgr::IsAnyTileVisibleInBox( const Vector &vMins, const Vector &vMaxs, int iOwner )
+{
+	int iMinX, iMinY, iMaxX, iMaxY;
+	ComputeFOWPosition( vMins, iMinX, iMinY );
+	ComputeFOWPosition( vMaxs, iMaxX, iMaxY );
+	return TestTileRectVisibility( iMinX, iMinY, iMaxX, iMaxY, iOwner, false, sv_fogofwar_summary.GetBool() );
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Returns true if all tiles in the box are visible to the owner.
+//-----------------------------------------------------------------------------
+bool CFogOfWarMgr::IsBoxFullyVisible( const Vector &vMins, const Vector &vMaxs, int iOwner )
+{
+	int iMinX, iMinY, iMaxX, iMaxY;
+	ComputeFOWPosition( vMins, iMinX, iMinY );
+	ComputeFOWPosition( vMaxs, iMaxX, iMaxY );
+	return TestTileRectVisibility( iMinX, iMinY, iMaxX, iMaxY, iOwner, true, sv_fogofwar_summary.GetBool() );
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Tests the tiles of a rect. Returns true if all tiles are visible 
+//			(bFully) or if any tile is visible.
+//-----------------------------------------------------------------------------
+static bool FOWScanTileRect( const FOWSIZE_TYPE *pFogOfWar, int iGridSize, int iMinX, int iMinY, int iMaxX, int iMaxY, 
+							FOWSIZE_TYPE ownerBit, bool bFully )
+{
+	int x, y;
+	const FOWSIZE_TYPE *pRow;
+	for( y = iMinY; y <= iMaxY; y++ )
+	{
+		pRow = pFogOfWar + y * iGridSize;
+		for( x = iMinX; x <= iMaxX; x++ )
+		{
+			if( ( ( pRow[x] & ownerBit ) != 0 ) != bFully )
+				return !bFully;
+		}
+	}
+	return bFully;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Tile rect version of the box queries. The summary skips the blocks
+//			which are fully hidden or fully visible, so only blocks with mixed
+//			visibility for the owner are tested per tile.
+//-----------------------------------------------------------------------------
+bool CFogOfWarMgr::TestTileRectVisibility( int iMinX, int iMinY, int iMaxX, int iMaxY, int iOwner, bool bFully, bool bUseSummary )
+{
+	if( iOwner < 0 || iOwner >= FOWMAXPLAYERS || m_nGridSize <= 0 )
+		return false;
+
+	iMinX = MAX( iMinX, 0 );
+	iMinY = MAX( iMinY, 0 );
+	iMaxX = MIN( iMaxX, m_nGridSize - 1 );
+	iMaxY = MIN( iMaxY, m_nGridSize - 1 );
+	if( iMinX > iMaxX || iMinY > iMaxY )
+		return false;
+
+	FOWSIZE_TYPE ownerBit = ( 1 << iOwner );
+	const FOWSIZE_TYPE *pFogOfWar = m_FogOfWar.Base();
+
+	if( !bUseSummary || m_BlockVisibleAny.Count() == 0 )
+		return FOWScanTileRect( pFogOfWar, m_nGridSize, iMinX, iMinY, iMaxX, iMaxY, ownerBit, bFully );
+
+	int bx, by, bidx;
+	for( by = iMinY >> FOWBLOCK_SHIFT; by <= ( iMaxY >> FOWBLOCK_SHIFT ); by++ )
+	{
+		for( bx = iMinX >> FOWBLOCK_SHIFT; bx <= ( iMaxX >> FOWBLOCK_SHIFT ); bx++ )
+		{
+			bidx = bx + by * m_nBlockGridSize;
+			if( bFully )
+			{
+				if( m_BlockVisibleAll[bidx] & ownerBit )
+					continue;
+				if( ( m_BlockVisibleAny[bidx] & ownerBit ) == 0 )
+					return false;
+			}
+			else
+			{
+				if( ( m_BlockVisibleAny[bidx] & ownerBit ) == 0 )
+					continue;
+				if( m_BlockVisibleAll[bidx] & ownerBit )
+					return true;
+			}
+
+			// Mixed block, test the tiles of the block inside the rect
+			if( FOWScanTileRect( pFogOfWar, m_nGridSize, 
+					MAX( iMinX, bx << FOWBLOCK_SHIFT ), MAX( iMinY, by << FOWBLOCK_SHIFT ), 
+					MIN( iMaxX, ( ( bx + 1 ) << FOWBLOCK_SHIFT ) - 1 ), MIN( iMaxY, ( ( by + 1 ) << FOWBLOCK_SHIFT ) - 1 ), 
+					ownerBit, bFully ) != bFully )
+				return !bFully;
+		}
+	}
+	return bFully;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Updates the transmit bits of an entity from its fow flags and fow status.
+//-----------------------------------------------------------------------------
+void CFogOfWarMgr::UpdateTransmitBits( CBaseEntity *pEnt )
+{
+	int iEntIndex = pEnt->entindex();
+	if( iEntIndex < 0 || iEntIndex >= MAX_EDICTS )
+		return;
+
+	int nFlags = pEnt->GetFOWFlags();
+	if( nFlags & FOWFLAG_NOTRANSMIT )
+		m_TransmitFogEntities.Set( iEntIndex );
+	else
+		m_TransmitFogEntities.Clear( iEntIndex );
+
+	if( nFlags & FOWFLAG_HIDDEN )
+		m_TransmitHiddenEntities.Set( iEntIndex );
+	else
+		m_TransmitHiddenEntities.Clear( iEntIndex );
+
+	for( int i = 0; i < FOWMAXPLAYERS; i++ )
+	{
+		if( pEnt->m_bInFOW[i] )
+			m_TransmitVisible[i].Clear( iEntIndex );
+		else
+			m_TransmitVisible[i].Set( iEntIndex );
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void CFogOfWarMgr::ClearTransmitBits( int iEntIndex )
+{
+	if( iEntIndex < 0 || iEntIndex >= MAX_EDICTS )
+		return;
+
+	m_TransmitFogEntities.Clear( iEntIndex );
+	m_TransmitHiddenEntities.Clear( iEntIndex );
+	for( int i = 0; i < FOWMAXPLAYERS; i++ )
+		m_TransmitVisible[i].Clear( iEntIndex );
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Computes the entities which should not be transmitted to the player,
+//			because they are in the fog of war. Same rules as 
+//			CBaseEntity::ShouldTransmitInFOW: entities that are not hidden
+//			are still send once, so those are left out until known.
+//			Returns false if the fog of war does not block anything for this player.
+//-----------------------------------------------------------------------------
+bool CFogOfWarMgr::ComputeTransmitBlocked( CBasePlayer *pPlayer, CBitVec<MAX_EDICTS> &blocked )
+{
+	if( !sv_fogofwar_transmitbits.GetBool() || sv_fogofwar.GetBool() == false )
+		return false;
+
+	int iOwner = pPlayer->GetOwnerNumber();
+	if( pPlayer->IsObserver() && iOwner == 0 )
+		return false;
+
+	if( iOwner < 0 || iOwner >= FOWMAXPLAYERS )
+		return false;
+
+	int iPlayerIndex = pPlayer->entindex() - 1;
+	if( iPlayerIndex < 0 || iPlayerIndex >= MAX_PLAYERS )
+		return false;
+
+	const uint32 *pFog = m_TransmitFogEntities.Base();
+	const uint32 *pHidden = m_TransmitHiddenEntities.Base();
+	const uint32 *pVisible = m_TransmitVisible[iOwner].Base();
+	const uint32 *pKnown = m_KnownEntities[iPlayerIndex].Base();
+	uint32 *pBlocked = blocked.Base();
+	for( int i = 0; i < blocked.GetNumDWords(); i++ )
+		pBlocked[i] = pFog[i] & ~pVisible[i] & ( pHidden[i] | pKnown[i] );
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Benchmark of the fog of war part of CheckTransmit on synthetic
+//			entities, testing each entity against the transmit bits.
+//-----------------------------------------------------------------------------
+struct FOWTransmitBenchmarkEnt_t
+{
+	int m_nFOWFlags;
+	bool m_bInFOW[FOWMAXPLAYERS];
+};
+
+CON_COMMAND_F( sv_fogofwar_transmit_benchmark, "Measures the fog of war transmit checks per snapshot on synthetic entities, per entity versus the transmit bits.\n\tArguments: [entities] [players] [snapshots]", FCVAR_CHEAT )
+{
+	if ( !UTIL_IsCommandIssuedByServerAdmin() )
+		return;
+
+	int nEntities = args.ArgC() > 1 ? atoi( args[1] ) : 2000;
+	int nPlayers = args.ArgC() > 2 ? atoi( args[2] ) : 8;
+	int nSnapshots = args.ArgC() > 3 ? atoi( args[3] ) : 100;
+	nEntities = clamp( nEntities, 1, MAX_EDICTS - 1 );
+	nPlayers = clamp( nPlayers, 1, FOWMAXPLAYERS );
+	nSnapshots = MAX( nSnapshots, 1 );
+
+	int i, j, iSnapshot, iPlayer;
+
+	// Half of the entities are hidden, each entity is visible to about a third of the owners
+	CUtlVector< FOWTransmitBenchmarkEnt_t > ents;
+	ents.SetCount( nEntities );
+	CBitVec<MAX_EDICTS> fog, hidden, known, blocked;
+	CBitVec<MAX_EDICTS> *pVisible = new CBitVec<MAX_EDICTS>[FOWMAXPLAYERS];
+	fog.ClearAll();
+	hidden.ClearAll();
+	known.SetAll();
+	for( j = 0; j < FOWMAXPLAYERS; j++ )
+		pVisible[j].ClearAll();
+	for( i = 0; i < nEntities; i++ )
+	{
+		ents[i].m_nFOWFlags = FOWFLAG_NOTRANSMIT | ( ( i & 1 ) ? FOWFLAG_HIDDEN : 0 );
+		fog.Set( i );
+		if( i & 1 )
+			hidden.Set( i );
+		for( j = 0; j < FOWMAXPLAYERS; j++ )
+		{
+			ents[i].m_bInFOW[j] = RandomInt( 0, 2 ) != 0;
+			if( !ents[i].m_bInFOW[j] )
+				pVisible[j].Set( i );
+		}
+	}
+
+	// Per entity, like ShouldTransmitInFOW
+	int nEntitySend = 0;
+	double fStartTime = Plat_FloatTime();
+	for( iSnapshot = 0; iSnapshot < nSnapshots; iSnapshot++ )
+	{
+		nEntitySend = 0;
+		for( iPlayer = 0; iPlayer < nPlayers; iPlayer++ )
+		{
+			for( i = 0; i < nEntities; i++ )
+			{
+				const FOWTransmitBenchmarkEnt_t &ent = ents[i];
+				if( ( ent.m_nFOWFlags & FOWFLAG_NOTRANSMIT ) == 0 )
+				{
+					nEntitySend++;
+					continue;
+				}
+				if( ( ent.m_nFOWFlags & FOWFLAG_HIDDEN ) == 0 && !known.IsBitSet( i ) )
+				{
+					nEntitySend++;
+					continue;
+				}
+				if( !ent.m_bInFOW[iPlayer] )
+					nEntitySend++;
+			}
+		}
+	}
+	double fEntityTime = ( Plat_FloatTime() - fStartTime ) / nSnapshots;
+
+	// Transmit bits
+	int nBitsSend = 0;
+	fStartTime = Plat_FloatTime();
+	for( iSnapshot = 0; iSnapshot < nSnapshots; iSnapshot++ )
+	{
+		nBitsSend = 0;
+		for( iPlayer = 0; iPlayer < nPlayers; iPlayer++ )
+		{
+			const uint32 *pFog = fog.Base();
+			const uint32 *pHidden = hidden.Base();
+			const uint32 *pVis = pVisible[iPlayer].Base();
+			const uint32 *pKnown = known.Base();
+			uint32 *pBlocked = blocked.Base();
+			for( j = 0; j < blocked.GetNumDWords(); j++ )
+				pBlocked[j] = pFog[j] & ~pVis[j] & ( pHidden[j] | pKnown[j] );
+
+			for( i = 0; i < nEntities; i++ )
+			{
+				if( !blocked.IsBitSet( i ) )
+					nBitsSend++;
+			}
+		}
+	}
+	double fBitsTime = ( Plat_FloatTime() - fStartTime ) / nSnapshots;
+
+	delete [] pVisible;
+
+	Msg( "sv_fogofwar_transmit_benchmark: %d entities, %d players, %d snapshots\n", nEntities, nPlayers, nSnapshots );
+	Msg( "\tper entity: %.4f ms per snapshot (%d send)\n", fEntityTime * 1000.0, nEntitySend );
+	Msg( "\ttransmit bits: %.4f ms per snapshot (%d send)\n", fBitsTime * 1000.0, nBitsSend );
+	if( nEntitySend != nBitsSend )
+		Warning( "sv_fogofwar_transmit_benchmark: results differ!\n" );
 }
+#endif // CLIENT_DLL
 
 #if 0
 //-----------------------------------------------------------------------------
@@ -16,6 +16,10 @@
 #include "hl2wars/hl2wars_shareddefs.h"
 #include "igamesystem.h"
 
+#ifndef DISABLE_PYTHON
+	namespace boost { namespace python { class list; namespace api { class object; } } }
+#endif // DISABLE_PYTHON
+
 // Forward declarations
 #ifdef CLIENT_DLL
 	#include "view_shared.h"
@@ -37,6 +41,30 @@ void FOWRemoveEntity( FOWListInfo **pHead, int ownernumber, CBaseEntity *pEnt );
 
 extern ConVar sv_fogofwar;
 
+#ifndef CLIENT_DLL
+// An updater to be shadow casted by a job. Everything needed from the entity is
+// gathered on the main thread, so jobs never touch the entities.
+struct FOWCaster_t
+{
+	CBaseEntity *m_pEnt;
+	int m_iX, m_iY;
+	int m_iRadius;
+	float m_fEyeZ;
+	CUtlVector< int > *m_pFootprint; // If set, the revealed tiles are stored here instead of in the bit plane
+};
+
+// All updaters of a single owner. Jobs of different owners don't share any output,
+// so they can run in parallel. The bit plane is merged into the grid afterwards.
+struct FOWShadowCastJob_t
+{
+	int m_iOwner;
+	CUtlVector< FOWCaster_t > m_Casters;
+	bool m_bUsesPlane; // True if any caster has no footprint, i.e. writes to the bit plane
+	CUtlVector< uint32 > m_VisiblePlane; // One bit per tile. CVarBitVec is limited to USHRT_MAX bits.
+	CUtlVector< int > m_LitTiles;
+};
+#endif // CLIENT_DLL
+
 // The client uses a smaller size type, since we only need to compute the fog of war of the local player
 #ifdef CLIENT_DLL
 	#define FOWSIZE_TYPE unsigned char
@@ -48,6 +76,10 @@ extern ConVar sv_fogofwar;
 	#define FOWHIDDEN_MASK 0x0000
 	#define FOWCLEAR_MASK 0xffff
 	#define FOWINDEX(x, y) x + y*m_nGridSize
+
+	// Visibility summary on the server. Blocks of FOWBLOCK_SIZE x FOWBLOCK_SIZE tiles.
+	#define FOWBLOCK_SHIFT 3
+	#define FOWBLOCK_SIZE (1 << FOWBLOCK_SHIFT)
 #endif // CLIENT_DLL
 
 //-----------------------------------------------------------------------------
@@ -79,8 +111,10 @@ public: // CBaseGameSystem overrides
 	// Heightmap
 	bool				CanCalculateHeightMap();
 	void				CalculateHeightMap();
+	void				BuildHeightMap();
 	void				SaveHeightMap();
 	void				LoadHeightMap();
+	bool				IsGeneratingHeightMap() { return m_bGeneratingHeightMap; }
 	void				ModifyHeightAtTile( int x, int y, float fHeight );
 	void				ModifyHeightAtPoint( const Vector &vPoint, float fHeight );
 	void				ModifyHeightAtExtent( const Vector &vMins, const Vector &vMaxs, float fHeight );
@@ -106,6 +140,13 @@ private:
 	void				AllocateFogOfWar();
 	void				DeallocateFogOfWar();
 
+	// Height map generation spread over multiple frames. Uses a flat height map until done.
+	float				ComputeHeightMapTraceZ();
+	float				CalculateTileHeight( int x, int y, float z );
+	void				StartHeightMapGeneration();
+	void				UpdateHeightMapGeneration();
+	void				CancelHeightMapGeneration();
+
 #ifdef CLIENT_DLL
 	void				UpdateTexture( bool bConverge, float fTime = 0.0f );
 	
@@ -125,8 +166,34 @@ protected:
 	void				UpdateFogOfWarState( int x, int y, int radius, FOWSIZE_TYPE mask, FOWSIZE_TYPE clearmask = FOWCLEAR_MASK );
 
 	void				ShadowCast( int cx, int cy, int row, float start, float end,
-									int radius, int xx, int xy, int yx, int yys, FOWSIZE_TYPE mask, float eyez, CUtlVector< FowPos_t > &EndPos );
-	void				DoShadowCasting( CBaseEntity *pEnt, int radius, FOWSIZE_TYPE mask );
+									int radius, int xx, int xy, int yx, int yys, FOWSIZE_TYPE mask, float eyez, CUtlVector< FowPos_t > &EndPos,
+									CUtlVector< int > *pLitTiles = NULL );
+	void				DoShadowCasting( CBaseEntity *pEnt, int radius, FOWSIZE_TYPE mask, CUtlVector< int > *pLitTiles = NULL );
+
+#ifndef CLIENT_DLL
+	// Incremental updating. Each updater keeps the tiles it revealed (footprint), and each owner
+	// keeps a reference count per tile. Only updaters which changed tile, radius or eye height are recast.
+	void				UpdateIncremental();
+	void				ResetIncremental();
+	void				AcquireFootprint( CBaseEntity *pEnt, int iOwner );
+	void				ReleaseFootprint( CBaseEntity *pEnt );
+	void				MarkTileDirty( int x, int y );
+	void				ComposeFogOfWar( int iMinX, int iMinY, int iMaxX, int iMaxY );
+
+	// Visibility summary. Per block of tiles the owners seeing any tile (OR) and the owners 
+	// seeing all tiles (AND), and whether a tile of the block changed since the last UpdateVisibility.
+	void				UpdateBlockSummary( int iMinX, int iMinY, int iMaxX, int iMaxY );
+	void				RebuildBlockSummary();
+	int					GetBlockIndex( int x, int y );
+
+	// Shadow cast jobs, one per owner. Optionally run on the thread pool.
+	void				ComputeFootprint( int x0, int y0, int radius, float eyez, CUtlVector< int > &litTiles );
+	void				ResetShadowCastJobs();
+	void				AddShadowCaster( int iOwner, CBaseEntity *pEnt, int radius, float eyez, CUtlVector< int > *pFootprint = NULL );
+	void				RunShadowCastJobs();
+	void				ProcessShadowCastJob( FOWShadowCastJob_t *&pJob );
+	void				MergeShadowCastJobs();
+#endif // CLIENT_DLL
 
 public:
 	FOWSIZE_TYPE		CalculatePlayerVisibilityMask( int iOwner );
@@ -134,6 +201,7 @@ public:
 
 	Vector				ComputeWorldPosition( int x, int y );
 	void				ComputeFOWPosition( const Vector &vPos, int &x, int &y );
+	int					GetGridSize() { return m_nGridSize; }
 
 public:
 	// Lists
@@ -148,6 +216,18 @@ public:
 	// Querying
 	bool				PointInFOW( const Vector &vPoint, int iOwner );
 
+	// Batched queries. Visible masks contain a bit per owner seeing the tile.
+	bool				IsAnyTileVisibleInBox( const Vector &vMins, const Vector &vMaxs, int iOwner );
+	bool				IsBoxFullyVisible( const Vector &vMins, const Vector &vMaxs, int iOwner );
+	bool				TestTileRectVisibility( int iMinX, int iMinY, int iMaxX, int iMaxY, int iOwner, bool bFully, bool bUseSummary = true );
+	void				ComputeVisibleMasks( const Vector *pPoints, int iCount, FOWSIZE_TYPE *pVisibleMasks );
+	int					ComputeVisibilityChanges( CBaseEntity * const *pEnts, int iCount, FOWSIZE_TYPE *pChangedMasks );
+	FOWSIZE_TYPE		ComputeVisibilityChange( CBaseEntity *pEnt );
+#ifndef DISABLE_PYTHON
+	boost::python::list	PyComputeVisibleMasks( boost::python::api::object points );
+	boost::python::list	PyComputeVisibilityChanges( boost::python::api::object entities );
+#endif // DISABLE_PYTHON
+
 	// For entities that are not hidden in the fog of war, but not updated (FOWFLAG_NOTRANSMIT, but not FOWFLAG_HIDDEN)
 	// These entities should be transmitted at least once.
 	bool				IsEntityKnown( int iPlayerIndex, int iEntIndex );
@@ -155,6 +235,12 @@ public:
 	void				MarkEntityUnKnown( int iPlayerIndex, int iEntIndex );
 	void				ResetToUnknown( int iPlayerIndex );
 	void				ResetToKnown( int iPlayerIndex );
+
+	// Transmit bits, indexed by edict. Mirror the fow flags and fow status of entities, and are only
+	// updated when those change. Used by CheckTransmit to skip the entities in the fog of war in bulk.
+	void				UpdateTransmitBits( CBaseEntity *pEnt );
+	void				ClearTransmitBits( int iEntIndex );
+	bool				ComputeTransmitBlocked( CBasePlayer *pPlayer, CBitVec<MAX_EDICTS> &blocked );
 #endif // CLIENT_DLL
 
 #if 0
@@ -177,6 +263,19 @@ private:
 	int			m_nGridSize, m_nTileSize;
 	CUtlVector< FOWSIZE_TYPE > m_FogOfWar;
 	CUtlVector< float > m_TileHeights;
+
+	struct HeightModification_t
+	{
+		int m_iTile;
+		float m_fHeight;
+	};
+	bool		m_bGeneratingHeightMap;
+	int			m_iHeightMapGenColumn;
+	int			m_nHeightMapGenFrames;
+	float		m_fHeightMapGenZ;
+	double		m_fHeightMapGenStartTime;
+	CUtlVector< float > m_GeneratingTileHeights;
+	CUtlVector< HeightModification_t > m_HeightModifications; // Modifications while generating, applied when done
 	
 	FOWListInfo *m_pFogUpdaterListHead;
 	CUtlVector<CBaseEntity *> m_FogEntities;
@@ -188,6 +287,29 @@ private:
 	// FOWFLAG_NOTRANSMIT related
 #ifndef CLIENT_DLL
 	CBitVec<MAX_EDICTS> m_KnownEntities[MAX_PLAYERS]; // Used for known functions
+
+	CBitVec<MAX_EDICTS> m_TransmitFogEntities; // Entities with FOWFLAG_NOTRANSMIT
+	CBitVec<MAX_EDICTS> m_TransmitHiddenEntities; // Entities with FOWFLAG_HIDDEN
+	CBitVec<MAX_EDICTS> m_TransmitVisible[FOWMAXPLAYERS]; // Entities not in the fog of war for the owner
+#endif // CLIENT_DLL
+
+	// Incremental update state
+#ifndef CLIENT_DLL
+	bool		m_bNeedsFullRebuild;
+	bool		m_bIncrementalShadowCast;
+	CUtlVector< unsigned short > m_TileRefCounts[FOWMAXPLAYERS]; // Number of updaters of an owner revealing a tile
+	CUtlVector< FOWSIZE_TYPE > m_TileOwnerBits; // Bit per owner with a non zero reference count
+	FOWSIZE_TYPE m_OwnerVisibilityMask[FOWMAXPLAYERS];
+	int			m_iDirtyMinX, m_iDirtyMinY, m_iDirtyMaxX, m_iDirtyMaxY;
+
+	int			m_nBlockGridSize;
+	CUtlVector< FOWSIZE_TYPE > m_BlockVisibleAny;
+	CUtlVector< FOWSIZE_TYPE > m_BlockVisibleAll;
+	CUtlVector< unsigned char > m_BlockChanged;
+	bool		m_bAllBlocksChanged;
+
+	FOWShadowCastJob_t m_ShadowCastJobs[FOWMAXPLAYERS];
+	CUtlVector< FOWShadowCastJob_t * > m_ActiveShadowCastJobs;
 #endif // CLIENT_DLL
 
 	// Visualization on the client
@@ -239,6 +361,13 @@ inline bool CFogOfWarMgr::PointInFOW( const Vector &vPoint, int iOwner )
 	return ( m_FogOfWar[FOWINDEX(x, y)] & ~CalculatePlayerVisibilityMask( iOwner ) ) != 0;
 }
 
+inline int CFogOfWarMgr::GetBlockIndex( int x, int y )
+{
+	x = clamp( x, 0, m_nGridSize - 1 ) >> FOWBLOCK_SHIFT;
+	y = clamp( y, 0, m_nGridSize - 1 ) >> FOWBLOCK_SHIFT;
+	return x + y * m_nBlockGridSize;
+}
+
 inline bool CFogOfWarMgr::IsEntityKnown( int iPlayerIndex, int iEntIndex )
 {
 	return m_KnownEntities[iPlayerIndex].IsBitSet( iEntIndex );
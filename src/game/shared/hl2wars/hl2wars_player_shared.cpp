@@ -18,6 +18,7 @@
 #else
 	#include "hl2wars_player.h"
 	#include "hl2wars_gamerules.h"
+	#include "unit_navigator.h"
 #endif // CLIENT_DLL
 
 #include "imouse.h"
@@ -201,6 +202,17 @@ void CHL2WarsPlayer::UpdateMouseData( Vector &vMouseAim )
 	::input->GetFullscreenMousePos( &(m_MouseData.m_iX), &(m_MouseData.m_iY) );
 #endif 
 
+#ifdef CLIENT_DLL
+	// If we hit the world or nothing, first pick the nearest unit with its screen bounds under the mouse.
+	// Like the scan below, only solid units which are not point sized are picked.
+	if( (!m_MouseData.GetEnt() || m_MouseData.GetEnt()->GetRefEHandle().GetEntryIndex() == 0) && !g_debug_mouse_noradiuscheck.GetBool() )
+	{
+		CUnitBase *pUnit = g_Unit_Manager.FindUnitAtScreenPos( m_MouseData.m_iX, m_MouseData.m_iY );
+		if( pUnit )
+			m_MouseData.SetEnt( pUnit );
+	}
+#endif // CLIENT_DLL
+
 	// If we hit the world or nothing, do a larger scan for entities
 #define MOUSE_ENT_TOLERANCE 64.0f 
 	if( (!m_MouseData.GetEnt() || m_MouseData.GetEnt()->GetRefEHandle().GetEntryIndex() == 0) && !g_debug_mouse_noradiuscheck.GetBool() )
@@ -618,14 +630,15 @@ void CHL2WarsPlayer::OnLeftMouseButtonReleased( const MouseTraceData_t &data )
 				else
 				{
 					ClearSelection();
-					engine->ServerCmd("player_clearselection");
+					CUtlVector< EHANDLE > selection;
 #ifndef DISABLE_PYTHON
 					if( pIUnit->IsSelectableByPlayer(this, GetSelection()) ) 
 #endif // DISABLE_PYTHON
 					{
 						pIUnit->Select(this);
-						engine->ServerCmd( VarArgs("player_addunit %ld", EncodeEntity(pMouseEnt)) );
+						selection.AddToTail( pMouseEnt );
 					}
+					SendUnitsCommand( "player_selection", true, selection );
 				}
 			}
 
@@ -1017,6 +1030,22 @@ void CHL2WarsPlayer::OrderUnits()
 	}
 #endif // DISABLE_PYTHON
 
+#ifndef CLIENT_DLL
+	// Units ordered together can share their route
+	CUnitGroupOrderScope groupOrder;
+	Vector vCentroid( 0, 0, 0 );
+	int iCount = 0;
+	for( i=0; i<m_hSelectedUnits.Count(); i++ )
+	{
+		if( m_hSelectedUnits.Element(i) == NULL )
+			continue;
+		vCentroid += m_hSelectedUnits.Element(i)->GetAbsOrigin();
+		iCount++;
+	}
+	if( iCount > 1 )
+		groupOrder.Begin( vCentroid / iCount );
+#endif // CLIENT_DLL
+
 	for( i=0; i<m_hSelectedUnits.Count(); i++ )
 	{
 		if( m_hSelectedUnits.Element(i) == NULL )
@@ -1025,6 +1054,10 @@ void CHL2WarsPlayer::OrderUnits()
 		m_hSelectedUnits.Element(i)->GetIUnit()->Order(this);
 	}
 
+#ifndef CLIENT_DLL
+	groupOrder.End();
+#endif // CLIENT_DLL
+
 #ifndef DISABLE_PYTHON
 	if( SrcPySystem()->IsPythonRunning() )
 	{
@@ -1037,6 +1070,74 @@ void CHL2WarsPlayer::OrderUnits()
 #endif // DISABLE_PYTHON
 }
 
+//-----------------------------------------------------------------------------
+// Purpose: Entity lists are written as zig-zag encoded deltas between the 
+//			entities, so lists in selection order stay compact. Each delta 
+//			is a varint of 5 bits per character, with the sixth bit marking 
+//			another character follows.
+//-----------------------------------------------------------------------------
+static const char s_EntityListChars[] = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ-_";
+
+int PackEntityList( const CUtlVector< long > &entities, int iStart, char *pOut, int iMaxLen )
+{
+	char buf[8];
+	int iLen = 0;
+	long iPrev = 0;
+	int i;
+	for( i = iStart; i < entities.Count(); i++ )
+	{
+		long iDiff = entities[i] - iPrev;
+		if( i != iStart && iDiff == 0 )
+			continue; // Duplicate
+		unsigned long iDelta = iDiff >= 0 ? (unsigned long)iDiff << 1 : ( (unsigned long)( -iDiff ) << 1 ) - 1;
+
+		int n = 0;
+		while( iDelta >= 32 )
+		{
+			buf[n++] = s_EntityListChars[(iDelta & 31) | 32];
+			iDelta >>= 5;
+		}
+		buf[n++] = s_EntityListChars[iDelta];
+
+		if( iLen + n >= iMaxLen )
+			break;
+		Q_memcpy( pOut + iLen, buf, n );
+		iLen += n;
+		iPrev = entities[i];
+	}
+	pOut[iLen] = '\0';
+	return i - iStart;
+}
+
+void UnpackEntityList( const char *pIn, CUtlVector< long > &entities )
+{
+	unsigned long iValue = 0;
+	long iPrev = 0;
+	int iShift = 0;
+	for( ; *pIn; pIn++ )
+	{
+		const char *pChar = Q_strnchr( s_EntityListChars, *pIn, sizeof(s_EntityListChars) - 1 );
+		if( !pChar || iShift > 30 )
+			return;
+
+		int iDigit = pChar - s_EntityListChars;
+		iValue |= (unsigned long)( iDigit & 31 ) << iShift;
+		if( iDigit & 32 )
+		{
+			iShift += 5;
+			continue;
+		}
+
+		if( iValue & 1 )
+			iPrev -= (long)( ( iValue + 1 ) >> 1 );
+		else
+			iPrev += (long)( iValue >> 1 );
+		entities.AddToTail( iPrev );
+		iValue = 0;
+		iShift = 0;
+	}
+}
+
 void CHL2WarsPlayer::ScheduleSelectionChangedSignal()
 {
 	m_bSelectionChangedSignalScheduled = true;
@@ -1071,6 +1172,11 @@ void CHL2WarsPlayer::MakeCurrentSelectionGroup( int iGroup, bool bClearGroup )
 		m_Groups[iGroup].m_Group.AddToTail(m_hSelectedUnits[i]);
 	}
 
+	OnGroupChanged( iGroup );
+}
+
+void CHL2WarsPlayer::OnGroupChanged( int iGroup )
+{
 #ifndef DISABLE_PYTHON
 	if( SrcPySystem()->IsPythonRunning() )
 	{
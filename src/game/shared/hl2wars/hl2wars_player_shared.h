@@ -99,4 +99,25 @@ inline long EncodeEntity( CBaseEntity *pEntity )
 #endif // 
 }
 
+#ifndef CLIENT_DLL
+inline CBaseEntity *DecodeEntity( long iEncodedEHandle )
+{
+#ifdef CLIENTSENDEHANDLE
+	int iSerialNum = (iEncodedEHandle >> MAX_EDICT_BITS);
+	int iEntryIndex = iEncodedEHandle & ~(iSerialNum << MAX_EDICT_BITS);
+	EHANDLE hEnt( iEntryIndex, iSerialNum );
+	return hEnt.Get();
+#else
+	return UTIL_EntityByIndex( iEncodedEHandle );
+#endif // CLIENTSENDEHANDLE
+}
+#endif // CLIENT_DLL
+
+// Packs a list of encoded entities into a string argument for a client command, 
+// so a whole selection can be send in one command. The order is kept.
+// Returns the number of entities packed, starting at iStart.
+#define ENTITYLIST_MAX_PACKED 448
+int PackEntityList( const CUtlVector< long > &entities, int iStart, char *pOut, int iMaxLen );
+void UnpackEntityList( const char *pIn, CUtlVector< long > &entities );
+
 #endif // HL2WARS_PLAYER_SHARED_H
\ No newline at end of file
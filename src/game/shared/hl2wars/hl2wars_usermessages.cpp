@@ -66,5 +66,7 @@ void RegisterUserMessages()
 	usermessages->Register( "PyNetworkArrayFull", -1 );
 	usermessages->Register( "PyNetworkDictElement", -1 );
 	usermessages->Register( "PyNetworkDictFull", -1 );
+	usermessages->Register( "PyNetworkVarNames", -1 );
+	usermessages->Register( "PyNetworkVarBatch", -1 );
 }
 
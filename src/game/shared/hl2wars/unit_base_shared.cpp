@@ -14,6 +14,7 @@
 #ifdef CLIENT_DLL
 	#include "c_hl2wars_player.h"
 	#include "c_wars_weapon.h"
+	#include "view.h"
 #else
 	#include "hl2wars_player.h"
 	#include "wars_weapon.h"
@@ -33,6 +34,148 @@ extern void	SpawnBlood(Vector vecSpot, const Vector &vecDir, int bloodColor, flo
 ConVar unit_cheaphitboxtest("unit_cheaphitboxtest", "1", FCVAR_CHEAT|FCVAR_REPLICATED, "Enables/disables testing against hitboxes of an unit, regardless of whether they have hitboxes");
 ConVar unit_cheapshotsimulation("unit_cheapshotsimulation", "1", FCVAR_CHEAT|FCVAR_REPLICATED, "Enables/disables cheap shooting.");
 
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+CUnitSpatialGrid::CUnitSpatialGrid() : m_iCount(0)
+{
+	memset( m_CellOwnerMasks, 0, sizeof(m_CellOwnerMasks) );
+	memset( m_CellOwnerCounts, 0, sizeof(m_CellOwnerCounts) );
+	m_fMinZ = FLT_MAX;
+	m_fMaxZ = -FLT_MAX;
+}
+
+//-------------------------------------
+
+void CUnitSpatialGrid::AddCellOwner( int iCell, int iOwner )
+{
+	int iBit = UnitGridOwnerBitIndex( iOwner );
+	if( m_CellOwnerCounts[iCell][iBit]++ == 0 )
+		m_CellOwnerMasks[iCell] |= ( 1u << iBit );
+}
+
+//-------------------------------------
+
+void CUnitSpatialGrid::RemoveCellOwner( int iCell, int iOwner )
+{
+	int iBit = UnitGridOwnerBitIndex( iOwner );
+	Assert( m_CellOwnerCounts[iCell][iBit] > 0 );
+	if( --m_CellOwnerCounts[iCell][iBit] == 0 )
+		m_CellOwnerMasks[iCell] &= ~( 1u << iBit );
+}
+
+//-------------------------------------
+
+int CUnitSpatialGrid::Insert( CUnitBase *pUnit, const Vector &vPos, int iOwner )
+{
+	int iHandle;
+	if( m_FreeHandles.Count() )
+	{
+		iHandle = m_FreeHandles.Tail();
+		m_FreeHandles.RemoveMultipleFromTail( 1 );
+	}
+	else
+	{
+		iHandle = m_Locations.AddToTail();
+	}
+
+	int x, y;
+	ComputeCell( vPos, x, y );
+
+	GridLocation_t &location = m_Locations[iHandle];
+	location.m_iCell = x + y * UNITGRID_SIZE;
+	location.m_iIndex = m_Cells[location.m_iCell].AddToTail();
+
+	UnitGridEntry_t &entry = m_Cells[location.m_iCell][location.m_iIndex];
+	entry.m_pUnit = pUnit;
+	entry.m_vPos = vPos;
+	entry.m_iOwner = iOwner;
+	entry.m_iHandle = iHandle;
+
+	AddCellOwner( location.m_iCell, iOwner );
+	m_fMinZ = MIN( m_fMinZ, vPos.z );
+	m_fMaxZ = MAX( m_fMaxZ, vPos.z );
+
+	m_iCount++;
+	return iHandle;
+}
+
+//-------------------------------------
+
+void CUnitSpatialGrid::Remove( int iHandle )
+{
+	if( !m_Locations.IsValidIndex( iHandle ) || m_Locations[iHandle].m_iCell == -1 )
+	{
+		Assert( 0 );
+		return;
+	}
+
+	GridLocation_t &location = m_Locations[iHandle];
+	CUtlVector< UnitGridEntry_t > &cell = m_Cells[location.m_iCell];
+
+	RemoveCellOwner( location.m_iCell, cell[location.m_iIndex].m_iOwner );
+
+	// Fast remove moves the last entry of the cell, so update its location
+	cell.FastRemove( location.m_iIndex );
+	if( cell.IsValidIndex( location.m_iIndex ) )
+		m_Locations[cell[location.m_iIndex].m_iHandle].m_iIndex = location.m_iIndex;
+
+	location.m_iCell = -1;
+	location.m_iIndex = -1;
+	m_FreeHandles.AddToTail( iHandle );
+	m_iCount--;
+}
+
+//-------------------------------------
+
+void CUnitSpatialGrid::Move( int iHandle, const Vector &vPos )
+{
+	Assert( m_Locations.IsValidIndex( iHandle ) && m_Locations[iHandle].m_iCell != -1 );
+
+	int x, y;
+	ComputeCell( vPos, x, y );
+
+	m_fMinZ = MIN( m_fMinZ, vPos.z );
+	m_fMaxZ = MAX( m_fMaxZ, vPos.z );
+
+	GridLocation_t &location = m_Locations[iHandle];
+	int iNewCell = x + y * UNITGRID_SIZE;
+	if( iNewCell == location.m_iCell )
+	{
+		m_Cells[location.m_iCell][location.m_iIndex].m_vPos = vPos;
+		return;
+	}
+
+	UnitGridEntry_t entry = m_Cells[location.m_iCell][location.m_iIndex];
+	entry.m_vPos = vPos;
+
+	RemoveCellOwner( location.m_iCell, entry.m_iOwner );
+	AddCellOwner( iNewCell, entry.m_iOwner );
+
+	CUtlVector< UnitGridEntry_t > &oldCell = m_Cells[location.m_iCell];
+	oldCell.FastRemove( location.m_iIndex );
+	if( oldCell.IsValidIndex( location.m_iIndex ) )
+		m_Locations[oldCell[location.m_iIndex].m_iHandle].m_iIndex = location.m_iIndex;
+
+	location.m_iCell = iNewCell;
+	location.m_iIndex = m_Cells[iNewCell].AddToTail( entry );
+}
+
+//-------------------------------------
+
+void CUnitSpatialGrid::RemoveAll()
+{
+	for( int i = 0; i < UNITGRID_SIZE*UNITGRID_SIZE; i++ )
+		m_Cells[i].RemoveAll();
+	m_Locations.RemoveAll();
+	m_FreeHandles.RemoveAll();
+	m_iCount = 0;
+
+	memset( m_CellOwnerMasks, 0, sizeof(m_CellOwnerMasks) );
+	memset( m_CellOwnerCounts, 0, sizeof(m_CellOwnerCounts) );
+	m_fMinZ = FLT_MAX;
+	m_fMaxZ = -FLT_MAX;
+}
+
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 
@@ -43,6 +186,10 @@ CUnit_Manager g_Unit_Manager;
 CUnit_Manager::CUnit_Manager()
 {
 	m_Units.EnsureCapacity( MAX_UNITS );
+	m_iLastGridUpdateTick = -1;
+#ifdef CLIENT_DLL
+	m_iLastScreenCacheFrame = -1;
+#endif // CLIENT_DLL
 }
 
 //-------------------------------------
@@ -66,6 +213,10 @@ int CUnit_Manager::NumUnits()
 void CUnit_Manager::AddUnit( CUnitBase *pUnit )
 {
 	m_Units.AddToTail( pUnit );
+
+	// Might be called from the constructor, so the position is set on the next update
+	pUnit->m_iUnitGridHandle = m_Grid.Insert( pUnit, vec3_origin, pUnit->GetOwnerNumber() );
+	m_iLastGridUpdateTick = -1;
 }
 
 //-------------------------------------
@@ -76,8 +227,770 @@ void CUnit_Manager::RemoveUnit( CUnitBase *pUnit )
 
 	if ( i != -1 )
 		m_Units.FastRemove( i );
+
+	if( pUnit->m_iUnitGridHandle != -1 )
+	{
+		m_Grid.Remove( pUnit->m_iUnitGridHandle );
+		pUnit->m_iUnitGridHandle = -1;
+	}
+}
+
+//-------------------------------------
+
+void CUnit_Manager::UpdateUnitPosition( CUnitBase *pUnit )
+{
+	if( pUnit->m_iUnitGridHandle != -1 )
+		m_Grid.Move( pUnit->m_iUnitGridHandle, pUnit->GetAbsOrigin() );
+}
+
+//-------------------------------------
+// Catches units that moved outside PhysicsSimulate (teleports, parented units, etc).
+// Done at most once per tick, on the first query.
+//-------------------------------------
+void CUnit_Manager::UpdateAllUnitPositions()
+{
+	m_iLastGridUpdateTick = gpGlobals->tickcount;
+
+	for( int i = 0; i < m_Units.Count(); i++ )
+		UpdateUnitPosition( m_Units[i] );
+}
+
+//-------------------------------------
+
+void CUnit_Manager::UpdateGrid()
+{
+	if( m_iLastGridUpdateTick != gpGlobals->tickcount )
+		UpdateAllUnitPositions();
+}
+
+//-------------------------------------
+
+class CUnitRadiusCollector
+{
+public:
+	CUnitRadiusCollector( CUtlVector< CUnitBase * > &units, const Vector &vCenter, float fRadius ) 
+		: m_Units(units), m_vCenter(vCenter), m_fRadiusSqr(fRadius*fRadius) {}
+
+	bool operator() ( const UnitGridEntry_t &entry )
+	{
+		if( m_vCenter.DistToSqr( entry.m_pUnit->GetAbsOrigin() ) <= m_fRadiusSqr )
+			m_Units.AddToTail( entry.m_pUnit );
+		return true;
+	}
+
+	CUtlVector< CUnitBase * > &m_Units;
+	const Vector &m_vCenter;
+	float m_fRadiusSqr;
+};
+
+int CUnit_Manager::FindUnitsInRadius( CUtlVector< CUnitBase * > &units, const Vector &vCenter, float fRadius, unsigned int ownerMask )
+{
+	UpdateGrid();
+
+	units.RemoveAll();
+
+	CUnitRadiusCollector collector( units, vCenter, fRadius );
+	m_Grid.ForAllInRadius( collector, vCenter, fRadius + UNITGRID_TOLERANCE, ownerMask );
+	return units.Count();
 }
 
+//-------------------------------------
+
+class CUnitBoxCollector
+{
+public:
+	CUnitBoxCollector( CUtlVector< CUnitBase * > &units, const Vector &vMins, const Vector &vMaxs ) 
+		: m_Units(units), m_vMins(vMins), m_vMaxs(vMaxs) {}
+
+	bool operator() ( const UnitGridEntry_t &entry )
+	{
+		if( IsPointInBox( entry.m_pUnit->GetAbsOrigin(), m_vMins, m_vMaxs ) )
+			m_Units.AddToTail( entry.m_pUnit );
+		return true;
+	}
+
+	CUtlVector< CUnitBase * > &m_Units;
+	const Vector &m_vMins;
+	const Vector &m_vMaxs;
+};
+
+int CUnit_Manager::FindUnitsInBox( CUtlVector< CUnitBase * > &units, const Vector &vMins, const Vector &vMaxs, unsigned int ownerMask )
+{
+	UpdateGrid();
+
+	units.RemoveAll();
+
+	Vector vTolerance( UNITGRID_TOLERANCE, UNITGRID_TOLERANCE, 0 );
+	CUnitBoxCollector collector( units, vMins, vMaxs );
+	m_Grid.ForAllInBox( collector, vMins - vTolerance, vMaxs + vTolerance, ownerMask );
+	return units.Count();
+}
+
+//-------------------------------------
+
+class CUnitPlanesCollector
+{
+public:
+	CUnitPlanesCollector( CUtlVector< CUnitBase * > &units, const VPlane *pPlanes, int nPlanes ) 
+		: m_Units(units), m_pPlanes(pPlanes), m_nPlanes(nPlanes) {}
+
+	bool operator() ( const UnitGridEntry_t &entry )
+	{
+		const Vector &vPos = entry.m_pUnit->GetAbsOrigin();
+		for( int i = 0; i < m_nPlanes; i++ )
+		{
+			if( m_pPlanes[i].DistTo( vPos ) < 0.0f )
+				return true;
+		}
+		m_Units.AddToTail( entry.m_pUnit );
+		return true;
+	}
+
+	CUtlVector< CUnitBase * > &m_Units;
+	const VPlane *m_pPlanes;
+	int m_nPlanes;
+};
+
+int CUnit_Manager::FindUnitsInFrustum( CUtlVector< CUnitBase * > &units, const VPlane *pPlanes, int nPlanes, unsigned int ownerMask )
+{
+	UpdateGrid();
+
+	units.RemoveAll();
+
+	CUnitPlanesCollector collector( units, pPlanes, nPlanes );
+	m_Grid.ForAllInPlanes( collector, pPlanes, nPlanes, UNITGRID_TOLERANCE, ownerMask );
+	return units.Count();
+}
+
+#ifdef CLIENT_DLL
+//-----------------------------------------------------------------------------
+// Purpose: Screen cache
+//-----------------------------------------------------------------------------
+CUnitScreenCache::CUnitScreenCache()
+{
+	Clear( 0, 0 );
+}
+
+void CUnitScreenCache::Clear( int iScreenWidth, int iScreenHeight )
+{
+	m_iScreenWidth = iScreenWidth;
+	m_iScreenHeight = iScreenHeight;
+	m_nCellsX = MAX( ( iScreenWidth + UNITSCREEN_CELLSIZE - 1 ) / UNITSCREEN_CELLSIZE, 1 );
+	m_nCellsY = MAX( ( iScreenHeight + UNITSCREEN_CELLSIZE - 1 ) / UNITSCREEN_CELLSIZE, 1 );
+	m_iMaxExtent = 0;
+
+	m_Units.RemoveAll();
+	m_OwnerBits.RemoveAll();
+	m_X.RemoveAll();
+	m_Y.RemoveAll();
+	m_XMin.RemoveAll();
+	m_YMin.RemoveAll();
+	m_XMax.RemoveAll();
+	m_YMax.RemoveAll();
+	m_Depth.RemoveAll();
+	m_Pickable.RemoveAll();
+	m_CellStart.RemoveAll();
+	m_CellUnits.RemoveAll();
+}
+
+void CUnitScreenCache::Add( CUnitBase *pUnit, unsigned int ownerBit, int iX, int iY, int iXMin, int iYMin, int iXMax, int iYMax, float fDepth, bool bPickable )
+{
+	// Keep the coordinates in range of a short. Units this far off screen are never picked.
+	iX = clamp( iX, -SHRT_MAX, SHRT_MAX );
+	iY = clamp( iY, -SHRT_MAX, SHRT_MAX );
+	iXMin = clamp( iXMin, -SHRT_MAX, iX );
+	iYMin = clamp( iYMin, -SHRT_MAX, iY );
+	iXMax = clamp( iXMax, iX, SHRT_MAX );
+	iYMax = clamp( iYMax, iY, SHRT_MAX );
+
+	m_Units.AddToTail( pUnit );
+	m_OwnerBits.AddToTail( ownerBit );
+	m_X.AddToTail( iX );
+	m_Y.AddToTail( iY );
+	m_XMin.AddToTail( iXMin );
+	m_YMin.AddToTail( iYMin );
+	m_XMax.AddToTail( iXMax );
+	m_YMax.AddToTail( iYMax );
+	m_Depth.AddToTail( fDepth );
+	m_Pickable.AddToTail( bPickable );
+
+	// Limit to the screen size, so one huge unit does not make all point queries visit the whole grid.
+	int iExtent = MAX( MAX( iX - iXMin, iXMax - iX ), MAX( iY - iYMin, iYMax - iY ) );
+	m_iMaxExtent = MAX( m_iMaxExtent, MIN( iExtent, MAX( m_iScreenWidth, m_iScreenHeight ) ) );
+}
+
+//-------------------------------------
+// Counting sort of the units on the cell of their origin. Origins outside 
+// the screen go into the nearest border cell.
+//-------------------------------------
+void CUnitScreenCache::BuildGrid()
+{
+	int i, nCells = m_nCellsX * m_nCellsY;
+	CUtlVector< int > unitCells;
+	unitCells.SetCount( m_Units.Count() );
+
+	m_CellStart.SetCount( nCells + 1 );
+	memset( m_CellStart.Base(), 0, m_CellStart.Count() * sizeof(int) );
+	for( i = 0; i < m_Units.Count(); i++ )
+	{
+		int x = clamp( m_X[i] / UNITSCREEN_CELLSIZE, 0, m_nCellsX - 1 );
+		int y = clamp( m_Y[i] / UNITSCREEN_CELLSIZE, 0, m_nCellsY - 1 );
+		unitCells[i] = x + y * m_nCellsX;
+		m_CellStart[unitCells[i] + 1]++;
+	}
+	for( i = 0; i < nCells; i++ )
+		m_CellStart[i + 1] += m_CellStart[i];
+
+	CUtlVector< int > cellFill;
+	cellFill.SetCount( nCells );
+	memcpy( cellFill.Base(), m_CellStart.Base(), nCells * sizeof(int) );
+	m_CellUnits.SetCount( m_Units.Count() );
+	for( i = 0; i < m_Units.Count(); i++ )
+		m_CellUnits[cellFill[unitCells[i]]++] = i;
+}
+
+void CUnitScreenCache::FindInRect( CUtlVector< int > &indices, int iXMin, int iYMin, int iXMax, int iYMax, unsigned int ownerMask ) const
+{
+	if( m_CellStart.Count() == 0 )
+		return;
+
+	int xmin = clamp( iXMin / UNITSCREEN_CELLSIZE, 0, m_nCellsX - 1 );
+	int ymin = clamp( iYMin / UNITSCREEN_CELLSIZE, 0, m_nCellsY - 1 );
+	int xmax = clamp( iXMax / UNITSCREEN_CELLSIZE, 0, m_nCellsX - 1 );
+	int ymax = clamp( iYMax / UNITSCREEN_CELLSIZE, 0, m_nCellsY - 1 );
+	for( int y = ymin; y <= ymax; y++ )
+	{
+		for( int x = xmin; x <= xmax; x++ )
+		{
+			int iCell = x + y * m_nCellsX;
+			for( int j = m_CellStart[iCell]; j < m_CellStart[iCell + 1]; j++ )
+			{
+				int i = m_CellUnits[j];
+				if( ( m_OwnerBits[i] & ownerMask ) && m_X[i] >= iXMin && m_Y[i] >= iYMin && m_X[i] <= iXMax && m_Y[i] <= iYMax )
+					indices.AddToTail( i );
+			}
+		}
+	}
+}
+
+int CUnitScreenCache::FindAtPos( int iX, int iY, unsigned int ownerMask ) const
+{
+	if( m_CellStart.Count() == 0 )
+		return -1;
+
+	// The bounds of a unit extend at most m_iMaxExtent from the cell of its origin
+	int xmin = clamp( ( iX - m_iMaxExtent ) / UNITSCREEN_CELLSIZE, 0, m_nCellsX - 1 );
+	int ymin = clamp( ( iY - m_iMaxExtent ) / UNITSCREEN_CELLSIZE, 0, m_nCellsY - 1 );
+	int xmax = clamp( ( iX + m_iMaxExtent ) / UNITSCREEN_CELLSIZE, 0, m_nCellsX - 1 );
+	int ymax = clamp( ( iY + m_iMaxExtent ) / UNITSCREEN_CELLSIZE, 0, m_nCellsY - 1 );
+	int iBest = -1;
+	for( int y = ymin; y <= ymax; y++ )
+	{
+		for( int x = xmin; x <= xmax; x++ )
+		{
+			int iCell = x + y * m_nCellsX;
+			for( int j = m_CellStart[iCell]; j < m_CellStart[iCell + 1]; j++ )
+			{
+				int i = m_CellUnits[j];
+				if( !m_Pickable[i] || ( m_OwnerBits[i] & ownerMask ) == 0 || iX < m_XMin[i] || iY < m_YMin[i] || iX > m_XMax[i] || iY > m_YMax[i] )
+					continue;
+				if( iBest == -1 || m_Depth[i] < m_Depth[iBest] )
+					iBest = i;
+			}
+		}
+	}
+	return iBest;
+}
+
+//-------------------------------------
+// Projects the units in view into the screen cache. ProjectToScreen returns 
+// false for positions behind the camera.
+//-------------------------------------
+static bool ProjectToScreen( const VMatrix &worldToScreen, const Vector &vPos, float fWidth, float fHeight, float &fX, float &fY, float &fW )
+{
+	fW = worldToScreen[3][0] * vPos.x + worldToScreen[3][1] * vPos.y + worldToScreen[3][2] * vPos.z + worldToScreen[3][3];
+	if( fW <= 0.001f )
+		return false;
+	float fInvW = 1.0f / fW;
+	fX = 0.5f * ( 1.0f + ( worldToScreen[0][0] * vPos.x + worldToScreen[0][1] * vPos.y + worldToScreen[0][2] * vPos.z + worldToScreen[0][3] ) * fInvW ) * fWidth;
+	fY = 0.5f * ( 1.0f - ( worldToScreen[1][0] * vPos.x + worldToScreen[1][1] * vPos.y + worldToScreen[1][2] * vPos.z + worldToScreen[1][3] ) * fInvW ) * fHeight;
+	return true;
+}
+
+// Screen position and bounds of the world space box. Boxes crossing the camera plane only use the origin.
+static bool ProjectBoundsToScreen( const VMatrix &worldToScreen, const Vector &vOrigin, const Vector &vMins, const Vector &vMaxs, 
+	float fWidth, float fHeight, int &iX, int &iY, int &iXMin, int &iYMin, int &iXMax, int &iYMax, float &fW )
+{
+	float fX, fY;
+	if( !ProjectToScreen( worldToScreen, vOrigin, fWidth, fHeight, fX, fY, fW ) )
+		return false;
+
+	float fXMin = fX, fYMin = fY, fXMax = fX, fYMax = fY;
+	Vector vCorner;
+	for( int i = 0; i < 8; i++ )
+	{
+		vCorner.x = ( i & 1 ) ? vMaxs.x : vMins.x;
+		vCorner.y = ( i & 2 ) ? vMaxs.y : vMins.y;
+		vCorner.z = ( i & 4 ) ? vMaxs.z : vMins.z;
+
+		float fCornerX, fCornerY, fCornerW;
+		if( !ProjectToScreen( worldToScreen, vCorner, fWidth, fHeight, fCornerX, fCornerY, fCornerW ) )
+		{
+			fXMin = fXMax = fX;
+			fYMin = fYMax = fY;
+			break;
+		}
+		fXMin = MIN( fXMin, fCornerX );
+		fYMin = MIN( fYMin, fCornerY );
+		fXMax = MAX( fXMax, fCornerX );
+		fYMax = MAX( fYMax, fCornerY );
+	}
+
+	iX = (int)floor( fX );
+	iY = (int)floor( fY );
+	iXMin = (int)floor( fXMin );
+	iYMin = (int)floor( fYMin );
+	iXMax = (int)ceil( fXMax );
+	iYMax = (int)ceil( fYMax );
+	return true;
+}
+
+class CUnitScreenCacheBuilder
+{
+public:
+	CUnitScreenCacheBuilder( CUnitScreenCache &cache, const VMatrix &worldToScreen, int iWidth, int iHeight ) 
+		: m_Cache(cache), m_WorldToScreen(worldToScreen), m_fWidth((float)iWidth), m_fHeight((float)iHeight) {}
+
+	bool operator() ( const UnitGridEntry_t &entry )
+	{
+		CUnitBase *pUnit = entry.m_pUnit;
+		if( pUnit->IsDormant() )
+			return true;
+
+		Vector vMins, vMaxs;
+		pUnit->CollisionProp()->WorldSpaceAABB( &vMins, &vMaxs );
+
+		int iX, iY, iXMin, iYMin, iXMax, iYMax;
+		float fW;
+		if( ProjectBoundsToScreen( m_WorldToScreen, pUnit->GetAbsOrigin(), vMins, vMaxs, m_fWidth, m_fHeight, iX, iY, iXMin, iYMin, iXMax, iYMax, fW ) )
+		{
+			// Non solid units (such as dead units) can still be box selected, but not picked
+			bool bPickable = !pUnit->IsPointSized() && pUnit->IsSolid();
+			m_Cache.Add( pUnit, UnitGridOwnerBit( entry.m_iOwner ), iX, iY, iXMin, iYMin, iXMax, iYMax, fW, bPickable );
+		}
+		return true;
+	}
+
+	CUnitScreenCache &m_Cache;
+	const VMatrix &m_WorldToScreen;
+	float m_fWidth, m_fHeight;
+};
+
+//-------------------------------------
+// Plane where fSign * ( row - fScale * w ) >= 0, with row the clip space 
+// coordinate of the axis.
+//-------------------------------------
+static void ComputeScreenPlane( const VMatrix &worldToScreen, int iAxis, float fScale, float fSign, VPlane &plane )
+{
+	Vector vNormal( fSign * ( worldToScreen[iAxis][0] - fScale * worldToScreen[3][0] ),
+					fSign * ( worldToScreen[iAxis][1] - fScale * worldToScreen[3][1] ),
+					fSign * ( worldToScreen[iAxis][2] - fScale * worldToScreen[3][2] ) );
+	float fDist = -fSign * ( worldToScreen[iAxis][3] - fScale * worldToScreen[3][3] );
+	float fLength = vNormal.Length();
+	if( fLength > 0.0f )
+	{
+		vNormal /= fLength;
+		fDist /= fLength;
+	}
+	plane.Init( vNormal, fDist );
+}
+
+//-------------------------------------
+// Rebuilds the screen cache from the units in view. The view is padded, 
+// so units with only their bounds on screen can still be picked.
+//-------------------------------------
+#define UNITSCREEN_VIEWPADDING 0.25f
+
+void CUnit_Manager::UpdateScreenCache()
+{
+	if( m_iLastScreenCacheFrame == gpGlobals->framecount )
+		return;
+	m_iLastScreenCacheFrame = gpGlobals->framecount;
+
+	VPROF_BUDGET( "CUnit_Manager::UpdateScreenCache", VPROF_BUDGETGROUP_GAME );
+
+	UpdateGrid();
+
+	int iWidth = ScreenWidth();
+	int iHeight = ScreenHeight();
+	m_ScreenCache.Clear( iWidth, iHeight );
+
+	// Planes of the padded view, in normalized device coordinates
+	const VMatrix &worldToScreen = engine->WorldToScreenMatrix();
+	VPlane planes[5];
+	ComputeScreenPlane( worldToScreen, 0, -1.0f - UNITSCREEN_VIEWPADDING, 1.0f, planes[0] );
+	ComputeScreenPlane( worldToScreen, 0, 1.0f + UNITSCREEN_VIEWPADDING, -1.0f, planes[1] );
+	ComputeScreenPlane( worldToScreen, 1, -1.0f - UNITSCREEN_VIEWPADDING, 1.0f, planes[2] );
+	ComputeScreenPlane( worldToScreen, 1, 1.0f + UNITSCREEN_VIEWPADDING, -1.0f, planes[3] );
+	ComputeScreenPlane( worldToScreen, 3, 0.0f, 1.0f, planes[4] ); // In front of the camera
+
+	CUnitScreenCacheBuilder builder( m_ScreenCache, worldToScreen, iWidth, iHeight );
+	m_Grid.ForAllInPlanes( builder, planes, ARRAYSIZE(planes), UNITGRID_TOLERANCE );
+	m_ScreenCache.BuildGrid();
+}
+
+//-------------------------------------
+// Units with their origin inside the screen rect (in pixels). Dormant units
+// are skipped. Rects inside the padded view are answered from the screen 
+// cache, other rects test the units between the planes bounding the rect.
+//-------------------------------------
+class CUnitScreenRectCollector
+{
+public:
+	CUnitScreenRectCollector( CUtlVector< CUnitBase * > &units, int iXMin, int iYMin, int iXMax, int iYMax ) 
+		: m_Units(units), m_iXMin(iXMin), m_iYMin(iYMin), m_iXMax(iXMax), m_iYMax(iYMax) {}
+
+	bool operator() ( const UnitGridEntry_t &entry )
+	{
+		if( entry.m_pUnit->IsDormant() )
+			return true;
+
+		int iX, iY;
+		if( GetVectorInScreenSpace( entry.m_pUnit->GetAbsOrigin(), iX, iY ) && 
+				iX >= m_iXMin && iY >= m_iYMin && iX <= m_iXMax && iY <= m_iYMax )
+			m_Units.AddToTail( entry.m_pUnit );
+		return true;
+	}
+
+	CUtlVector< CUnitBase * > &m_Units;
+	int m_iXMin, m_iYMin, m_iXMax, m_iYMax;
+};
+
+int CUnit_Manager::FindUnitsInScreenRectUncached( CUtlVector< CUnitBase * > &units, int iXMin, int iYMin, int iXMax, int iYMax, unsigned int ownerMask )
+{
+	UpdateGrid();
+
+	units.RemoveAll();
+
+	// Normalized device coordinates of the rect, padded by a pixel for rounding
+	float fWidth = (float)ScreenWidth();
+	float fHeight = (float)ScreenHeight();
+	float fXMin = ( 2.0f * ( iXMin - 1 ) / fWidth ) - 1.0f;
+	float fXMax = ( 2.0f * ( iXMax + 1 ) / fWidth ) - 1.0f;
+	float fYMin = 1.0f - ( 2.0f * ( iYMax + 1 ) / fHeight );
+	float fYMax = 1.0f - ( 2.0f * ( iYMin - 1 ) / fHeight );
+
+	const VMatrix &worldToScreen = engine->WorldToScreenMatrix();
+	VPlane planes[5];
+	ComputeScreenPlane( worldToScreen, 0, fXMin, 1.0f, planes[0] );
+	ComputeScreenPlane( worldToScreen, 0, fXMax, -1.0f, planes[1] );
+	ComputeScreenPlane( worldToScreen, 1, fYMin, 1.0f, planes[2] );
+	ComputeScreenPlane( worldToScreen, 1, fYMax, -1.0f, planes[3] );
+	ComputeScreenPlane( worldToScreen, 3, 0.0f, 1.0f, planes[4] ); // In front of the camera
+
+	CUnitScreenRectCollector collector( units, iXMin, iYMin, iXMax, iYMax );
+	m_Grid.ForAllInPlanes( collector, planes, ARRAYSIZE(planes), UNITGRID_TOLERANCE, ownerMask );
+	return units.Count();
+}
+
+int CUnit_Manager::FindUnitsInScreenRect( CUtlVector< CUnitBase * > &units, int iXMin, int iYMin, int iXMax, int iYMax, unsigned int ownerMask )
+{
+	// Padding of the cached view in pixels
+	int iPadX = (int)( UNITSCREEN_VIEWPADDING * 0.5f * ScreenWidth() );
+	int iPadY = (int)( UNITSCREEN_VIEWPADDING * 0.5f * ScreenHeight() );
+	if( iXMin < -iPadX || iYMin < -iPadY || iXMax >= ScreenWidth() + iPadX || iYMax >= ScreenHeight() + iPadY )
+		return FindUnitsInScreenRectUncached( units, iXMin, iYMin, iXMax, iYMax, ownerMask );
+
+	UpdateScreenCache();
+
+	units.RemoveAll();
+
+	CUtlVector< int > indices;
+	m_ScreenCache.FindInRect( indices, iXMin, iYMin, iXMax, iYMax, ownerMask );
+	units.EnsureCapacity( indices.Count() );
+	for( int i = 0; i < indices.Count(); i++ )
+		units.AddToTail( m_ScreenCache.GetUnit( indices[i] ) );
+	return units.Count();
+}
+
+//-------------------------------------
+// Nearest unit with its screen bounds containing the position
+//-------------------------------------
+CUnitBase *CUnit_Manager::FindUnitAtScreenPos( int iX, int iY, unsigned int ownerMask )
+{
+	UpdateScreenCache();
+
+	int i = m_ScreenCache.FindAtPos( iX, iY, ownerMask );
+	return i != -1 ? m_ScreenCache.GetUnit( i ) : NULL;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Benchmark of box selection and picking on synthetic units in 
+//			screen space, projecting all units per query versus the screen 
+//			cache build once.
+//-----------------------------------------------------------------------------
+CON_COMMAND_F( cl_unit_screencache_benchmark, "Measures box select and picking queries on synthetic units in view, projecting all units per query versus the screen cache.\n\tArguments: [units] [queries]", FCVAR_CHEAT )
+{
+	int nUnits = args.ArgC() > 1 ? atoi( args[1] ) : 1000;
+	int nQueries = args.ArgC() > 2 ? atoi( args[2] ) : 100;
+	nUnits = MAX( nUnits, 1 );
+	nQueries = MAX( nQueries, 1 );
+
+	int i, j, iWidth = ScreenWidth(), iHeight = ScreenHeight();
+	const VMatrix &worldToScreen = engine->WorldToScreenMatrix();
+
+	// Units spread in front of the camera, with the bounds of a human sized unit
+	Vector vForward, vRight, vUp;
+	AngleVectors( MainViewAngles(), &vForward, &vRight, &vUp );
+	CUtlVector< Vector > positions;
+	CUtlVector< int > owners;
+	positions.SetCount( nUnits );
+	owners.SetCount( nUnits );
+	for( i = 0; i < nUnits; i++ )
+	{
+		float fDist = RandomFloat( 256.0f, 2048.0f );
+		positions[i] = MainViewOrigin() + vForward * fDist + vRight * RandomFloat( -fDist, fDist ) + vUp * RandomFloat( -fDist, fDist ) * 0.6f;
+		owners[i] = 2 + (i % 8);
+	}
+	const Vector vMins( -16.0f, -16.0f, 0.0f ), vMaxs( 16.0f, 16.0f, 72.0f );
+
+	CUtlVector< int > rects;
+	rects.SetCount( nQueries * 4 );
+	for( i = 0; i < nQueries; i++ )
+	{
+		int iX = RandomInt( 0, iWidth - 1 ), iY = RandomInt( 0, iHeight - 1 );
+		rects[i*4+0] = iX;
+		rects[i*4+1] = iY;
+		rects[i*4+2] = MIN( iX + RandomInt( 0, iWidth / 3 ), iWidth - 1 );
+		rects[i*4+3] = MIN( iY + RandomInt( 0, iHeight / 3 ), iHeight - 1 );
+	}
+
+	// Projecting all units for each query, like box select did before
+	int nBruteRect = 0, nBrutePick = 0;
+	double fStartTime = Plat_FloatTime();
+	for( i = 0; i < nQueries; i++ )
+	{
+		const int *pRect = &rects[i*4];
+		unsigned int ownerMask = UnitGridOwnerBit( owners[i % nUnits] );
+		float fBestDepth = FLT_MAX;
+		for( j = 0; j < nUnits; j++ )
+		{
+			int iX, iY, iXMin, iYMin, iXMax, iYMax;
+			float fW;
+			if( ( UnitGridOwnerBit( owners[j] ) & ownerMask ) == 0 || 
+					!ProjectBoundsToScreen( worldToScreen, positions[j], positions[j] + vMins, positions[j] + vMaxs, 
+						(float)iWidth, (float)iHeight, iX, iY, iXMin, iYMin, iXMax, iYMax, fW ) )
+				continue;
+			if( iX >= pRect[0] && iY >= pRect[1] && iX <= pRect[2] && iY <= pRect[3] )
+				nBruteRect++;
+			if( pRect[0] >= iXMin && pRect[1] >= iYMin && pRect[0] <= iXMax && pRect[1] <= iYMax && fW < fBestDepth )
+				fBestDepth = fW;
+		}
+		if( fBestDepth != FLT_MAX )
+			nBrutePick++;
+	}
+	double fBruteTime = Plat_FloatTime() - fStartTime;
+
+	// Screen cache, build once and queried with the grid
+	int nCacheRect = 0, nCachePick = 0;
+	fStartTime = Plat_FloatTime();
+	CUnitScreenCache cache;
+	cache.Clear( iWidth, iHeight );
+	for( j = 0; j < nUnits; j++ )
+	{
+		int iX, iY, iXMin, iYMin, iXMax, iYMax;
+		float fW;
+		if( ProjectBoundsToScreen( worldToScreen, positions[j], positions[j] + vMins, positions[j] + vMaxs, 
+				(float)iWidth, (float)iHeight, iX, iY, iXMin, iYMin, iXMax, iYMax, fW ) )
+			cache.Add( NULL, UnitGridOwnerBit( owners[j] ), iX, iY, iXMin, iYMin, iXMax, iYMax, fW );
+	}
+	cache.BuildGrid();
+	double fBuildTime = Plat_FloatTime() - fStartTime;
+
+	CUtlVector< int > indices;
+	for( i = 0; i < nQueries; i++ )
+	{
+		const int *pRect = &rects[i*4];
+		unsigned int ownerMask = UnitGridOwnerBit( owners[i % nUnits] );
+		indices.RemoveAll();
+		cache.FindInRect( indices, pRect[0], pRect[1], pRect[2], pRect[3], ownerMask );
+		nCacheRect += indices.Count();
+		if( cache.FindAtPos( pRect[0], pRect[1], ownerMask ) != -1 )
+			nCachePick++;
+	}
+	double fCacheTime = Plat_FloatTime() - fStartTime;
+
+	Msg( "cl_unit_screencache_benchmark: %d units (%d in view), %d box and pick queries\n", nUnits, cache.Count(), nQueries );
+	Msg( "\tall units %.3f ms, screen cache %.3f ms (build %.3f ms)\n", fBruteTime * 1000.0, fCacheTime * 1000.0, fBuildTime * 1000.0 );
+	Msg( "\tbox select found %d, picking found %d\n", nCacheRect, nCachePick );
+	if( nBruteRect != nCacheRect || nBrutePick != nCachePick )
+		Warning( "cl_unit_screencache_benchmark: results differ (box %d versus %d, pick %d versus %d)!\n", nBruteRect, nCacheRect, nBrutePick, nCachePick );
+}
+#endif // CLIENT_DLL
+
+#ifndef CLIENT_DLL
+//-----------------------------------------------------------------------------
+// Purpose: Benchmark of the owner filtered radius, box and plane queries on
+//			synthetic units, comparing testing all units against the unit grid.
+//-----------------------------------------------------------------------------
+struct GridBenchmarkUnit_t
+{
+	Vector m_vPos;
+	int m_iOwner;
+};
+
+struct GridBenchmarkQuery_t
+{
+	Vector m_vCenter;
+	Vector m_vMins, m_vMaxs;
+	VPlane m_Planes[4];
+	int m_iOwner;
+};
+
+enum GridBenchmarkShape_t
+{
+	GRIDBENCHMARK_RADIUS = 0,
+	GRIDBENCHMARK_BOX,
+	GRIDBENCHMARK_PLANES,
+
+	GRIDBENCHMARK_COUNT,
+};
+
+static const char *s_GridBenchmarkShapeNames[GRIDBENCHMARK_COUNT] = { "radius", "box", "planes" };
+
+static bool GridBenchmarkTest( int iShape, const GridBenchmarkQuery_t &query, const Vector &vPos, float fRadiusSqr )
+{
+	switch( iShape )
+	{
+	case GRIDBENCHMARK_RADIUS:
+		return query.m_vCenter.DistToSqr( vPos ) <= fRadiusSqr;
+	case GRIDBENCHMARK_BOX:
+		return IsPointInBox( vPos, query.m_vMins, query.m_vMaxs );
+	default:
+		for( int i = 0; i < ARRAYSIZE(query.m_Planes); i++ )
+		{
+			if( query.m_Planes[i].DistTo( vPos ) < 0.0f )
+				return false;
+		}
+		return true;
+	}
+}
+
+class CGridBenchmarkCollector
+{
+public:
+	CGridBenchmarkCollector( int iShape, const GridBenchmarkQuery_t &query, float fRadiusSqr ) 
+		: m_iShape(iShape), m_Query(query), m_fRadiusSqr(fRadiusSqr), m_nFound(0) {}
+
+	bool operator() ( const UnitGridEntry_t &entry )
+	{
+		if( entry.m_iOwner == m_Query.m_iOwner && GridBenchmarkTest( m_iShape, m_Query, entry.m_vPos, m_fRadiusSqr ) )
+			m_nFound++;
+		return true;
+	}
+
+	int m_iShape;
+	const GridBenchmarkQuery_t &m_Query;
+	float m_fRadiusSqr;
+	int m_nFound;
+};
+
+static void UnitGridBenchmark( int nUnits, int nQueries, float fRadius )
+{
+	int i, j, iShape;
+	float fRadiusSqr = fRadius * fRadius;
+
+	// Spread the units with about one unit per 128x128 area, over 8 owners
+	float fHalfSize = MIN( sqrt( (float)nUnits ) * 128.0f, (float)FOW_WORLDSIZE ) / 2.0f;
+	CUtlVector< GridBenchmarkUnit_t > units;
+	units.SetCount( nUnits );
+	for( i = 0; i < nUnits; i++ )
+	{
+		units[i].m_vPos = Vector( RandomFloat( -fHalfSize, fHalfSize ), RandomFloat( -fHalfSize, fHalfSize ), RandomFloat( 0.0f, 256.0f ) );
+		units[i].m_iOwner = 2 + (i % 8);
+	}
+
+	// The plane query is the radius square rotated by 45 degrees, like the ground 
+	// area of a rotated camera.
+	CUtlVector< GridBenchmarkQuery_t > queries;
+	queries.SetCount( nQueries );
+	for( i = 0; i < nQueries; i++ )
+	{
+		GridBenchmarkQuery_t &query = queries[i];
+		query.m_vCenter = Vector( RandomFloat( -fHalfSize, fHalfSize ), RandomFloat( -fHalfSize, fHalfSize ), 0.0f );
+		query.m_vMins = query.m_vCenter - Vector( fRadius, fRadius, MAX_COORD_FLOAT );
+		query.m_vMaxs = query.m_vCenter + Vector( fRadius, fRadius, MAX_COORD_FLOAT );
+		query.m_iOwner = 2 + (i % 8);
+		for( j = 0; j < ARRAYSIZE(query.m_Planes); j++ )
+		{
+			float fAngle = DEG2RAD( 45.0f + j * 90.0f );
+			Vector vNormal( -cos( fAngle ), -sin( fAngle ), 0.0f );
+			query.m_Planes[j].Init( vNormal, vNormal.Dot( query.m_vCenter ) - fRadius );
+		}
+	}
+
+	CUnitSpatialGrid *pGrid = new CUnitSpatialGrid();
+	for( i = 0; i < nUnits; i++ )
+		pGrid->Insert( NULL, units[i].m_vPos, units[i].m_iOwner );
+
+	Msg( "unit_grid_benchmark: %d units, %d queries, radius %.0f\n", nUnits, nQueries, fRadius );
+	for( iShape = 0; iShape < GRIDBENCHMARK_COUNT; iShape++ )
+	{
+		// Test all units
+		int nBruteFound = 0;
+		double fStartTime = Plat_FloatTime();
+		for( i = 0; i < nQueries; i++ )
+		{
+			for( j = 0; j < nUnits; j++ )
+			{
+				if( units[j].m_iOwner == queries[i].m_iOwner && GridBenchmarkTest( iShape, queries[i], units[j].m_vPos, fRadiusSqr ) )
+					nBruteFound++;
+			}
+		}
+		double fBruteTime = Plat_FloatTime() - fStartTime;
+
+		// Unit grid, only visiting the cells containing units of the owner
+		int nGridFound = 0;
+		fStartTime = Plat_FloatTime();
+		for( i = 0; i < nQueries; i++ )
+		{
+			const GridBenchmarkQuery_t &query = queries[i];
+			CGridBenchmarkCollector collector( iShape, query, fRadiusSqr );
+			unsigned int ownerMask = UnitGridOwnerBit( query.m_iOwner );
+			if( iShape == GRIDBENCHMARK_RADIUS )
+				pGrid->ForAllInRadius( collector, query.m_vCenter, fRadius, ownerMask );
+			else if( iShape == GRIDBENCHMARK_BOX )
+				pGrid->ForAllInBox( collector, query.m_vMins, query.m_vMaxs, ownerMask );
+			else
+				pGrid->ForAllInPlanes( collector, query.m_Planes, ARRAYSIZE(query.m_Planes), 0.0f, ownerMask );
+			nGridFound += collector.m_nFound;
+		}
+		double fGridTime = Plat_FloatTime() - fStartTime;
+
+		Msg( "\t%s: all units %.3f ms, unit grid %.3f ms (%d found)\n", s_GridBenchmarkShapeNames[iShape], 
+			fBruteTime * 1000.0, fGridTime * 1000.0, nGridFound );
+		if( nBruteFound != nGridFound )
+			Warning( "unit_grid_benchmark: %s results differ (%d versus %d)!\n", s_GridBenchmarkShapeNames[iShape], nBruteFound, nGridFound );
+	}
+
+	delete pGrid;
+}
+
+CON_COMMAND_F( unit_grid_benchmark, "Measures owner filtered radius, box and plane queries on 100, 500 and 2000 synthetic units, testing all units versus the unit grid.\n\tArguments: [queries] [radius]", FCVAR_CHEAT )
+{
+	if ( !UTIL_IsCommandIssuedByServerAdmin() )
+		return;
+
+	int nQueries = args.ArgC() > 1 ? atoi( args[1] ) : 1000;
+	float fRadius = args.ArgC() > 2 ? atof( args[2] ) : 1024.0f;
+	nQueries = MAX( nQueries, 1 );
+
+	static const int s_UnitCounts[] = { 100, 500, 2000 };
+	for( int i = 0; i < ARRAYSIZE(s_UnitCounts); i++ )
+		UnitGridBenchmark( s_UnitCounts[i], nQueries, fRadius );
+}
+#endif // CLIENT_DLL
+
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 UnitListInfo *g_pUnitListHead = NULL;
@@ -107,6 +1020,47 @@ void MapUnits( boost::python::object method )
 		}
 	}
 }
+
+static CUtlVector< CUnitBase * > s_PyUnitQueryResults;
+
+static unsigned int PyUnitQueryOwnerMask( int iOwner )
+{
+	return iOwner == -1 ? UNITGRID_ALLOWNERS : UnitGridOwnerBit( iOwner );
+}
+
+static boost::python::list PyUnitQueryResultsToList( int iOwner )
+{
+	boost::python::list units;
+	for( int i = 0; i < s_PyUnitQueryResults.Count(); i++ )
+	{
+		// Owners from 31 and up share a bit in the grid
+		if( iOwner != -1 && s_PyUnitQueryResults[i]->GetOwnerNumber() != iOwner )
+			continue;
+		units.append( s_PyUnitQueryResults[i]->GetPyInstance() );
+	}
+	s_PyUnitQueryResults.RemoveAll();
+	return units;
+}
+
+boost::python::list UnitsInRadius( const Vector &vCenter, float fRadius, int iOwner )
+{
+	g_Unit_Manager.FindUnitsInRadius( s_PyUnitQueryResults, vCenter, fRadius, PyUnitQueryOwnerMask( iOwner ) );
+	return PyUnitQueryResultsToList( iOwner );
+}
+
+boost::python::list UnitsInBox( const Vector &vMins, const Vector &vMaxs, int iOwner )
+{
+	g_Unit_Manager.FindUnitsInBox( s_PyUnitQueryResults, vMins, vMaxs, PyUnitQueryOwnerMask( iOwner ) );
+	return PyUnitQueryResultsToList( iOwner );
+}
+
+#ifdef CLIENT_DLL
+boost::python::list UnitsInScreenRect( int iXMin, int iYMin, int iXMax, int iYMax, int iOwner )
+{
+	g_Unit_Manager.FindUnitsInScreenRect( s_PyUnitQueryResults, iXMin, iYMin, iXMax, iYMax, PyUnitQueryOwnerMask( iOwner ) );
+	return PyUnitQueryResultsToList( iOwner );
+}
+#endif // CLIENT_DLL
 #endif // DISABLE_PYTHON
 
 //-----------------------------------------------------------------------------
@@ -138,7 +1092,7 @@ Disposition_t GetPlayerRelationShip(int p1, int p2)
 // Input  :
 // Output :
 //-----------------------------------------------------------------------------
-CUnitBase::CUnitBase() : m_bUseCheapShotSimulation(true), m_fAccuracy(1.0f), m_bCanBeSeen(true)
+CUnitBase::CUnitBase() : m_bUseCheapShotSimulation(true), m_fAccuracy(1.0f), m_iUnitGridHandle(-1), m_bCanBeSeen(true)
 {
 	SetAllowNavIgnore(true);
 
@@ -152,6 +1106,7 @@ CUnitBase::CUnitBase() : m_bUseCheapShotSimulation(true), m_fAccuracy(1.0f), m_b
 	m_fTestRouteStartHeight = 100.0f;
 	m_fLastRangeAttackLOSTime = -1;
 	m_iAttackLOSMask = MASK_BLOCKLOS_AND_NPCS|CONTENTS_IGNORE_NODRAW_OPAQUE;
+	m_bBatchedTick = false;
 
 	// Default unit type
 	SetUnitType("unit_unknown");
@@ -178,6 +1133,10 @@ void CUnitBase::UpdateOnRemove( void )
 {
 	RemoveFromUnitList();
 
+#ifndef CLIENT_DLL
+	DisableBatchedTick();
+#endif // CLIENT_DLL
+
 	int i;
 	for( i=0; i < m_SelectedByPlayers.Count(); i++ )
 	{
@@ -278,6 +1237,9 @@ void CUnitBase::PhysicsSimulate( void )
 	// Run all but the base think function
 	PhysicsRunThink( THINK_FIRE_ALL_BUT_BASE );
 	PhysicsRunThink( THINK_FIRE_BASE_ONLY );
+
+	// Movement is done in the think functions
+	g_Unit_Manager.UpdateUnitPosition( this );
 }
 
 //-----------------------------------------------------------------------------
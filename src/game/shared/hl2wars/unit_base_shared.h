@@ -52,8 +52,275 @@ extern UnitListInfo *g_pUnitListHead;
 UnitListInfo *GetUnitListForOwnernumber(int iOwnerNumber);
 #ifndef DISABLE_PYTHON
 	void MapUnits( boost::python::object method );
+
+	// Unit grid queries. Owner -1 returns the units of all owners.
+	boost::python::list UnitsInRadius( const Vector &vCenter, float fRadius, int iOwner = -1 );
+	boost::python::list UnitsInBox( const Vector &vMins, const Vector &vMaxs, int iOwner = -1 );
+#ifdef CLIENT_DLL
+	// Units with their origin inside the screen rect (in pixels). Dormant units are not returned.
+	boost::python::list UnitsInScreenRect( int iXMin, int iYMin, int iXMax, int iYMax, int iOwner = -1 );
+#endif // CLIENT_DLL
 #endif // DISABLE_PYTHON
 
+//=============================================================================
+//
+// class CUnitSpatialGrid
+//
+// Uniform grid over the world, bucketing units on their position. Allows 
+// finding the units near a position without iterating over all units.
+// Entries are referenced by a handle, which stays valid while moving.
+//
+//=============================================================================
+#define UNITGRID_CELLSIZE 512
+#define UNITGRID_SIZE ( FOW_WORLDSIZE / UNITGRID_CELLSIZE )
+#define UNITGRID_TOLERANCE 64.0f // Units are repositioned in the grid once per tick, so pad queries a bit
+#define UNITGRID_OWNERBITS 32
+#define UNITGRID_ALLOWNERS 0xFFFFFFFF
+
+// Bit of an owner in the owner masks of the grid. Owners from 31 and up share the last bit.
+inline int UnitGridOwnerBitIndex( int iOwner )
+{
+	return ( iOwner >= 0 && iOwner < UNITGRID_OWNERBITS - 1 ) ? iOwner : UNITGRID_OWNERBITS - 1;
+}
+
+inline unsigned int UnitGridOwnerBit( int iOwner )
+{
+	return 1u << UnitGridOwnerBitIndex( iOwner );
+}
+
+struct UnitGridEntry_t
+{
+	CUnitBase *m_pUnit;
+	Vector m_vPos;
+	int m_iOwner;
+	int m_iHandle;
+};
+
+class CUnitSpatialGrid
+{
+public:
+	CUnitSpatialGrid();
+
+	int				Insert( CUnitBase *pUnit, const Vector &vPos, int iOwner );
+	void			Remove( int iHandle );
+	void			Move( int iHandle, const Vector &vPos );
+	void			RemoveAll();
+	int				Count() const { return m_iCount; }
+	const CUtlVector< UnitGridEntry_t > &GetCell( int iCell ) const { return m_Cells[iCell]; }
+
+	void			ComputeCell( const Vector &vPos, int &x, int &y ) const;
+	void			ComputeCellBounds( int x, int y, Vector &vMins, Vector &vMaxs ) const;
+
+	// Owners with entries in a cell (see UnitGridOwnerBit)
+	unsigned int	GetCellOwnerMask( int iCell ) const { return m_CellOwnerMasks[iCell]; }
+
+	// Calls func( const UnitGridEntry_t &entry ) for all entries of the owners in the mask in the cells 
+	// overlapping the radius, box or planes. Stops and returns false when the functor returns false.
+	template < typename Functor >
+	bool			ForAllInRadius( Functor &func, const Vector &vCenter, float fRadius, unsigned int ownerMask = UNITGRID_ALLOWNERS );
+	template < typename Functor >
+	bool			ForAllInBox( Functor &func, const Vector &vMins, const Vector &vMaxs, unsigned int ownerMask = UNITGRID_ALLOWNERS );
+	// Cells outside any of the planes (normals pointing inwards) by more than the tolerance are skipped.
+	template < typename Functor >
+	bool			ForAllInPlanes( Functor &func, const VPlane *pPlanes, int nPlanes, float fTolerance, unsigned int ownerMask = UNITGRID_ALLOWNERS );
+
+private:
+	template < typename Functor >
+	bool			ForAllInCell( Functor &func, int iCell, unsigned int ownerMask );
+
+	void			AddCellOwner( int iCell, int iOwner );
+	void			RemoveCellOwner( int iCell, int iOwner );
+
+	struct GridLocation_t
+	{
+		int m_iCell;
+		int m_iIndex;
+	};
+
+	CUtlVector< UnitGridEntry_t > m_Cells[UNITGRID_SIZE*UNITGRID_SIZE];
+	CUtlVector< GridLocation_t > m_Locations;
+	CUtlVector< int > m_FreeHandles;
+	int m_iCount;
+
+	// Per owner buckets. Number of entries per owner bit in each cell.
+	unsigned int m_CellOwnerMasks[UNITGRID_SIZE*UNITGRID_SIZE];
+	unsigned short m_CellOwnerCounts[UNITGRID_SIZE*UNITGRID_SIZE][UNITGRID_OWNERBITS];
+
+	// Z range of all entries, used as the height of the cells when testing against planes. Only grows.
+	float m_fMinZ, m_fMaxZ;
+};
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+inline void CUnitSpatialGrid::ComputeCell( const Vector &vPos, int &x, int &y ) const
+{
+	x = clamp( (int)( ( vPos.x + (FOW_WORLDSIZE / 2) ) / UNITGRID_CELLSIZE ), 0, UNITGRID_SIZE - 1 );
+	y = clamp( (int)( ( vPos.y + (FOW_WORLDSIZE / 2) ) / UNITGRID_CELLSIZE ), 0, UNITGRID_SIZE - 1 );
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Bounds of a cell, using the z range of the entries. The border cells
+//			also contain the positions outside the world.
+//-----------------------------------------------------------------------------
+inline void CUnitSpatialGrid::ComputeCellBounds( int x, int y, Vector &vMins, Vector &vMaxs ) const
+{
+	vMins.x = x == 0 ? -MAX_COORD_FLOAT : x * UNITGRID_CELLSIZE - (FOW_WORLDSIZE / 2);
+	vMins.y = y == 0 ? -MAX_COORD_FLOAT : y * UNITGRID_CELLSIZE - (FOW_WORLDSIZE / 2);
+	vMaxs.x = x == UNITGRID_SIZE - 1 ? MAX_COORD_FLOAT : (x + 1) * UNITGRID_CELLSIZE - (FOW_WORLDSIZE / 2);
+	vMaxs.y = y == UNITGRID_SIZE - 1 ? MAX_COORD_FLOAT : (y + 1) * UNITGRID_CELLSIZE - (FOW_WORLDSIZE / 2);
+	vMins.z = m_fMinZ;
+	vMaxs.z = m_fMaxZ;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+template < typename Functor >
+inline bool CUnitSpatialGrid::ForAllInCell( Functor &func, int iCell, unsigned int ownerMask )
+{
+	if( ( m_CellOwnerMasks[iCell] & ownerMask ) == 0 )
+		return true;
+
+	const CUtlVector< UnitGridEntry_t > &cell = m_Cells[iCell];
+	bool bFilterOwners = ( m_CellOwnerMasks[iCell] & ~ownerMask ) != 0;
+	for( int i = 0; i < cell.Count(); i++ )
+	{
+		if( bFilterOwners && ( UnitGridOwnerBit( cell[i].m_iOwner ) & ownerMask ) == 0 )
+			continue;
+		if( func( cell[i] ) == false )
+			return false;
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+template < typename Functor >
+inline bool CUnitSpatialGrid::ForAllInRadius( Functor &func, const Vector &vCenter, float fRadius, unsigned int ownerMask )
+{
+	int iMinX, iMinY, iMaxX, iMaxY, x, y;
+	ComputeCell( vCenter - Vector( fRadius, fRadius, 0 ), iMinX, iMinY );
+	ComputeCell( vCenter + Vector( fRadius, fRadius, 0 ), iMaxX, iMaxY );
+
+	for( y = iMinY; y <= iMaxY; y++ )
+	{
+		for( x = iMinX; x <= iMaxX; x++ )
+		{
+			if( ForAllInCell( func, x + y * UNITGRID_SIZE, ownerMask ) == false )
+				return false;
+		}
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+template < typename Functor >
+inline bool CUnitSpatialGrid::ForAllInBox( Functor &func, const Vector &vMins, const Vector &vMaxs, unsigned int ownerMask )
+{
+	int iMinX, iMinY, iMaxX, iMaxY, x, y;
+	ComputeCell( vMins, iMinX, iMinY );
+	ComputeCell( vMaxs, iMaxX, iMaxY );
+
+	for( y = iMinY; y <= iMaxY; y++ )
+	{
+		for( x = iMinX; x <= iMaxX; x++ )
+		{
+			if( ForAllInCell( func, x + y * UNITGRID_SIZE, ownerMask ) == false )
+				return false;
+		}
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+template < typename Functor >
+inline bool CUnitSpatialGrid::ForAllInPlanes( Functor &func, const VPlane *pPlanes, int nPlanes, float fTolerance, unsigned int ownerMask )
+{
+	int x, y, iCell, i;
+	Vector vMins, vMaxs, vFar;
+
+	for( y = 0; y < UNITGRID_SIZE; y++ )
+	{
+		for( x = 0; x < UNITGRID_SIZE; x++ )
+		{
+			iCell = x + y * UNITGRID_SIZE;
+			if( ( m_CellOwnerMasks[iCell] & ownerMask ) == 0 )
+				continue;
+
+			// Test the corner furthest along the normal of each plane
+			ComputeCellBounds( x, y, vMins, vMaxs );
+			for( i = 0; i < nPlanes; i++ )
+			{
+				const Vector &vNormal = pPlanes[i].m_Normal;
+				vFar.x = vNormal.x >= 0.0f ? vMaxs.x : vMins.x;
+				vFar.y = vNormal.y >= 0.0f ? vMaxs.y : vMins.y;
+				vFar.z = vNormal.z >= 0.0f ? vMaxs.z : vMins.z;
+				if( pPlanes[i].DistTo( vFar ) < -fTolerance )
+					break;
+			}
+			if( i != nPlanes )
+				continue;
+
+			if( ForAllInCell( func, iCell, ownerMask ) == false )
+				return false;
+		}
+	}
+	return true;
+}
+
+#ifdef CLIENT_DLL
+//=============================================================================
+//
+// class CUnitScreenCache
+//
+// Screen space bounds of the units in view, stored as structure of arrays. 
+// The units are bucketed on their projected origin in a coarse grid over the
+// screen, so box selection and picking become range queries.
+//
+//=============================================================================
+#define UNITSCREEN_CELLSIZE 64
+
+class CUnitScreenCache
+{
+public:
+	CUnitScreenCache();
+
+	void			Clear( int iScreenWidth, int iScreenHeight );
+	void			Add( CUnitBase *pUnit, unsigned int ownerBit, int iX, int iY, int iXMin, int iYMin, int iXMax, int iYMax, float fDepth, bool bPickable = true );
+	void			BuildGrid();
+
+	int				Count() const { return m_Units.Count(); }
+	CUnitBase *		GetUnit( int i ) const { return m_Units[i]; }
+
+	// Indices of the units of the owners in the mask with their origin inside the rect
+	void			FindInRect( CUtlVector< int > &indices, int iXMin, int iYMin, int iXMax, int iYMax, unsigned int ownerMask ) const;
+	// Index of the nearest pickable unit of the owners in the mask with its bounds containing the position, or -1
+	int				FindAtPos( int iX, int iY, unsigned int ownerMask ) const;
+
+private:
+	int m_iScreenWidth, m_iScreenHeight;
+	int m_nCellsX, m_nCellsY;
+	int m_iMaxExtent; // Largest distance from an origin to the edge of its bounds
+
+	CUtlVector< CUnitBase * > m_Units;
+	CUtlVector< unsigned int > m_OwnerBits;
+	CUtlVector< short > m_X, m_Y;
+	CUtlVector< short > m_XMin, m_YMin, m_XMax, m_YMax;
+	CUtlVector< float > m_Depth;
+	CUtlVector< bool > m_Pickable; // Solid and not point sized, like the mouse picking scan requires
+
+	// Units of cell i are m_CellUnits[m_CellStart[i]] up to m_CellUnits[m_CellStart[i+1]]
+	CUtlVector< int > m_CellStart;
+	CUtlVector< int > m_CellUnits;
+};
+#endif // CLIENT_DLL
+
 //=============================================================================
 //
 // class CUnit_Manager
@@ -75,6 +342,23 @@ public:
 	void RemoveUnit( CUnitBase *pUnit );
 
 	bool FindUnit( CUnitBase *pUnit )	{ return ( m_Units.Find( pUnit ) != m_Units.InvalidIndex() ); }
+
+	// Spatial queries
+	void UpdateUnitPosition( CUnitBase *pUnit );
+	void UpdateAllUnitPositions();
+	void UpdateGrid();
+	const CUnitSpatialGrid &GetGrid() const { return m_Grid; }
+	int FindUnitsInRadius( CUtlVector< CUnitBase * > &units, const Vector &vCenter, float fRadius, unsigned int ownerMask = UNITGRID_ALLOWNERS );
+	int FindUnitsInBox( CUtlVector< CUnitBase * > &units, const Vector &vMins, const Vector &vMaxs, unsigned int ownerMask = UNITGRID_ALLOWNERS );
+	int FindUnitsInFrustum( CUtlVector< CUnitBase * > &units, const VPlane *pPlanes, int nPlanes, unsigned int ownerMask = UNITGRID_ALLOWNERS );
+#ifdef CLIENT_DLL
+	int FindUnitsInScreenRect( CUtlVector< CUnitBase * > &units, int iXMin, int iYMin, int iXMax, int iYMax, unsigned int ownerMask = UNITGRID_ALLOWNERS );
+	CUnitBase *FindUnitAtScreenPos( int iX, int iY, unsigned int ownerMask = UNITGRID_ALLOWNERS );
+
+	// Screen bounds of the units in view, rebuild once per frame when used
+	void UpdateScreenCache();
+	const CUnitScreenCache &GetScreenCache() const { return m_ScreenCache; }
+#endif // CLIENT_DLL
 	
 private:
 	enum
@@ -86,6 +370,16 @@ private:
 	
 	CUnitArray m_Units;
 
+	CUnitSpatialGrid m_Grid;
+	int m_iLastGridUpdateTick;
+
+#ifdef CLIENT_DLL
+	// For rects extending outside the view covered by the screen cache
+	int FindUnitsInScreenRectUncached( CUtlVector< CUnitBase * > &units, int iXMin, int iYMin, int iXMax, int iYMax, unsigned int ownerMask );
+
+	CUnitScreenCache m_ScreenCache;
+	int m_iLastScreenCacheFrame;
+#endif // CLIENT_DLL
 };
 
 //-------------------------------------
@@ -126,6 +420,10 @@ public:
 	friend class UnitBaseNavigator;
 	friend class UnitBaseSense;
 	friend class UnitBaseAnimState;
+	friend class CUnit_Manager;
+#ifndef CLIENT_DLL
+	friend class CUnitTickSystem;
+#endif // CLIENT_DLL
 
 	//-----------------------------------------------------
 	//
@@ -298,6 +596,16 @@ public:
 #endif // DISABLE_PYTHON
 	virtual void		HandleAnimEvent( animevent_t *pEvent );
 
+	// Batched tick. Sensing, navigation, movement and the animstate update of the unit 
+	// are done by the unit tick system, instead of per unit from the Python think.
+	// The optional hook is called after sensing, before the navigator updates.
+#ifndef DISABLE_PYTHON
+	void				SetBatchedTick( boost::python::object movecommand, boost::python::object locomotion, boost::python::object senses, 
+							boost::python::object animstate, float fTickInterval = 0.1f, boost::python::object hook = boost::python::object() );
+#endif // DISABLE_PYTHON
+	void				DisableBatchedTick();
+	bool				IsBatchedTickEnabled() { return m_bBatchedTick; }
+
 #endif
 
 	CBaseEntity *		GetEnemy();
@@ -413,6 +721,9 @@ private:
 	CUnitBase *m_pPrev;
 	CUnitBase *m_pNext;
 
+	// Handle in the spatial grid of the unit manager
+	int m_iUnitGridHandle;
+
 	bool m_bCanBeSeen;
 	bool m_bUseCustomCanBeSeenCheck;
 	int m_iSelectionPriority;
@@ -452,6 +763,20 @@ private:
 	boost::python::object m_pyAnimEventMap; // Keeps m_pAnimEventMap valid
 #endif // DISABLE_PYTHON
 
+	// Batched tick
+	bool m_bBatchedTick;
+	float m_fBatchedTickInterval;
+	float m_fNextBatchedTickTime;
+	float m_fLastBatchedTickTime;
+	UnitBaseMoveCommand *m_pBatchedMoveCommand;
+	UnitBaseLocomotion *m_pBatchedLocomotion;
+	UnitBaseSense *m_pBatchedSenses;
+	UnitBaseAnimState *m_pBatchedAnimState;
+#ifndef DISABLE_PYTHON
+	boost::python::object m_pyBatchedTickComponents; // Keeps the component pointers valid
+	boost::python::object m_pyBatchedTickHook;
+#endif // DISABLE_PYTHON
+
 	// Animation state
 	CNetworkVar(bool, m_bCrouching );
 	CNetworkVar(bool, m_bClimbing );
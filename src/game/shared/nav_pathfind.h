@@ -40,6 +40,12 @@ class ShortestPathCost
 {
 public:
 	float operator() ( CNavArea *area, CNavArea *fromArea, const CNavLadder *ladder, const CFuncElevator *elevator, float length )
+	{
+		return (*this)( area, fromArea, ladder, elevator, length, fromArea ? fromArea->GetCostSoFar() : 0.0f );
+	}
+
+	// Used by searches with a CNavPathContext, which passes the cost so far of 'fromArea'
+	float operator() ( CNavArea *area, CNavArea *fromArea, const CNavLadder *ladder, const CFuncElevator *elevator, float length, float fromCostSoFar )
 	{
 		if ( fromArea == NULL )
 		{
@@ -64,7 +70,7 @@ public:
 				dist = ( area->GetCenter() - fromArea->GetCenter() ).Length();
 			}
 
-			float cost = dist + fromArea->GetCostSoFar();
+			float cost = dist + fromCostSoFar;
 
 			// if this is a "crouch" area, add penalty
 			if ( area->GetAttributes() & NAV_MESH_CROUCH )
@@ -87,19 +93,273 @@ public:
 
 //--------------------------------------------------------------------------------------------------------------
 /**
- * Find path from startArea to goalArea via an A* search, using supplied cost heuristic.
- * If cost functor returns -1 for an area, that area is considered a dead end.
- * This doesn't actually build a path, but the path is defined by following parent
- * pointers back from goalArea to startArea.
- * If 'closestArea' is non-NULL, the closest area to the goal is returned (useful if the path fails).
- * If 'goalArea' is NULL, will compute a path as close as possible to 'goalPos'.
- * If 'goalPos' is NULL, will use the center of 'goalArea' as the goal position.
- * If 'maxPathLength' is nonzero, path building will stop when this length is reached.
- * Returns true if a path exists.
+ * Search context using the search state stored on the nav areas themselves (open list, markers,
+ * costs and parents). This is the default context of NavAreaBuildPath(). Only one search can
+ * use it at a time, but the resulting path can be read from the areas with CNavArea::GetParent().
  */
-#define IGNORE_NAV_BLOCKERS true
-template< typename CostFunctor >
-bool NavAreaBuildPath( CNavArea *startArea, CNavArea *goalArea, const Vector *goalPos, CostFunctor &costFunc, CNavArea **closestArea = NULL, float maxPathLength = 0.0f, int teamID = TEAM_ANY, bool ignoreNavBlockers = false )
+class CNavAreaGlobalSearchContext
+{
+public:
+	void ClearSearchLists( void )							{ CNavArea::ClearSearchLists(); }
+
+	bool IsOpenListEmpty( void ) const						{ return CNavArea::IsOpenListEmpty(); }
+	CNavArea *PopOpenList( void )							{ return CNavArea::PopOpenList(); }
+	bool IsOpen( const CNavArea *area ) const				{ return area->IsOpen(); }
+	void AddToOpenList( CNavArea *area )					{ area->AddToOpenList(); }
+	void UpdateOnOpenList( CNavArea *area )					{ area->UpdateOnOpenList(); }
+
+	bool IsClosed( const CNavArea *area ) const				{ return area->IsClosed(); }
+	void AddToClosedList( CNavArea *area )					{ area->AddToClosedList(); }
+	void RemoveFromClosedList( CNavArea *area )				{ area->RemoveFromClosedList(); }
+
+	float GetCostSoFar( const CNavArea *area ) const		{ return area->GetCostSoFar(); }
+	void SetCostSoFar( CNavArea *area, float value )		{ area->SetCostSoFar( value ); }
+	float GetTotalCost( const CNavArea *area ) const		{ return area->GetTotalCost(); }
+	void SetTotalCost( CNavArea *area, float value )		{ area->SetTotalCost( value ); }
+	float GetPathLengthSoFar( const CNavArea *area ) const	{ return area->GetPathLengthSoFar(); }
+	void SetPathLengthSoFar( CNavArea *area, float value )	{ area->SetPathLengthSoFar( value ); }
+
+	CNavArea *GetParent( const CNavArea *area ) const		{ return area->GetParent(); }
+	NavTraverseType GetParentHow( const CNavArea *area ) const	{ return area->GetParentHow(); }
+	void SetParent( CNavArea *area, CNavArea *parent, NavTraverseType how = NUM_TRAVERSE_TYPES )	{ area->SetParent( parent, how ); }
+
+	// cost functors read the cost so far of 'fromArea' from the area itself
+	template< typename CostFunctor >
+	float ComputeCost( CostFunctor &costFunc, CNavArea *area, CNavArea *fromArea, const CNavLadder *ladder, const CFuncElevator *elevator, float length )
+	{
+		return costFunc( area, fromArea, ladder, elevator, length );
+	}
+};
+
+
+//--------------------------------------------------------------------------------------------------------------
+/**
+ * Reentrant search context for NavAreaBuildPath(). All search state lives in this object: the
+ * open list is a binary heap on total cost and the costs and parents are stored in an array
+ * indexed by area ID. The nav areas are not modified, so searches using different contexts can
+ * run at the same time (for example one context per thread), as long as the nav mesh itself
+ * does not change.
+ *
+ * The resulting path is read with GetParent() and GetParentHow() of the context, instead of
+ * the functions on CNavArea. A context can be reused for any number of searches.
+ *
+ * Cost functors used with a context must provide an operator() taking the cost so far of 'fromArea'
+ * as additional last argument, because CNavArea::GetCostSoFar() is not updated by the search.
+ */
+class CNavPathContext
+{
+public:
+	CNavPathContext( void ) : m_marker( 0 ) {}
+
+	void ClearSearchLists( void )
+	{
+		// effectively clears all states
+		++m_marker;
+		if ( m_marker == 0 )
+		{
+			// wrapped around, old states might match the new marker
+			for( int i=0; i<m_states.Count(); ++i )
+				m_states[i].m_marker = 0;
+			m_marker = 1;
+		}
+
+		m_openList.RemoveAll();
+	}
+
+	bool IsOpenListEmpty( void ) const						{ return m_openList.Count() == 0; }
+
+	CNavArea *PopOpenList( void )
+	{
+		if ( m_openList.Count() == 0 )
+			return NULL;
+
+		CNavArea *area = m_openList[0];
+		GetState( area ).m_heapIndex = -1;
+
+		CNavArea *last = m_openList[ m_openList.Count()-1 ];
+		m_openList.RemoveMultipleFromTail( 1 );
+		if ( last != area )
+		{
+			m_openList[0] = last;
+			GetState( last ).m_heapIndex = 0;
+			HeapSiftDown( 0 );
+		}
+		return area;
+	}
+
+	bool IsOpen( const CNavArea *area ) const
+	{
+		const AreaState_t *state = FindState( area );
+		return state && state->m_heapIndex != -1;
+	}
+
+	void AddToOpenList( CNavArea *area )
+	{
+		AreaState_t &state = GetState( area );
+		if ( state.m_heapIndex != -1 )
+		{
+			// already on list
+			return;
+		}
+
+		state.m_heapIndex = m_openList.AddToTail( area );
+		HeapSiftUp( state.m_heapIndex );
+	}
+
+	void UpdateOnOpenList( CNavArea *area )
+	{
+		// total cost of an area on the open list only decreases
+		AreaState_t &state = GetState( area );
+		if ( state.m_heapIndex != -1 )
+			HeapSiftUp( state.m_heapIndex );
+	}
+
+	bool IsClosed( const CNavArea *area ) const
+	{
+		// like CNavArea, "closed" is defined as searched and not on open list
+		const AreaState_t *state = FindState( area );
+		return state && state->m_closed && state->m_heapIndex == -1;
+	}
+
+	void AddToClosedList( CNavArea *area )					{ GetState( area ).m_closed = true; }
+	void RemoveFromClosedList( CNavArea *area )				{ /* closed areas are moved back to the open list, which is enough */ }
+
+	float GetCostSoFar( const CNavArea *area ) const		{ const AreaState_t *state = FindState( area ); return state ? state->m_costSoFar : 0.0f; }
+	void SetCostSoFar( CNavArea *area, float value )		{ Assert( value >= 0.0 && !IS_NAN(value) ); GetState( area ).m_costSoFar = value; }
+	float GetTotalCost( const CNavArea *area ) const		{ const AreaState_t *state = FindState( area ); return state ? state->m_totalCost : 0.0f; }
+	void SetTotalCost( CNavArea *area, float value )		{ Assert( value >= 0.0 && !IS_NAN(value) ); GetState( area ).m_totalCost = value; }
+	float GetPathLengthSoFar( const CNavArea *area ) const	{ const AreaState_t *state = FindState( area ); return state ? state->m_pathLengthSoFar : 0.0f; }
+	void SetPathLengthSoFar( CNavArea *area, float value )	{ Assert( value >= 0.0 && !IS_NAN(value) ); GetState( area ).m_pathLengthSoFar = value; }
+
+	CNavArea *GetParent( const CNavArea *area ) const		{ const AreaState_t *state = FindState( area ); return state ? state->m_parent : NULL; }
+	NavTraverseType GetParentHow( const CNavArea *area ) const	{ const AreaState_t *state = FindState( area ); return state ? state->m_parentHow : NUM_TRAVERSE_TYPES; }
+	void SetParent( CNavArea *area, CNavArea *parent, NavTraverseType how = NUM_TRAVERSE_TYPES )
+	{
+		AreaState_t &state = GetState( area );
+		state.m_parent = parent;
+		state.m_parentHow = how;
+	}
+
+	// cost functors get the cost so far of 'fromArea' from this context
+	template< typename CostFunctor >
+	float ComputeCost( CostFunctor &costFunc, CNavArea *area, CNavArea *fromArea, const CNavLadder *ladder, const CFuncElevator *elevator, float length )
+	{
+		return costFunc( area, fromArea, ladder, elevator, length, fromArea ? GetCostSoFar( fromArea ) : 0.0f );
+	}
+
+	// release the memory used by the search states
+	void Purge( void )
+	{
+		m_states.Purge();
+		m_openList.Purge();
+	}
+
+private:
+	struct AreaState_t
+	{
+		unsigned int m_marker;				// state is only valid if m_marker == CNavPathContext::m_marker
+		int m_heapIndex;					// index on the open list, -1 if not open
+		bool m_closed;
+		float m_costSoFar;
+		float m_totalCost;
+		float m_pathLengthSoFar;
+		CNavArea *m_parent;
+		NavTraverseType m_parentHow;
+	};
+
+	const AreaState_t *FindState( const CNavArea *area ) const
+	{
+		unsigned int id = area->GetID();
+		if ( id >= (unsigned int)m_states.Count() || m_states[id].m_marker != m_marker )
+			return NULL;
+		return &m_states[id];
+	}
+
+	AreaState_t &GetState( const CNavArea *area )
+	{
+		unsigned int id = area->GetID();
+		if ( id >= (unsigned int)m_states.Count() )
+		{
+			int oldCount = m_states.Count();
+			m_states.SetCount( id + 1 );
+			for( int i=oldCount; i<m_states.Count(); ++i )
+				m_states[i].m_marker = 0;
+		}
+
+		AreaState_t &state = m_states[id];
+		if ( state.m_marker != m_marker )
+		{
+			// first use of this area in the current search
+			state.m_marker = m_marker;
+			state.m_heapIndex = -1;
+			state.m_closed = false;
+			state.m_costSoFar = 0.0f;
+			state.m_totalCost = 0.0f;
+			state.m_pathLengthSoFar = 0.0f;
+			state.m_parent = NULL;
+			state.m_parentHow = NUM_TRAVERSE_TYPES;
+		}
+		return state;
+	}
+
+	float GetHeapCost( int index ) const
+	{
+		return m_states[ m_openList[index]->GetID() ].m_totalCost;
+	}
+
+	void HeapSwap( int a, int b )
+	{
+		CNavArea *area = m_openList[a];
+		m_openList[a] = m_openList[b];
+		m_openList[b] = area;
+		m_states[ m_openList[a]->GetID() ].m_heapIndex = a;
+		m_states[ m_openList[b]->GetID() ].m_heapIndex = b;
+	}
+
+	void HeapSiftUp( int index )
+	{
+		while ( index > 0 )
+		{
+			int parent = ( index - 1 ) / 2;
+			if ( GetHeapCost( parent ) <= GetHeapCost( index ) )
+				break;
+			HeapSwap( parent, index );
+			index = parent;
+		}
+	}
+
+	void HeapSiftDown( int index )
+	{
+		int count = m_openList.Count();
+		while ( true )
+		{
+			int smallest = index;
+			int left = 2 * index + 1;
+			int right = left + 1;
+			if ( left < count && GetHeapCost( left ) < GetHeapCost( smallest ) )
+				smallest = left;
+			if ( right < count && GetHeapCost( right ) < GetHeapCost( smallest ) )
+				smallest = right;
+			if ( smallest == index )
+				break;
+			HeapSwap( smallest, index );
+			index = smallest;
+		}
+	}
+
+	unsigned int m_marker;
+	CUtlVector< AreaState_t > m_states;		// indexed by area ID
+	CUtlVector< CNavArea * > m_openList;	// binary heap, lowest total cost first
+};
+
+
+//--------------------------------------------------------------------------------------------------------------
+/**
+ * Implementation of the A* search of NavAreaBuildPath(). The search state is kept in the
+ * given search context, which is either CNavAreaGlobalSearchContext or a CNavPathContext.
+ */
+template< typename SearchContext, typename CostFunctor >
+bool NavAreaBuildPathInternal( SearchContext &ctx, CNavArea *startArea, CNavArea *goalArea, const Vector *goalPos, CostFunctor &costFunc, CNavArea **closestArea, float maxPathLength, int teamID, bool ignoreNavBlockers )
 {
 	VPROF_BUDGET( "NavAreaBuildPath", "NextBotSpiky" );
 
@@ -121,12 +381,12 @@ bool NavAreaBuildPath( CNavArea *startArea, CNavArea *goalArea, const Vector *go
 	if (goalArea == NULL && goalPos == NULL)
 		return false;
 
-	startArea->SetParent( NULL );
+	ctx.SetParent( startArea, NULL );
 
 	// if we are already in the goal area, build trivial path
 	if (startArea == goalArea)
 	{
-		goalArea->SetParent( NULL );
+		ctx.SetParent( goalArea, NULL );
 		return true;
 	}
 
@@ -134,30 +394,30 @@ bool NavAreaBuildPath( CNavArea *startArea, CNavArea *goalArea, const Vector *go
 	Vector actualGoalPos = (goalPos) ? *goalPos : goalArea->GetCenter();
 
 	// start search
-	CNavArea::ClearSearchLists();
+	ctx.ClearSearchLists();
 
 	// compute estimate of path length
 	/// @todo Cost might work as "manhattan distance"
-	startArea->SetTotalCost( (startArea->GetCenter() - actualGoalPos).Length() );
+	ctx.SetTotalCost( startArea, (startArea->GetCenter() - actualGoalPos).Length() );
 
-	float initCost = costFunc( startArea, NULL, NULL, NULL, -1.0f );	
+	float initCost = ctx.ComputeCost( costFunc, startArea, NULL, NULL, NULL, -1.0f );	
 	if (initCost < 0.0f)
 		return false;
-	startArea->SetCostSoFar( initCost );
-	startArea->SetPathLengthSoFar( 0.0 );
+	ctx.SetCostSoFar( startArea, initCost );
+	ctx.SetPathLengthSoFar( startArea, 0.0 );
 
-	startArea->AddToOpenList();
+	ctx.AddToOpenList( startArea );
 
 	// keep track of the area we visit that is closest to the goal
 	if (closestArea)
 		*closestArea = startArea;
-	float closestAreaDist = startArea->GetTotalCost();
+	float closestAreaDist = ctx.GetTotalCost( startArea );
 
 	// do A* search
-	while( !CNavArea::IsOpenListEmpty() )
+	while( !ctx.IsOpenListEmpty() )
 	{
 		// get next area to check
-		CNavArea *area = CNavArea::PopOpenList();
+		CNavArea *area = ctx.PopOpenList();
 
 #ifndef CLIENT_DLL
 		if ( isDebug )
@@ -342,7 +602,7 @@ bool NavAreaBuildPath( CNavArea *startArea, CNavArea *goalArea, const Vector *go
 			if ( newArea->IsBlocked( teamID, ignoreNavBlockers ) )
 				continue;
 
-			float newCostSoFar = costFunc( newArea, area, ladder, elevator, length );
+			float newCostSoFar = ctx.ComputeCost( costFunc, newArea, area, ladder, elevator, length );
 			
 			// check if cost functor says this area is a dead-end
 			if ( newCostSoFar < 0.0f )
@@ -353,14 +613,14 @@ bool NavAreaBuildPath( CNavArea *startArea, CNavArea *goalArea, const Vector *go
 			{
 				// keep track of path length so far
 				float deltaLength = ( newArea->GetCenter() - area->GetCenter() ).Length();
-				float newLengthSoFar = area->GetPathLengthSoFar() + deltaLength;
+				float newLengthSoFar = ctx.GetPathLengthSoFar( area ) + deltaLength;
 				if ( newLengthSoFar > maxPathLength )
 					continue;
 				
-				newArea->SetPathLengthSoFar( newLengthSoFar );
+				ctx.SetPathLengthSoFar( newArea, newLengthSoFar );
 			}
 
-			if ( ( newArea->IsOpen() || newArea->IsClosed() ) && newArea->GetCostSoFar() <= newCostSoFar )
+			if ( ( ctx.IsOpen( newArea ) || ctx.IsClosed( newArea ) ) && ctx.GetCostSoFar( newArea ) <= newCostSoFar )
 			{
 				// this is a worse path - skip it
 				continue;
@@ -378,36 +638,68 @@ bool NavAreaBuildPath( CNavArea *startArea, CNavArea *goalArea, const Vector *go
 					closestAreaDist = newCostRemaining;
 				}
 				
-				newArea->SetCostSoFar( newCostSoFar );
-				newArea->SetTotalCost( newCostSoFar + newCostRemaining );
+				ctx.SetCostSoFar( newArea, newCostSoFar );
+				ctx.SetTotalCost( newArea, newCostSoFar + newCostRemaining );
 
-				if ( newArea->IsClosed() )
+				if ( ctx.IsClosed( newArea ) )
 				{
-					newArea->RemoveFromClosedList();
+					ctx.RemoveFromClosedList( newArea );
 				}
 
-				if ( newArea->IsOpen() )
+				if ( ctx.IsOpen( newArea ) )
 				{
 					// area already on open list, update the list order to keep costs sorted
-					newArea->UpdateOnOpenList();
+					ctx.UpdateOnOpenList( newArea );
 				}
 				else
 				{
-					newArea->AddToOpenList();
+					ctx.AddToOpenList( newArea );
 				}
 
-				newArea->SetParent( area, how );
+				ctx.SetParent( newArea, area, how );
 			}
 		}
 
 		// we have searched this area
-		area->AddToClosedList();
+		ctx.AddToClosedList( area );
 	}
 
 	return false;
 }
 
 
+//--------------------------------------------------------------------------------------------------------------
+/**
+ * Find path from startArea to goalArea via an A* search, using supplied cost heuristic.
+ * If cost functor returns -1 for an area, that area is considered a dead end.
+ * This doesn't actually build a path, but the path is defined by following parent
+ * pointers back from goalArea to startArea.
+ * If 'closestArea' is non-NULL, the closest area to the goal is returned (useful if the path fails).
+ * If 'goalArea' is NULL, will compute a path as close as possible to 'goalPos'.
+ * If 'goalPos' is NULL, will use the center of 'goalArea' as the goal position.
+ * If 'maxPathLength' is nonzero, path building will stop when this length is reached.
+ * Returns true if a path exists.
+ */
+#define IGNORE_NAV_BLOCKERS true
+template< typename CostFunctor >
+bool NavAreaBuildPath( CNavArea *startArea, CNavArea *goalArea, const Vector *goalPos, CostFunctor &costFunc, CNavArea **closestArea = NULL, float maxPathLength = 0.0f, int teamID = TEAM_ANY, bool ignoreNavBlockers = false )
+{
+	CNavAreaGlobalSearchContext ctx;
+	return NavAreaBuildPathInternal( ctx, startArea, goalArea, goalPos, costFunc, closestArea, maxPathLength, teamID, ignoreNavBlockers );
+}
+
+//--------------------------------------------------------------------------------------------------------------
+/**
+ * Same as above, but keeps the search state in 'ctx' instead of on the nav areas, so multiple searches
+ * can run at the same time. The path is defined by following ctx.GetParent() back from goalArea to startArea.
+ */
+template< typename CostFunctor >
+bool NavAreaBuildPath( CNavPathContext &ctx, CNavArea *startArea, CNavArea *goalArea, const Vector *goalPos, CostFunctor &costFunc, CNavArea **closestArea = NULL, float maxPathLength = 0.0f, int teamID = TEAM_ANY, bool ignoreNavBlockers = false )
+{
+	return NavAreaBuildPathInternal( ctx, startArea, goalArea, goalPos, costFunc, closestArea, maxPathLength, teamID, ignoreNavBlockers );
+}
+
+
 //--------------------------------------------------------------------------------------------------------------
 /**
  * Compute distance between two areas. Return -1 if can't reach 'endArea' from 'startArea'.
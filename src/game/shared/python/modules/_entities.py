@@ -1253,6 +1253,10 @@ class Entities(GenerateModuleSemiShared):
         mb.mem_funs('GetCommander').call_policies = call_policies.return_value_policy( call_policies.return_by_value )
         
         mb.free_function('MapUnits').include()
+        mb.free_function('UnitsInRadius').include()
+        mb.free_function('UnitsInBox').include()
+        if self.isClient:
+            mb.free_function('UnitsInScreenRect').include()
         
         self.ParseUnitBaseShared(mb, cls_name)
         
@@ -140,11 +140,13 @@ class EntitiesMisc(GenerateModuleSemiShared):
         cls.include()
         cls.rename('NetworkVarInternal') 
         cls.mem_funs('NetworkVarsUpdateClient').exclude()
+        cls.mem_funs('WritePayload').exclude()
 
         cls = mb.class_('CPythonNetworkArray')
         cls.include()
         cls.rename('NetworkArrayInternal') 
         cls.mem_funs('NetworkVarsUpdateClient').exclude()
+        cls.mem_funs('WritePayload').exclude()
         cls.mem_funs('GetItem').rename('__getitem__')
         cls.mem_funs('SetItem').rename('__setitem__')
         
@@ -152,6 +154,7 @@ class EntitiesMisc(GenerateModuleSemiShared):
         cls.include()
         cls.rename('NetworkDictInternal') 
         cls.mem_funs('NetworkVarsUpdateClient').exclude()
+        cls.mem_funs('WritePayload').exclude()
         cls.mem_funs('GetItem').rename('__getitem__')
         cls.mem_funs('SetItem').rename('__setitem__')
         
@@ -48,6 +48,12 @@ class FOW(GenerateModuleSemiShared):
         
         if self.isServer:
             cls.mem_fun('PointInFOW').include()
+            cls.mem_fun('IsAnyTileVisibleInBox').include()
+            cls.mem_fun('IsBoxFullyVisible').include()
+            cls.mem_fun('PyComputeVisibleMasks').include()
+            cls.mem_fun('PyComputeVisibleMasks').rename('ComputeVisibleMasks')
+            cls.mem_fun('PyComputeVisibilityChanges').include()
+            cls.mem_fun('PyComputeVisibilityChanges').rename('ComputeVisibilityChanges')
                 
         mb.free_function('FogOfWarMgr').include()
         mb.free_function('FogOfWarMgr').call_policies = call_policies.return_value_policy( call_policies.reference_existing_object )
@@ -38,4 +38,5 @@ class _SrcTests(GenerateModuleSemiShared):
         mb.decls().exclude() 
 
         mb.free_function('SrcPyTest_EntityArg').include()
-        mb.free_function('SrcPyTest_NCrossProducts').include()
\ No newline at end of file
+        mb.free_function('SrcPyTest_NCrossProducts').include()
+        mb.free_function('SrcPyTest_HandleAttrPerSecond').include()
\ No newline at end of file
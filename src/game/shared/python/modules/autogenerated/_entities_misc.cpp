@@ -146,7 +146,7 @@ struct IMouse_wrapper : IMouse, bp::wrapper< IMouse > {
     }
 
     virtual long unsigned int GetCursor(  ){
-        bp::override func_GetCursor = this->get_override( "GetCursor" );
+        PY_OVERRIDE_LOOKUP( func_GetCursor, "GetCursor" );
         try {
             return func_GetCursor(  );
         } catch(bp::error_already_set &) {
@@ -168,7 +168,7 @@ struct IMouse_wrapper : IMouse, bp::wrapper< IMouse > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetIMouse(  ) of Class: IMouse\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetIMouse = this->get_override( "GetIMouse" );
+        PY_OVERRIDE_LOOKUP( func_GetIMouse, "GetIMouse" );
         if( func_GetIMouse.ptr() != Py_None )
             try {
                 return func_GetIMouse(  );
@@ -185,7 +185,7 @@ struct IMouse_wrapper : IMouse, bp::wrapper< IMouse > {
     }
 
     virtual void OnClickLeftDoublePressed( ::C_HL2WarsPlayer * player ){
-        bp::override func_OnClickLeftDoublePressed = this->get_override( "OnClickLeftDoublePressed" );
+        PY_OVERRIDE_LOOKUP( func_OnClickLeftDoublePressed, "OnClickLeftDoublePressed" );
         try {
             func_OnClickLeftDoublePressed( boost::python::ptr(player) );
         } catch(bp::error_already_set &) {
@@ -194,7 +194,7 @@ struct IMouse_wrapper : IMouse, bp::wrapper< IMouse > {
     }
 
     virtual void OnClickLeftPressed( ::C_HL2WarsPlayer * player ){
-        bp::override func_OnClickLeftPressed = this->get_override( "OnClickLeftPressed" );
+        PY_OVERRIDE_LOOKUP( func_OnClickLeftPressed, "OnClickLeftPressed" );
         try {
             func_OnClickLeftPressed( boost::python::ptr(player) );
         } catch(bp::error_already_set &) {
@@ -203,7 +203,7 @@ struct IMouse_wrapper : IMouse, bp::wrapper< IMouse > {
     }
 
     virtual void OnClickLeftReleased( ::C_HL2WarsPlayer * player ){
-        bp::override func_OnClickLeftReleased = this->get_override( "OnClickLeftReleased" );
+        PY_OVERRIDE_LOOKUP( func_OnClickLeftReleased, "OnClickLeftReleased" );
         try {
             func_OnClickLeftReleased( boost::python::ptr(player) );
         } catch(bp::error_already_set &) {
@@ -212,7 +212,7 @@ struct IMouse_wrapper : IMouse, bp::wrapper< IMouse > {
     }
 
     virtual void OnClickRightDoublePressed( ::C_HL2WarsPlayer * player ){
-        bp::override func_OnClickRightDoublePressed = this->get_override( "OnClickRightDoublePressed" );
+        PY_OVERRIDE_LOOKUP( func_OnClickRightDoublePressed, "OnClickRightDoublePressed" );
         try {
             func_OnClickRightDoublePressed( boost::python::ptr(player) );
         } catch(bp::error_already_set &) {
@@ -221,7 +221,7 @@ struct IMouse_wrapper : IMouse, bp::wrapper< IMouse > {
     }
 
     virtual void OnClickRightPressed( ::C_HL2WarsPlayer * player ){
-        bp::override func_OnClickRightPressed = this->get_override( "OnClickRightPressed" );
+        PY_OVERRIDE_LOOKUP( func_OnClickRightPressed, "OnClickRightPressed" );
         try {
             func_OnClickRightPressed( boost::python::ptr(player) );
         } catch(bp::error_already_set &) {
@@ -230,7 +230,7 @@ struct IMouse_wrapper : IMouse, bp::wrapper< IMouse > {
     }
 
     virtual void OnClickRightReleased( ::C_HL2WarsPlayer * player ){
-        bp::override func_OnClickRightReleased = this->get_override( "OnClickRightReleased" );
+        PY_OVERRIDE_LOOKUP( func_OnClickRightReleased, "OnClickRightReleased" );
         try {
             func_OnClickRightReleased( boost::python::ptr(player) );
         } catch(bp::error_already_set &) {
@@ -239,7 +239,7 @@ struct IMouse_wrapper : IMouse, bp::wrapper< IMouse > {
     }
 
     virtual void OnCursorEntered( ::C_HL2WarsPlayer * player ){
-        bp::override func_OnCursorEntered = this->get_override( "OnCursorEntered" );
+        PY_OVERRIDE_LOOKUP( func_OnCursorEntered, "OnCursorEntered" );
         try {
             func_OnCursorEntered( boost::python::ptr(player) );
         } catch(bp::error_already_set &) {
@@ -248,7 +248,7 @@ struct IMouse_wrapper : IMouse, bp::wrapper< IMouse > {
     }
 
     virtual void OnCursorExited( ::C_HL2WarsPlayer * player ){
-        bp::override func_OnCursorExited = this->get_override( "OnCursorExited" );
+        PY_OVERRIDE_LOOKUP( func_OnCursorExited, "OnCursorExited" );
         try {
             func_OnCursorExited( boost::python::ptr(player) );
         } catch(bp::error_already_set &) {
@@ -257,7 +257,7 @@ struct IMouse_wrapper : IMouse, bp::wrapper< IMouse > {
     }
 
     virtual void OnHoverPaint(  ){
-        bp::override func_OnHoverPaint = this->get_override( "OnHoverPaint" );
+        PY_OVERRIDE_LOOKUP( func_OnHoverPaint, "OnHoverPaint" );
         try {
             func_OnHoverPaint(  );
         } catch(bp::error_already_set &) {
@@ -297,7 +297,7 @@ struct PyMouse_wrapper : PyMouse, bp::wrapper< PyMouse > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetCursor(  ) of Class: PyMouse\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetCursor = this->get_override( "GetCursor" );
+        PY_OVERRIDE_LOOKUP( func_GetCursor, "GetCursor" );
         if( func_GetCursor.ptr() != Py_None )
             try {
                 return func_GetCursor(  );
@@ -327,7 +327,7 @@ struct PyMouse_wrapper : PyMouse, bp::wrapper< PyMouse > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnHoverPaint(  ) of Class: PyMouse\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnHoverPaint = this->get_override( "OnHoverPaint" );
+        PY_OVERRIDE_LOOKUP( func_OnHoverPaint, "OnHoverPaint" );
         if( func_OnHoverPaint.ptr() != Py_None )
             try {
                 func_OnHoverPaint(  );
@@ -357,7 +357,7 @@ struct PyMouse_wrapper : PyMouse, bp::wrapper< PyMouse > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetIMouse(  ) of Class: IMouse\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetIMouse = this->get_override( "GetIMouse" );
+        PY_OVERRIDE_LOOKUP( func_GetIMouse, "GetIMouse" );
         if( func_GetIMouse.ptr() != Py_None )
             try {
                 return func_GetIMouse(  );
@@ -374,7 +374,7 @@ struct PyMouse_wrapper : PyMouse, bp::wrapper< PyMouse > {
     }
 
     virtual void OnClickLeftPressed( ::C_HL2WarsPlayer * player ) {
-        boost::python::override func_OnClickLeftPressed = this->get_override( "OnClickLeftPressed" );
+        PY_OVERRIDE_LOOKUP( func_OnClickLeftPressed, "OnClickLeftPressed" );
         if( func_OnClickLeftPressed.ptr() != Py_None )
             try {
                 func_OnClickLeftPressed( player ? player->GetPyHandle() : bp::object() );
@@ -391,7 +391,7 @@ struct PyMouse_wrapper : PyMouse, bp::wrapper< PyMouse > {
     }
 
     virtual void OnClickRightPressed( ::C_HL2WarsPlayer * player ) {
-        boost::python::override func_OnClickRightPressed = this->get_override( "OnClickRightPressed" );
+        PY_OVERRIDE_LOOKUP( func_OnClickRightPressed, "OnClickRightPressed" );
         if( func_OnClickRightPressed.ptr() != Py_None )
             try {
                 func_OnClickRightPressed( player ? player->GetPyHandle() : bp::object() );
@@ -408,7 +408,7 @@ struct PyMouse_wrapper : PyMouse, bp::wrapper< PyMouse > {
     }
 
     virtual void OnClickLeftReleased( ::C_HL2WarsPlayer * player ) {
-        boost::python::override func_OnClickLeftReleased = this->get_override( "OnClickLeftReleased" );
+        PY_OVERRIDE_LOOKUP( func_OnClickLeftReleased, "OnClickLeftReleased" );
         if( func_OnClickLeftReleased.ptr() != Py_None )
             try {
                 func_OnClickLeftReleased( player ? player->GetPyHandle() : bp::object() );
@@ -425,7 +425,7 @@ struct PyMouse_wrapper : PyMouse, bp::wrapper< PyMouse > {
     }
 
     virtual void OnClickRightReleased( ::C_HL2WarsPlayer * player ) {
-        boost::python::override func_OnClickRightReleased = this->get_override( "OnClickRightReleased" );
+        PY_OVERRIDE_LOOKUP( func_OnClickRightReleased, "OnClickRightReleased" );
         if( func_OnClickRightReleased.ptr() != Py_None )
             try {
                 func_OnClickRightReleased( player ? player->GetPyHandle() : bp::object() );
@@ -442,7 +442,7 @@ struct PyMouse_wrapper : PyMouse, bp::wrapper< PyMouse > {
     }
 
     virtual void OnClickLeftDoublePressed( ::C_HL2WarsPlayer * player ) {
-        boost::python::override func_OnClickLeftDoublePressed = this->get_override( "OnClickLeftDoublePressed" );
+        PY_OVERRIDE_LOOKUP( func_OnClickLeftDoublePressed, "OnClickLeftDoublePressed" );
         if( func_OnClickLeftDoublePressed.ptr() != Py_None )
             try {
                 func_OnClickLeftDoublePressed( player ? player->GetPyHandle() : bp::object() );
@@ -459,7 +459,7 @@ struct PyMouse_wrapper : PyMouse, bp::wrapper< PyMouse > {
     }
 
     virtual void OnClickRightDoublePressed( ::C_HL2WarsPlayer * player ) {
-        boost::python::override func_OnClickRightDoublePressed = this->get_override( "OnClickRightDoublePressed" );
+        PY_OVERRIDE_LOOKUP( func_OnClickRightDoublePressed, "OnClickRightDoublePressed" );
         if( func_OnClickRightDoublePressed.ptr() != Py_None )
             try {
                 func_OnClickRightDoublePressed( player ? player->GetPyHandle() : bp::object() );
@@ -476,7 +476,7 @@ struct PyMouse_wrapper : PyMouse, bp::wrapper< PyMouse > {
     }
 
     virtual void OnCursorEntered( ::C_HL2WarsPlayer * player ) {
-        boost::python::override func_OnCursorEntered = this->get_override( "OnCursorEntered" );
+        PY_OVERRIDE_LOOKUP( func_OnCursorEntered, "OnCursorEntered" );
         if( func_OnCursorEntered.ptr() != Py_None )
             try {
                 func_OnCursorEntered( player ? player->GetPyHandle() : bp::object() );
@@ -493,7 +493,7 @@ struct PyMouse_wrapper : PyMouse, bp::wrapper< PyMouse > {
     }
 
     virtual void OnCursorExited( ::C_HL2WarsPlayer * player ) {
-        boost::python::override func_OnCursorExited = this->get_override( "OnCursorExited" );
+        PY_OVERRIDE_LOOKUP( func_OnCursorExited, "OnCursorExited" );
         if( func_OnCursorExited.ptr() != Py_None )
             try {
                 func_OnCursorExited( player ? player->GetPyHandle() : bp::object() );
@@ -2409,7 +2409,7 @@ struct IEntityFindFilter_wrapper : IEntityFindFilter, bp::wrapper< IEntityFindFi
     }
 
     virtual ::CBaseEntity * GetFilterResult(  ){
-        bp::override func_GetFilterResult = this->get_override( "GetFilterResult" );
+        PY_OVERRIDE_LOOKUP( func_GetFilterResult, "GetFilterResult" );
         try {
             return func_GetFilterResult(  );
         } catch(bp::error_already_set &) {
@@ -2418,7 +2418,7 @@ struct IEntityFindFilter_wrapper : IEntityFindFilter, bp::wrapper< IEntityFindFi
     }
 
     virtual bool ShouldFindEntity( ::CBaseEntity * pEntity ){
-        bp::override func_ShouldFindEntity = this->get_override( "ShouldFindEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldFindEntity, "ShouldFindEntity" );
         try {
             return func_ShouldFindEntity( boost::python::ptr(pEntity) );
         } catch(bp::error_already_set &) {
@@ -2438,7 +2438,7 @@ struct CGlobalEntityList_wrapper : CGlobalEntityList, bp::wrapper< CGlobalEntity
     }
 
     virtual void OnAddEntity( ::IHandleEntity * pEnt, ::CBaseHandle handle ){
-        bp::override func_OnAddEntity = this->get_override( "OnAddEntity" );
+        PY_OVERRIDE_LOOKUP( func_OnAddEntity, "OnAddEntity" );
         if( func_OnAddEntity.ptr() != Py_None )
             try {
                 func_OnAddEntity( boost::python::ptr(pEnt), handle );
@@ -2455,7 +2455,7 @@ struct CGlobalEntityList_wrapper : CGlobalEntityList, bp::wrapper< CGlobalEntity
     }
 
     virtual void OnRemoveEntity( ::IHandleEntity * pEnt, ::CBaseHandle handle ){
-        bp::override func_OnRemoveEntity = this->get_override( "OnRemoveEntity" );
+        PY_OVERRIDE_LOOKUP( func_OnRemoveEntity, "OnRemoveEntity" );
         if( func_OnRemoveEntity.ptr() != Py_None )
             try {
                 func_OnRemoveEntity( boost::python::ptr(pEnt), handle );
@@ -2537,7 +2537,7 @@ struct IMouse_wrapper : IMouse, bp::wrapper< IMouse > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetIMouse(  ) of Class: IMouse\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetIMouse = this->get_override( "GetIMouse" );
+        PY_OVERRIDE_LOOKUP( func_GetIMouse, "GetIMouse" );
         if( func_GetIMouse.ptr() != Py_None )
             try {
                 return func_GetIMouse(  );
@@ -2554,7 +2554,7 @@ struct IMouse_wrapper : IMouse, bp::wrapper< IMouse > {
     }
 
     virtual void OnClickLeftDoublePressed( ::CHL2WarsPlayer * player ){
-        bp::override func_OnClickLeftDoublePressed = this->get_override( "OnClickLeftDoublePressed" );
+        PY_OVERRIDE_LOOKUP( func_OnClickLeftDoublePressed, "OnClickLeftDoublePressed" );
         try {
             func_OnClickLeftDoublePressed( boost::python::ptr(player) );
         } catch(bp::error_already_set &) {
@@ -2563,7 +2563,7 @@ struct IMouse_wrapper : IMouse, bp::wrapper< IMouse > {
     }
 
     virtual void OnClickLeftPressed( ::CHL2WarsPlayer * player ){
-        bp::override func_OnClickLeftPressed = this->get_override( "OnClickLeftPressed" );
+        PY_OVERRIDE_LOOKUP( func_OnClickLeftPressed, "OnClickLeftPressed" );
         try {
             func_OnClickLeftPressed( boost::python::ptr(player) );
         } catch(bp::error_already_set &) {
@@ -2572,7 +2572,7 @@ struct IMouse_wrapper : IMouse, bp::wrapper< IMouse > {
     }
 
     virtual void OnClickLeftReleased( ::CHL2WarsPlayer * player ){
-        bp::override func_OnClickLeftReleased = this->get_override( "OnClickLeftReleased" );
+        PY_OVERRIDE_LOOKUP( func_OnClickLeftReleased, "OnClickLeftReleased" );
         try {
             func_OnClickLeftReleased( boost::python::ptr(player) );
         } catch(bp::error_already_set &) {
@@ -2581,7 +2581,7 @@ struct IMouse_wrapper : IMouse, bp::wrapper< IMouse > {
     }
 
     virtual void OnClickRightDoublePressed( ::CHL2WarsPlayer * player ){
-        bp::override func_OnClickRightDoublePressed = this->get_override( "OnClickRightDoublePressed" );
+        PY_OVERRIDE_LOOKUP( func_OnClickRightDoublePressed, "OnClickRightDoublePressed" );
         try {
             func_OnClickRightDoublePressed( boost::python::ptr(player) );
         } catch(bp::error_already_set &) {
@@ -2590,7 +2590,7 @@ struct IMouse_wrapper : IMouse, bp::wrapper< IMouse > {
     }
 
     virtual void OnClickRightPressed( ::CHL2WarsPlayer * player ){
-        bp::override func_OnClickRightPressed = this->get_override( "OnClickRightPressed" );
+        PY_OVERRIDE_LOOKUP( func_OnClickRightPressed, "OnClickRightPressed" );
         try {
             func_OnClickRightPressed( boost::python::ptr(player) );
         } catch(bp::error_already_set &) {
@@ -2599,7 +2599,7 @@ struct IMouse_wrapper : IMouse, bp::wrapper< IMouse > {
     }
 
     virtual void OnClickRightReleased( ::CHL2WarsPlayer * player ){
-        bp::override func_OnClickRightReleased = this->get_override( "OnClickRightReleased" );
+        PY_OVERRIDE_LOOKUP( func_OnClickRightReleased, "OnClickRightReleased" );
         try {
             func_OnClickRightReleased( boost::python::ptr(player) );
         } catch(bp::error_already_set &) {
@@ -2608,7 +2608,7 @@ struct IMouse_wrapper : IMouse, bp::wrapper< IMouse > {
     }
 
     virtual void OnCursorEntered( ::CHL2WarsPlayer * player ){
-        bp::override func_OnCursorEntered = this->get_override( "OnCursorEntered" );
+        PY_OVERRIDE_LOOKUP( func_OnCursorEntered, "OnCursorEntered" );
         try {
             func_OnCursorEntered( boost::python::ptr(player) );
         } catch(bp::error_already_set &) {
@@ -2617,7 +2617,7 @@ struct IMouse_wrapper : IMouse, bp::wrapper< IMouse > {
     }
 
     virtual void OnCursorExited( ::CHL2WarsPlayer * player ){
-        bp::override func_OnCursorExited = this->get_override( "OnCursorExited" );
+        PY_OVERRIDE_LOOKUP( func_OnCursorExited, "OnCursorExited" );
         try {
             func_OnCursorExited( boost::python::ptr(player) );
         } catch(bp::error_already_set &) {
@@ -2690,7 +2690,7 @@ struct PyMouse_wrapper : PyMouse, bp::wrapper< PyMouse > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetIMouse(  ) of Class: IMouse\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetIMouse = this->get_override( "GetIMouse" );
+        PY_OVERRIDE_LOOKUP( func_GetIMouse, "GetIMouse" );
         if( func_GetIMouse.ptr() != Py_None )
             try {
                 return func_GetIMouse(  );
@@ -2707,7 +2707,7 @@ struct PyMouse_wrapper : PyMouse, bp::wrapper< PyMouse > {
     }
 
     virtual void OnClickLeftPressed( ::CHL2WarsPlayer * player ) {
-        boost::python::override func_OnClickLeftPressed = this->get_override( "OnClickLeftPressed" );
+        PY_OVERRIDE_LOOKUP( func_OnClickLeftPressed, "OnClickLeftPressed" );
         if( func_OnClickLeftPressed.ptr() != Py_None )
             try {
                 func_OnClickLeftPressed( player ? player->GetPyHandle() : bp::object() );
@@ -2724,7 +2724,7 @@ struct PyMouse_wrapper : PyMouse, bp::wrapper< PyMouse > {
     }
 
     virtual void OnClickRightPressed( ::CHL2WarsPlayer * player ) {
-        boost::python::override func_OnClickRightPressed = this->get_override( "OnClickRightPressed" );
+        PY_OVERRIDE_LOOKUP( func_OnClickRightPressed, "OnClickRightPressed" );
         if( func_OnClickRightPressed.ptr() != Py_None )
             try {
                 func_OnClickRightPressed( player ? player->GetPyHandle() : bp::object() );
@@ -2741,7 +2741,7 @@ struct PyMouse_wrapper : PyMouse, bp::wrapper< PyMouse > {
     }
 
     virtual void OnClickLeftReleased( ::CHL2WarsPlayer * player ) {
-        boost::python::override func_OnClickLeftReleased = this->get_override( "OnClickLeftReleased" );
+        PY_OVERRIDE_LOOKUP( func_OnClickLeftReleased, "OnClickLeftReleased" );
         if( func_OnClickLeftReleased.ptr() != Py_None )
             try {
                 func_OnClickLeftReleased( player ? player->GetPyHandle() : bp::object() );
@@ -2758,7 +2758,7 @@ struct PyMouse_wrapper : PyMouse, bp::wrapper< PyMouse > {
     }
 
     virtual void OnClickRightReleased( ::CHL2WarsPlayer * player ) {
-        boost::python::override func_OnClickRightReleased = this->get_override( "OnClickRightReleased" );
+        PY_OVERRIDE_LOOKUP( func_OnClickRightReleased, "OnClickRightReleased" );
         if( func_OnClickRightReleased.ptr() != Py_None )
             try {
                 func_OnClickRightReleased( player ? player->GetPyHandle() : bp::object() );
@@ -2775,7 +2775,7 @@ struct PyMouse_wrapper : PyMouse, bp::wrapper< PyMouse > {
     }
 
     virtual void OnClickLeftDoublePressed( ::CHL2WarsPlayer * player ) {
-        boost::python::override func_OnClickLeftDoublePressed = this->get_override( "OnClickLeftDoublePressed" );
+        PY_OVERRIDE_LOOKUP( func_OnClickLeftDoublePressed, "OnClickLeftDoublePressed" );
         if( func_OnClickLeftDoublePressed.ptr() != Py_None )
             try {
                 func_OnClickLeftDoublePressed( player ? player->GetPyHandle() : bp::object() );
@@ -2792,7 +2792,7 @@ struct PyMouse_wrapper : PyMouse, bp::wrapper< PyMouse > {
     }
 
     virtual void OnClickRightDoublePressed( ::CHL2WarsPlayer * player ) {
-        boost::python::override func_OnClickRightDoublePressed = this->get_override( "OnClickRightDoublePressed" );
+        PY_OVERRIDE_LOOKUP( func_OnClickRightDoublePressed, "OnClickRightDoublePressed" );
         if( func_OnClickRightDoublePressed.ptr() != Py_None )
             try {
                 func_OnClickRightDoublePressed( player ? player->GetPyHandle() : bp::object() );
@@ -2809,7 +2809,7 @@ struct PyMouse_wrapper : PyMouse, bp::wrapper< PyMouse > {
     }
 
     virtual void OnCursorEntered( ::CHL2WarsPlayer * player ) {
-        boost::python::override func_OnCursorEntered = this->get_override( "OnCursorEntered" );
+        PY_OVERRIDE_LOOKUP( func_OnCursorEntered, "OnCursorEntered" );
         if( func_OnCursorEntered.ptr() != Py_None )
             try {
                 func_OnCursorEntered( player ? player->GetPyHandle() : bp::object() );
@@ -2826,7 +2826,7 @@ struct PyMouse_wrapper : PyMouse, bp::wrapper< PyMouse > {
     }
 
     virtual void OnCursorExited( ::CHL2WarsPlayer * player ) {
-        boost::python::override func_OnCursorExited = this->get_override( "OnCursorExited" );
+        PY_OVERRIDE_LOOKUP( func_OnCursorExited, "OnCursorExited" );
         if( func_OnCursorExited.ptr() != Py_None )
             try {
                 func_OnCursorExited( player ? player->GetPyHandle() : bp::object() );
@@ -4445,7 +4445,7 @@ BOOST_PYTHON_MODULE(_entities_misc){
             , (void ( ::CMultiDamage::* )( ::CBaseEntity * ) )( &::CMultiDamage::SetTarget )
             , ( bp::arg("pTarget") ) );
 
-    bp::class_< CPythonNetworkArray >( "NetworkArrayInternal", bp::init< bp::object, char const *, bp::optional< bp::list, bool, bool > >(( bp::arg("self"), bp::arg("name"), bp::arg("data")=boost::python::list(), bp::arg("initstatechanged")=(bool)(false), bp::arg("changedcallback")=(bool)(false) )) )    
+    bp::class_< CPythonNetworkArray, boost::noncopyable >( "NetworkArrayInternal", bp::init< bp::object, char const *, bp::optional< bp::list, bool, bool > >(( bp::arg("self"), bp::arg("name"), bp::arg("data")=boost::python::list(), bp::arg("initstatechanged")=(bool)(false), bp::arg("changedcallback")=(bool)(false) )) )    
         .def( 
             "__getitem__"
             , (::boost::python::object ( ::CPythonNetworkArray::* )( int ) )( &::CPythonNetworkArray::GetItem )
@@ -4459,7 +4459,7 @@ BOOST_PYTHON_MODULE(_entities_misc){
             , (void ( ::CPythonNetworkArray::* )( int,::boost::python::object ) )( &::CPythonNetworkArray::SetItem )
             , ( bp::arg("idx"), bp::arg("data") ) );
 
-    bp::class_< CPythonNetworkDict >( "NetworkDictInternal", bp::init< bp::object, char const *, bp::optional< bp::dict, bool, bool > >(( bp::arg("self"), bp::arg("name"), bp::arg("data")=boost::python::dict(), bp::arg("initstatechanged")=(bool)(false), bp::arg("changedcallback")=(bool)(false) )) )    
+    bp::class_< CPythonNetworkDict, boost::noncopyable >( "NetworkDictInternal", bp::init< bp::object, char const *, bp::optional< bp::dict, bool, bool > >(( bp::arg("self"), bp::arg("name"), bp::arg("data")=boost::python::dict(), bp::arg("initstatechanged")=(bool)(false), bp::arg("changedcallback")=(bool)(false) )) )    
         .def( 
             "__getitem__"
             , (::boost::python::object ( ::CPythonNetworkDict::* )( ::boost::python::object ) )( &::CPythonNetworkDict::GetItem )
@@ -4473,7 +4473,7 @@ BOOST_PYTHON_MODULE(_entities_misc){
             , (void ( ::CPythonNetworkDict::* )( ::boost::python::object,::boost::python::object ) )( &::CPythonNetworkDict::SetItem )
             , ( bp::arg("key"), bp::arg("data") ) );
 
-    bp::class_< CPythonNetworkVar >( "NetworkVarInternal", bp::init< bp::object, char const *, bp::optional< bp::object, bool, bool > >(( bp::arg("self"), bp::arg("name"), bp::arg("data")=boost::python::object(), bp::arg("initstatechanged")=(bool)(false), bp::arg("changedcallback")=(bool)(false) )) )    
+    bp::class_< CPythonNetworkVar, boost::noncopyable >( "NetworkVarInternal", bp::init< bp::object, char const *, bp::optional< bp::object, bool, bool > >(( bp::arg("self"), bp::arg("name"), bp::arg("data")=boost::python::object(), bp::arg("initstatechanged")=(bool)(false), bp::arg("changedcallback")=(bool)(false) )) )    
         .def( 
             "Get"
             , (::boost::python::object ( ::CPythonNetworkVar::* )(  ) )( &::CPythonNetworkVar::Get ) )    
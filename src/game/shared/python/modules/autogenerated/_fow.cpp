@@ -90,6 +90,14 @@ BOOST_PYTHON_MODULE(_fow){
             "ComputeFOWPosition"
             , (void ( ::CFogOfWarMgr::* )( ::Vector const &,int &,int & ) )( &::CFogOfWarMgr::ComputeFOWPosition )
             , ( bp::arg("vPos"), bp::arg("x"), bp::arg("y") ) )    
+        .def( 
+            "ComputeVisibilityChanges"
+            , (::boost::python::list ( ::CFogOfWarMgr::* )( ::boost::python::object ) )( &::CFogOfWarMgr::PyComputeVisibilityChanges )
+            , ( bp::arg("entities") ) )    
+        .def( 
+            "ComputeVisibleMasks"
+            , (::boost::python::list ( ::CFogOfWarMgr::* )( ::boost::python::object ) )( &::CFogOfWarMgr::PyComputeVisibleMasks )
+            , ( bp::arg("points") ) )    
         .def( 
             "ComputeWorldPosition"
             , (::Vector ( ::CFogOfWarMgr::* )( int,int ) )( &::CFogOfWarMgr::ComputeWorldPosition )
@@ -105,6 +113,14 @@ BOOST_PYTHON_MODULE(_fow){
             "GetHeightAtTile"
             , (float ( ::CFogOfWarMgr::* )( int,int ) )( &::CFogOfWarMgr::GetHeightAtTile )
             , ( bp::arg("x"), bp::arg("y") ) )    
+        .def( 
+            "IsAnyTileVisibleInBox"
+            , (bool ( ::CFogOfWarMgr::* )( ::Vector const &,::Vector const &,int ) )( &::CFogOfWarMgr::IsAnyTileVisibleInBox )
+            , ( bp::arg("vMins"), bp::arg("vMaxs"), bp::arg("iOwner") ) )    
+        .def( 
+            "IsBoxFullyVisible"
+            , (bool ( ::CFogOfWarMgr::* )( ::Vector const &,::Vector const &,int ) )( &::CFogOfWarMgr::IsBoxFullyVisible )
+            , ( bp::arg("vMins"), bp::arg("vMaxs"), bp::arg("iOwner") ) )    
         .def( 
             "ModifyHeightAtExtent"
             , (void ( ::CFogOfWarMgr::* )( ::Vector const &,::Vector const &,float ) )( &::CFogOfWarMgr::ModifyHeightAtExtent )
@@ -99,7 +99,7 @@ struct CBaseGameSystem_wrapper : CBaseGameSystem, bp::wrapper< CBaseGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling Init(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Init = this->get_override( "Init" );
+        PY_OVERRIDE_LOOKUP( func_Init, "Init" );
         if( func_Init.ptr() != Py_None )
             try {
                 return func_Init(  );
@@ -129,7 +129,7 @@ struct CBaseGameSystem_wrapper : CBaseGameSystem, bp::wrapper< CBaseGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelInitPostEntity(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelInitPostEntity = this->get_override( "LevelInitPostEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelInitPostEntity, "LevelInitPostEntity" );
         if( func_LevelInitPostEntity.ptr() != Py_None )
             try {
                 func_LevelInitPostEntity(  );
@@ -159,7 +159,7 @@ struct CBaseGameSystem_wrapper : CBaseGameSystem, bp::wrapper< CBaseGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelInitPreEntity(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelInitPreEntity = this->get_override( "LevelInitPreEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelInitPreEntity, "LevelInitPreEntity" );
         if( func_LevelInitPreEntity.ptr() != Py_None )
             try {
                 func_LevelInitPreEntity(  );
@@ -189,7 +189,7 @@ struct CBaseGameSystem_wrapper : CBaseGameSystem, bp::wrapper< CBaseGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelShutdownPostEntity(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelShutdownPostEntity = this->get_override( "LevelShutdownPostEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelShutdownPostEntity, "LevelShutdownPostEntity" );
         if( func_LevelShutdownPostEntity.ptr() != Py_None )
             try {
                 func_LevelShutdownPostEntity(  );
@@ -219,7 +219,7 @@ struct CBaseGameSystem_wrapper : CBaseGameSystem, bp::wrapper< CBaseGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelShutdownPreEntity(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelShutdownPreEntity = this->get_override( "LevelShutdownPreEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelShutdownPreEntity, "LevelShutdownPreEntity" );
         if( func_LevelShutdownPreEntity.ptr() != Py_None )
             try {
                 func_LevelShutdownPreEntity(  );
@@ -249,7 +249,7 @@ struct CBaseGameSystem_wrapper : CBaseGameSystem, bp::wrapper< CBaseGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling Name(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Name = this->get_override( "Name" );
+        PY_OVERRIDE_LOOKUP( func_Name, "Name" );
         if( func_Name.ptr() != Py_None )
             try {
                 return func_Name(  );
@@ -279,7 +279,7 @@ struct CBaseGameSystem_wrapper : CBaseGameSystem, bp::wrapper< CBaseGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling OnRestore(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnRestore = this->get_override( "OnRestore" );
+        PY_OVERRIDE_LOOKUP( func_OnRestore, "OnRestore" );
         if( func_OnRestore.ptr() != Py_None )
             try {
                 func_OnRestore(  );
@@ -309,7 +309,7 @@ struct CBaseGameSystem_wrapper : CBaseGameSystem, bp::wrapper< CBaseGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling OnSave(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnSave = this->get_override( "OnSave" );
+        PY_OVERRIDE_LOOKUP( func_OnSave, "OnSave" );
         if( func_OnSave.ptr() != Py_None )
             try {
                 func_OnSave(  );
@@ -339,7 +339,7 @@ struct CBaseGameSystem_wrapper : CBaseGameSystem, bp::wrapper< CBaseGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling PostInit(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PostInit = this->get_override( "PostInit" );
+        PY_OVERRIDE_LOOKUP( func_PostInit, "PostInit" );
         if( func_PostInit.ptr() != Py_None )
             try {
                 func_PostInit(  );
@@ -369,7 +369,7 @@ struct CBaseGameSystem_wrapper : CBaseGameSystem, bp::wrapper< CBaseGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling Shutdown(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Shutdown = this->get_override( "Shutdown" );
+        PY_OVERRIDE_LOOKUP( func_Shutdown, "Shutdown" );
         if( func_Shutdown.ptr() != Py_None )
             try {
                 func_Shutdown(  );
@@ -417,7 +417,7 @@ struct CAutoGameSystem_wrapper : CAutoGameSystem, bp::wrapper< CAutoGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling Name(  ) of Class: CAutoGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Name = this->get_override( "Name" );
+        PY_OVERRIDE_LOOKUP( func_Name, "Name" );
         if( func_Name.ptr() != Py_None )
             try {
                 return func_Name(  );
@@ -455,7 +455,7 @@ struct CAutoGameSystem_wrapper : CAutoGameSystem, bp::wrapper< CAutoGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling Init(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Init = this->get_override( "Init" );
+        PY_OVERRIDE_LOOKUP( func_Init, "Init" );
         if( func_Init.ptr() != Py_None )
             try {
                 return func_Init(  );
@@ -485,7 +485,7 @@ struct CAutoGameSystem_wrapper : CAutoGameSystem, bp::wrapper< CAutoGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelInitPostEntity(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelInitPostEntity = this->get_override( "LevelInitPostEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelInitPostEntity, "LevelInitPostEntity" );
         if( func_LevelInitPostEntity.ptr() != Py_None )
             try {
                 func_LevelInitPostEntity(  );
@@ -515,7 +515,7 @@ struct CAutoGameSystem_wrapper : CAutoGameSystem, bp::wrapper< CAutoGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelInitPreEntity(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelInitPreEntity = this->get_override( "LevelInitPreEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelInitPreEntity, "LevelInitPreEntity" );
         if( func_LevelInitPreEntity.ptr() != Py_None )
             try {
                 func_LevelInitPreEntity(  );
@@ -545,7 +545,7 @@ struct CAutoGameSystem_wrapper : CAutoGameSystem, bp::wrapper< CAutoGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelShutdownPostEntity(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelShutdownPostEntity = this->get_override( "LevelShutdownPostEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelShutdownPostEntity, "LevelShutdownPostEntity" );
         if( func_LevelShutdownPostEntity.ptr() != Py_None )
             try {
                 func_LevelShutdownPostEntity(  );
@@ -575,7 +575,7 @@ struct CAutoGameSystem_wrapper : CAutoGameSystem, bp::wrapper< CAutoGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelShutdownPreEntity(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelShutdownPreEntity = this->get_override( "LevelShutdownPreEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelShutdownPreEntity, "LevelShutdownPreEntity" );
         if( func_LevelShutdownPreEntity.ptr() != Py_None )
             try {
                 func_LevelShutdownPreEntity(  );
@@ -605,7 +605,7 @@ struct CAutoGameSystem_wrapper : CAutoGameSystem, bp::wrapper< CAutoGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling OnRestore(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnRestore = this->get_override( "OnRestore" );
+        PY_OVERRIDE_LOOKUP( func_OnRestore, "OnRestore" );
         if( func_OnRestore.ptr() != Py_None )
             try {
                 func_OnRestore(  );
@@ -635,7 +635,7 @@ struct CAutoGameSystem_wrapper : CAutoGameSystem, bp::wrapper< CAutoGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling OnSave(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnSave = this->get_override( "OnSave" );
+        PY_OVERRIDE_LOOKUP( func_OnSave, "OnSave" );
         if( func_OnSave.ptr() != Py_None )
             try {
                 func_OnSave(  );
@@ -665,7 +665,7 @@ struct CAutoGameSystem_wrapper : CAutoGameSystem, bp::wrapper< CAutoGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling PostInit(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PostInit = this->get_override( "PostInit" );
+        PY_OVERRIDE_LOOKUP( func_PostInit, "PostInit" );
         if( func_PostInit.ptr() != Py_None )
             try {
                 func_PostInit(  );
@@ -695,7 +695,7 @@ struct CAutoGameSystem_wrapper : CAutoGameSystem, bp::wrapper< CAutoGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling Shutdown(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Shutdown = this->get_override( "Shutdown" );
+        PY_OVERRIDE_LOOKUP( func_Shutdown, "Shutdown" );
         if( func_Shutdown.ptr() != Py_None )
             try {
                 func_Shutdown(  );
@@ -743,7 +743,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling Init(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Init = this->get_override( "Init" );
+        PY_OVERRIDE_LOOKUP( func_Init, "Init" );
         if( func_Init.ptr() != Py_None )
             try {
                 return func_Init(  );
@@ -773,7 +773,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelInitPostEntity(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelInitPostEntity = this->get_override( "LevelInitPostEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelInitPostEntity, "LevelInitPostEntity" );
         if( func_LevelInitPostEntity.ptr() != Py_None )
             try {
                 func_LevelInitPostEntity(  );
@@ -803,7 +803,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelInitPreEntity(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelInitPreEntity = this->get_override( "LevelInitPreEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelInitPreEntity, "LevelInitPreEntity" );
         if( func_LevelInitPreEntity.ptr() != Py_None )
             try {
                 func_LevelInitPreEntity(  );
@@ -833,7 +833,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelShutdownPostEntity(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelShutdownPostEntity = this->get_override( "LevelShutdownPostEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelShutdownPostEntity, "LevelShutdownPostEntity" );
         if( func_LevelShutdownPostEntity.ptr() != Py_None )
             try {
                 func_LevelShutdownPostEntity(  );
@@ -863,7 +863,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelShutdownPreEntity(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelShutdownPreEntity = this->get_override( "LevelShutdownPreEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelShutdownPreEntity, "LevelShutdownPreEntity" );
         if( func_LevelShutdownPreEntity.ptr() != Py_None )
             try {
                 func_LevelShutdownPreEntity(  );
@@ -893,7 +893,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling Name(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Name = this->get_override( "Name" );
+        PY_OVERRIDE_LOOKUP( func_Name, "Name" );
         if( func_Name.ptr() != Py_None )
             try {
                 return func_Name(  );
@@ -923,7 +923,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling OnRestore(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnRestore = this->get_override( "OnRestore" );
+        PY_OVERRIDE_LOOKUP( func_OnRestore, "OnRestore" );
         if( func_OnRestore.ptr() != Py_None )
             try {
                 func_OnRestore(  );
@@ -953,7 +953,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling OnSave(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnSave = this->get_override( "OnSave" );
+        PY_OVERRIDE_LOOKUP( func_OnSave, "OnSave" );
         if( func_OnSave.ptr() != Py_None )
             try {
                 func_OnSave(  );
@@ -983,7 +983,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling PostInit(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PostInit = this->get_override( "PostInit" );
+        PY_OVERRIDE_LOOKUP( func_PostInit, "PostInit" );
         if( func_PostInit.ptr() != Py_None )
             try {
                 func_PostInit(  );
@@ -1013,7 +1013,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling PostRender(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PostRender = this->get_override( "PostRender" );
+        PY_OVERRIDE_LOOKUP( func_PostRender, "PostRender" );
         if( func_PostRender.ptr() != Py_None )
             try {
                 func_PostRender(  );
@@ -1043,7 +1043,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling PreRender(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PreRender = this->get_override( "PreRender" );
+        PY_OVERRIDE_LOOKUP( func_PreRender, "PreRender" );
         if( func_PreRender.ptr() != Py_None )
             try {
                 func_PreRender(  );
@@ -1073,7 +1073,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling Shutdown(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Shutdown = this->get_override( "Shutdown" );
+        PY_OVERRIDE_LOOKUP( func_Shutdown, "Shutdown" );
         if( func_Shutdown.ptr() != Py_None )
             try {
                 func_Shutdown(  );
@@ -1103,7 +1103,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling Update( frametime ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Update = this->get_override( "Update" );
+        PY_OVERRIDE_LOOKUP( func_Update, "Update" );
         if( func_Update.ptr() != Py_None )
             try {
                 func_Update( frametime );
@@ -1151,7 +1151,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling Name(  ) of Class: CAutoGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Name = this->get_override( "Name" );
+        PY_OVERRIDE_LOOKUP( func_Name, "Name" );
         if( func_Name.ptr() != Py_None )
             try {
                 return func_Name(  );
@@ -1189,7 +1189,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling Init(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Init = this->get_override( "Init" );
+        PY_OVERRIDE_LOOKUP( func_Init, "Init" );
         if( func_Init.ptr() != Py_None )
             try {
                 return func_Init(  );
@@ -1219,7 +1219,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelInitPostEntity(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelInitPostEntity = this->get_override( "LevelInitPostEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelInitPostEntity, "LevelInitPostEntity" );
         if( func_LevelInitPostEntity.ptr() != Py_None )
             try {
                 func_LevelInitPostEntity(  );
@@ -1249,7 +1249,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelInitPreEntity(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelInitPreEntity = this->get_override( "LevelInitPreEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelInitPreEntity, "LevelInitPreEntity" );
         if( func_LevelInitPreEntity.ptr() != Py_None )
             try {
                 func_LevelInitPreEntity(  );
@@ -1279,7 +1279,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelShutdownPostEntity(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelShutdownPostEntity = this->get_override( "LevelShutdownPostEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelShutdownPostEntity, "LevelShutdownPostEntity" );
         if( func_LevelShutdownPostEntity.ptr() != Py_None )
             try {
                 func_LevelShutdownPostEntity(  );
@@ -1309,7 +1309,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelShutdownPreEntity(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelShutdownPreEntity = this->get_override( "LevelShutdownPreEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelShutdownPreEntity, "LevelShutdownPreEntity" );
         if( func_LevelShutdownPreEntity.ptr() != Py_None )
             try {
                 func_LevelShutdownPreEntity(  );
@@ -1339,7 +1339,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling OnRestore(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnRestore = this->get_override( "OnRestore" );
+        PY_OVERRIDE_LOOKUP( func_OnRestore, "OnRestore" );
         if( func_OnRestore.ptr() != Py_None )
             try {
                 func_OnRestore(  );
@@ -1369,7 +1369,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling OnSave(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnSave = this->get_override( "OnSave" );
+        PY_OVERRIDE_LOOKUP( func_OnSave, "OnSave" );
         if( func_OnSave.ptr() != Py_None )
             try {
                 func_OnSave(  );
@@ -1399,7 +1399,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling PostInit(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PostInit = this->get_override( "PostInit" );
+        PY_OVERRIDE_LOOKUP( func_PostInit, "PostInit" );
         if( func_PostInit.ptr() != Py_None )
             try {
                 func_PostInit(  );
@@ -1429,7 +1429,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling PostRender(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PostRender = this->get_override( "PostRender" );
+        PY_OVERRIDE_LOOKUP( func_PostRender, "PostRender" );
         if( func_PostRender.ptr() != Py_None )
             try {
                 func_PostRender(  );
@@ -1459,7 +1459,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling PreRender(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PreRender = this->get_override( "PreRender" );
+        PY_OVERRIDE_LOOKUP( func_PreRender, "PreRender" );
         if( func_PreRender.ptr() != Py_None )
             try {
                 func_PreRender(  );
@@ -1489,7 +1489,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling Shutdown(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Shutdown = this->get_override( "Shutdown" );
+        PY_OVERRIDE_LOOKUP( func_Shutdown, "Shutdown" );
         if( func_Shutdown.ptr() != Py_None )
             try {
                 func_Shutdown(  );
@@ -1519,7 +1519,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling Update( frametime ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Update = this->get_override( "Update" );
+        PY_OVERRIDE_LOOKUP( func_Update, "Update" );
         if( func_Update.ptr() != Py_None )
             try {
                 func_Update( frametime );
@@ -1547,7 +1547,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual void AppendParm( char const * pszParm, char const * pszValues ){
-        bp::override func_AppendParm = this->get_override( "AppendParm" );
+        PY_OVERRIDE_LOOKUP( func_AppendParm, "AppendParm" );
         try {
             func_AppendParm( pszParm, pszValues );
         } catch(bp::error_already_set &) {
@@ -1556,7 +1556,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual char const * CheckParm( char const * psz, char const * * ppszValue=0 ) const {
-        bp::override func_CheckParm = this->get_override( "CheckParm" );
+        PY_OVERRIDE_LOOKUP( func_CheckParm, "CheckParm" );
         try {
             return func_CheckParm( psz, ppszValue );
         } catch(bp::error_already_set &) {
@@ -1565,7 +1565,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual void CreateCmdLine( char const * commandline ){
-        bp::override func_CreateCmdLine = this->get_override( "CreateCmdLine" );
+        PY_OVERRIDE_LOOKUP( func_CreateCmdLine, "CreateCmdLine" );
         try {
             func_CreateCmdLine( commandline );
         } catch(bp::error_already_set &) {
@@ -1574,7 +1574,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual void CreateCmdLine( int argc, char * * argv ){
-        bp::override func_CreateCmdLine = this->get_override( "CreateCmdLine" );
+        PY_OVERRIDE_LOOKUP( func_CreateCmdLine, "CreateCmdLine" );
         try {
             func_CreateCmdLine( argc, argv );
         } catch(bp::error_already_set &) {
@@ -1583,7 +1583,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual int FindParm( char const * psz ) const {
-        bp::override func_FindParm = this->get_override( "FindParm" );
+        PY_OVERRIDE_LOOKUP( func_FindParm, "FindParm" );
         try {
             return func_FindParm( psz );
         } catch(bp::error_already_set &) {
@@ -1592,7 +1592,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual char const * GetCmdLine(  ) const {
-        bp::override func_GetCmdLine = this->get_override( "GetCmdLine" );
+        PY_OVERRIDE_LOOKUP( func_GetCmdLine, "GetCmdLine" );
         try {
             return func_GetCmdLine(  );
         } catch(bp::error_already_set &) {
@@ -1601,7 +1601,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual char const * GetParm( int nIndex ) const {
-        bp::override func_GetParm = this->get_override( "GetParm" );
+        PY_OVERRIDE_LOOKUP( func_GetParm, "GetParm" );
         try {
             return func_GetParm( nIndex );
         } catch(bp::error_already_set &) {
@@ -1610,7 +1610,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual int ParmCount(  ) const {
-        bp::override func_ParmCount = this->get_override( "ParmCount" );
+        PY_OVERRIDE_LOOKUP( func_ParmCount, "ParmCount" );
         try {
             return func_ParmCount(  );
         } catch(bp::error_already_set &) {
@@ -1619,7 +1619,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual char const * ParmValue( char const * psz, char const * pDefaultVal=0 ) const {
-        bp::override func_ParmValue = this->get_override( "ParmValue" );
+        PY_OVERRIDE_LOOKUP( func_ParmValue, "ParmValue" );
         try {
             return func_ParmValue( psz, pDefaultVal );
         } catch(bp::error_already_set &) {
@@ -1628,7 +1628,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual int ParmValue( char const * psz, int nDefaultVal ) const {
-        bp::override func_ParmValue = this->get_override( "ParmValue" );
+        PY_OVERRIDE_LOOKUP( func_ParmValue, "ParmValue" );
         try {
             return func_ParmValue( psz, nDefaultVal );
         } catch(bp::error_already_set &) {
@@ -1637,7 +1637,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual float ParmValue( char const * psz, float flDefaultVal ) const {
-        bp::override func_ParmValue = this->get_override( "ParmValue" );
+        PY_OVERRIDE_LOOKUP( func_ParmValue, "ParmValue" );
         try {
             return func_ParmValue( psz, flDefaultVal );
         } catch(bp::error_already_set &) {
@@ -1646,7 +1646,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual void RemoveParm( char const * parm ){
-        bp::override func_RemoveParm = this->get_override( "RemoveParm" );
+        PY_OVERRIDE_LOOKUP( func_RemoveParm, "RemoveParm" );
         try {
             func_RemoveParm( parm );
         } catch(bp::error_already_set &) {
@@ -1655,7 +1655,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual void SetParm( int nIndex, char const * pNewParm ){
-        bp::override func_SetParm = this->get_override( "SetParm" );
+        PY_OVERRIDE_LOOKUP( func_SetParm, "SetParm" );
         try {
             func_SetParm( nIndex, pNewParm );
         } catch(bp::error_already_set &) {
@@ -1695,7 +1695,7 @@ struct PyGameEventListener_wrapper : PyGameEventListener, bp::wrapper< PyGameEve
         if( py_log_overrides.GetBool() )
             Msg("Calling PyFireGameEvent( event ) of Class: PyGameEventListener\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_FireGameEvent = this->get_override( "FireGameEvent" );
+        PY_OVERRIDE_LOOKUP( func_FireGameEvent, "FireGameEvent" );
         if( func_FireGameEvent.ptr() != Py_None )
             try {
                 func_FireGameEvent( event );
@@ -3442,7 +3442,7 @@ struct CBaseGameSystem_wrapper : CBaseGameSystem, bp::wrapper< CBaseGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling Init(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Init = this->get_override( "Init" );
+        PY_OVERRIDE_LOOKUP( func_Init, "Init" );
         if( func_Init.ptr() != Py_None )
             try {
                 return func_Init(  );
@@ -3472,7 +3472,7 @@ struct CBaseGameSystem_wrapper : CBaseGameSystem, bp::wrapper< CBaseGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelInitPostEntity(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelInitPostEntity = this->get_override( "LevelInitPostEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelInitPostEntity, "LevelInitPostEntity" );
         if( func_LevelInitPostEntity.ptr() != Py_None )
             try {
                 func_LevelInitPostEntity(  );
@@ -3502,7 +3502,7 @@ struct CBaseGameSystem_wrapper : CBaseGameSystem, bp::wrapper< CBaseGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelInitPreEntity(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelInitPreEntity = this->get_override( "LevelInitPreEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelInitPreEntity, "LevelInitPreEntity" );
         if( func_LevelInitPreEntity.ptr() != Py_None )
             try {
                 func_LevelInitPreEntity(  );
@@ -3532,7 +3532,7 @@ struct CBaseGameSystem_wrapper : CBaseGameSystem, bp::wrapper< CBaseGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelShutdownPostEntity(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelShutdownPostEntity = this->get_override( "LevelShutdownPostEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelShutdownPostEntity, "LevelShutdownPostEntity" );
         if( func_LevelShutdownPostEntity.ptr() != Py_None )
             try {
                 func_LevelShutdownPostEntity(  );
@@ -3562,7 +3562,7 @@ struct CBaseGameSystem_wrapper : CBaseGameSystem, bp::wrapper< CBaseGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelShutdownPreEntity(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelShutdownPreEntity = this->get_override( "LevelShutdownPreEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelShutdownPreEntity, "LevelShutdownPreEntity" );
         if( func_LevelShutdownPreEntity.ptr() != Py_None )
             try {
                 func_LevelShutdownPreEntity(  );
@@ -3592,7 +3592,7 @@ struct CBaseGameSystem_wrapper : CBaseGameSystem, bp::wrapper< CBaseGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling Name(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Name = this->get_override( "Name" );
+        PY_OVERRIDE_LOOKUP( func_Name, "Name" );
         if( func_Name.ptr() != Py_None )
             try {
                 return func_Name(  );
@@ -3622,7 +3622,7 @@ struct CBaseGameSystem_wrapper : CBaseGameSystem, bp::wrapper< CBaseGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling OnRestore(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnRestore = this->get_override( "OnRestore" );
+        PY_OVERRIDE_LOOKUP( func_OnRestore, "OnRestore" );
         if( func_OnRestore.ptr() != Py_None )
             try {
                 func_OnRestore(  );
@@ -3652,7 +3652,7 @@ struct CBaseGameSystem_wrapper : CBaseGameSystem, bp::wrapper< CBaseGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling OnSave(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnSave = this->get_override( "OnSave" );
+        PY_OVERRIDE_LOOKUP( func_OnSave, "OnSave" );
         if( func_OnSave.ptr() != Py_None )
             try {
                 func_OnSave(  );
@@ -3682,7 +3682,7 @@ struct CBaseGameSystem_wrapper : CBaseGameSystem, bp::wrapper< CBaseGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling PostInit(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PostInit = this->get_override( "PostInit" );
+        PY_OVERRIDE_LOOKUP( func_PostInit, "PostInit" );
         if( func_PostInit.ptr() != Py_None )
             try {
                 func_PostInit(  );
@@ -3712,7 +3712,7 @@ struct CBaseGameSystem_wrapper : CBaseGameSystem, bp::wrapper< CBaseGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling Shutdown(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Shutdown = this->get_override( "Shutdown" );
+        PY_OVERRIDE_LOOKUP( func_Shutdown, "Shutdown" );
         if( func_Shutdown.ptr() != Py_None )
             try {
                 func_Shutdown(  );
@@ -3760,7 +3760,7 @@ struct CAutoGameSystem_wrapper : CAutoGameSystem, bp::wrapper< CAutoGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling Name(  ) of Class: CAutoGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Name = this->get_override( "Name" );
+        PY_OVERRIDE_LOOKUP( func_Name, "Name" );
         if( func_Name.ptr() != Py_None )
             try {
                 return func_Name(  );
@@ -3798,7 +3798,7 @@ struct CAutoGameSystem_wrapper : CAutoGameSystem, bp::wrapper< CAutoGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling Init(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Init = this->get_override( "Init" );
+        PY_OVERRIDE_LOOKUP( func_Init, "Init" );
         if( func_Init.ptr() != Py_None )
             try {
                 return func_Init(  );
@@ -3828,7 +3828,7 @@ struct CAutoGameSystem_wrapper : CAutoGameSystem, bp::wrapper< CAutoGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelInitPostEntity(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelInitPostEntity = this->get_override( "LevelInitPostEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelInitPostEntity, "LevelInitPostEntity" );
         if( func_LevelInitPostEntity.ptr() != Py_None )
             try {
                 func_LevelInitPostEntity(  );
@@ -3858,7 +3858,7 @@ struct CAutoGameSystem_wrapper : CAutoGameSystem, bp::wrapper< CAutoGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelInitPreEntity(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelInitPreEntity = this->get_override( "LevelInitPreEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelInitPreEntity, "LevelInitPreEntity" );
         if( func_LevelInitPreEntity.ptr() != Py_None )
             try {
                 func_LevelInitPreEntity(  );
@@ -3888,7 +3888,7 @@ struct CAutoGameSystem_wrapper : CAutoGameSystem, bp::wrapper< CAutoGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelShutdownPostEntity(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelShutdownPostEntity = this->get_override( "LevelShutdownPostEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelShutdownPostEntity, "LevelShutdownPostEntity" );
         if( func_LevelShutdownPostEntity.ptr() != Py_None )
             try {
                 func_LevelShutdownPostEntity(  );
@@ -3918,7 +3918,7 @@ struct CAutoGameSystem_wrapper : CAutoGameSystem, bp::wrapper< CAutoGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelShutdownPreEntity(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelShutdownPreEntity = this->get_override( "LevelShutdownPreEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelShutdownPreEntity, "LevelShutdownPreEntity" );
         if( func_LevelShutdownPreEntity.ptr() != Py_None )
             try {
                 func_LevelShutdownPreEntity(  );
@@ -3948,7 +3948,7 @@ struct CAutoGameSystem_wrapper : CAutoGameSystem, bp::wrapper< CAutoGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling OnRestore(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnRestore = this->get_override( "OnRestore" );
+        PY_OVERRIDE_LOOKUP( func_OnRestore, "OnRestore" );
         if( func_OnRestore.ptr() != Py_None )
             try {
                 func_OnRestore(  );
@@ -3978,7 +3978,7 @@ struct CAutoGameSystem_wrapper : CAutoGameSystem, bp::wrapper< CAutoGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling OnSave(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnSave = this->get_override( "OnSave" );
+        PY_OVERRIDE_LOOKUP( func_OnSave, "OnSave" );
         if( func_OnSave.ptr() != Py_None )
             try {
                 func_OnSave(  );
@@ -4008,7 +4008,7 @@ struct CAutoGameSystem_wrapper : CAutoGameSystem, bp::wrapper< CAutoGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling PostInit(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PostInit = this->get_override( "PostInit" );
+        PY_OVERRIDE_LOOKUP( func_PostInit, "PostInit" );
         if( func_PostInit.ptr() != Py_None )
             try {
                 func_PostInit(  );
@@ -4038,7 +4038,7 @@ struct CAutoGameSystem_wrapper : CAutoGameSystem, bp::wrapper< CAutoGameSystem >
         if( py_log_overrides.GetBool() )
             Msg("Calling Shutdown(  ) of Class: CBaseGameSystem\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Shutdown = this->get_override( "Shutdown" );
+        PY_OVERRIDE_LOOKUP( func_Shutdown, "Shutdown" );
         if( func_Shutdown.ptr() != Py_None )
             try {
                 func_Shutdown(  );
@@ -4086,7 +4086,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling FrameUpdatePostEntityThink(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_FrameUpdatePostEntityThink = this->get_override( "FrameUpdatePostEntityThink" );
+        PY_OVERRIDE_LOOKUP( func_FrameUpdatePostEntityThink, "FrameUpdatePostEntityThink" );
         if( func_FrameUpdatePostEntityThink.ptr() != Py_None )
             try {
                 func_FrameUpdatePostEntityThink(  );
@@ -4116,7 +4116,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling FrameUpdatePreEntityThink(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_FrameUpdatePreEntityThink = this->get_override( "FrameUpdatePreEntityThink" );
+        PY_OVERRIDE_LOOKUP( func_FrameUpdatePreEntityThink, "FrameUpdatePreEntityThink" );
         if( func_FrameUpdatePreEntityThink.ptr() != Py_None )
             try {
                 func_FrameUpdatePreEntityThink(  );
@@ -4146,7 +4146,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling Init(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Init = this->get_override( "Init" );
+        PY_OVERRIDE_LOOKUP( func_Init, "Init" );
         if( func_Init.ptr() != Py_None )
             try {
                 return func_Init(  );
@@ -4176,7 +4176,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelInitPostEntity(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelInitPostEntity = this->get_override( "LevelInitPostEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelInitPostEntity, "LevelInitPostEntity" );
         if( func_LevelInitPostEntity.ptr() != Py_None )
             try {
                 func_LevelInitPostEntity(  );
@@ -4206,7 +4206,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelInitPreEntity(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelInitPreEntity = this->get_override( "LevelInitPreEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelInitPreEntity, "LevelInitPreEntity" );
         if( func_LevelInitPreEntity.ptr() != Py_None )
             try {
                 func_LevelInitPreEntity(  );
@@ -4236,7 +4236,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelShutdownPostEntity(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelShutdownPostEntity = this->get_override( "LevelShutdownPostEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelShutdownPostEntity, "LevelShutdownPostEntity" );
         if( func_LevelShutdownPostEntity.ptr() != Py_None )
             try {
                 func_LevelShutdownPostEntity(  );
@@ -4266,7 +4266,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelShutdownPreEntity(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelShutdownPreEntity = this->get_override( "LevelShutdownPreEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelShutdownPreEntity, "LevelShutdownPreEntity" );
         if( func_LevelShutdownPreEntity.ptr() != Py_None )
             try {
                 func_LevelShutdownPreEntity(  );
@@ -4296,7 +4296,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling Name(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Name = this->get_override( "Name" );
+        PY_OVERRIDE_LOOKUP( func_Name, "Name" );
         if( func_Name.ptr() != Py_None )
             try {
                 return func_Name(  );
@@ -4326,7 +4326,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling OnRestore(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnRestore = this->get_override( "OnRestore" );
+        PY_OVERRIDE_LOOKUP( func_OnRestore, "OnRestore" );
         if( func_OnRestore.ptr() != Py_None )
             try {
                 func_OnRestore(  );
@@ -4356,7 +4356,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling OnSave(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnSave = this->get_override( "OnSave" );
+        PY_OVERRIDE_LOOKUP( func_OnSave, "OnSave" );
         if( func_OnSave.ptr() != Py_None )
             try {
                 func_OnSave(  );
@@ -4386,7 +4386,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling PostInit(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PostInit = this->get_override( "PostInit" );
+        PY_OVERRIDE_LOOKUP( func_PostInit, "PostInit" );
         if( func_PostInit.ptr() != Py_None )
             try {
                 func_PostInit(  );
@@ -4416,7 +4416,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling PreClientUpdate(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PreClientUpdate = this->get_override( "PreClientUpdate" );
+        PY_OVERRIDE_LOOKUP( func_PreClientUpdate, "PreClientUpdate" );
         if( func_PreClientUpdate.ptr() != Py_None )
             try {
                 func_PreClientUpdate(  );
@@ -4446,7 +4446,7 @@ struct CBaseGameSystemPerFrame_wrapper : CBaseGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling Shutdown(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Shutdown = this->get_override( "Shutdown" );
+        PY_OVERRIDE_LOOKUP( func_Shutdown, "Shutdown" );
         if( func_Shutdown.ptr() != Py_None )
             try {
                 func_Shutdown(  );
@@ -4494,7 +4494,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling Name(  ) of Class: CAutoGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Name = this->get_override( "Name" );
+        PY_OVERRIDE_LOOKUP( func_Name, "Name" );
         if( func_Name.ptr() != Py_None )
             try {
                 return func_Name(  );
@@ -4532,7 +4532,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling FrameUpdatePostEntityThink(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_FrameUpdatePostEntityThink = this->get_override( "FrameUpdatePostEntityThink" );
+        PY_OVERRIDE_LOOKUP( func_FrameUpdatePostEntityThink, "FrameUpdatePostEntityThink" );
         if( func_FrameUpdatePostEntityThink.ptr() != Py_None )
             try {
                 func_FrameUpdatePostEntityThink(  );
@@ -4562,7 +4562,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling FrameUpdatePreEntityThink(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_FrameUpdatePreEntityThink = this->get_override( "FrameUpdatePreEntityThink" );
+        PY_OVERRIDE_LOOKUP( func_FrameUpdatePreEntityThink, "FrameUpdatePreEntityThink" );
         if( func_FrameUpdatePreEntityThink.ptr() != Py_None )
             try {
                 func_FrameUpdatePreEntityThink(  );
@@ -4592,7 +4592,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling Init(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Init = this->get_override( "Init" );
+        PY_OVERRIDE_LOOKUP( func_Init, "Init" );
         if( func_Init.ptr() != Py_None )
             try {
                 return func_Init(  );
@@ -4622,7 +4622,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelInitPostEntity(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelInitPostEntity = this->get_override( "LevelInitPostEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelInitPostEntity, "LevelInitPostEntity" );
         if( func_LevelInitPostEntity.ptr() != Py_None )
             try {
                 func_LevelInitPostEntity(  );
@@ -4652,7 +4652,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelInitPreEntity(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelInitPreEntity = this->get_override( "LevelInitPreEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelInitPreEntity, "LevelInitPreEntity" );
         if( func_LevelInitPreEntity.ptr() != Py_None )
             try {
                 func_LevelInitPreEntity(  );
@@ -4682,7 +4682,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelShutdownPostEntity(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelShutdownPostEntity = this->get_override( "LevelShutdownPostEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelShutdownPostEntity, "LevelShutdownPostEntity" );
         if( func_LevelShutdownPostEntity.ptr() != Py_None )
             try {
                 func_LevelShutdownPostEntity(  );
@@ -4712,7 +4712,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelShutdownPreEntity(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelShutdownPreEntity = this->get_override( "LevelShutdownPreEntity" );
+        PY_OVERRIDE_LOOKUP( func_LevelShutdownPreEntity, "LevelShutdownPreEntity" );
         if( func_LevelShutdownPreEntity.ptr() != Py_None )
             try {
                 func_LevelShutdownPreEntity(  );
@@ -4742,7 +4742,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling OnRestore(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnRestore = this->get_override( "OnRestore" );
+        PY_OVERRIDE_LOOKUP( func_OnRestore, "OnRestore" );
         if( func_OnRestore.ptr() != Py_None )
             try {
                 func_OnRestore(  );
@@ -4772,7 +4772,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling OnSave(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnSave = this->get_override( "OnSave" );
+        PY_OVERRIDE_LOOKUP( func_OnSave, "OnSave" );
         if( func_OnSave.ptr() != Py_None )
             try {
                 func_OnSave(  );
@@ -4802,7 +4802,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling PostInit(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PostInit = this->get_override( "PostInit" );
+        PY_OVERRIDE_LOOKUP( func_PostInit, "PostInit" );
         if( func_PostInit.ptr() != Py_None )
             try {
                 func_PostInit(  );
@@ -4832,7 +4832,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling PreClientUpdate(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_PreClientUpdate = this->get_override( "PreClientUpdate" );
+        PY_OVERRIDE_LOOKUP( func_PreClientUpdate, "PreClientUpdate" );
         if( func_PreClientUpdate.ptr() != Py_None )
             try {
                 func_PreClientUpdate(  );
@@ -4862,7 +4862,7 @@ struct CAutoGameSystemPerFrame_wrapper : CAutoGameSystemPerFrame, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling Shutdown(  ) of Class: CBaseGameSystemPerFrame\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Shutdown = this->get_override( "Shutdown" );
+        PY_OVERRIDE_LOOKUP( func_Shutdown, "Shutdown" );
         if( func_Shutdown.ptr() != Py_None )
             try {
                 func_Shutdown(  );
@@ -4890,7 +4890,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual void AppendParm( char const * pszParm, char const * pszValues ){
-        bp::override func_AppendParm = this->get_override( "AppendParm" );
+        PY_OVERRIDE_LOOKUP( func_AppendParm, "AppendParm" );
         try {
             func_AppendParm( pszParm, pszValues );
         } catch(bp::error_already_set &) {
@@ -4899,7 +4899,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual char const * CheckParm( char const * psz, char const * * ppszValue=0 ) const {
-        bp::override func_CheckParm = this->get_override( "CheckParm" );
+        PY_OVERRIDE_LOOKUP( func_CheckParm, "CheckParm" );
         try {
             return func_CheckParm( psz, ppszValue );
         } catch(bp::error_already_set &) {
@@ -4908,7 +4908,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual void CreateCmdLine( char const * commandline ){
-        bp::override func_CreateCmdLine = this->get_override( "CreateCmdLine" );
+        PY_OVERRIDE_LOOKUP( func_CreateCmdLine, "CreateCmdLine" );
         try {
             func_CreateCmdLine( commandline );
         } catch(bp::error_already_set &) {
@@ -4917,7 +4917,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual void CreateCmdLine( int argc, char * * argv ){
-        bp::override func_CreateCmdLine = this->get_override( "CreateCmdLine" );
+        PY_OVERRIDE_LOOKUP( func_CreateCmdLine, "CreateCmdLine" );
         try {
             func_CreateCmdLine( argc, argv );
         } catch(bp::error_already_set &) {
@@ -4926,7 +4926,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual int FindParm( char const * psz ) const {
-        bp::override func_FindParm = this->get_override( "FindParm" );
+        PY_OVERRIDE_LOOKUP( func_FindParm, "FindParm" );
         try {
             return func_FindParm( psz );
         } catch(bp::error_already_set &) {
@@ -4935,7 +4935,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual char const * GetCmdLine(  ) const {
-        bp::override func_GetCmdLine = this->get_override( "GetCmdLine" );
+        PY_OVERRIDE_LOOKUP( func_GetCmdLine, "GetCmdLine" );
         try {
             return func_GetCmdLine(  );
         } catch(bp::error_already_set &) {
@@ -4944,7 +4944,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual char const * GetParm( int nIndex ) const {
-        bp::override func_GetParm = this->get_override( "GetParm" );
+        PY_OVERRIDE_LOOKUP( func_GetParm, "GetParm" );
         try {
             return func_GetParm( nIndex );
         } catch(bp::error_already_set &) {
@@ -4953,7 +4953,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual int ParmCount(  ) const {
-        bp::override func_ParmCount = this->get_override( "ParmCount" );
+        PY_OVERRIDE_LOOKUP( func_ParmCount, "ParmCount" );
         try {
             return func_ParmCount(  );
         } catch(bp::error_already_set &) {
@@ -4962,7 +4962,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual char const * ParmValue( char const * psz, char const * pDefaultVal=0 ) const {
-        bp::override func_ParmValue = this->get_override( "ParmValue" );
+        PY_OVERRIDE_LOOKUP( func_ParmValue, "ParmValue" );
         try {
             return func_ParmValue( psz, pDefaultVal );
         } catch(bp::error_already_set &) {
@@ -4971,7 +4971,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual int ParmValue( char const * psz, int nDefaultVal ) const {
-        bp::override func_ParmValue = this->get_override( "ParmValue" );
+        PY_OVERRIDE_LOOKUP( func_ParmValue, "ParmValue" );
         try {
             return func_ParmValue( psz, nDefaultVal );
         } catch(bp::error_already_set &) {
@@ -4980,7 +4980,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual float ParmValue( char const * psz, float flDefaultVal ) const {
-        bp::override func_ParmValue = this->get_override( "ParmValue" );
+        PY_OVERRIDE_LOOKUP( func_ParmValue, "ParmValue" );
         try {
             return func_ParmValue( psz, flDefaultVal );
         } catch(bp::error_already_set &) {
@@ -4989,7 +4989,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual void RemoveParm( char const * parm ){
-        bp::override func_RemoveParm = this->get_override( "RemoveParm" );
+        PY_OVERRIDE_LOOKUP( func_RemoveParm, "RemoveParm" );
         try {
             func_RemoveParm( parm );
         } catch(bp::error_already_set &) {
@@ -4998,7 +4998,7 @@ struct ICommandLine_wrapper : ICommandLine, bp::wrapper< ICommandLine > {
     }
 
     virtual void SetParm( int nIndex, char const * pNewParm ){
-        bp::override func_SetParm = this->get_override( "SetParm" );
+        PY_OVERRIDE_LOOKUP( func_SetParm, "SetParm" );
         try {
             func_SetParm( nIndex, pNewParm );
         } catch(bp::error_already_set &) {
@@ -5018,7 +5018,7 @@ struct IMapEntityFilter_wrapper : IMapEntityFilter, bp::wrapper< IMapEntityFilte
     }
 
     virtual ::CBaseEntity * CreateNextEntity( char const * pClassname ){
-        bp::override func_CreateNextEntity = this->get_override( "CreateNextEntity" );
+        PY_OVERRIDE_LOOKUP( func_CreateNextEntity, "CreateNextEntity" );
         try {
             return func_CreateNextEntity( pClassname );
         } catch(bp::error_already_set &) {
@@ -5027,7 +5027,7 @@ struct IMapEntityFilter_wrapper : IMapEntityFilter, bp::wrapper< IMapEntityFilte
     }
 
     virtual bool ShouldCreateEntity( char const * pClassname ){
-        bp::override func_ShouldCreateEntity = this->get_override( "ShouldCreateEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldCreateEntity, "ShouldCreateEntity" );
         try {
             return func_ShouldCreateEntity( pClassname );
         } catch(bp::error_already_set &) {
@@ -5067,7 +5067,7 @@ struct PyGameEventListener_wrapper : PyGameEventListener, bp::wrapper< PyGameEve
         if( py_log_overrides.GetBool() )
             Msg("Calling PyFireGameEvent( event ) of Class: PyGameEventListener\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_FireGameEvent = this->get_override( "FireGameEvent" );
+        PY_OVERRIDE_LOOKUP( func_FireGameEvent, "FireGameEvent" );
         if( func_FireGameEvent.ptr() != Py_None )
             try {
                 func_FireGameEvent( event );
@@ -51,7 +51,7 @@ struct C_HL2WarsGameRules_wrapper : C_HL2WarsGameRules, bp::wrapper< C_HL2WarsGa
         if( py_log_overrides.GetBool() )
             Msg("Calling InitGamerules(  ) of Class: C_HL2WarsGameRules\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_InitGamerules = this->get_override( "InitGamerules" );
+        PY_OVERRIDE_LOOKUP( func_InitGamerules, "InitGamerules" );
         if( func_InitGamerules.ptr() != Py_None )
             try {
                 func_InitGamerules(  );
@@ -81,7 +81,7 @@ struct C_HL2WarsGameRules_wrapper : C_HL2WarsGameRules, bp::wrapper< C_HL2WarsGa
         if( py_log_overrides.GetBool() )
             Msg("Calling IsTeamplay(  ) of Class: C_HL2WarsGameRules\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_IsTeamplay = this->get_override( "IsTeamplay" );
+        PY_OVERRIDE_LOOKUP( func_IsTeamplay, "IsTeamplay" );
         if( func_IsTeamplay.ptr() != Py_None )
             try {
                 return func_IsTeamplay(  );
@@ -111,7 +111,7 @@ struct C_HL2WarsGameRules_wrapper : C_HL2WarsGameRules, bp::wrapper< C_HL2WarsGa
         if( py_log_overrides.GetBool() )
             Msg("Calling ShutdownGamerules(  ) of Class: C_HL2WarsGameRules\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShutdownGamerules = this->get_override( "ShutdownGamerules" );
+        PY_OVERRIDE_LOOKUP( func_ShutdownGamerules, "ShutdownGamerules" );
         if( func_ShutdownGamerules.ptr() != Py_None )
             try {
                 func_ShutdownGamerules(  );
@@ -297,7 +297,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
         if( py_log_overrides.GetBool() )
             Msg("Calling AllowAutoTargetCrosshair(  ) of Class: CHL2WarsGameRules\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_AllowAutoTargetCrosshair = this->get_override( "AllowAutoTargetCrosshair" );
+        PY_OVERRIDE_LOOKUP( func_AllowAutoTargetCrosshair, "AllowAutoTargetCrosshair" );
         if( func_AllowAutoTargetCrosshair.ptr() != Py_None )
             try {
                 return func_AllowAutoTargetCrosshair(  );
@@ -327,7 +327,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
         if( py_log_overrides.GetBool() )
             Msg("Calling ChangeLevel(  ) of Class: CHL2WarsGameRules\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ChangeLevel = this->get_override( "ChangeLevel" );
+        PY_OVERRIDE_LOOKUP( func_ChangeLevel, "ChangeLevel" );
         if( func_ChangeLevel.ptr() != Py_None )
             try {
                 func_ChangeLevel(  );
@@ -357,7 +357,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
         if( py_log_overrides.GetBool() )
             Msg("Calling CreateStandardEntities(  ) of Class: CHL2WarsGameRules\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_CreateStandardEntities = this->get_override( "CreateStandardEntities" );
+        PY_OVERRIDE_LOOKUP( func_CreateStandardEntities, "CreateStandardEntities" );
         if( func_CreateStandardEntities.ptr() != Py_None )
             try {
                 func_CreateStandardEntities(  );
@@ -387,7 +387,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
         if( py_log_overrides.GetBool() )
             Msg("Calling DeathNotice( boost::python::ptr(pVictim), boost::ref(info) ) of Class: CHL2WarsGameRules\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_DeathNotice = this->get_override( "DeathNotice" );
+        PY_OVERRIDE_LOOKUP( func_DeathNotice, "DeathNotice" );
         if( func_DeathNotice.ptr() != Py_None )
             try {
                 func_DeathNotice( boost::python::ptr(pVictim), boost::ref(info) );
@@ -417,7 +417,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
         if( py_log_overrides.GetBool() )
             Msg("Calling GetChatFormat( bTeamOnly, boost::python::ptr(pPlayer) ) of Class: CHL2WarsGameRules\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetChatFormat = this->get_override( "GetChatFormat" );
+        PY_OVERRIDE_LOOKUP( func_GetChatFormat, "GetChatFormat" );
         if( func_GetChatFormat.ptr() != Py_None )
             try {
                 return func_GetChatFormat( bTeamOnly, boost::python::ptr(pPlayer) );
@@ -447,7 +447,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
         if( py_log_overrides.GetBool() )
             Msg("Calling GetChatPrefix( bTeamOnly, boost::python::ptr(pPlayer) ) of Class: CHL2WarsGameRules\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetChatPrefix = this->get_override( "GetChatPrefix" );
+        PY_OVERRIDE_LOOKUP( func_GetChatPrefix, "GetChatPrefix" );
         if( func_GetChatPrefix.ptr() != Py_None )
             try {
                 return func_GetChatPrefix( bTeamOnly, boost::python::ptr(pPlayer) );
@@ -477,7 +477,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
         if( py_log_overrides.GetBool() )
             Msg("Calling GetGameDescription(  ) of Class: CHL2WarsGameRules\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetGameDescription = this->get_override( "GetGameDescription" );
+        PY_OVERRIDE_LOOKUP( func_GetGameDescription, "GetGameDescription" );
         if( func_GetGameDescription.ptr() != Py_None )
             try {
                 return func_GetGameDescription(  );
@@ -507,7 +507,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
         if( py_log_overrides.GetBool() )
             Msg("Calling GetNextLevelName( bRandom ) of Class: CHL2WarsGameRules\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetNextLevelName = this->get_override( "GetNextLevelName" );
+        PY_OVERRIDE_LOOKUP( func_GetNextLevelName, "GetNextLevelName" );
         if( func_GetNextLevelName.ptr() != Py_None )
             try {
                 return func_GetNextLevelName( bRandom );
@@ -537,7 +537,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
         if( py_log_overrides.GetBool() )
             Msg("Calling GetPlayerClassname(  ) of Class: CHL2WarsGameRules\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetPlayerClassname = this->get_override( "GetPlayerClassname" );
+        PY_OVERRIDE_LOOKUP( func_GetPlayerClassname, "GetPlayerClassname" );
         if( func_GetPlayerClassname.ptr() != Py_None )
             try {
                 return func_GetPlayerClassname(  );
@@ -567,7 +567,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
         if( py_log_overrides.GetBool() )
             Msg("Calling GoToIntermission(  ) of Class: CHL2WarsGameRules\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GoToIntermission = this->get_override( "GoToIntermission" );
+        PY_OVERRIDE_LOOKUP( func_GoToIntermission, "GoToIntermission" );
         if( func_GoToIntermission.ptr() != Py_None )
             try {
                 func_GoToIntermission(  );
@@ -597,7 +597,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
         if( py_log_overrides.GetBool() )
             Msg("Calling Init(  ) of Class: CHL2WarsGameRules\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Init = this->get_override( "Init" );
+        PY_OVERRIDE_LOOKUP( func_Init, "Init" );
         if( func_Init.ptr() != Py_None )
             try {
                 return func_Init(  );
@@ -627,7 +627,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
         if( py_log_overrides.GetBool() )
             Msg("Calling InitGamerules(  ) of Class: CHL2WarsGameRules\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_InitGamerules = this->get_override( "InitGamerules" );
+        PY_OVERRIDE_LOOKUP( func_InitGamerules, "InitGamerules" );
         if( func_InitGamerules.ptr() != Py_None )
             try {
                 func_InitGamerules(  );
@@ -657,7 +657,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
         if( py_log_overrides.GetBool() )
             Msg("Calling InitHUD( boost::python::ptr(pl) ) of Class: CHL2WarsGameRules\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_InitHUD = this->get_override( "InitHUD" );
+        PY_OVERRIDE_LOOKUP( func_InitHUD, "InitHUD" );
         if( func_InitHUD.ptr() != Py_None )
             try {
                 func_InitHUD( boost::python::ptr(pl) );
@@ -687,7 +687,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
         if( py_log_overrides.GetBool() )
             Msg("Calling IsCoOp(  ) of Class: CHL2WarsGameRules\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_IsCoOp = this->get_override( "IsCoOp" );
+        PY_OVERRIDE_LOOKUP( func_IsCoOp, "IsCoOp" );
         if( func_IsCoOp.ptr() != Py_None )
             try {
                 return func_IsCoOp(  );
@@ -717,7 +717,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
         if( py_log_overrides.GetBool() )
             Msg("Calling IsDeathmatch(  ) of Class: CHL2WarsGameRules\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_IsDeathmatch = this->get_override( "IsDeathmatch" );
+        PY_OVERRIDE_LOOKUP( func_IsDeathmatch, "IsDeathmatch" );
         if( func_IsDeathmatch.ptr() != Py_None )
             try {
                 return func_IsDeathmatch(  );
@@ -747,7 +747,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
         if( py_log_overrides.GetBool() )
             Msg("Calling IsTeamplay(  ) of Class: CHL2WarsGameRules\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_IsTeamplay = this->get_override( "IsTeamplay" );
+        PY_OVERRIDE_LOOKUP( func_IsTeamplay, "IsTeamplay" );
         if( func_IsTeamplay.ptr() != Py_None )
             try {
                 return func_IsTeamplay(  );
@@ -777,7 +777,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
         if( py_log_overrides.GetBool() )
             Msg("Calling LevelShutdown(  ) of Class: CHL2WarsGameRules\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_LevelShutdown = this->get_override( "LevelShutdown" );
+        PY_OVERRIDE_LOOKUP( func_LevelShutdown, "LevelShutdown" );
         if( func_LevelShutdown.ptr() != Py_None )
             try {
                 func_LevelShutdown(  );
@@ -807,7 +807,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
         if( py_log_overrides.GetBool() )
             Msg("Calling Precache(  ) of Class: CHL2WarsGameRules\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Precache = this->get_override( "Precache" );
+        PY_OVERRIDE_LOOKUP( func_Precache, "Precache" );
         if( func_Precache.ptr() != Py_None )
             try {
                 func_Precache(  );
@@ -837,7 +837,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
         if( py_log_overrides.GetBool() )
             Msg("Calling PyClientConnected( clientindex, name, address, reject, maxrejectlen ) of Class: CHL2WarsGameRules\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ClientConnected = this->get_override( "ClientConnected" );
+        PY_OVERRIDE_LOOKUP( func_ClientConnected, "ClientConnected" );
         if( func_ClientConnected.ptr() != Py_None )
             try {
                 return func_ClientConnected( clientindex, name, address, reject, maxrejectlen );
@@ -867,7 +867,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
         if( py_log_overrides.GetBool() )
             Msg("Calling ShutdownGamerules(  ) of Class: CHL2WarsGameRules\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShutdownGamerules = this->get_override( "ShutdownGamerules" );
+        PY_OVERRIDE_LOOKUP( func_ShutdownGamerules, "ShutdownGamerules" );
         if( func_ShutdownGamerules.ptr() != Py_None )
             try {
                 func_ShutdownGamerules(  );
@@ -897,7 +897,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
         if( py_log_overrides.GetBool() )
             Msg("Calling Think(  ) of Class: CHL2WarsGameRules\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Think = this->get_override( "Think" );
+        PY_OVERRIDE_LOOKUP( func_Think, "Think" );
         if( func_Think.ptr() != Py_None )
             try {
                 func_Think(  );
@@ -916,7 +916,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
     virtual PyObject *GetPySelf() const { return boost::python::detail::wrapper_base_::get_owner(*this); }
 
     virtual void PyClientDisconnected( ::CBasePlayer * client ) {
-        boost::python::override func_ClientDisconnected = this->get_override( "ClientDisconnected" );
+        PY_OVERRIDE_LOOKUP( func_ClientDisconnected, "ClientDisconnected" );
         if( func_ClientDisconnected.ptr() != Py_None )
             try {
                 func_ClientDisconnected( *client );
@@ -933,7 +933,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
     }
 
     virtual void ClientActive( ::CBasePlayer * client ) {
-        boost::python::override func_ClientActive = this->get_override( "ClientActive" );
+        PY_OVERRIDE_LOOKUP( func_ClientActive, "ClientActive" );
         if( func_ClientActive.ptr() != Py_None )
             try {
                 func_ClientActive( *client );
@@ -950,7 +950,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
     }
 
     virtual void PlayerSpawn( ::CBasePlayer * player ) {
-        boost::python::override func_PlayerSpawn = this->get_override( "PlayerSpawn" );
+        PY_OVERRIDE_LOOKUP( func_PlayerSpawn, "PlayerSpawn" );
         if( func_PlayerSpawn.ptr() != Py_None )
             try {
                 func_PlayerSpawn( *player );
@@ -967,7 +967,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
     }
 
     virtual void PlayerThink( ::CBasePlayer * player ) {
-        boost::python::override func_PlayerThink = this->get_override( "PlayerThink" );
+        PY_OVERRIDE_LOOKUP( func_PlayerThink, "PlayerThink" );
         if( func_PlayerThink.ptr() != Py_None )
             try {
                 func_PlayerThink( *player );
@@ -984,7 +984,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
     }
 
     virtual bool FPlayerCanRespawn( ::CBasePlayer * player ) {
-        boost::python::override func_FPlayerCanRespawn = this->get_override( "FPlayerCanRespawn" );
+        PY_OVERRIDE_LOOKUP( func_FPlayerCanRespawn, "FPlayerCanRespawn" );
         if( func_FPlayerCanRespawn.ptr() != Py_None )
             try {
                 return func_FPlayerCanRespawn( *player );
@@ -1001,7 +1001,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
     }
 
     virtual float FlPlayerSpawnTime( ::CBasePlayer * player ) {
-        boost::python::override func_FlPlayerSpawnTime = this->get_override( "FlPlayerSpawnTime" );
+        PY_OVERRIDE_LOOKUP( func_FlPlayerSpawnTime, "FlPlayerSpawnTime" );
         if( func_FlPlayerSpawnTime.ptr() != Py_None )
             try {
                 return func_FlPlayerSpawnTime( *player );
@@ -1018,7 +1018,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
     }
 
     virtual ::CBaseEntity * GetPlayerSpawnSpot( ::CBasePlayer * player ) {
-        boost::python::override func_GetPlayerSpawnSpot = this->get_override( "GetPlayerSpawnSpot" );
+        PY_OVERRIDE_LOOKUP( func_GetPlayerSpawnSpot, "GetPlayerSpawnSpot" );
         if( func_GetPlayerSpawnSpot.ptr() != Py_None )
             try {
                 return func_GetPlayerSpawnSpot( *player );
@@ -1035,7 +1035,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
     }
 
     virtual bool IsSpawnPointValid( ::CBaseEntity * spot, ::CBasePlayer * player ) {
-        boost::python::override func_IsSpawnPointValid = this->get_override( "IsSpawnPointValid" );
+        PY_OVERRIDE_LOOKUP( func_IsSpawnPointValid, "IsSpawnPointValid" );
         if( func_IsSpawnPointValid.ptr() != Py_None )
             try {
                 return func_IsSpawnPointValid( *spot, *player );
@@ -1052,7 +1052,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
     }
 
     virtual bool ClientCommand( ::CBaseEntity * edict, ::CCommand const & args ) {
-        boost::python::override func_ClientCommand = this->get_override( "ClientCommand" );
+        PY_OVERRIDE_LOOKUP( func_ClientCommand, "ClientCommand" );
         if( func_ClientCommand.ptr() != Py_None )
             try {
                 return func_ClientCommand( *edict, args );
@@ -1069,7 +1069,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
     }
 
     virtual void ClientSettingsChanged( ::CBasePlayer * player ) {
-        boost::python::override func_ClientSettingsChanged = this->get_override( "ClientSettingsChanged" );
+        PY_OVERRIDE_LOOKUP( func_ClientSettingsChanged, "ClientSettingsChanged" );
         if( func_ClientSettingsChanged.ptr() != Py_None )
             try {
                 func_ClientSettingsChanged( *player );
@@ -1086,7 +1086,7 @@ struct CHL2WarsGameRules_wrapper : CHL2WarsGameRules, bp::wrapper< CHL2WarsGameR
     }
 
     virtual void PlayerChangedOwnerNumber( ::CBasePlayer * player, int oldownernumber, int newownernumber ) {
-        boost::python::override func_PlayerChangedOwnerNumber = this->get_override( "PlayerChangedOwnerNumber" );
+        PY_OVERRIDE_LOOKUP( func_PlayerChangedOwnerNumber, "PlayerChangedOwnerNumber" );
         if( func_PlayerChangedOwnerNumber.ptr() != Py_None )
             try {
                 func_PlayerChangedOwnerNumber( *player, oldownernumber, newownernumber );
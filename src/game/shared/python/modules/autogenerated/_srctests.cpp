@@ -32,6 +32,17 @@ BOOST_PYTHON_MODULE(_srctests){
     
     }
 
+    { //::SrcPyTest_HandleAttrPerSecond
+    
+        typedef float ( *SrcPyTest_HandleAttrPerSecond_function_type )( ::boost::python::object,char const *,int );
+        
+        bp::def( 
+            "SrcPyTest_HandleAttrPerSecond"
+            , SrcPyTest_HandleAttrPerSecond_function_type( &::SrcPyTest_HandleAttrPerSecond )
+            , ( bp::arg("handle"), bp::arg("pAttrName"), bp::arg("n") ) );
+    
+    }
+
     { //::SrcPyTest_NCrossProducts
     
         typedef void ( *SrcPyTest_NCrossProducts_function_type )( int,::Vector &,::Vector & );
@@ -72,6 +83,17 @@ BOOST_PYTHON_MODULE(_srctests){
     
     }
 
+    { //::SrcPyTest_HandleAttrPerSecond
+    
+        typedef float ( *SrcPyTest_HandleAttrPerSecond_function_type )( ::boost::python::object,char const *,int );
+        
+        bp::def( 
+            "SrcPyTest_HandleAttrPerSecond"
+            , SrcPyTest_HandleAttrPerSecond_function_type( &::SrcPyTest_HandleAttrPerSecond )
+            , ( bp::arg("handle"), bp::arg("pAttrName"), bp::arg("n") ) );
+    
+    }
+
     { //::SrcPyTest_NCrossProducts
     
         typedef void ( *SrcPyTest_NCrossProducts_function_type )( int,::Vector &,::Vector & );
@@ -59,7 +59,7 @@ struct PyClientSideEffect_wrapper : PyClientSideEffect, bp::wrapper< PyClientSid
         if( py_log_overrides.GetBool() )
             Msg("Calling Draw( frametime ) of Class: PyClientSideEffect\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Draw = this->get_override( "Draw" );
+        PY_OVERRIDE_LOOKUP( func_Draw, "Draw" );
         if( func_Draw.ptr() != Py_None )
             try {
                 func_Draw( frametime );
@@ -82,7 +82,7 @@ struct CTraceFilter_wrapper : CTraceFilter, bp::wrapper< CTraceFilter > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -99,7 +99,7 @@ struct CTraceFilter_wrapper : CTraceFilter, bp::wrapper< CTraceFilter > {
     }
 
     virtual bool ShouldHitEntity( ::IHandleEntity * pEntity, int contentsMask ){
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         try {
             return func_ShouldHitEntity( boost::python::ptr(pEntity), contentsMask );
         } catch(bp::error_already_set &) {
@@ -132,7 +132,7 @@ struct CTraceFilterSimple_wrapper : CTraceFilterSimple, bp::wrapper< CTraceFilte
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -162,7 +162,7 @@ struct CTraceFilterSimple_wrapper : CTraceFilterSimple, bp::wrapper< CTraceFilte
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -192,7 +192,7 @@ struct CTraceFilterSimple_wrapper : CTraceFilterSimple, bp::wrapper< CTraceFilte
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -222,7 +222,7 @@ struct CTraceFilterSimple_wrapper : CTraceFilterSimple, bp::wrapper< CTraceFilte
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -270,7 +270,7 @@ struct CPyTraceFilterSimple_wrapper : CPyTraceFilterSimple, bp::wrapper< CPyTrac
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -300,7 +300,7 @@ struct CPyTraceFilterSimple_wrapper : CPyTraceFilterSimple, bp::wrapper< CPyTrac
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -330,7 +330,7 @@ struct CPyTraceFilterSimple_wrapper : CPyTraceFilterSimple, bp::wrapper< CPyTrac
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -360,7 +360,7 @@ struct CPyTraceFilterSimple_wrapper : CPyTraceFilterSimple, bp::wrapper< CPyTrac
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -408,7 +408,7 @@ struct CTraceFilterChain_wrapper : CTraceFilterChain, bp::wrapper< CTraceFilterC
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterChain\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -438,7 +438,7 @@ struct CTraceFilterChain_wrapper : CTraceFilterChain, bp::wrapper< CTraceFilterC
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -479,7 +479,7 @@ struct CTraceFilterEntitiesOnly_wrapper : CTraceFilterEntitiesOnly, bp::wrapper<
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilterEntitiesOnly\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -496,7 +496,7 @@ struct CTraceFilterEntitiesOnly_wrapper : CTraceFilterEntitiesOnly, bp::wrapper<
     }
 
     virtual bool ShouldHitEntity( ::IHandleEntity * pEntity, int contentsMask ){
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         try {
             return func_ShouldHitEntity( boost::python::ptr(pEntity), contentsMask );
         } catch(bp::error_already_set &) {
@@ -536,7 +536,7 @@ struct CTraceFilterHitAll_wrapper : CTraceFilterHitAll, bp::wrapper< CTraceFilte
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pServerEntity), contentsMask ) of Class: CTraceFilterHitAll\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pServerEntity), contentsMask );
@@ -566,7 +566,7 @@ struct CTraceFilterHitAll_wrapper : CTraceFilterHitAll, bp::wrapper< CTraceFilte
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -614,7 +614,7 @@ struct CTraceFilterIgnoreTeam_wrapper : CTraceFilterIgnoreTeam, bp::wrapper< CTr
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterIgnoreTeam\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -644,7 +644,7 @@ struct CTraceFilterIgnoreTeam_wrapper : CTraceFilterIgnoreTeam, bp::wrapper< CTr
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -674,7 +674,7 @@ struct CTraceFilterIgnoreTeam_wrapper : CTraceFilterIgnoreTeam, bp::wrapper< CTr
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -704,7 +704,7 @@ struct CTraceFilterIgnoreTeam_wrapper : CTraceFilterIgnoreTeam, bp::wrapper< CTr
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -752,7 +752,7 @@ struct CTraceFilterSkipTwoEntities_wrapper : CTraceFilterSkipTwoEntities, bp::wr
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity2( boost::python::ptr(pPassEntity2) ) of Class: CTraceFilterSkipTwoEntities\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity2 = this->get_override( "SetPassEntity2" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity2, "SetPassEntity2" );
         if( func_SetPassEntity2.ptr() != Py_None )
             try {
                 func_SetPassEntity2( boost::python::ptr(pPassEntity2) );
@@ -782,7 +782,7 @@ struct CTraceFilterSkipTwoEntities_wrapper : CTraceFilterSkipTwoEntities, bp::wr
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterSkipTwoEntities\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -812,7 +812,7 @@ struct CTraceFilterSkipTwoEntities_wrapper : CTraceFilterSkipTwoEntities, bp::wr
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -842,7 +842,7 @@ struct CTraceFilterSkipTwoEntities_wrapper : CTraceFilterSkipTwoEntities, bp::wr
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -872,7 +872,7 @@ struct CTraceFilterSkipTwoEntities_wrapper : CTraceFilterSkipTwoEntities, bp::wr
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -920,7 +920,7 @@ struct CTraceFilterLOS_wrapper : CTraceFilterLOS, bp::wrapper< CTraceFilterLOS >
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterLOS\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -950,7 +950,7 @@ struct CTraceFilterLOS_wrapper : CTraceFilterLOS, bp::wrapper< CTraceFilterLOS >
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -980,7 +980,7 @@ struct CTraceFilterLOS_wrapper : CTraceFilterLOS, bp::wrapper< CTraceFilterLOS >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -1010,7 +1010,7 @@ struct CTraceFilterLOS_wrapper : CTraceFilterLOS, bp::wrapper< CTraceFilterLOS >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -1040,7 +1040,7 @@ struct CTraceFilterLOS_wrapper : CTraceFilterLOS, bp::wrapper< CTraceFilterLOS >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity2( boost::python::ptr(pPassEntity2) ) of Class: CTraceFilterSkipTwoEntities\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity2 = this->get_override( "SetPassEntity2" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity2, "SetPassEntity2" );
         if( func_SetPassEntity2.ptr() != Py_None )
             try {
                 func_SetPassEntity2( boost::python::ptr(pPassEntity2) );
@@ -1088,7 +1088,7 @@ struct CTraceFilterNoNPCsOrPlayer_wrapper : CTraceFilterNoNPCsOrPlayer, bp::wrap
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterNoNPCsOrPlayer\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -1118,7 +1118,7 @@ struct CTraceFilterNoNPCsOrPlayer_wrapper : CTraceFilterNoNPCsOrPlayer, bp::wrap
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -1148,7 +1148,7 @@ struct CTraceFilterNoNPCsOrPlayer_wrapper : CTraceFilterNoNPCsOrPlayer, bp::wrap
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -1178,7 +1178,7 @@ struct CTraceFilterNoNPCsOrPlayer_wrapper : CTraceFilterNoNPCsOrPlayer, bp::wrap
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -1226,7 +1226,7 @@ struct CTraceFilterNoUnitsOrPlayer_wrapper : CTraceFilterNoUnitsOrPlayer, bp::wr
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterNoUnitsOrPlayer\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -1256,7 +1256,7 @@ struct CTraceFilterNoUnitsOrPlayer_wrapper : CTraceFilterNoUnitsOrPlayer, bp::wr
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -1286,7 +1286,7 @@ struct CTraceFilterNoUnitsOrPlayer_wrapper : CTraceFilterNoUnitsOrPlayer, bp::wr
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -1316,7 +1316,7 @@ struct CTraceFilterNoUnitsOrPlayer_wrapper : CTraceFilterNoUnitsOrPlayer, bp::wr
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -1364,7 +1364,7 @@ struct CTraceFilterOnlyNPCsAndPlayer_wrapper : CTraceFilterOnlyNPCsAndPlayer, bp
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilterOnlyNPCsAndPlayer\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -1394,7 +1394,7 @@ struct CTraceFilterOnlyNPCsAndPlayer_wrapper : CTraceFilterOnlyNPCsAndPlayer, bp
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterOnlyNPCsAndPlayer\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -1424,7 +1424,7 @@ struct CTraceFilterOnlyNPCsAndPlayer_wrapper : CTraceFilterOnlyNPCsAndPlayer, bp
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -1454,7 +1454,7 @@ struct CTraceFilterOnlyNPCsAndPlayer_wrapper : CTraceFilterOnlyNPCsAndPlayer, bp
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -1502,7 +1502,7 @@ struct CTraceFilterOnlyUnitsAndPlayer_wrapper : CTraceFilterOnlyUnitsAndPlayer,
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilterOnlyUnitsAndPlayer\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -1532,7 +1532,7 @@ struct CTraceFilterOnlyUnitsAndPlayer_wrapper : CTraceFilterOnlyUnitsAndPlayer,
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterOnlyUnitsAndPlayer\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -1562,7 +1562,7 @@ struct CTraceFilterOnlyUnitsAndPlayer_wrapper : CTraceFilterOnlyUnitsAndPlayer,
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -1592,7 +1592,7 @@ struct CTraceFilterOnlyUnitsAndPlayer_wrapper : CTraceFilterOnlyUnitsAndPlayer,
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -1633,7 +1633,7 @@ struct CTraceFilterSimpleClassnameList_wrapper : CTraceFilterSimpleClassnameList
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterSimpleClassnameList\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -1663,7 +1663,7 @@ struct CTraceFilterSimpleClassnameList_wrapper : CTraceFilterSimpleClassnameList
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -1693,7 +1693,7 @@ struct CTraceFilterSimpleClassnameList_wrapper : CTraceFilterSimpleClassnameList
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -1723,7 +1723,7 @@ struct CTraceFilterSimpleClassnameList_wrapper : CTraceFilterSimpleClassnameList
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -1764,7 +1764,7 @@ struct CTraceFilterSimpleList_wrapper : CTraceFilterSimpleList, bp::wrapper< CTr
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterSimpleList\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -1794,7 +1794,7 @@ struct CTraceFilterSimpleList_wrapper : CTraceFilterSimpleList, bp::wrapper< CTr
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -1824,7 +1824,7 @@ struct CTraceFilterSimpleList_wrapper : CTraceFilterSimpleList, bp::wrapper< CTr
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -1854,7 +1854,7 @@ struct CTraceFilterSimpleList_wrapper : CTraceFilterSimpleList, bp::wrapper< CTr
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -1902,7 +1902,7 @@ struct CTraceFilterSkipClassname_wrapper : CTraceFilterSkipClassname, bp::wrappe
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterSkipClassname\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -1932,7 +1932,7 @@ struct CTraceFilterSkipClassname_wrapper : CTraceFilterSkipClassname, bp::wrappe
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -1962,7 +1962,7 @@ struct CTraceFilterSkipClassname_wrapper : CTraceFilterSkipClassname, bp::wrappe
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -1992,7 +1992,7 @@ struct CTraceFilterSkipClassname_wrapper : CTraceFilterSkipClassname, bp::wrappe
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -2040,7 +2040,7 @@ struct CTraceFilterSkipEnemies_wrapper : CTraceFilterSkipEnemies, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterSkipEnemies\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -2070,7 +2070,7 @@ struct CTraceFilterSkipEnemies_wrapper : CTraceFilterSkipEnemies, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -2100,7 +2100,7 @@ struct CTraceFilterSkipEnemies_wrapper : CTraceFilterSkipEnemies, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -2130,7 +2130,7 @@ struct CTraceFilterSkipEnemies_wrapper : CTraceFilterSkipEnemies, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -2178,7 +2178,7 @@ struct CTraceFilterSkipFriendly_wrapper : CTraceFilterSkipFriendly, bp::wrapper<
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterSkipFriendly\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -2208,7 +2208,7 @@ struct CTraceFilterSkipFriendly_wrapper : CTraceFilterSkipFriendly, bp::wrapper<
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -2238,7 +2238,7 @@ struct CTraceFilterSkipFriendly_wrapper : CTraceFilterSkipFriendly, bp::wrapper<
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -2268,7 +2268,7 @@ struct CTraceFilterSkipFriendly_wrapper : CTraceFilterSkipFriendly, bp::wrapper<
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -2316,7 +2316,7 @@ struct CTraceFilterSkipTwoClassnames_wrapper : CTraceFilterSkipTwoClassnames, bp
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterSkipTwoClassnames\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -2346,7 +2346,7 @@ struct CTraceFilterSkipTwoClassnames_wrapper : CTraceFilterSkipTwoClassnames, bp
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -2376,7 +2376,7 @@ struct CTraceFilterSkipTwoClassnames_wrapper : CTraceFilterSkipTwoClassnames, bp
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -2406,7 +2406,7 @@ struct CTraceFilterSkipTwoClassnames_wrapper : CTraceFilterSkipTwoClassnames, bp
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -2454,7 +2454,7 @@ struct CTraceFilterWars_wrapper : CTraceFilterWars, bp::wrapper< CTraceFilterWar
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilterWars\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -2484,7 +2484,7 @@ struct CTraceFilterWars_wrapper : CTraceFilterWars, bp::wrapper< CTraceFilterWar
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterWars\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -2514,7 +2514,7 @@ struct CTraceFilterWars_wrapper : CTraceFilterWars, bp::wrapper< CTraceFilterWar
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -2544,7 +2544,7 @@ struct CTraceFilterWars_wrapper : CTraceFilterWars, bp::wrapper< CTraceFilterWar
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -2592,7 +2592,7 @@ struct CTraceFilterWorldAndPropsOnly_wrapper : CTraceFilterWorldAndPropsOnly, bp
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilterWorldAndPropsOnly\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -2622,7 +2622,7 @@ struct CTraceFilterWorldAndPropsOnly_wrapper : CTraceFilterWorldAndPropsOnly, bp
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pServerEntity), contentsMask ) of Class: CTraceFilterWorldAndPropsOnly\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pServerEntity), contentsMask );
@@ -2670,7 +2670,7 @@ struct CTraceFilterWorldOnly_wrapper : CTraceFilterWorldOnly, bp::wrapper< CTrac
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilterWorldOnly\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -2700,7 +2700,7 @@ struct CTraceFilterWorldOnly_wrapper : CTraceFilterWorldOnly, bp::wrapper< CTrac
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pServerEntity), contentsMask ) of Class: CTraceFilterWorldOnly\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pServerEntity), contentsMask );
@@ -5048,7 +5048,7 @@ struct CTraceFilter_wrapper : CTraceFilter, bp::wrapper< CTraceFilter > {
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -5065,7 +5065,7 @@ struct CTraceFilter_wrapper : CTraceFilter, bp::wrapper< CTraceFilter > {
     }
 
     virtual bool ShouldHitEntity( ::IHandleEntity * pEntity, int contentsMask ){
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         try {
             return func_ShouldHitEntity( boost::python::ptr(pEntity), contentsMask );
         } catch(bp::error_already_set &) {
@@ -5098,7 +5098,7 @@ struct CTraceFilterSimple_wrapper : CTraceFilterSimple, bp::wrapper< CTraceFilte
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -5128,7 +5128,7 @@ struct CTraceFilterSimple_wrapper : CTraceFilterSimple, bp::wrapper< CTraceFilte
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -5158,7 +5158,7 @@ struct CTraceFilterSimple_wrapper : CTraceFilterSimple, bp::wrapper< CTraceFilte
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -5188,7 +5188,7 @@ struct CTraceFilterSimple_wrapper : CTraceFilterSimple, bp::wrapper< CTraceFilte
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -5236,7 +5236,7 @@ struct CPyTraceFilterSimple_wrapper : CPyTraceFilterSimple, bp::wrapper< CPyTrac
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -5266,7 +5266,7 @@ struct CPyTraceFilterSimple_wrapper : CPyTraceFilterSimple, bp::wrapper< CPyTrac
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -5296,7 +5296,7 @@ struct CPyTraceFilterSimple_wrapper : CPyTraceFilterSimple, bp::wrapper< CPyTrac
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -5326,7 +5326,7 @@ struct CPyTraceFilterSimple_wrapper : CPyTraceFilterSimple, bp::wrapper< CPyTrac
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -5374,7 +5374,7 @@ struct CTraceFilterChain_wrapper : CTraceFilterChain, bp::wrapper< CTraceFilterC
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterChain\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -5404,7 +5404,7 @@ struct CTraceFilterChain_wrapper : CTraceFilterChain, bp::wrapper< CTraceFilterC
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -5445,7 +5445,7 @@ struct CTraceFilterEntitiesOnly_wrapper : CTraceFilterEntitiesOnly, bp::wrapper<
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilterEntitiesOnly\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -5462,7 +5462,7 @@ struct CTraceFilterEntitiesOnly_wrapper : CTraceFilterEntitiesOnly, bp::wrapper<
     }
 
     virtual bool ShouldHitEntity( ::IHandleEntity * pEntity, int contentsMask ){
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         try {
             return func_ShouldHitEntity( boost::python::ptr(pEntity), contentsMask );
         } catch(bp::error_already_set &) {
@@ -5502,7 +5502,7 @@ struct CTraceFilterHitAll_wrapper : CTraceFilterHitAll, bp::wrapper< CTraceFilte
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pServerEntity), contentsMask ) of Class: CTraceFilterHitAll\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pServerEntity), contentsMask );
@@ -5532,7 +5532,7 @@ struct CTraceFilterHitAll_wrapper : CTraceFilterHitAll, bp::wrapper< CTraceFilte
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -5580,7 +5580,7 @@ struct CTraceFilterIgnoreTeam_wrapper : CTraceFilterIgnoreTeam, bp::wrapper< CTr
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterIgnoreTeam\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -5610,7 +5610,7 @@ struct CTraceFilterIgnoreTeam_wrapper : CTraceFilterIgnoreTeam, bp::wrapper< CTr
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -5640,7 +5640,7 @@ struct CTraceFilterIgnoreTeam_wrapper : CTraceFilterIgnoreTeam, bp::wrapper< CTr
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -5670,7 +5670,7 @@ struct CTraceFilterIgnoreTeam_wrapper : CTraceFilterIgnoreTeam, bp::wrapper< CTr
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -5718,7 +5718,7 @@ struct CTraceFilterSkipTwoEntities_wrapper : CTraceFilterSkipTwoEntities, bp::wr
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity2( boost::python::ptr(pPassEntity2) ) of Class: CTraceFilterSkipTwoEntities\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity2 = this->get_override( "SetPassEntity2" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity2, "SetPassEntity2" );
         if( func_SetPassEntity2.ptr() != Py_None )
             try {
                 func_SetPassEntity2( boost::python::ptr(pPassEntity2) );
@@ -5748,7 +5748,7 @@ struct CTraceFilterSkipTwoEntities_wrapper : CTraceFilterSkipTwoEntities, bp::wr
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterSkipTwoEntities\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -5778,7 +5778,7 @@ struct CTraceFilterSkipTwoEntities_wrapper : CTraceFilterSkipTwoEntities, bp::wr
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -5808,7 +5808,7 @@ struct CTraceFilterSkipTwoEntities_wrapper : CTraceFilterSkipTwoEntities, bp::wr
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -5838,7 +5838,7 @@ struct CTraceFilterSkipTwoEntities_wrapper : CTraceFilterSkipTwoEntities, bp::wr
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -5886,7 +5886,7 @@ struct CTraceFilterLOS_wrapper : CTraceFilterLOS, bp::wrapper< CTraceFilterLOS >
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterLOS\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -5916,7 +5916,7 @@ struct CTraceFilterLOS_wrapper : CTraceFilterLOS, bp::wrapper< CTraceFilterLOS >
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -5946,7 +5946,7 @@ struct CTraceFilterLOS_wrapper : CTraceFilterLOS, bp::wrapper< CTraceFilterLOS >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -5976,7 +5976,7 @@ struct CTraceFilterLOS_wrapper : CTraceFilterLOS, bp::wrapper< CTraceFilterLOS >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -6006,7 +6006,7 @@ struct CTraceFilterLOS_wrapper : CTraceFilterLOS, bp::wrapper< CTraceFilterLOS >
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity2( boost::python::ptr(pPassEntity2) ) of Class: CTraceFilterSkipTwoEntities\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity2 = this->get_override( "SetPassEntity2" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity2, "SetPassEntity2" );
         if( func_SetPassEntity2.ptr() != Py_None )
             try {
                 func_SetPassEntity2( boost::python::ptr(pPassEntity2) );
@@ -6047,7 +6047,7 @@ struct CTraceFilterMelee_wrapper : CTraceFilterMelee, bp::wrapper< CTraceFilterM
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterMelee\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -6101,7 +6101,7 @@ struct CTraceFilterMelee_wrapper : CTraceFilterMelee, bp::wrapper< CTraceFilterM
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilterEntitiesOnly\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -6155,7 +6155,7 @@ struct CTraceFilterNoNPCsOrPlayer_wrapper : CTraceFilterNoNPCsOrPlayer, bp::wrap
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterNoNPCsOrPlayer\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -6185,7 +6185,7 @@ struct CTraceFilterNoNPCsOrPlayer_wrapper : CTraceFilterNoNPCsOrPlayer, bp::wrap
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -6215,7 +6215,7 @@ struct CTraceFilterNoNPCsOrPlayer_wrapper : CTraceFilterNoNPCsOrPlayer, bp::wrap
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -6245,7 +6245,7 @@ struct CTraceFilterNoNPCsOrPlayer_wrapper : CTraceFilterNoNPCsOrPlayer, bp::wrap
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -6293,7 +6293,7 @@ struct CTraceFilterNoUnitsOrPlayer_wrapper : CTraceFilterNoUnitsOrPlayer, bp::wr
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterNoUnitsOrPlayer\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -6323,7 +6323,7 @@ struct CTraceFilterNoUnitsOrPlayer_wrapper : CTraceFilterNoUnitsOrPlayer, bp::wr
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -6353,7 +6353,7 @@ struct CTraceFilterNoUnitsOrPlayer_wrapper : CTraceFilterNoUnitsOrPlayer, bp::wr
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -6383,7 +6383,7 @@ struct CTraceFilterNoUnitsOrPlayer_wrapper : CTraceFilterNoUnitsOrPlayer, bp::wr
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -6431,7 +6431,7 @@ struct CTraceFilterOnlyNPCsAndPlayer_wrapper : CTraceFilterOnlyNPCsAndPlayer, bp
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilterOnlyNPCsAndPlayer\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -6461,7 +6461,7 @@ struct CTraceFilterOnlyNPCsAndPlayer_wrapper : CTraceFilterOnlyNPCsAndPlayer, bp
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterOnlyNPCsAndPlayer\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -6491,7 +6491,7 @@ struct CTraceFilterOnlyNPCsAndPlayer_wrapper : CTraceFilterOnlyNPCsAndPlayer, bp
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -6521,7 +6521,7 @@ struct CTraceFilterOnlyNPCsAndPlayer_wrapper : CTraceFilterOnlyNPCsAndPlayer, bp
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -6569,7 +6569,7 @@ struct CTraceFilterOnlyUnitsAndPlayer_wrapper : CTraceFilterOnlyUnitsAndPlayer,
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilterOnlyUnitsAndPlayer\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -6599,7 +6599,7 @@ struct CTraceFilterOnlyUnitsAndPlayer_wrapper : CTraceFilterOnlyUnitsAndPlayer,
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterOnlyUnitsAndPlayer\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -6629,7 +6629,7 @@ struct CTraceFilterOnlyUnitsAndPlayer_wrapper : CTraceFilterOnlyUnitsAndPlayer,
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -6659,7 +6659,7 @@ struct CTraceFilterOnlyUnitsAndPlayer_wrapper : CTraceFilterOnlyUnitsAndPlayer,
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -6700,7 +6700,7 @@ struct CTraceFilterSimpleClassnameList_wrapper : CTraceFilterSimpleClassnameList
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterSimpleClassnameList\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -6730,7 +6730,7 @@ struct CTraceFilterSimpleClassnameList_wrapper : CTraceFilterSimpleClassnameList
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -6760,7 +6760,7 @@ struct CTraceFilterSimpleClassnameList_wrapper : CTraceFilterSimpleClassnameList
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -6790,7 +6790,7 @@ struct CTraceFilterSimpleClassnameList_wrapper : CTraceFilterSimpleClassnameList
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -6831,7 +6831,7 @@ struct CTraceFilterSimpleList_wrapper : CTraceFilterSimpleList, bp::wrapper< CTr
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterSimpleList\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -6861,7 +6861,7 @@ struct CTraceFilterSimpleList_wrapper : CTraceFilterSimpleList, bp::wrapper< CTr
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -6891,7 +6891,7 @@ struct CTraceFilterSimpleList_wrapper : CTraceFilterSimpleList, bp::wrapper< CTr
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -6921,7 +6921,7 @@ struct CTraceFilterSimpleList_wrapper : CTraceFilterSimpleList, bp::wrapper< CTr
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -6969,7 +6969,7 @@ struct CTraceFilterSkipClassname_wrapper : CTraceFilterSkipClassname, bp::wrappe
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterSkipClassname\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -6999,7 +6999,7 @@ struct CTraceFilterSkipClassname_wrapper : CTraceFilterSkipClassname, bp::wrappe
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -7029,7 +7029,7 @@ struct CTraceFilterSkipClassname_wrapper : CTraceFilterSkipClassname, bp::wrappe
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -7059,7 +7059,7 @@ struct CTraceFilterSkipClassname_wrapper : CTraceFilterSkipClassname, bp::wrappe
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -7107,7 +7107,7 @@ struct CTraceFilterSkipEnemies_wrapper : CTraceFilterSkipEnemies, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterSkipEnemies\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -7137,7 +7137,7 @@ struct CTraceFilterSkipEnemies_wrapper : CTraceFilterSkipEnemies, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -7167,7 +7167,7 @@ struct CTraceFilterSkipEnemies_wrapper : CTraceFilterSkipEnemies, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -7197,7 +7197,7 @@ struct CTraceFilterSkipEnemies_wrapper : CTraceFilterSkipEnemies, bp::wrapper< C
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -7245,7 +7245,7 @@ struct CTraceFilterSkipFriendly_wrapper : CTraceFilterSkipFriendly, bp::wrapper<
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterSkipFriendly\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -7275,7 +7275,7 @@ struct CTraceFilterSkipFriendly_wrapper : CTraceFilterSkipFriendly, bp::wrapper<
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -7305,7 +7305,7 @@ struct CTraceFilterSkipFriendly_wrapper : CTraceFilterSkipFriendly, bp::wrapper<
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -7335,7 +7335,7 @@ struct CTraceFilterSkipFriendly_wrapper : CTraceFilterSkipFriendly, bp::wrapper<
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -7383,7 +7383,7 @@ struct CTraceFilterSkipTwoClassnames_wrapper : CTraceFilterSkipTwoClassnames, bp
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterSkipTwoClassnames\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -7413,7 +7413,7 @@ struct CTraceFilterSkipTwoClassnames_wrapper : CTraceFilterSkipTwoClassnames, bp
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilter\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -7443,7 +7443,7 @@ struct CTraceFilterSkipTwoClassnames_wrapper : CTraceFilterSkipTwoClassnames, bp
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -7473,7 +7473,7 @@ struct CTraceFilterSkipTwoClassnames_wrapper : CTraceFilterSkipTwoClassnames, bp
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -7521,7 +7521,7 @@ struct CTraceFilterWars_wrapper : CTraceFilterWars, bp::wrapper< CTraceFilterWar
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilterWars\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -7551,7 +7551,7 @@ struct CTraceFilterWars_wrapper : CTraceFilterWars, bp::wrapper< CTraceFilterWar
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask ) of Class: CTraceFilterWars\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pHandleEntity), contentsMask );
@@ -7581,7 +7581,7 @@ struct CTraceFilterWars_wrapper : CTraceFilterWars, bp::wrapper< CTraceFilterWar
         if( py_log_overrides.GetBool() )
             Msg("Calling SetCollisionGroup( iCollisionGroup ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetCollisionGroup = this->get_override( "SetCollisionGroup" );
+        PY_OVERRIDE_LOOKUP( func_SetCollisionGroup, "SetCollisionGroup" );
         if( func_SetCollisionGroup.ptr() != Py_None )
             try {
                 func_SetCollisionGroup( iCollisionGroup );
@@ -7611,7 +7611,7 @@ struct CTraceFilterWars_wrapper : CTraceFilterWars, bp::wrapper< CTraceFilterWar
         if( py_log_overrides.GetBool() )
             Msg("Calling SetPassEntity( boost::python::ptr(pPassEntity) ) of Class: CTraceFilterSimple\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetPassEntity = this->get_override( "SetPassEntity" );
+        PY_OVERRIDE_LOOKUP( func_SetPassEntity, "SetPassEntity" );
         if( func_SetPassEntity.ptr() != Py_None )
             try {
                 func_SetPassEntity( boost::python::ptr(pPassEntity) );
@@ -7659,7 +7659,7 @@ struct CTraceFilterWorldAndPropsOnly_wrapper : CTraceFilterWorldAndPropsOnly, bp
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilterWorldAndPropsOnly\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -7689,7 +7689,7 @@ struct CTraceFilterWorldAndPropsOnly_wrapper : CTraceFilterWorldAndPropsOnly, bp
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pServerEntity), contentsMask ) of Class: CTraceFilterWorldAndPropsOnly\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pServerEntity), contentsMask );
@@ -7737,7 +7737,7 @@ struct CTraceFilterWorldOnly_wrapper : CTraceFilterWorldOnly, bp::wrapper< CTrac
         if( py_log_overrides.GetBool() )
             Msg("Calling GetTraceType(  ) of Class: CTraceFilterWorldOnly\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_GetTraceType = this->get_override( "GetTraceType" );
+        PY_OVERRIDE_LOOKUP( func_GetTraceType, "GetTraceType" );
         if( func_GetTraceType.ptr() != Py_None )
             try {
                 return func_GetTraceType(  );
@@ -7767,7 +7767,7 @@ struct CTraceFilterWorldOnly_wrapper : CTraceFilterWorldOnly, bp::wrapper< CTrac
         if( py_log_overrides.GetBool() )
             Msg("Calling ShouldHitEntity( boost::python::ptr(pServerEntity), contentsMask ) of Class: CTraceFilterWorldOnly\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_ShouldHitEntity = this->get_override( "ShouldHitEntity" );
+        PY_OVERRIDE_LOOKUP( func_ShouldHitEntity, "ShouldHitEntity" );
         if( func_ShouldHitEntity.ptr() != Py_None )
             try {
                 return func_ShouldHitEntity( boost::python::ptr(pServerEntity), contentsMask );
@@ -1185,6 +1185,16 @@ BOOST_PYTHON_MODULE(srcbase){
     
     }
 
+    { //::GetTickMethodStats
+    
+        typedef ::boost::python::tuple ( *GetTickMethodStats_function_type )(  );
+        
+        bp::def( 
+            "GetTickMethodStats"
+            , GetTickMethodStats_function_type( &::GetTickMethodStats ) );
+    
+    }
+
     { //::IsSolid
     
         typedef bool ( *IsSolid_function_type )( ::SolidType_t,int );
@@ -1231,7 +1241,7 @@ BOOST_PYTHON_MODULE(srcbase){
 
     { //::RegisterTickMethod
     
-        typedef void ( *RegisterTickMethod_function_type )( ::boost::python::object,float,bool );
+        typedef int ( *RegisterTickMethod_function_type )( ::boost::python::object,float,bool );
         
         bp::def( 
             "RegisterTickMethod"
@@ -1740,4 +1750,15 @@ BOOST_PYTHON_MODULE(srcbase){
             , ( bp::arg("method") ) );
     
     }
+
+    { //::UnregisterTickMethodByHandle
+    
+        typedef void ( *UnregisterTickMethodByHandle_function_type )( int );
+        
+        bp::def( 
+            "UnregisterTickMethodByHandle"
+            , UnregisterTickMethodByHandle_function_type( &::UnregisterTickMethodByHandle )
+            , ( bp::arg("iHandle") ) );
+    
+    }
 }
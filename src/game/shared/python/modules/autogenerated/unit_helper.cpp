@@ -60,7 +60,7 @@ struct UnitBaseAnimState_wrapper : UnitBaseAnimState, bp::wrapper< UnitBaseAnimS
         if( py_log_overrides.GetBool() )
             Msg("Calling Update( eyeYaw, eyePitch ) of Class: UnitBaseAnimState\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Update = this->get_override( "Update" );
+        PY_OVERRIDE_LOOKUP( func_Update, "Update" );
         if( func_Update.ptr() != Py_None )
             try {
                 func_Update( eyeYaw, eyePitch );
@@ -141,7 +141,7 @@ struct UnitAnimState_wrapper : UnitAnimState, bp::wrapper< UnitAnimState > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnEndSpecificActivity( specificactivity ) of Class: UnitAnimState\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnEndSpecificActivity = this->get_override( "OnEndSpecificActivity" );
+        PY_OVERRIDE_LOOKUP( func_OnEndSpecificActivity, "OnEndSpecificActivity" );
         if( func_OnEndSpecificActivity.ptr() != Py_None )
             try {
                 return func_OnEndSpecificActivity( specificactivity );
@@ -171,7 +171,7 @@ struct UnitAnimState_wrapper : UnitAnimState, bp::wrapper< UnitAnimState > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnNewModel(  ) of Class: UnitAnimState\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnNewModel = this->get_override( "OnNewModel" );
+        PY_OVERRIDE_LOOKUP( func_OnNewModel, "OnNewModel" );
         if( func_OnNewModel.ptr() != Py_None )
             try {
                 func_OnNewModel(  );
@@ -231,7 +231,7 @@ struct UnitBaseLocomotion_wrapper : UnitBaseLocomotion, bp::wrapper< UnitBaseLoc
         if( py_log_overrides.GetBool() )
             Msg("Calling HandleJump(  ) of Class: UnitBaseLocomotion\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_HandleJump = this->get_override( "HandleJump" );
+        PY_OVERRIDE_LOOKUP( func_HandleJump, "HandleJump" );
         if( func_HandleJump.ptr() != Py_None )
             try {
                 func_HandleJump(  );
@@ -279,7 +279,7 @@ struct UnitBaseAirLocomotion_wrapper : UnitBaseAirLocomotion, bp::wrapper< UnitB
         if( py_log_overrides.GetBool() )
             Msg("Calling HandleJump(  ) of Class: UnitBaseLocomotion\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_HandleJump = this->get_override( "HandleJump" );
+        PY_OVERRIDE_LOOKUP( func_HandleJump, "HandleJump" );
         if( func_HandleJump.ptr() != Py_None )
             try {
                 func_HandleJump(  );
@@ -1625,7 +1625,7 @@ struct BaseAnimEventHandler_wrapper : BaseAnimEventHandler, bp::wrapper< BaseAni
     }
 
     virtual void HandleEvent( ::CUnitBase * pUnit, ::animevent_t * event ) {
-        boost::python::override func_HandleEvent = this->get_override( "HandleEvent" );
+        PY_OVERRIDE_LOOKUP( func_HandleEvent, "HandleEvent" );
         if( func_HandleEvent.ptr() != Py_None )
             try {
                 func_HandleEvent( pUnit ? pUnit->GetPyHandle() : bp::object(), event );
@@ -1670,7 +1670,7 @@ struct CAI_Expresser_wrapper : CAI_Expresser, bp::wrapper< CAI_Expresser > {
         if( py_log_overrides.GetBool() )
             Msg("Calling IsSpeaking(  ) of Class: CAI_Expresser\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_IsSpeaking = this->get_override( "IsSpeaking" );
+        PY_OVERRIDE_LOOKUP( func_IsSpeaking, "IsSpeaking" );
         if( func_IsSpeaking.ptr() != Py_None )
             try {
                 return func_IsSpeaking(  );
@@ -1700,7 +1700,7 @@ struct CAI_Expresser_wrapper : CAI_Expresser, bp::wrapper< CAI_Expresser > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnSpeechFinished(  ) of Class: CAI_Expresser\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnSpeechFinished = this->get_override( "OnSpeechFinished" );
+        PY_OVERRIDE_LOOKUP( func_OnSpeechFinished, "OnSpeechFinished" );
         if( func_OnSpeechFinished.ptr() != Py_None )
             try {
                 func_OnSpeechFinished(  );
@@ -1734,7 +1734,7 @@ struct CAI_Expresser_wrapper : CAI_Expresser, bp::wrapper< CAI_Expresser > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SpeakDispatchResponse( boost::ref(concept), boost::python::ptr(response), boost::python::ptr(criteria), boost::python::ptr(filter) ) of Class: CAI_Expresser\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SpeakDispatchResponse = this->get_override( "SpeakDispatchResponse" );
+        PY_OVERRIDE_LOOKUP( func_SpeakDispatchResponse, "SpeakDispatchResponse" );
         if( func_SpeakDispatchResponse.ptr() != Py_None )
             try {
                 return func_SpeakDispatchResponse( boost::ref(concept), boost::python::ptr(response), boost::python::ptr(criteria), boost::python::ptr(filter) );
@@ -1768,7 +1768,7 @@ struct CAI_Expresser_wrapper : CAI_Expresser, bp::wrapper< CAI_Expresser > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SpeakRawSentence( pszSentence, delay, volume, soundlevel, boost::python::ptr(pListener) ) of Class: CAI_Expresser\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SpeakRawSentence = this->get_override( "SpeakRawSentence" );
+        PY_OVERRIDE_LOOKUP( func_SpeakRawSentence, "SpeakRawSentence" );
         if( func_SpeakRawSentence.ptr() != Py_None )
             try {
                 return func_SpeakRawSentence( pszSentence, delay, volume, soundlevel, boost::python::ptr(pListener) );
@@ -1803,7 +1803,7 @@ struct TossGrenadeAnimEventHandler_wrapper : TossGrenadeAnimEventHandler, bp::wr
     }
 
     virtual void HandleEvent( ::CUnitBase * pUnit, ::animevent_t * event ) {
-        boost::python::override func_HandleEvent = this->get_override( "HandleEvent" );
+        PY_OVERRIDE_LOOKUP( func_HandleEvent, "HandleEvent" );
         if( func_HandleEvent.ptr() != Py_None )
             try {
                 func_HandleEvent( pUnit ? pUnit->GetPyHandle() : bp::object(), event );
@@ -1851,7 +1851,7 @@ struct UnitBaseAnimState_wrapper : UnitBaseAnimState, bp::wrapper< UnitBaseAnimS
         if( py_log_overrides.GetBool() )
             Msg("Calling Update( eyeYaw, eyePitch ) of Class: UnitBaseAnimState\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Update = this->get_override( "Update" );
+        PY_OVERRIDE_LOOKUP( func_Update, "Update" );
         if( func_Update.ptr() != Py_None )
             try {
                 func_Update( eyeYaw, eyePitch );
@@ -1932,7 +1932,7 @@ struct UnitAnimState_wrapper : UnitAnimState, bp::wrapper< UnitAnimState > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnEndSpecificActivity( specificactivity ) of Class: UnitAnimState\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnEndSpecificActivity = this->get_override( "OnEndSpecificActivity" );
+        PY_OVERRIDE_LOOKUP( func_OnEndSpecificActivity, "OnEndSpecificActivity" );
         if( func_OnEndSpecificActivity.ptr() != Py_None )
             try {
                 return func_OnEndSpecificActivity( specificactivity );
@@ -1962,7 +1962,7 @@ struct UnitAnimState_wrapper : UnitAnimState, bp::wrapper< UnitAnimState > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnNewModel(  ) of Class: UnitAnimState\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnNewModel = this->get_override( "OnNewModel" );
+        PY_OVERRIDE_LOOKUP( func_OnNewModel, "OnNewModel" );
         if( func_OnNewModel.ptr() != Py_None )
             try {
                 func_OnNewModel(  );
@@ -2022,7 +2022,7 @@ struct UnitBaseLocomotion_wrapper : UnitBaseLocomotion, bp::wrapper< UnitBaseLoc
         if( py_log_overrides.GetBool() )
             Msg("Calling HandleJump(  ) of Class: UnitBaseLocomotion\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_HandleJump = this->get_override( "HandleJump" );
+        PY_OVERRIDE_LOOKUP( func_HandleJump, "HandleJump" );
         if( func_HandleJump.ptr() != Py_None )
             try {
                 func_HandleJump(  );
@@ -2070,7 +2070,7 @@ struct UnitBaseAirLocomotion_wrapper : UnitBaseAirLocomotion, bp::wrapper< UnitB
         if( py_log_overrides.GetBool() )
             Msg("Calling HandleJump(  ) of Class: UnitBaseLocomotion\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_HandleJump = this->get_override( "HandleJump" );
+        PY_OVERRIDE_LOOKUP( func_HandleJump, "HandleJump" );
         if( func_HandleJump.ptr() != Py_None )
             try {
                 func_HandleJump(  );
@@ -2111,7 +2111,7 @@ struct UnitBaseNavigator_wrapper : UnitBaseNavigator, bp::wrapper< UnitBaseNavig
         if( py_log_overrides.GetBool() )
             Msg("Calling CalcMove( boost::ref(MoveCommand), angles, speed ) of Class: UnitBaseNavigator\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_CalcMove = this->get_override( "CalcMove" );
+        PY_OVERRIDE_LOOKUP( func_CalcMove, "CalcMove" );
         if( func_CalcMove.ptr() != Py_None )
             try {
                 func_CalcMove( boost::ref(MoveCommand), angles, speed );
@@ -2141,7 +2141,7 @@ struct UnitBaseNavigator_wrapper : UnitBaseNavigator, bp::wrapper< UnitBaseNavig
         if( py_log_overrides.GetBool() )
             Msg("Calling DrawDebugInfo(  ) of Class: UnitBaseNavigator\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_DrawDebugInfo = this->get_override( "DrawDebugInfo" );
+        PY_OVERRIDE_LOOKUP( func_DrawDebugInfo, "DrawDebugInfo" );
         if( func_DrawDebugInfo.ptr() != Py_None )
             try {
                 func_DrawDebugInfo(  );
@@ -2171,7 +2171,7 @@ struct UnitBaseNavigator_wrapper : UnitBaseNavigator, bp::wrapper< UnitBaseNavig
         if( py_log_overrides.GetBool() )
             Msg("Calling DrawDebugRouteOverlay(  ) of Class: UnitBaseNavigator\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_DrawDebugRouteOverlay = this->get_override( "DrawDebugRouteOverlay" );
+        PY_OVERRIDE_LOOKUP( func_DrawDebugRouteOverlay, "DrawDebugRouteOverlay" );
         if( func_DrawDebugRouteOverlay.ptr() != Py_None )
             try {
                 func_DrawDebugRouteOverlay(  );
@@ -2201,7 +2201,7 @@ struct UnitBaseNavigator_wrapper : UnitBaseNavigator, bp::wrapper< UnitBaseNavig
         if( py_log_overrides.GetBool() )
             Msg("Calling Reset(  ) of Class: UnitBaseNavigator\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Reset = this->get_override( "Reset" );
+        PY_OVERRIDE_LOOKUP( func_Reset, "Reset" );
         if( func_Reset.ptr() != Py_None )
             try {
                 func_Reset(  );
@@ -2231,7 +2231,7 @@ struct UnitBaseNavigator_wrapper : UnitBaseNavigator, bp::wrapper< UnitBaseNavig
         if( py_log_overrides.GetBool() )
             Msg("Calling SetGoal( boost::ref(destination), goaltolerance, goalflags, avoidenemies ) of Class: UnitBaseNavigator\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetGoal = this->get_override( "SetGoal" );
+        PY_OVERRIDE_LOOKUP( func_SetGoal, "SetGoal" );
         if( func_SetGoal.ptr() != Py_None )
             try {
                 return func_SetGoal( boost::ref(destination), goaltolerance, goalflags, avoidenemies );
@@ -2261,7 +2261,7 @@ struct UnitBaseNavigator_wrapper : UnitBaseNavigator, bp::wrapper< UnitBaseNavig
         if( py_log_overrides.GetBool() )
             Msg("Calling SetGoalInRange( boost::ref(destination), maxrange, minrange, goaltolerance, goalflags, avoidenemies ) of Class: UnitBaseNavigator\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetGoalInRange = this->get_override( "SetGoalInRange" );
+        PY_OVERRIDE_LOOKUP( func_SetGoalInRange, "SetGoalInRange" );
         if( func_SetGoalInRange.ptr() != Py_None )
             try {
                 return func_SetGoalInRange( boost::ref(destination), maxrange, minrange, goaltolerance, goalflags, avoidenemies );
@@ -2291,7 +2291,7 @@ struct UnitBaseNavigator_wrapper : UnitBaseNavigator, bp::wrapper< UnitBaseNavig
         if( py_log_overrides.GetBool() )
             Msg("Calling SetGoalTarget( boost::python::ptr(pTarget), goaltolerance, goalflags, avoidenemies ) of Class: UnitBaseNavigator\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetGoalTarget = this->get_override( "SetGoalTarget" );
+        PY_OVERRIDE_LOOKUP( func_SetGoalTarget, "SetGoalTarget" );
         if( func_SetGoalTarget.ptr() != Py_None )
             try {
                 return func_SetGoalTarget( boost::python::ptr(pTarget), goaltolerance, goalflags, avoidenemies );
@@ -2321,7 +2321,7 @@ struct UnitBaseNavigator_wrapper : UnitBaseNavigator, bp::wrapper< UnitBaseNavig
         if( py_log_overrides.GetBool() )
             Msg("Calling SetGoalTargetInRange( boost::python::ptr(pTarget), maxrange, minrange, goaltolerance, goalflags, avoidenemies ) of Class: UnitBaseNavigator\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetGoalTargetInRange = this->get_override( "SetGoalTargetInRange" );
+        PY_OVERRIDE_LOOKUP( func_SetGoalTargetInRange, "SetGoalTargetInRange" );
         if( func_SetGoalTargetInRange.ptr() != Py_None )
             try {
                 return func_SetGoalTargetInRange( boost::python::ptr(pTarget), maxrange, minrange, goaltolerance, goalflags, avoidenemies );
@@ -2351,7 +2351,7 @@ struct UnitBaseNavigator_wrapper : UnitBaseNavigator, bp::wrapper< UnitBaseNavig
         if( py_log_overrides.GetBool() )
             Msg("Calling StopMoving(  ) of Class: UnitBaseNavigator\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_StopMoving = this->get_override( "StopMoving" );
+        PY_OVERRIDE_LOOKUP( func_StopMoving, "StopMoving" );
         if( func_StopMoving.ptr() != Py_None )
             try {
                 func_StopMoving(  );
@@ -2381,7 +2381,7 @@ struct UnitBaseNavigator_wrapper : UnitBaseNavigator, bp::wrapper< UnitBaseNavig
         if( py_log_overrides.GetBool() )
             Msg("Calling Update( boost::ref(mv) ) of Class: UnitBaseNavigator\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Update = this->get_override( "Update" );
+        PY_OVERRIDE_LOOKUP( func_Update, "Update" );
         if( func_Update.ptr() != Py_None )
             try {
                 func_Update( boost::ref(mv) );
@@ -2411,7 +2411,7 @@ struct UnitBaseNavigator_wrapper : UnitBaseNavigator, bp::wrapper< UnitBaseNavig
         if( py_log_overrides.GetBool() )
             Msg("Calling UpdateIdealAngles( boost::ref(MoveCommand), boost::python::ptr(pathdir) ) of Class: UnitBaseNavigator\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_UpdateIdealAngles = this->get_override( "UpdateIdealAngles" );
+        PY_OVERRIDE_LOOKUP( func_UpdateIdealAngles, "UpdateIdealAngles" );
         if( func_UpdateIdealAngles.ptr() != Py_None )
             try {
                 func_UpdateIdealAngles( boost::ref(MoveCommand), boost::python::ptr(pathdir) );
@@ -2452,7 +2452,7 @@ struct UnitBaseAirNavigator_wrapper : UnitBaseAirNavigator, bp::wrapper< UnitBas
         if( py_log_overrides.GetBool() )
             Msg("Calling MoveUpdateWaypoint(  ) of Class: UnitBaseAirNavigator\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_MoveUpdateWaypoint = this->get_override( "MoveUpdateWaypoint" );
+        PY_OVERRIDE_LOOKUP( func_MoveUpdateWaypoint, "MoveUpdateWaypoint" );
         if( func_MoveUpdateWaypoint.ptr() != Py_None )
             try {
                 return func_MoveUpdateWaypoint(  );
@@ -2482,7 +2482,7 @@ struct UnitBaseAirNavigator_wrapper : UnitBaseAirNavigator, bp::wrapper< UnitBas
         if( py_log_overrides.GetBool() )
             Msg("Calling TestRoute( boost::ref(vStartPos), boost::ref(vEndPos) ) of Class: UnitBaseAirNavigator\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_TestRoute = this->get_override( "TestRoute" );
+        PY_OVERRIDE_LOOKUP( func_TestRoute, "TestRoute" );
         if( func_TestRoute.ptr() != Py_None )
             try {
                 return func_TestRoute( boost::ref(vStartPos), boost::ref(vEndPos) );
@@ -2512,7 +2512,7 @@ struct UnitBaseAirNavigator_wrapper : UnitBaseAirNavigator, bp::wrapper< UnitBas
         if( py_log_overrides.GetBool() )
             Msg("Calling Update( boost::ref(mv) ) of Class: UnitBaseAirNavigator\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Update = this->get_override( "Update" );
+        PY_OVERRIDE_LOOKUP( func_Update, "Update" );
         if( func_Update.ptr() != Py_None )
             try {
                 func_Update( boost::ref(mv) );
@@ -2542,7 +2542,7 @@ struct UnitBaseAirNavigator_wrapper : UnitBaseAirNavigator, bp::wrapper< UnitBas
         if( py_log_overrides.GetBool() )
             Msg("Calling CalcMove( boost::ref(MoveCommand), angles, speed ) of Class: UnitBaseNavigator\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_CalcMove = this->get_override( "CalcMove" );
+        PY_OVERRIDE_LOOKUP( func_CalcMove, "CalcMove" );
         if( func_CalcMove.ptr() != Py_None )
             try {
                 func_CalcMove( boost::ref(MoveCommand), angles, speed );
@@ -2572,7 +2572,7 @@ struct UnitBaseAirNavigator_wrapper : UnitBaseAirNavigator, bp::wrapper< UnitBas
         if( py_log_overrides.GetBool() )
             Msg("Calling DrawDebugInfo(  ) of Class: UnitBaseNavigator\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_DrawDebugInfo = this->get_override( "DrawDebugInfo" );
+        PY_OVERRIDE_LOOKUP( func_DrawDebugInfo, "DrawDebugInfo" );
         if( func_DrawDebugInfo.ptr() != Py_None )
             try {
                 func_DrawDebugInfo(  );
@@ -2602,7 +2602,7 @@ struct UnitBaseAirNavigator_wrapper : UnitBaseAirNavigator, bp::wrapper< UnitBas
         if( py_log_overrides.GetBool() )
             Msg("Calling DrawDebugRouteOverlay(  ) of Class: UnitBaseNavigator\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_DrawDebugRouteOverlay = this->get_override( "DrawDebugRouteOverlay" );
+        PY_OVERRIDE_LOOKUP( func_DrawDebugRouteOverlay, "DrawDebugRouteOverlay" );
         if( func_DrawDebugRouteOverlay.ptr() != Py_None )
             try {
                 func_DrawDebugRouteOverlay(  );
@@ -2632,7 +2632,7 @@ struct UnitBaseAirNavigator_wrapper : UnitBaseAirNavigator, bp::wrapper< UnitBas
         if( py_log_overrides.GetBool() )
             Msg("Calling Reset(  ) of Class: UnitBaseNavigator\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_Reset = this->get_override( "Reset" );
+        PY_OVERRIDE_LOOKUP( func_Reset, "Reset" );
         if( func_Reset.ptr() != Py_None )
             try {
                 func_Reset(  );
@@ -2662,7 +2662,7 @@ struct UnitBaseAirNavigator_wrapper : UnitBaseAirNavigator, bp::wrapper< UnitBas
         if( py_log_overrides.GetBool() )
             Msg("Calling SetGoal( boost::ref(destination), goaltolerance, goalflags, avoidenemies ) of Class: UnitBaseNavigator\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetGoal = this->get_override( "SetGoal" );
+        PY_OVERRIDE_LOOKUP( func_SetGoal, "SetGoal" );
         if( func_SetGoal.ptr() != Py_None )
             try {
                 return func_SetGoal( boost::ref(destination), goaltolerance, goalflags, avoidenemies );
@@ -2692,7 +2692,7 @@ struct UnitBaseAirNavigator_wrapper : UnitBaseAirNavigator, bp::wrapper< UnitBas
         if( py_log_overrides.GetBool() )
             Msg("Calling SetGoalInRange( boost::ref(destination), maxrange, minrange, goaltolerance, goalflags, avoidenemies ) of Class: UnitBaseNavigator\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetGoalInRange = this->get_override( "SetGoalInRange" );
+        PY_OVERRIDE_LOOKUP( func_SetGoalInRange, "SetGoalInRange" );
         if( func_SetGoalInRange.ptr() != Py_None )
             try {
                 return func_SetGoalInRange( boost::ref(destination), maxrange, minrange, goaltolerance, goalflags, avoidenemies );
@@ -2722,7 +2722,7 @@ struct UnitBaseAirNavigator_wrapper : UnitBaseAirNavigator, bp::wrapper< UnitBas
         if( py_log_overrides.GetBool() )
             Msg("Calling SetGoalTarget( boost::python::ptr(pTarget), goaltolerance, goalflags, avoidenemies ) of Class: UnitBaseNavigator\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetGoalTarget = this->get_override( "SetGoalTarget" );
+        PY_OVERRIDE_LOOKUP( func_SetGoalTarget, "SetGoalTarget" );
         if( func_SetGoalTarget.ptr() != Py_None )
             try {
                 return func_SetGoalTarget( boost::python::ptr(pTarget), goaltolerance, goalflags, avoidenemies );
@@ -2752,7 +2752,7 @@ struct UnitBaseAirNavigator_wrapper : UnitBaseAirNavigator, bp::wrapper< UnitBas
         if( py_log_overrides.GetBool() )
             Msg("Calling SetGoalTargetInRange( boost::python::ptr(pTarget), maxrange, minrange, goaltolerance, goalflags, avoidenemies ) of Class: UnitBaseNavigator\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SetGoalTargetInRange = this->get_override( "SetGoalTargetInRange" );
+        PY_OVERRIDE_LOOKUP( func_SetGoalTargetInRange, "SetGoalTargetInRange" );
         if( func_SetGoalTargetInRange.ptr() != Py_None )
             try {
                 return func_SetGoalTargetInRange( boost::python::ptr(pTarget), maxrange, minrange, goaltolerance, goalflags, avoidenemies );
@@ -2782,7 +2782,7 @@ struct UnitBaseAirNavigator_wrapper : UnitBaseAirNavigator, bp::wrapper< UnitBas
         if( py_log_overrides.GetBool() )
             Msg("Calling StopMoving(  ) of Class: UnitBaseNavigator\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_StopMoving = this->get_override( "StopMoving" );
+        PY_OVERRIDE_LOOKUP( func_StopMoving, "StopMoving" );
         if( func_StopMoving.ptr() != Py_None )
             try {
                 func_StopMoving(  );
@@ -2812,7 +2812,7 @@ struct UnitBaseAirNavigator_wrapper : UnitBaseAirNavigator, bp::wrapper< UnitBas
         if( py_log_overrides.GetBool() )
             Msg("Calling UpdateIdealAngles( boost::ref(MoveCommand), boost::python::ptr(pathdir) ) of Class: UnitBaseNavigator\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_UpdateIdealAngles = this->get_override( "UpdateIdealAngles" );
+        PY_OVERRIDE_LOOKUP( func_UpdateIdealAngles, "UpdateIdealAngles" );
         if( func_UpdateIdealAngles.ptr() != Py_None )
             try {
                 func_UpdateIdealAngles( boost::ref(MoveCommand), boost::python::ptr(pathdir) );
@@ -2857,7 +2857,7 @@ struct UnitExpresser_wrapper : UnitExpresser, bp::wrapper< UnitExpresser > {
         if( py_log_overrides.GetBool() )
             Msg("Calling IsSpeaking(  ) of Class: CAI_Expresser\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_IsSpeaking = this->get_override( "IsSpeaking" );
+        PY_OVERRIDE_LOOKUP( func_IsSpeaking, "IsSpeaking" );
         if( func_IsSpeaking.ptr() != Py_None )
             try {
                 return func_IsSpeaking(  );
@@ -2887,7 +2887,7 @@ struct UnitExpresser_wrapper : UnitExpresser, bp::wrapper< UnitExpresser > {
         if( py_log_overrides.GetBool() )
             Msg("Calling OnSpeechFinished(  ) of Class: CAI_Expresser\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_OnSpeechFinished = this->get_override( "OnSpeechFinished" );
+        PY_OVERRIDE_LOOKUP( func_OnSpeechFinished, "OnSpeechFinished" );
         if( func_OnSpeechFinished.ptr() != Py_None )
             try {
                 func_OnSpeechFinished(  );
@@ -2921,7 +2921,7 @@ struct UnitExpresser_wrapper : UnitExpresser, bp::wrapper< UnitExpresser > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SpeakDispatchResponse( boost::ref(concept), boost::python::ptr(response), boost::python::ptr(criteria), boost::python::ptr(filter) ) of Class: CAI_Expresser\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SpeakDispatchResponse = this->get_override( "SpeakDispatchResponse" );
+        PY_OVERRIDE_LOOKUP( func_SpeakDispatchResponse, "SpeakDispatchResponse" );
         if( func_SpeakDispatchResponse.ptr() != Py_None )
             try {
                 return func_SpeakDispatchResponse( boost::ref(concept), boost::python::ptr(response), boost::python::ptr(criteria), boost::python::ptr(filter) );
@@ -2955,7 +2955,7 @@ struct UnitExpresser_wrapper : UnitExpresser, bp::wrapper< UnitExpresser > {
         if( py_log_overrides.GetBool() )
             Msg("Calling SpeakRawSentence( pszSentence, delay, volume, soundlevel, boost::python::ptr(pListener) ) of Class: CAI_Expresser\n");
         #endif // _DEBUG/PY_CHECK_LOG_OVERRIDES
-        bp::override func_SpeakRawSentence = this->get_override( "SpeakRawSentence" );
+        PY_OVERRIDE_LOOKUP( func_SpeakRawSentence, "SpeakRawSentence" );
         if( func_SpeakRawSentence.ptr() != Py_None )
             try {
                 return func_SpeakRawSentence( pszSentence, delay, volume, soundlevel, boost::python::ptr(pListener) );
@@ -4739,6 +4739,15 @@ BOOST_PYTHON_MODULE(unit_helper){
                 , DrawDebugRouteOverlay_function_type(&::UnitBaseNavigator::DrawDebugRouteOverlay)
                 , default_DrawDebugRouteOverlay_function_type(&UnitBaseNavigator_wrapper::default_DrawDebugRouteOverlay) );
         
+        }
+        { //::UnitBaseNavigator::IsPathPending
+        
+            typedef bool ( ::UnitBaseNavigator::*IsPathPending_function_type )(  ) ;
+            
+            UnitBaseNavigator_exposer.def( 
+                "IsPathPending"
+                , IsPathPending_function_type( &::UnitBaseNavigator::IsPathPending ) );
+        
         }
         { //::UnitBaseNavigator::RegenerateConsiderList
         
@@ -34,7 +34,9 @@ class SrcBase(GenerateModulePureShared):
         # Tick and per frame method register functions
         mb.free_function('RegisterTickMethod').include()
         mb.free_function('UnregisterTickMethod').include()
+        mb.free_function('UnregisterTickMethodByHandle').include()
         mb.free_function('GetRegisteredTickMethods').include()
+        mb.free_function('GetTickMethodStats').include()
         
         mb.free_function('RegisterPerFrameMethod').include()
         mb.free_function('UnregisterPerFrameMethod').include()
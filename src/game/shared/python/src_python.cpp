@@ -13,6 +13,7 @@
 #include "src_python_entities.h"
 #include "src_python_networkvar.h"
 #include "gamestringpool.h"
+#include "frameobject.h"
 
 #ifdef CLIENT_DLL
 	#include "networkstringtable_clientdll.h"
@@ -41,6 +42,12 @@ unsigned int g_hPythonThreadID;
 	ConVar py_log_overrides("py_log_overrides", "0", FCVAR_REPLICATED);
 #endif
 
+ConVar py_override_cache("py_override_cache", "1", FCVAR_REPLICATED, "Cache which Python classes do not override a wrapped virtual method");
+
+// Bumped each time the interpreter starts or stops, invalidating all override caches
+int g_iPyOverrideCacheGeneration = 1;
+static boost::python::override *s_pPyNoOverride = NULL;
+
 // Global main space
 boost::python::object mainmodule;
 boost::python::object mainnamespace;
@@ -63,6 +70,8 @@ bp::object _physics;
 	boost::python::object _vguicontrols;
 #endif // CLIENT_DLL
 
+bp::object g_pyBaseEntityClass;
+
 static CSrcPython g_SrcPythonSystem;
 
 CSrcPython *SrcPySystem()
@@ -78,6 +87,43 @@ void SysAppendPath( const char *path, bool inclsubdirs = false )
 	SrcPySystem()->SysAppendPath(path, inclsubdirs);
 }
 
+//-----------------------------------------------------------------------------
+// Purpose: Override cache used by the generated wrapper methods
+//-----------------------------------------------------------------------------
+const boost::python::override &SrcPyNoOverride()
+{
+	Assert( s_pPyNoOverride );
+	return *s_pPyNoOverride;
+}
+
+const boost::python::override &CPyOverrideCache::Update( PyObject *pSelf, const boost::python::override &func )
+{
+	if( !pSelf )
+		return func;
+
+	PyTypeObject *pType = Py_TYPE( pSelf );
+	OverrideEntry_t &entry = m_Entries[ HashType( pType ) ];
+	if( func.ptr() != Py_None )
+	{
+		if( entry.m_pType == pType )
+			entry.m_pType = NULL;
+		return func;
+	}
+
+	// Remember the "no override" result, so the cached path can hand out copies of it
+	if( !s_pPyNoOverride )
+		s_pPyNoOverride = new boost::python::override( func );
+
+	// The lookup through the instance assigns a version tag if the type didn't have one yet
+	if( PyType_HasFeature( pType, Py_TPFLAGS_VALID_VERSION_TAG ) )
+	{
+		entry.m_pType = pType;
+		entry.m_iVersionTag = pType->tp_version_tag;
+		entry.m_iGeneration = g_iPyOverrideCacheGeneration;
+	}
+	return func;
+}
+
 #ifdef CLIENT_DLL
 extern void HookPyNetworkCls();
 #endif // CLIENT_DLL
@@ -117,10 +163,16 @@ extern void AppendSharedModules();
 //-----------------------------------------------------------------------------
 // Purpose: 
 //-----------------------------------------------------------------------------
-CSrcPython::CSrcPython()
+CSrcPython::CSrcPython() : m_ProfileStacks( k_eDictCompareTypeCaseSensitive ), m_ProfileSelf( k_eDictCompareTypeCaseSensitive )
 {
 	m_bPythonRunning = false;
 	m_bPythonIsFinalizing = false;
+	m_bProfiling = false;
+
+	m_methodTickHashMap.SetLessFunc( DefLessFunc( long ) );
+	m_iTickMethodOrder = 0;
+	m_iTickMethodsFired = 0;
+	m_fTickMethodsTime = 0.0f;
 
 	double fStartTime = Plat_FloatTime();
 	// Before the python interpreter is initialized, the modules must be appended
@@ -237,6 +289,11 @@ bool CSrcPython::Init( )
 	_entities_misc = Import("_entities_misc");
 	Run( "import _entities" );
 	_entities = Import("_entities");
+#ifdef CLIENT_DLL
+	g_pyBaseEntityClass = _entities.attr("C_BaseEntity");
+#else
+	g_pyBaseEntityClass = _entities.attr("CBaseEntity");
+#endif // CLIENT_DLL
 	unit_helper = Import("unit_helper");
 	_particles = Import("_particles");
 	_physics = Import("_physics");
@@ -304,8 +361,14 @@ void CSrcPython::ExtraShutdown( void )
 	ClearPyGameRules();
 
 	// Make sure these lists don't hold references
+	if( m_bProfiling )
+	{
+		PyEval_SetProfile( NULL, NULL );
+		m_bProfiling = false;
+		PurgeProfile();
+	}
 	m_deleteList.Purge();
-	m_methodTickList.Purge();
+	PurgeTickMethods();
 	m_methodPerFrameList.Purge();
 
 	// Clear modules
@@ -321,6 +384,7 @@ void CSrcPython::ExtraShutdown( void )
 	srcbase = bp::object();
 	_entities_misc = bp::object();
 	_entities = bp::object();
+	g_pyBaseEntityClass = bp::object();
 	unit_helper = bp::object();
 	_particles = bp::object();
 	_physics = bp::object();
@@ -331,6 +395,9 @@ void CSrcPython::ExtraShutdown( void )
 	// Finalize
 	m_bPythonIsFinalizing = true;
 	PyErr_Clear(); // Make sure it does not hold any references...
+	g_iPyOverrideCacheGeneration++;
+	delete s_pPyNoOverride;
+	s_pPyNoOverride = NULL;
 	Py_Finalize();
 #ifdef WIN32
 	PyImport_FreeDynLibraries(); // IMPORTANT, otherwise it will crash.
@@ -491,35 +558,10 @@ void CSrcPython::FrameUpdatePostEntityThink( void )
 	PyEval_RunThreads();  // Force threads to run. TODO: Performance?
 
 	// Update tick methods
-	int i;
-	for(i=m_methodTickList.Count()-1; i>=0; i--)
-	{
-		if( m_methodTickList[i].m_fNextTickTime < gpGlobals->curtime )
-		{
-			try {
-				m_methodTickList[i].method();
-
-				// Method might have removed the method already
-				if( !m_methodTickList.IsValidIndex(i) )
-					continue;
-
-				// Remove tick methods that are not looped (used to call back a function after a set time)
-				if( !m_methodTickList[i].m_bLooped )
-				{
-					m_methodTickList.Remove(i);
-					continue;
-				}
-			} catch( error_already_set & ) {
-				Warning("Unregistering tick method due the following exception (catch exception if you don't want this): \n");
-				PyErr_Print();
-				m_methodTickList.Remove(i);
-				continue;
-			}
-			m_methodTickList[i].m_fNextTickTime = gpGlobals->curtime + m_methodTickList[i].m_fTickSignal;
-		}	
-	}
+	UpdateTickMethods();
 
 	// Update frame methods
+	int i;
 	for(i=m_methodPerFrameList.Count()-1; i>=0; i--)
 	{
 		try {
@@ -874,6 +916,17 @@ void CSrcPython::AddToDelayedUpdateList( EHANDLE hEnt, char *name, bp::object da
 	py_delayed_data_update_list.AddToTail( v );
 }
 
+// Data of the last delayed update of the variable, or None
+bp::object CSrcPython::GetDelayedUpdateData( EHANDLE hEnt, const char *name )
+{
+	for( int i = py_delayed_data_update_list.Count() - 1; i >= 0; i-- )
+	{
+		if( py_delayed_data_update_list[i].hEnt == hEnt && !Q_strcmp( py_delayed_data_update_list[i].name, name ) )
+			return py_delayed_data_update_list[i].data;
+	}
+	return bp::object();
+}
+
 extern ConVar g_debug_pynetworkvar;
 void CSrcPython::CleanupDelayedUpdateList()
 {
@@ -901,53 +954,311 @@ void CSrcPython::CleanupDelayedUpdateList()
 #endif // CLIENT_DLL
 
 //-----------------------------------------------------------------------------
-// 
+// Purpose: Fires all tick methods that are due. The methods are kept in a 
+//			min-heap on their next tick time, so only due methods are touched.
 //-----------------------------------------------------------------------------
-void CSrcPython::RegisterTickMethod( bp::object method, float ticksignal, bool looped )
+void CSrcPython::UpdateTickMethods()
 {
-	int i;
-	for(i=0; i<m_methodTickList.Count(); i++)
+	VPROF_BUDGET( "CSrcPython::UpdateTickMethods", VPROF_BUDGETGROUP_GAME );
+
+	double fStartTime = Plat_FloatTime();
+	int iFired = 0;
+
+	while( m_methodTickHeap.Count() > 0 )
 	{
-		if( m_methodTickList[i].method == method )
+		int iSlot = m_methodTickHeap[0];
+		if( m_methodTickList[iSlot].m_fNextTickTime >= gpGlobals->curtime )
+			break;
+
+		// Reschedule or remove before calling, so the method is free to (un)register 
+		// tick methods (including itself).
+		int iHandle = TickMethodHandle( iSlot );
+		bp::object method = m_methodTickList[iSlot].method;
+		if( m_methodTickList[iSlot].m_bLooped )
 		{
-			PyErr_SetString(PyExc_Exception, "Method already registered" );
+			m_methodTickList[iSlot].m_fNextTickTime = gpGlobals->curtime + m_methodTickList[iSlot].m_fTickSignal;
+			m_methodTickList[iSlot].m_iOrder = m_iTickMethodOrder++;
+			TickHeapDown( 0 );
+		}
+		else
+		{
+			// Not looped (used to call back a function after a set time)
+			RemoveTickMethod( iSlot );
+		}
+
+		iFired++;
+		try {
+			method();
+		} catch( error_already_set & ) {
+			Warning("Unregistering tick method due the following exception (catch exception if you don't want this): \n");
+			PyErr_Print();
+
+			// Method might have removed the method already
+			iSlot = TickMethodSlotFromHandle( iHandle );
+			if( iSlot != -1 )
+				RemoveTickMethod( iSlot );
+		}
+	}
+
+	m_iTickMethodsFired = iFired;
+	m_fTickMethodsTime = Plat_FloatTime() - fStartTime;
+	VPROF_INCREMENT_COUNTER( "PyTickMethods: fired", iFired );
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void CSrcPython::PurgeTickMethods()
+{
+	m_methodTickList.Purge();
+	m_methodTickFreeSlots.Purge();
+	m_methodTickHeap.Purge();
+	m_methodTickHashMap.Purge();
+	m_iTickMethodsFired = 0;
+	m_fTickMethodsTime = 0.0f;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Returns the slot of the registered method comparing equal to method,
+//			or -1. Bound methods are new objects on each access, so this can't 
+//			compare by identity.
+//-----------------------------------------------------------------------------
+int CSrcPython::FindTickMethod( bp::object method, long iHash )
+{
+	unsigned short idx = m_methodTickHashMap.Find( iHash );
+	if( idx == m_methodTickHashMap.InvalidIndex() )
+		return -1;
+
+	for( int iSlot = m_methodTickHashMap[idx]; iSlot != -1; iSlot = m_methodTickList[iSlot].m_iNextSameHash )
+	{
+		if( m_methodTickList[iSlot].method == method )
+			return iSlot;
+	}
+	return -1;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+int CSrcPython::TickMethodSlotFromHandle( int iHandle )
+{
+	int iSlot = iHandle & 0xFFFF;
+	if( iHandle < 0 || !m_methodTickList.IsValidIndex( iSlot ) )
+		return -1;
+	if( m_methodTickList[iSlot].m_iHeapIndex == -1 || m_methodTickList[iSlot].m_iSerial != ( iHandle >> 16 ) )
+		return -1;
+	return iSlot;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void CSrcPython::RemoveTickMethod( int iSlot )
+{
+	py_tick_methods &tickmethod = m_methodTickList[iSlot];
+
+	// Unlink from the hash chain
+	unsigned short idx = m_methodTickHashMap.Find( tickmethod.m_iHash );
+	Assert( idx != m_methodTickHashMap.InvalidIndex() );
+	if( m_methodTickHashMap[idx] == iSlot )
+	{
+		if( tickmethod.m_iNextSameHash == -1 )
+			m_methodTickHashMap.RemoveAt( idx );
+		else
+			m_methodTickHashMap[idx] = tickmethod.m_iNextSameHash;
+	}
+	else
+	{
+		int iPrev = m_methodTickHashMap[idx];
+		while( m_methodTickList[iPrev].m_iNextSameHash != iSlot )
+			iPrev = m_methodTickList[iPrev].m_iNextSameHash;
+		m_methodTickList[iPrev].m_iNextSameHash = tickmethod.m_iNextSameHash;
+	}
+
+	// Remove from the heap by moving the last entry into its place
+	int iHeapIndex = tickmethod.m_iHeapIndex;
+	int iLast = m_methodTickHeap.Count() - 1;
+	if( iHeapIndex != iLast )
+	{
+		TickHeapSwap( iHeapIndex, iLast );
+		m_methodTickHeap.Remove( iLast );
+		TickHeapUp( iHeapIndex );
+		TickHeapDown( iHeapIndex );
+	}
+	else
+	{
+		m_methodTickHeap.Remove( iLast );
+	}
+
+	// Free the slot. Keep the reference alive until the end, so a destructor 
+	// running Python code can't see the slot half freed.
+	bp::object method = tickmethod.method;
+	tickmethod.method = bp::object();
+	tickmethod.m_iHeapIndex = -1;
+	tickmethod.m_iNextSameHash = -1;
+	tickmethod.m_iSerial = ( tickmethod.m_iSerial + 1 ) & 0x7FFF;
+	m_methodTickFreeSlots.AddToTail( iSlot );
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Tick method heap helpers
+//-----------------------------------------------------------------------------
+bool CSrcPython::TickMethodLess( int iSlotA, int iSlotB )
+{
+	const py_tick_methods &a = m_methodTickList[iSlotA];
+	const py_tick_methods &b = m_methodTickList[iSlotB];
+	if( a.m_fNextTickTime != b.m_fNextTickTime )
+		return a.m_fNextTickTime < b.m_fNextTickTime;
+	return a.m_iOrder < b.m_iOrder;
+}
+
+void CSrcPython::TickHeapSwap( int iHeapIndexA, int iHeapIndexB )
+{
+	int iSlotA = m_methodTickHeap[iHeapIndexA];
+	int iSlotB = m_methodTickHeap[iHeapIndexB];
+	m_methodTickHeap[iHeapIndexA] = iSlotB;
+	m_methodTickHeap[iHeapIndexB] = iSlotA;
+	m_methodTickList[iSlotA].m_iHeapIndex = iHeapIndexB;
+	m_methodTickList[iSlotB].m_iHeapIndex = iHeapIndexA;
+}
+
+void CSrcPython::TickHeapUp( int iHeapIndex )
+{
+	while( iHeapIndex > 0 )
+	{
+		int iParent = ( iHeapIndex - 1 ) / 2;
+		if( !TickMethodLess( m_methodTickHeap[iHeapIndex], m_methodTickHeap[iParent] ) )
+			break;
+		TickHeapSwap( iHeapIndex, iParent );
+		iHeapIndex = iParent;
+	}
+}
+
+void CSrcPython::TickHeapDown( int iHeapIndex )
+{
+	int iCount = m_methodTickHeap.Count();
+	for(;;)
+	{
+		int iChild = iHeapIndex * 2 + 1;
+		if( iChild >= iCount )
+			break;
+		if( iChild + 1 < iCount && TickMethodLess( m_methodTickHeap[iChild+1], m_methodTickHeap[iChild] ) )
+			iChild++;
+		if( !TickMethodLess( m_methodTickHeap[iChild], m_methodTickHeap[iHeapIndex] ) )
+			break;
+		TickHeapSwap( iHeapIndex, iChild );
+		iHeapIndex = iChild;
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Registers a method to be called each ticksignal seconds. Returns a
+//			handle which can be passed to UnregisterTickMethodByHandle.
+//-----------------------------------------------------------------------------
+int CSrcPython::RegisterTickMethod( bp::object method, float ticksignal, bool looped )
+{
+	long iHash = PyObject_Hash( method.ptr() );
+	if( iHash == -1 )
+		throw boost::python::error_already_set(); 
+
+	if( FindTickMethod( method, iHash ) != -1 )
+	{
+		PyErr_SetString(PyExc_Exception, "Method already registered" );
+		throw boost::python::error_already_set(); 
+	}
+
+	int iSlot;
+	if( m_methodTickFreeSlots.Count() > 0 )
+	{
+		iSlot = m_methodTickFreeSlots.Tail();
+		m_methodTickFreeSlots.RemoveMultipleFromTail( 1 );
+	}
+	else
+	{
+		if( m_methodTickList.Count() > 0xFFFF )
+		{
+			PyErr_SetString(PyExc_Exception, "Too many tick methods registered" );
 			throw boost::python::error_already_set(); 
 		}
+		iSlot = m_methodTickList.AddToTail();
+		m_methodTickList[iSlot].m_iSerial = 0;
 	}
-	py_tick_methods tickmethod;
+
+	// Negative signals would make the method due again within the same frame
+	py_tick_methods &tickmethod = m_methodTickList[iSlot];
 	tickmethod.method = method;
-	tickmethod.m_fTickSignal = ticksignal;
-	tickmethod.m_fNextTickTime = gpGlobals->curtime + ticksignal;
+	tickmethod.m_fTickSignal = MAX( ticksignal, 0.0f );
+	tickmethod.m_fNextTickTime = gpGlobals->curtime + tickmethod.m_fTickSignal;
 	tickmethod.m_bLooped = looped;
-	m_methodTickList.AddToTail(tickmethod);
+	tickmethod.m_iHash = iHash;
+	tickmethod.m_iOrder = m_iTickMethodOrder++;
+
+	// Link into the hash chain
+	unsigned short idx = m_methodTickHashMap.Find( iHash );
+	if( idx == m_methodTickHashMap.InvalidIndex() )
+	{
+		tickmethod.m_iNextSameHash = -1;
+		m_methodTickHashMap.Insert( iHash, iSlot );
+	}
+	else
+	{
+		tickmethod.m_iNextSameHash = m_methodTickHashMap[idx];
+		m_methodTickHashMap[idx] = iSlot;
+	}
+
+	// Add to the heap
+	tickmethod.m_iHeapIndex = m_methodTickHeap.AddToTail( iSlot );
+	TickHeapUp( tickmethod.m_iHeapIndex );
+
+	return TickMethodHandle( iSlot );
 }
 
 void CSrcPython::UnregisterTickMethod( bp::object method )
 {
-	int i;
-	for(i=0; i<m_methodTickList.Count(); i++)
+	long iHash = PyObject_Hash( method.ptr() );
+	if( iHash == -1 )
+		throw boost::python::error_already_set(); 
+
+	int iSlot = FindTickMethod( method, iHash );
+	if( iSlot == -1 )
 	{
-		if( m_methodTickList[i].method == method )
-		{
-			m_methodTickList.Remove(i);
-			return;
-		}
+		PyErr_SetString(PyExc_Exception, "Method not found" );
+		throw boost::python::error_already_set(); 
 	}
-	PyErr_SetString(PyExc_Exception, "Method not found" );
-	throw boost::python::error_already_set(); 
+	RemoveTickMethod( iSlot );
+}
+
+void CSrcPython::UnregisterTickMethodByHandle( int iHandle )
+{
+	int iSlot = TickMethodSlotFromHandle( iHandle );
+	if( iSlot == -1 )
+	{
+		PyErr_SetString(PyExc_Exception, "Invalid or expired tick method handle" );
+		throw boost::python::error_already_set(); 
+	}
+	RemoveTickMethod( iSlot );
 }
 
 boost::python::list CSrcPython::GetRegisteredTickMethods()
 {
 	boost::python::list methodlist;
 	int i;
-	for(i=0; i<m_methodTickList.Count(); i++)
+	for(i=0; i<m_methodTickHeap.Count(); i++)
 	{
-		methodlist.append(m_methodTickList[i].method);
+		methodlist.append(m_methodTickList[m_methodTickHeap[i]].method);
 	}
 	return methodlist;
 }
 
+//-----------------------------------------------------------------------------
+// Purpose: Returns (registered methods, methods fired last update, seconds 
+//			spent in the fired methods last update)
+//-----------------------------------------------------------------------------
+boost::python::tuple CSrcPython::GetTickMethodStats()
+{
+	return boost::python::make_tuple( m_methodTickHeap.Count(), m_iTickMethodsFired, m_fTickMethodsTime );
+}
+
 void CSrcPython::RegisterPerFrameMethod( bp::object method )
 {
 	int i;
@@ -988,6 +1299,217 @@ boost::python::list CSrcPython::GetRegisteredPerFrameMethods()
 	return methodlist;
 }
 
+#define PY_PROFILE_MAX_DEPTH 128
+#define PY_PROFILE_MAX_STACK 8192
+#define PY_PROFILE_REPORT_COUNT 20
+
+//-----------------------------------------------------------------------------
+// Purpose: Starts sampling the Python call stack of the main thread every 
+//			fInterval seconds of time spent in Python.
+//-----------------------------------------------------------------------------
+bool CSrcPython::StartProfiling( float fInterval )
+{
+	if( m_bProfiling )
+		return false;
+
+	PurgeProfile();
+	m_fProfileInterval = MAX( fInterval, 0.0001f );
+	m_fProfileUntilSample = m_fProfileInterval;
+	m_fProfileStartTime = Plat_FloatTime();
+	m_fProfileLastTime = m_fProfileStartTime;
+	m_bProfileInPython = false;
+	m_bProfiling = true;
+
+	// Only installs the hook for the calling (main) thread
+	PyEval_SetProfile( ProfileFunc, NULL );
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Stops the profiler, writes the collapsed stacks to pFilename (one 
+//			"frame;frame;frame samples" line per stack, as used by flame graph
+//			tools) and prints the functions with the most samples.
+//-----------------------------------------------------------------------------
+bool CSrcPython::StopProfiling( const char *pFilename )
+{
+	if( !m_bProfiling )
+		return false;
+
+	PyEval_SetProfile( NULL, NULL );
+	m_bProfiling = false;
+
+	int i;
+	FileHandle_t fh = filesystem->Open( pFilename, "wt", "MOD" );
+	if( fh )
+	{
+		for( i = m_ProfileStacks.First(); i != m_ProfileStacks.InvalidIndex(); i = m_ProfileStacks.Next( i ) )
+			filesystem->FPrintf( fh, "%s %d\n", m_ProfileStacks.GetElementName( i ), m_ProfileStacks[i] );
+		filesystem->Close( fh );
+	}
+	else
+	{
+		Warning( "Couldn't create %s!\n", pFilename );
+	}
+
+	Msg( "Python profile: %d samples, %.2f of %.2f seconds spent in python, %d stacks written to %s\n", 
+		m_iProfileSamples, m_fProfilePythonTime, Plat_FloatTime() - m_fProfileStartTime, m_ProfileStacks.Count(), pFilename );
+
+	// Print the functions with the most samples as innermost frame
+	CUtlVector< int > reported;
+	while( reported.Count() < PY_PROFILE_REPORT_COUNT )
+	{
+		int iBest = m_ProfileSelf.InvalidIndex();
+		for( i = m_ProfileSelf.First(); i != m_ProfileSelf.InvalidIndex(); i = m_ProfileSelf.Next( i ) )
+		{
+			if( reported.HasElement( i ) )
+				continue;
+			if( iBest == m_ProfileSelf.InvalidIndex() || m_ProfileSelf[i] > m_ProfileSelf[iBest] )
+				iBest = i;
+		}
+		if( iBest == m_ProfileSelf.InvalidIndex() )
+			break;
+		reported.AddToTail( iBest );
+		Msg( "\t%6.2f%%  %6d  %s\n", m_ProfileSelf[iBest] * 100.0f / MAX( m_iProfileSamples, 1 ), m_ProfileSelf[iBest], m_ProfileSelf.GetElementName( iBest ) );
+	}
+
+	PurgeProfile();
+	return fh != NULL;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: 
+//-----------------------------------------------------------------------------
+void CSrcPython::PurgeProfile()
+{
+	m_ProfileStacks.Purge();
+	m_ProfileSelf.Purge();
+	m_iProfileSamples = 0;
+	m_fProfilePythonTime = 0.0;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Profile hook. Only the time between an outermost call and its 
+//			return is counted, so engine time between calls into Python is 
+//			not sampled. Each event checks if a sample is due, and attributes
+//			it to the frame that was running since the previous event.
+//-----------------------------------------------------------------------------
+int CSrcPython::ProfileFunc( PyObject *obj, PyFrameObject *frame, int what, PyObject *arg )
+{
+	CSrcPython *pSystem = &g_SrcPythonSystem;
+	double fCurTime = Plat_FloatTime();
+
+	if( !pSystem->m_bProfileInPython )
+	{
+		pSystem->m_bProfileInPython = true;
+		pSystem->m_fProfileLastTime = fCurTime;
+		return 0;
+	}
+
+	double fElapsed = fCurTime - pSystem->m_fProfileLastTime;
+	pSystem->m_fProfilePythonTime += fElapsed;
+	pSystem->m_fProfileUntilSample -= fElapsed;
+	pSystem->m_fProfileLastTime = fCurTime;
+
+	if( pSystem->m_fProfileUntilSample <= 0.0 )
+	{
+		int iWeight = 1 + (int)( -pSystem->m_fProfileUntilSample / pSystem->m_fProfileInterval );
+		pSystem->m_fProfileUntilSample += iWeight * pSystem->m_fProfileInterval;
+
+		// On a call, the time before it was spent in the caller. On a C 
+		// return, it was spent in the C function.
+		if( what == PyTrace_CALL )
+			pSystem->ProfileSample( frame->f_back, NULL, iWeight );
+		else if( what == PyTrace_C_RETURN || what == PyTrace_C_EXCEPTION )
+			pSystem->ProfileSample( frame, arg, iWeight );
+		else
+			pSystem->ProfileSample( frame, NULL, iWeight );
+
+		// Don't count the time spent sampling
+		pSystem->m_fProfileLastTime = Plat_FloatTime();
+	}
+
+	if( what == PyTrace_RETURN && frame->f_back == NULL )
+		pSystem->m_bProfileInPython = false;
+	return 0;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Frame name in the collapsed stacks
+//-----------------------------------------------------------------------------
+static void PyProfileFrameName( PyFrameObject *frame, PyObject *pCFunc, char *pOut, int iMaxLen )
+{
+	if( pCFunc && PyCFunction_Check( pCFunc ) )
+	{
+		Q_snprintf( pOut, iMaxLen, "%s (builtin)", ((PyCFunctionObject *)pCFunc)->m_ml->ml_name );
+		return;
+	}
+
+	PyCodeObject *pCode = frame->f_code;
+	Q_snprintf( pOut, iMaxLen, "%s (%s:%d)", PyString_AsString( pCode->co_name ), 
+		PyString_AsString( pCode->co_filename ), pCode->co_firstlineno );
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Adds the stack of frame, root first, to the collapsed stacks. If 
+//			pCFunc is set, it's added as innermost frame.
+//-----------------------------------------------------------------------------
+void CSrcPython::ProfileSample( PyFrameObject *frame, PyObject *pCFunc, int iWeight )
+{
+	VPROF_BUDGET( "CSrcPython::ProfileSample", VPROF_BUDGETGROUP_GAME );
+	VPROF_INCREMENT_COUNTER( "PyProfile: samples", iWeight );
+
+	m_iProfileSamples += iWeight;
+
+	PyFrameObject *stack[PY_PROFILE_MAX_DEPTH];
+	int iDepth = 0;
+	for( PyFrameObject *f = frame; f && iDepth < PY_PROFILE_MAX_DEPTH; f = f->f_back )
+		stack[iDepth++] = f;
+
+	char buf[PY_PROFILE_MAX_STACK];
+	char name[512];
+	buf[0] = '\0';
+	if( iDepth == PY_PROFILE_MAX_DEPTH )
+		Q_strncat( buf, "[truncated]", sizeof( buf ), COPY_ALL_CHARACTERS );
+	if( iDepth == 0 )
+		Q_strncat( buf, "[unknown]", sizeof( buf ), COPY_ALL_CHARACTERS );
+
+	for( int i = iDepth - 1; i >= 0; i-- )
+	{
+		PyProfileFrameName( stack[i], NULL, name, sizeof( name ) );
+		if( buf[0] != '\0' )
+			Q_strncat( buf, ";", sizeof( buf ), COPY_ALL_CHARACTERS );
+		Q_strncat( buf, name, sizeof( buf ), COPY_ALL_CHARACTERS );
+	}
+
+	if( pCFunc )
+	{
+		PyProfileFrameName( frame, pCFunc, name, sizeof( name ) );
+		if( buf[0] != '\0' )
+			Q_strncat( buf, ";", sizeof( buf ), COPY_ALL_CHARACTERS );
+		Q_strncat( buf, name, sizeof( buf ), COPY_ALL_CHARACTERS );
+	}
+	else if( iDepth > 0 )
+	{
+		PyProfileFrameName( frame, NULL, name, sizeof( name ) );
+	}
+	else
+	{
+		Q_strncpy( name, "[unknown]", sizeof( name ) );
+	}
+
+	int idx = m_ProfileStacks.Find( buf );
+	if( idx == m_ProfileStacks.InvalidIndex() )
+		m_ProfileStacks.Insert( buf, iWeight );
+	else
+		m_ProfileStacks[idx] += iWeight;
+
+	idx = m_ProfileSelf.Find( name );
+	if( idx == m_ProfileSelf.InvalidIndex() )
+		m_ProfileSelf.Insert( name, iWeight );
+	else
+		m_ProfileSelf[idx] += iWeight;
+}
+
 //-----------------------------------------------------------------------------
 // Commands follow here
 //-----------------------------------------------------------------------------
@@ -1053,6 +1575,52 @@ CON_COMMAND_F( cl_py_reload, "Reload a python module", FCVAR_CHEAT)
 	g_SrcPythonSystem.Reload(args.ArgS());
 }
 
+#ifndef CLIENT_DLL
+CON_COMMAND( py_profile_start, "Start sampling the python call stacks of the main thread\n\tArguments: [sample interval in milliseconds, default 1]")
+#else
+CON_COMMAND_F( cl_py_profile_start, "Start sampling the python call stacks of the main thread\n\tArguments: [sample interval in milliseconds, default 1]", FCVAR_CHEAT)
+#endif // CLIENT_DLL
+{
+	if( !SrcPySystem()->IsPythonRunning() )
+		return;
+#ifndef CLIENT_DLL
+	if( !UTIL_IsCommandIssuedByServerAdmin() )
+		return;
+#endif // CLIENT_DLL
+	float fInterval = args.ArgC() > 1 ? atof( args[1] ) : 1.0f;
+	if( !g_SrcPythonSystem.StartProfiling( fInterval / 1000.0f ) )
+	{
+		Warning( "Python profiler is already running\n" );
+		return;
+	}
+	Msg( "Python profiler started (%.2f ms interval)\n", fInterval );
+}
+
+#ifndef CLIENT_DLL
+CON_COMMAND( py_profile_stop, "Stop the python profiler and write the collapsed stacks (for flame graphs)\n\tArguments: [filename, default pyprofile_server.txt]")
+#else
+CON_COMMAND_F( cl_py_profile_stop, "Stop the python profiler and write the collapsed stacks (for flame graphs)\n\tArguments: [filename, default pyprofile_client.txt]", FCVAR_CHEAT)
+#endif // CLIENT_DLL
+{
+	if( !SrcPySystem()->IsPythonRunning() )
+		return;
+#ifndef CLIENT_DLL
+	if( !UTIL_IsCommandIssuedByServerAdmin() )
+		return;
+#endif // CLIENT_DLL
+	if( !g_SrcPythonSystem.IsProfiling() )
+	{
+		Warning( "Python profiler is not running\n" );
+		return;
+	}
+#ifdef CLIENT_DLL
+	const char *pFilename = args.ArgC() > 1 ? args[1] : "pyprofile_client.txt";
+#else
+	const char *pFilename = args.ArgC() > 1 ? args[1] : "pyprofile_server.txt";
+#endif // CLIENT_DLL
+	g_SrcPythonSystem.StopProfiling( pFilename );
+}
+
 #ifdef CLIENT_DLL
 #include "vgui_controls/Panel.h"
 
@@ -16,6 +16,8 @@
 #endif // DISABLE_PYTHON
 
 #include <boost/python.hpp>
+#include "utlmap.h"
+#include "utldict.h"
 
 extern ConVar g_debug_python;
 #define DbgStrPyMsg if ( !g_debug_python.GetBool() ) ; else DevMsg
@@ -41,6 +43,67 @@ extern unsigned int g_hPythonThreadID;
 	extern ConVar py_log_overrides;
 #endif
 
+//-----------------------------------------------------------------------------
+// Purpose: Per call site cache of get_override results, used by the generated
+//			wrapper methods (see PY_OVERRIDE_LOOKUP). For each Python class that
+//			does not override the method we remember the type together with its
+//			version tag. Python resets the version tag whenever the class or one 
+//			of its bases is modified, so a stale entry never matches.
+//			Methods assigned directly to an instance dict are not seen once the
+//			class is cached.
+//-----------------------------------------------------------------------------
+extern ConVar py_override_cache;
+extern int g_iPyOverrideCacheGeneration;
+
+const boost::python::override &SrcPyNoOverride();
+
+#define PYOVERRIDECACHE_SIZE 16
+
+class CPyOverrideCache
+{
+public:
+	CPyOverrideCache()
+	{
+		memset( m_Entries, 0, sizeof( m_Entries ) );
+	}
+
+	// Returns true if the class of pSelf is known to not override the method
+	bool IsDefault( PyObject *pSelf ) const
+	{
+		if( !pSelf || !py_override_cache.GetBool() )
+			return false;
+		PyTypeObject *pType = Py_TYPE( pSelf );
+		const OverrideEntry_t &entry = m_Entries[ HashType( pType ) ];
+		return entry.m_pType == pType && entry.m_iVersionTag == pType->tp_version_tag &&
+			entry.m_iGeneration == g_iPyOverrideCacheGeneration && 
+			PyType_HasFeature( pType, Py_TPFLAGS_VALID_VERSION_TAG );
+	}
+
+	// Stores the result of a full lookup and passes it through
+	const boost::python::override &Update( PyObject *pSelf, const boost::python::override &func );
+
+private:
+	static int HashType( PyTypeObject *pType )
+	{
+		return ( (uintp)pType >> 5 ) & ( PYOVERRIDECACHE_SIZE - 1 );
+	}
+
+	struct OverrideEntry_t
+	{
+		PyTypeObject *m_pType;
+		unsigned int m_iVersionTag;
+		int m_iGeneration;
+	};
+	OverrideEntry_t m_Entries[PYOVERRIDECACHE_SIZE];
+};
+
+// Declares func as the override of name for the wrapper method in which it is used
+#define PY_OVERRIDE_LOOKUP( func, name )																		\
+	static CPyOverrideCache func##_cache;																		\
+	::boost::python::override func = func##_cache.IsDefault( ::boost::python::detail::wrapper_base_::get_owner( *this ) ) ?	\
+		SrcPyNoOverride() :																						\
+		func##_cache.Update( ::boost::python::detail::wrapper_base_::get_owner( *this ), this->get_override( name ) )
+
 //-----------------------------------------------------------------------------
 // Global variables to some commonly used modules. This way you don't need to import
 // these modules, which saves a lot of time
@@ -63,6 +126,9 @@ extern boost::python::object gamemgr;
 	extern boost::python::object _vguicontrols;
 #endif // CLIENT_DLL
 
+// Commonly used class objects, retrieved once after importing the modules
+extern boost::python::object g_pyBaseEntityClass; // _entities.CBaseEntity or _entities.C_BaseEntity
+
 //-----------------------------------------------------------------------------
 // Purpose: Adding modules to python
 //-----------------------------------------------------------------------------
@@ -316,14 +382,21 @@ public:
 	void CleanupDeleteList();
 	
 	// Tick and PerFrame registered methods
-	void RegisterTickMethod( boost::python::object method, float ticksignal, bool looped=true );
+	int RegisterTickMethod( boost::python::object method, float ticksignal, bool looped=true );
 	void UnregisterTickMethod( boost::python::object method );
+	void UnregisterTickMethodByHandle( int iHandle );
 	boost::python::list GetRegisteredTickMethods();
+	boost::python::tuple GetTickMethodStats();
 
 	void RegisterPerFrameMethod( boost::python::object method );
 	void UnregisterPerFrameMethod( boost::python::object method );
 	boost::python::list GetRegisteredPerFrameMethods();
 
+	// Sampling profiler
+	bool StartProfiling( float fInterval );
+	bool StopProfiling( const char *pFilename );
+	bool IsProfiling() { return m_bProfiling; }
+
 #ifdef CLIENT_DLL
 public:
 	typedef struct py_delayed_data_update {
@@ -334,12 +407,30 @@ public:
 	} py_delayed_data_update;
 
 	void AddToDelayedUpdateList( EHANDLE hEnt, char *name, boost::python::object data, bool callchanged=false );
+	boost::python::object GetDelayedUpdateData( EHANDLE hEnt, const char *name );
 	void CleanupDelayedUpdateList();
 #endif // CLIENT_DLL
 
 private:
 	void					ExecuteAllScriptsInPath( const char *pPath );
 
+	// Tick method scheduling
+	void					UpdateTickMethods();
+	void					PurgeTickMethods();
+	int						FindTickMethod( boost::python::object method, long iHash );
+	int						TickMethodSlotFromHandle( int iHandle );
+	int						TickMethodHandle( int iSlot ) { return ( m_methodTickList[iSlot].m_iSerial << 16 ) | iSlot; }
+	void					RemoveTickMethod( int iSlot );
+	bool					TickMethodLess( int iSlotA, int iSlotB );
+	void					TickHeapSwap( int iHeapIndexA, int iHeapIndexB );
+	void					TickHeapUp( int iHeapIndex );
+	void					TickHeapDown( int iHeapIndex );
+
+	// Sampling profiler
+	static int				ProfileFunc( PyObject *obj, struct _frame *frame, int what, PyObject *arg );
+	void					ProfileSample( struct _frame *frame, PyObject *pCFunc, int iWeight );
+	void					PurgeProfile();
+
 private:
 	bool m_bPythonRunning;
 	bool m_bPythonIsFinalizing;
@@ -361,9 +452,33 @@ private:
 		float m_fNextTickTime;
 		bool m_bLooped;
 		boost::python::object method;
+		long m_iHash;				// Python hash of method
+		int m_iNextSameHash;		// Next slot in the hash chain, -1 if last
+		int m_iHeapIndex;			// Position in m_methodTickHeap, -1 if the slot is free
+		int m_iSerial;				// Bumped each time the slot is freed, invalidates old handles
+		unsigned int m_iOrder;		// Schedule order, breaks ties between equal tick times
 	} py_tick_methods;
-	CUtlVector< py_tick_methods > m_methodTickList;
+	CUtlVector< py_tick_methods > m_methodTickList;		// Slots, indexed by the lower bits of a handle
+	CUtlVector< int > m_methodTickFreeSlots;
+	CUtlVector< int > m_methodTickHeap;					// Min-heap of slots, keyed on next tick time
+	CUtlMap< long, int > m_methodTickHashMap;			// Method hash -> first slot in the chain
+	unsigned int m_iTickMethodOrder;
+	int m_iTickMethodsFired;
+	float m_fTickMethodsTime;
+
 	CUtlVector< boost::python::object > m_methodPerFrameList;
+
+	// Sampling profiler
+	bool m_bProfiling;
+	bool m_bProfileInPython;			// Between an outermost call and its return
+	double m_fProfileInterval;
+	double m_fProfileStartTime;
+	double m_fProfileLastTime;			// Time of the last profile event in Python
+	double m_fProfileUntilSample;		// Python time left until the next sample
+	double m_fProfilePythonTime;
+	int m_iProfileSamples;
+	CUtlDict< int, int > m_ProfileStacks;	// Collapsed stack -> samples
+	CUtlDict< int, int > m_ProfileSelf;		// Function -> samples as innermost frame
 };
 
 CSrcPython *SrcPySystem();
@@ -394,9 +394,11 @@ boost::python::object RelToAbs( const char *path )
 //-----------------------------------------------------------------------------
 // Purpose:
 //-----------------------------------------------------------------------------
-void RegisterTickMethod( boost::python::object method, float ticksignal, bool looped ) { SrcPySystem()->RegisterTickMethod(method, ticksignal, looped); }
+int RegisterTickMethod( boost::python::object method, float ticksignal, bool looped ) { return SrcPySystem()->RegisterTickMethod(method, ticksignal, looped); }
 void UnregisterTickMethod( boost::python::object method ) { SrcPySystem()->UnregisterTickMethod(method); }
+void UnregisterTickMethodByHandle( int iHandle ) { SrcPySystem()->UnregisterTickMethodByHandle(iHandle); }
 boost::python::list GetRegisteredTickMethods() { return SrcPySystem()->GetRegisteredTickMethods(); }
+boost::python::tuple GetTickMethodStats() { return SrcPySystem()->GetTickMethodStats(); }
 
 void RegisterPerFrameMethod( boost::python::object method ) { SrcPySystem()->RegisterPerFrameMethod(method); }
 void UnregisterPerFrameMethod( boost::python::object method ) { SrcPySystem()->UnregisterPerFrameMethod(method); }
@@ -222,9 +222,11 @@ boost::python::object RelToAbs( const char *path );
 //-----------------------------------------------------------------------------
 // Purpose: 
 //-----------------------------------------------------------------------------
-void RegisterTickMethod( boost::python::object method, float ticksignal, bool looped = true );
+int RegisterTickMethod( boost::python::object method, float ticksignal, bool looped = true );
 void UnregisterTickMethod( boost::python::object method );
+void UnregisterTickMethodByHandle( int iHandle );
 boost::python::list GetRegisteredTickMethods();
+boost::python::tuple GetTickMethodStats();
 
 void RegisterPerFrameMethod( boost::python::object method );
 void UnregisterPerFrameMethod( boost::python::object method );
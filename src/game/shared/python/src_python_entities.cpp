@@ -90,10 +90,27 @@ const PyHandle& PyHandle::operator=( const bp::object val )
 	return *this;
 }
 
+//-----------------------------------------------------------------------------
+// Purpose: Looks up name on the entity instance. Returns NULL without an error
+//			set if the instance does not have the attribute.
+//-----------------------------------------------------------------------------
+static PyObject *PyHandleLookupAttr( const bp::object &instance, const char *name )
+{
+	PyObject *pAttr = PyObject_GetAttrString( instance.ptr(), name );
+	if( !pAttr )
+	{
+		if( !PyErr_ExceptionMatches( PyExc_AttributeError ) )
+			bp::throw_error_already_set();
+		PyErr_Clear();
+	}
+	return pAttr;
+}
+
 bp::object PyHandle::GetAttr( const char *name )
 {
-	if( hasattr(PyGet(), name) )
-		return PyGet().attr(name);
+	PyObject *pAttr = PyHandleLookupAttr( PyGet(), name );
+	if( pAttr )
+		return bp::object( bp::handle<>( pAttr ) );
 
 	boost::python::object self = boost::python::object(
 		boost::python::handle<>(
@@ -106,8 +123,10 @@ bp::object PyHandle::GetAttr( const char *name )
 
 bp::object PyHandle::GetAttribute( const char *name )
 {
-	if( hasattr(PyGet(), name) )
-		return PyGet().attr("__getattribute__")(name);
+	PyObject *pAttr = PyHandleLookupAttr( PyGet(), name );
+	if( pAttr )
+		return bp::object( bp::handle<>( pAttr ) );
+
 	boost::python::object self = boost::python::object(
 		boost::python::handle<>(
 		boost::python::borrowed(GetPySelf())
@@ -43,10 +43,18 @@ public:
 	bool NonZero();
 };
 
+// Python entities are accessed through their instance object, instead of wrapping the pointer again
 template< class T >
 inline bp::object CEPyHandle<T>::GetAttr( const char *name )
 {
-	return bp::object(bp::ptr(Get())).attr(name);
+	T *pEnt = Get();
+	if( pEnt )
+	{
+		bp::object instance = pEnt->GetPyInstance();
+		if( instance.ptr() != Py_None )
+			return bp::object( bp::handle<>( PyObject_GetAttrString( instance.ptr(), name ) ) );
+	}
+	return bp::object(bp::ptr(pEnt)).attr(name);
 }
 
 // ? Is using memcmp on a PyObject correct ?
@@ -66,11 +74,7 @@ int CEPyHandle<T>::Cmp( bp::object other )
 	}
 
 	// Check if it is directly a pointer to an entity
-#ifdef CLIENT_DLL
-	if( PyObject_IsInstance(pPyObject, bp::object(_entities.attr("C_BaseEntity")).ptr()) )
-#else
-	if( PyObject_IsInstance(pPyObject, bp::object(_entities.attr("CBaseEntity")).ptr()) )
-#endif // CLIENT_DLL
+	if( PyObject_IsInstance(pPyObject, g_pyBaseEntityClass.ptr()) )
 	{
 		CBaseEntity *pSelf = Get();
 		CBaseEntity *pOther = bp::extract<CBaseEntity *>(other);
@@ -156,11 +160,7 @@ inline int PyHandle::Cmp( bp::object other )
 	}
 
 	// Check if it is directly a pointer to an entity
-#ifdef CLIENT_DLL
-	if( PyObject_IsInstance(pPyObject, bp::object(_entities.attr("C_BaseEntity")).ptr()) )
-#else
-	if( PyObject_IsInstance(pPyObject, bp::object(_entities.attr("CBaseEntity")).ptr()) )
-#endif // CLIENT_DLL
+	if( PyObject_IsInstance(pPyObject, g_pyBaseEntityClass.ptr()) )
 	{
 		CBaseEntity *pSelf = Get();
 #ifdef PYPP_GENERATION // FIXME: Generation compiler doesn't likes this...
@@ -11,17 +11,71 @@
 
 #ifndef CLIENT_DLL
 #include "enginecallback.h"
+#include "tier1/utldict.h"
 #else
 #include "usermessages.h"
+#include "tier1/utlstring.h"
+#include "igamesystem.h"
 #endif // CLIENT_DLL
 
 ConVar g_debug_pynetworkvar("g_debug_pynetworkvar", "0", FCVAR_CHEAT|FCVAR_REPLICATED);
 
 #ifndef CLIENT_DLL
+ConVar g_pynetworkvar_batch("g_pynetworkvar_batch", "1", FCVAR_GAMEDLL, "Sends the changed network variables of an entity in one message, using interned names and element deltas for arrays and dictionaries.");
+
+//-----------------------------------------------------------------------------
+// Purpose: Entities with network variables that still need to be send to 
+//			one or more clients. CheckTransmit only marks the transmitted 
+//			entities, after which only the entities in this list are updated.
+//-----------------------------------------------------------------------------
+static CUtlVector< EHANDLE > s_PyNetworkVarQueue;
+static int s_PyNetworkVarQueueTick = -1;
+static int s_PyNetworkVarTransmitUserIDs[ABSOLUTE_PLAYER_LIMIT];
+
+// Number of calls into python for sending the network variables of a snapshot, shown in VPROF
+static int s_nPyNetworkVarCalls = 0;
+
+static void PyNetworkVarQueueEntity( CBaseEntity *pEnt )
+{
+	if( !pEnt || pEnt->m_bPyNetworkVarsQueued )
+		return;
+	pEnt->m_bPyNetworkVarsQueued = true;
+	s_PyNetworkVarQueue.AddToTail( pEnt );
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Interned network variable names. The client receives the name of 
+//			an id once, after which the id is used in the batched messages.
+//-----------------------------------------------------------------------------
+static CUtlDict< int, unsigned short > s_PyNetworkVarNameIds;
+static CBitVec<PYNETVAR_MAX_NAMEIDS> s_PyNetworkVarKnownNames[ABSOLUTE_PLAYER_LIMIT];
+static int s_PyNetworkVarClientUserIDs[ABSOLUTE_PLAYER_LIMIT];
+
+static int PyNetworkVarInternName( const char *pName )
+{
+	unsigned short idx = s_PyNetworkVarNameIds.Find( pName );
+	if( idx == s_PyNetworkVarNameIds.InvalidIndex() )
+	{
+		// Out of ids, the variable is send the old way
+		if( s_PyNetworkVarNameIds.Count() >= PYNETVAR_MAX_NAMEIDS )
+			return -1;
+		idx = s_PyNetworkVarNameIds.Insert( pName, s_PyNetworkVarNameIds.Count() );
+	}
+	return s_PyNetworkVarNameIds[idx];
+}
+
+static int PyNetworkVarClientUserID( int iClient )
+{
+	edict_t *pEdict = INDEXENT( iClient );
+	return pEdict ? engine->GetPlayerUserId( pEdict ) : -1;
+}
+
+//---------------------------------------------------------------------------------------
 CPythonNetworkVarBase::CPythonNetworkVarBase( bp::object ent, const char *name, bool changedcallback )
-	: m_bChangedCallback(changedcallback)
+	: m_bChangedCallback(changedcallback), m_iVersion(1), m_iFullVersion(1)
 {
 	Q_snprintf(m_Name, PYNETVAR_MAX_NAME, name);
+	m_iNameId = PyNetworkVarInternName( m_Name );
 	CBaseEntity *pEnt = NULL;
 	try {
 		pEnt = bp::extract<CBaseEntity *>(ent);
@@ -33,6 +87,7 @@ CPythonNetworkVarBase::CPythonNetworkVarBase( bp::object ent, const char *name,
 	m_wrefEnt = SrcPySystem()->CreateWeakRef(ent);
 	if( pEnt ) {
 		pEnt->m_utlPyNetworkVars.AddToTail(this);
+		m_hEnt = pEnt;
 	}
 }
 
@@ -52,11 +107,89 @@ CPythonNetworkVarBase::~CPythonNetworkVarBase()
 
 void CPythonNetworkVarBase::NetworkStateChanged( void )
 {
+	m_iVersion++;
+	m_iFullVersion = m_iVersion;
+	m_PlayerUpdateBits.SetAll();
+	PyNetworkVarQueueEntity( m_hEnt );
+}
+
+int CPythonNetworkVarBase::ElementStateChanged( void )
+{
+	m_iVersion++;
 	m_PlayerUpdateBits.SetAll();
+	PyNetworkVarQueueEntity( m_hEnt );
+	return m_iVersion;
 }
 
 void CPythonNetworkVarBase::NetworkVarsUpdateClient( CBaseEntity *pEnt, int iClient ) {}
 
+//-----------------------------------------------------------------------------
+// Purpose: Returns the update bringing the client to the current version. 
+//			Updates are serialized once and reused for all clients at the
+//			same version.
+//-----------------------------------------------------------------------------
+const PyNetworkVarPayload_t *CPythonNetworkVarBase::GetPayload( int iClient, int iUserID )
+{
+	int iClientVersion = 0;
+	if( m_ClientVersions.IsValidIndex( iClient ) && m_ClientVersions[iClient].m_iUserID == iUserID )
+		iClientVersion = m_ClientVersions[iClient].m_iVersion;
+
+	// Deltas can only be applied on top of the last full update
+	int iBaseVersion = iClientVersion >= m_iFullVersion ? iClientVersion : 0;
+
+	PyNetworkVarPayload_t &payload = m_Payloads[iBaseVersion == 0 ? 0 : 1];
+	if( payload.m_iVersion == m_iVersion && payload.m_iBaseVersion == iBaseVersion )
+		return &payload;
+
+	static unsigned char s_PayloadData[MAX_USER_MSG_DATA];
+	bf_write buf( "PyNetworkVarPayload", s_PayloadData, sizeof(s_PayloadData) );
+
+	// The client only applies a delta on the version it was made for
+	buf.WriteUBitVar( m_iVersion );
+	buf.WriteUBitVar( iBaseVersion );
+
+	s_nPyNetworkVarCalls++;
+	if( !WritePayload( buf, iBaseVersion ) )
+		return NULL;
+
+	if( buf.IsOverflowed() )
+	{
+		Warning("Network variable %s does not fit in a message\n", m_Name );
+		return NULL;
+	}
+
+	payload.m_iBaseVersion = iBaseVersion;
+	payload.m_iVersion = m_iVersion;
+	payload.m_nBits = buf.GetNumBitsWritten();
+	payload.m_Data.EnsureCapacity( buf.GetNumBytesWritten() );
+	V_memcpy( payload.m_Data.Base(), s_PayloadData, buf.GetNumBytesWritten() );
+	return &payload;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Forgets the version the client has, so the next update is a full
+//			update.
+//-----------------------------------------------------------------------------
+void CPythonNetworkVarBase::ResendFull( int iClient )
+{
+	if( m_ClientVersions.IsValidIndex( iClient ) )
+		m_ClientVersions[iClient].m_iVersion = 0;
+	m_PlayerUpdateBits.Set( iClient );
+	PyNetworkVarQueueEntity( m_hEnt );
+}
+
+void CPythonNetworkVarBase::SetClientVersion( int iClient, int iUserID, int iVersion )
+{
+	while( m_ClientVersions.Count() <= iClient )
+	{
+		ClientVersion_t &clientversion = m_ClientVersions[m_ClientVersions.AddToTail()];
+		clientversion.m_iUserID = -1;
+		clientversion.m_iVersion = 0;
+	}
+	m_ClientVersions[iClient].m_iUserID = iUserID;
+	m_ClientVersions[iClient].m_iVersion = iVersion;
+}
+
 //---------------------------------------------------------------------------------------
 CPythonNetworkVar::CPythonNetworkVar( bp::object ent, const char *name, bp::object data, 
 									 bool bInitStateChanged, bool changedcallback )
@@ -95,6 +228,17 @@ void CPythonNetworkVar::NetworkVarsUpdateClient( CBaseEntity *pEnt, int iClient
 		return;
 	}
 
+	// Entity handle and name are written in front of the value
+	unsigned char data[MAX_USER_MSG_DATA];
+	bf_write buf( "PyNetworkVar", data, MAX( MAX_USER_MSG_DATA - 4 - Q_strlen(m_Name) - 1, 0 ) );
+	PyWriteElement( write, buf );
+	if( buf.IsOverflowed() )
+	{
+		Warning("Network variable %s does not fit in a message\n", m_Name );
+		m_PlayerUpdateBits.Clear(iClient);
+		return;
+	}
+
 	CRecipientFilter filter;
 	filter.MakeReliable();
 	filter.AddRecipient(iClient);
@@ -104,7 +248,7 @@ void CPythonNetworkVar::NetworkVarsUpdateClient( CBaseEntity *pEnt, int iClient
 		UserMessageBegin( filter, "PyNetworkVar");
 	WRITE_EHANDLE(pEnt);
 	WRITE_STRING(m_Name);
-	PyWriteElement(write);
+	WRITE_BITS(data, buf.GetNumBitsWritten());
 	MessageEnd();
 
 	if( g_debug_pynetworkvar.GetBool() )
@@ -116,6 +260,32 @@ void CPythonNetworkVar::NetworkVarsUpdateClient( CBaseEntity *pEnt, int iClient
 	m_PlayerUpdateBits.Clear(iClient);
 }
 
+bool CPythonNetworkVar::WritePayload( bf_write &buf, int iBaseVersion )
+{
+	bp::object type = __builtin__.attr("type");
+
+	pywrite write;
+	try {
+		PyFillWriteElement(write, Get(), type );
+	} catch(boost::python::error_already_set &) {
+		Warning("Failed to parse data for network variable %s:\n", m_Name );
+		PyErr_Print();
+		PyErr_Clear();
+		Set( bp::object(0) );
+		return false;
+	}
+
+	buf.WriteByte( m_bChangedCallback ? PYNETVAR_VALUE_CC : PYNETVAR_VALUE );
+	PyWriteElement( write, buf );
+
+	if( g_debug_pynetworkvar.GetBool() )
+	{
+		Msg("%f - PyNetworkVar: %s, Value -> ", gpGlobals->curtime, m_Name);
+		PyPrintElement(write);
+	}
+	return true;
+}
+
 //---------------------------------------------------------------------------------------
 CPythonNetworkArray::CPythonNetworkArray( bp::object ent, const char *name, bp::list data, 
 										 bool bInitStateChanged, bool changedcallback )
@@ -124,17 +294,30 @@ CPythonNetworkArray::CPythonNetworkArray( bp::object ent, const char *name, bp::
 	if(data.ptr() != Py_None)
 	{
 		m_dataInternal = data;
+		ResetElementVersions();
 		if( bInitStateChanged )
 			NetworkStateChanged();
 	}
 }
 
+void CPythonNetworkArray::ResetElementVersions()
+{
+	m_ElementVersions.SetCount( bp::len( m_dataInternal ) );
+	for( int i = 0; i < m_ElementVersions.Count(); i++ )
+		m_ElementVersions[i] = 0;
+}
+
 void CPythonNetworkArray::SetItem( int idx, bp::object data )
 {
 	if( data == boost::python::object(m_dataInternal[idx]) )
 		return;
 	m_dataInternal[idx] = data;
-	NetworkStateChanged();
+
+	// Only this element needs to be send to clients having the previous version
+	if( m_ElementVersions.IsValidIndex( idx ) )
+		m_ElementVersions[idx] = ElementStateChanged();
+	else
+		NetworkStateChanged();
 }
 
 bp::object CPythonNetworkArray::GetItem( int idx )
@@ -145,6 +328,7 @@ bp::object CPythonNetworkArray::GetItem( int idx )
 void CPythonNetworkArray::Set( bp::list data )
 {
 	m_dataInternal = data;
+	ResetElementVersions();
 	NetworkStateChanged();
 }
 
@@ -169,6 +353,16 @@ void CPythonNetworkArray::NetworkVarsUpdateClient( CBaseEntity *pEnt, int iClien
 		return;
 	}
 
+	// Entity handle, name and length are written in front of the elements
+	unsigned char data[MAX_USER_MSG_DATA];
+	bf_write buf( "PyNetworkArrayFull", data, MAX( MAX_USER_MSG_DATA - 4 - Q_strlen(m_Name) - 2, 0 ) );
+	if( !PyWriteElements( writelist, buf ) )
+	{
+		Warning("Network variable %s does not fit in a message\n", m_Name );
+		m_PlayerUpdateBits.Clear(iClient);
+		return;
+	}
+
 	CRecipientFilter filter;
 	filter.MakeReliable();
 	filter.AddRecipient(iClient);
@@ -176,10 +370,7 @@ void CPythonNetworkArray::NetworkVarsUpdateClient( CBaseEntity *pEnt, int iClien
 	WRITE_EHANDLE(pEnt);
 	WRITE_STRING(m_Name);
 	WRITE_BYTE(length);
-	for(int i=0; i<writelist.Count(); i++)
-	{
-		PyWriteElement(writelist.Element(i));
-	}
+	WRITE_BITS(data, buf.GetNumBitsWritten());
 	MessageEnd();
 
 	if( g_debug_pynetworkvar.GetBool() )
@@ -195,6 +386,82 @@ void CPythonNetworkArray::NetworkVarsUpdateClient( CBaseEntity *pEnt, int iClien
 	m_PlayerUpdateBits.Clear(iClient);
 }
 
+bool CPythonNetworkArray::WritePayload( bf_write &buf, int iBaseVersion )
+{
+	bp::object type = __builtin__.attr("type");
+
+	int length = 0, i;
+	CUtlVector<int> indices;
+	CUtlVector<pywrite> writelist;
+	try {
+		length = boost::python::len(m_dataInternal);
+
+		// Elements changed since the base version. Send the full array if the 
+		// list was resized from Python or when most elements changed.
+		if( iBaseVersion != 0 && length == m_ElementVersions.Count() )
+		{
+			for( i = 0; i < length; i++ )
+			{
+				if( m_ElementVersions[i] > iBaseVersion )
+					indices.AddToTail(i);
+			}
+			if( indices.Count() * 2 > length )
+				iBaseVersion = 0;
+		}
+		else
+		{
+			iBaseVersion = 0;
+		}
+
+		if( iBaseVersion == 0 )
+		{
+			indices.RemoveAll();
+			for( i = 0; i < length; i++ )
+				indices.AddToTail(i);
+		}
+
+		for( i = 0; i < indices.Count(); i++ )
+		{
+			pywrite write;
+			PyFillWriteElement(write, boost::python::object(m_dataInternal[indices[i]]), type );
+			writelist.AddToTail(write);
+		}
+	} catch(boost::python::error_already_set &) {
+		PyErr_Print();
+		PyErr_Clear();
+		return false;
+	}
+
+	buf.WriteByte( iBaseVersion != 0 ? PYNETVAR_ARRAY_DELTA : PYNETVAR_ARRAY_FULL );
+	buf.WriteShort( length );
+	if( iBaseVersion != 0 )
+	{
+		buf.WriteShort( indices.Count() );
+		for( i = 0; i < writelist.Count(); i++ )
+		{
+			buf.WriteShort( indices[i] );
+			PyWriteElement( writelist[i], buf );
+		}
+	}
+	else
+	{
+		for( i = 0; i < writelist.Count(); i++ )
+			PyWriteElement( writelist[i], buf );
+	}
+
+	if( g_debug_pynetworkvar.GetBool() )
+	{
+		Msg("%f - PyNetworkArray: %s (%s, %d elements)\n", gpGlobals->curtime, m_Name, 
+			iBaseVersion != 0 ? "delta" : "full", writelist.Count());
+		for( i = 0; i < writelist.Count(); i++ )
+		{
+			Msg("\t%d: ", indices[i]);
+			PyPrintElement(writelist.Element(i));
+		}
+	}
+	return true;
+}
+
 //---------------------------------------------------------------------------------------
 CPythonNetworkDict::CPythonNetworkDict( bp::object ent, const char *name, bp::dict data, 
 									   bool bInitStateChanged, bool changedcallback )
@@ -218,7 +485,9 @@ void CPythonNetworkDict::SetItem( bp::object key, bp::object data )
 	}
 
 	m_dataInternal[key] = data;
-	NetworkStateChanged();
+
+	// Only this key needs to be send to clients having the previous version
+	m_KeyVersions[key] = ElementStateChanged();
 }
 
 bp::object CPythonNetworkDict::GetItem( bp::object key )
@@ -229,6 +498,7 @@ bp::object CPythonNetworkDict::GetItem( bp::object key )
 void CPythonNetworkDict::Set( bp::dict data )
 {
 	m_dataInternal = data;
+	m_KeyVersions = bp::dict();
 	NetworkStateChanged();
 }
 
@@ -264,6 +534,16 @@ void CPythonNetworkDict::NetworkVarsUpdateClient( CBaseEntity *pEnt, int iClient
 		return;
 	}
 
+	// Entity handle, name and length are written in front of the elements
+	unsigned char data[MAX_USER_MSG_DATA];
+	bf_write buf( "PyNetworkDictFull", data, MAX( MAX_USER_MSG_DATA - 4 - Q_strlen(m_Name) - 2, 0 ) );
+	if( !PyWriteElements( writelist, buf ) )
+	{
+		Warning("Network variable %s does not fit in a message\n", m_Name );
+		m_PlayerUpdateBits.Clear(iClient);
+		return;
+	}
+
 	CRecipientFilter filter;
 	filter.MakeReliable();
 	filter.AddRecipient(iClient);
@@ -271,10 +551,7 @@ void CPythonNetworkDict::NetworkVarsUpdateClient( CBaseEntity *pEnt, int iClient
 	WRITE_EHANDLE(pEnt);
 	WRITE_STRING(m_Name);
 	WRITE_BYTE((int)length);
-	for(int i=0; i<writelist.Count(); i++)
-	{
-		PyWriteElement(writelist.Element(i));
-	}
+	WRITE_BITS(data, buf.GetNumBitsWritten());
 	MessageEnd();
 
 	if( g_debug_pynetworkvar.GetBool() )
@@ -290,6 +567,248 @@ void CPythonNetworkDict::NetworkVarsUpdateClient( CBaseEntity *pEnt, int iClient
 	m_PlayerUpdateBits.Clear(iClient);
 }
 
+bool CPythonNetworkDict::WritePayload( bf_write &buf, int iBaseVersion )
+{
+	bp::object type = __builtin__.attr("type");
+
+	unsigned long length = 0;
+	int count = 0;
+	CUtlVector<pywrite> writelist;
+	try {
+		length = bp::len(m_dataInternal); 
+
+		// Keys changed since the base version, unless most of the dictionary changed
+		bp::list changedkeys;
+		if( iBaseVersion != 0 )
+		{
+			bp::list keys = m_KeyVersions.keys();
+			unsigned long nKeys = bp::len(keys);
+			for( unsigned long u = 0; u < nKeys; u++ )
+			{
+				int iKeyVersion = bp::extract<int>( bp::object( m_KeyVersions[keys[u]] ) );
+				if( iKeyVersion > iBaseVersion )
+					changedkeys.append(keys[u]);
+			}
+			if( (unsigned long)bp::len(changedkeys) * 2 > length )
+				iBaseVersion = 0;
+		}
+
+		if( iBaseVersion != 0 )
+		{
+			count = bp::len(changedkeys);
+			for( int i = 0; i < count; i++ )
+			{
+				bp::object objectKey = changedkeys[i];
+
+				pywrite write;
+				PyFillWriteElement(write, objectKey, type );
+				writelist.AddToTail(write);
+
+				pywrite write2;
+				PyFillWriteElement(write2, bp::object(m_dataInternal[objectKey]), type );
+				writelist.AddToTail(write2);
+			}
+		}
+		else
+		{
+			bp::object objectKey, objectValue;
+			const bp::object objectKeys = m_dataInternal.iterkeys();
+			const bp::object objectValues = m_dataInternal.itervalues();
+			for( unsigned long u = 0; u < length; u++ )
+			{
+				objectKey = objectKeys.attr( "next" )();
+				objectValue = objectValues.attr( "next" )();
+
+				pywrite write;
+				PyFillWriteElement(write, objectKey, type );
+				writelist.AddToTail(write);
+
+				pywrite write2;
+				PyFillWriteElement(write2, objectValue, type );
+				writelist.AddToTail(write2);
+			}
+			count = (int)length;
+		}
+	} catch(boost::python::error_already_set &) {
+		PyErr_Print();
+		PyErr_Clear();
+		return false;
+	}
+
+	buf.WriteByte( iBaseVersion != 0 ? PYNETVAR_DICT_DELTA : PYNETVAR_DICT_FULL );
+	buf.WriteShort( count );
+	for( int i = 0; i < writelist.Count(); i++ )
+		PyWriteElement( writelist[i], buf );
+
+	if( g_debug_pynetworkvar.GetBool() )
+	{
+		Msg("%f - PyNetworkDict: %s (%s, %d keys)\n", gpGlobals->curtime, m_Name, 
+			iBaseVersion != 0 ? "delta" : "full", count);
+		for( int i = 0; i < writelist.Count(); i++ )
+		{
+			Msg("\t");
+			PyPrintElement(writelist.Element(i));
+		}
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Sends all changed network variables of the entity to the client
+//			in as few messages as possible.
+//-----------------------------------------------------------------------------
+static void PyNetworkVarsUpdateClientBatched( CBaseEntity *pEnt, int iClient, int iUserID )
+{
+	static CUtlVector< CPythonNetworkVarBase * > s_Vars;
+	static CUtlVector< const PyNetworkVarPayload_t * > s_Payloads;
+	s_Vars.RemoveAll();
+	s_Payloads.RemoveAll();
+
+	int i, iEnd;
+
+	// A new player took this slot, so the client does not know any names yet
+	if( s_PyNetworkVarClientUserIDs[iClient] != iUserID )
+	{
+		s_PyNetworkVarClientUserIDs[iClient] = iUserID;
+		s_PyNetworkVarKnownNames[iClient].ClearAll();
+	}
+
+	for( i = 0; i < pEnt->m_utlPyNetworkVars.Count(); i++ )
+	{
+		CPythonNetworkVarBase *pVar = pEnt->m_utlPyNetworkVars.Element(i);
+		if( pVar->m_PlayerUpdateBits.Get(iClient) == false )
+			continue;
+
+		if( pVar->GetNameId() == -1 )
+		{
+			s_nPyNetworkVarCalls++;
+			pVar->NetworkVarsUpdateClient( pEnt, iClient );
+			continue;
+		}
+
+		const PyNetworkVarPayload_t *pPayload = pVar->GetPayload( iClient, iUserID );
+		if( !pPayload )
+			continue;
+
+		s_Vars.AddToTail( pVar );
+		s_Payloads.AddToTail( pPayload );
+	}
+
+	if( s_Vars.Count() == 0 )
+		return;
+
+	CRecipientFilter filter;
+	filter.MakeReliable();
+	filter.AddRecipient(iClient);
+
+	// Send the names the client doesn't know yet. Reliable messages arrive in
+	// order, so the names are known when the batch is parsed.
+	static CUtlVector< CPythonNetworkVarBase * > s_NewNames;
+	s_NewNames.RemoveAll();
+	for( i = 0; i < s_Vars.Count(); i++ )
+	{
+		if( s_PyNetworkVarKnownNames[iClient].IsBitSet( s_Vars[i]->GetNameId() ) )
+			continue;
+		s_PyNetworkVarKnownNames[iClient].Set( s_Vars[i]->GetNameId() );
+		s_NewNames.AddToTail( s_Vars[i] );
+	}
+
+	for( i = 0; i < s_NewNames.Count(); i = iEnd )
+	{
+		int nBytes = 1;
+		for( iEnd = i; iEnd < s_NewNames.Count() && iEnd - i < 255; iEnd++ )
+		{
+			int nNameBytes = 2 + Q_strlen( s_NewNames[iEnd]->GetName() ) + 1;
+			if( iEnd != i && nBytes + nNameBytes > MAX_USER_MSG_DATA )
+				break;
+			nBytes += nNameBytes;
+		}
+
+		UserMessageBegin( filter, "PyNetworkVarNames" );
+		WRITE_BYTE( iEnd - i );
+		for( int j = i; j < iEnd; j++ )
+		{
+			WRITE_SHORT( s_NewNames[j]->GetNameId() );
+			WRITE_STRING( s_NewNames[j]->GetName() );
+		}
+		MessageEnd();
+	}
+
+	// Write the updates, starting a new message when the maximum size is reached.
+	// Each update is at least 48 bits, so the count always fits in a byte.
+	// The size of each update is written, so the client can skip an update it 
+	// can't read.
+	const int nHeaderBits = 32 + 8; // Entity handle and count
+	for( i = 0; i < s_Vars.Count(); i = iEnd )
+	{
+		int nBits = nHeaderBits;
+		for( iEnd = i; iEnd < s_Vars.Count(); iEnd++ )
+		{
+			int nVarBits = 32 + s_Payloads[iEnd]->m_nBits;
+			if( nBits + nVarBits > MAX_USER_MSG_DATA * 8 )
+				break;
+			nBits += nVarBits;
+		}
+
+		if( iEnd == i )
+		{
+			// Too large for a message on its own
+			Warning("Network variable %s does not fit in a message\n", s_Vars[i]->GetName() );
+			s_Vars[i]->m_PlayerUpdateBits.Clear( iClient );
+			iEnd = i + 1;
+			continue;
+		}
+
+		UserMessageBegin( filter, "PyNetworkVarBatch" );
+		WRITE_EHANDLE( pEnt );
+		WRITE_BYTE( iEnd - i );
+		for( int j = i; j < iEnd; j++ )
+		{
+			WRITE_SHORT( s_Vars[j]->GetNameId() );
+			WRITE_SHORT( s_Payloads[j]->m_nBits );
+			WRITE_BITS( s_Payloads[j]->m_Data.Base(), s_Payloads[j]->m_nBits );
+
+			s_Vars[j]->SetClientVersion( iClient, iUserID, s_Payloads[j]->m_iVersion );
+			s_Vars[j]->m_PlayerUpdateBits.Clear( iClient );
+		}
+		MessageEnd();
+
+		if( g_debug_pynetworkvar.GetBool() )
+		{
+			Msg("#%d - %f - PyNetworkVarBatch: %d variables, %d bits\n", pEnt->entindex(), gpGlobals->curtime, iEnd - i, nBits);
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Send by a client which could not apply a batched update, because it 
+//			did not know the name id, could not read the update or did not 
+//			have the data and version the delta was made for.
+//-----------------------------------------------------------------------------
+CON_COMMAND_F( py_networkvar_resend, "Requests a full update of a network variable\n\tArguments: entindex nameid", FCVAR_HIDDEN )
+{
+	CBasePlayer *pPlayer = UTIL_GetCommandClient();
+	if( !pPlayer || args.ArgC() < 3 )
+		return;
+
+	CBaseEntity *pEnt = UTIL_EntityByIndex( atoi( args[1] ) );
+	int iNameId = atoi( args[2] );
+	if( !pEnt || iNameId < 0 || iNameId >= PYNETVAR_MAX_NAMEIDS )
+		return;
+
+	int iClient = pPlayer->entindex();
+
+	// The name is send again together with the update
+	s_PyNetworkVarKnownNames[iClient].Clear( iNameId );
+
+	for( int i = 0; i < pEnt->m_utlPyNetworkVars.Count(); i++ )
+	{
+		CPythonNetworkVarBase *pVar = pEnt->m_utlPyNetworkVars.Element(i);
+		if( pVar->GetNameId() == iNameId )
+			pVar->ResendFull( iClient );
+	}
+}
+
 //---------------------------------------------------------------------------------------
 void PyNetworkVarsUpdateClient( CBaseEntity *pEnt, int iEdict )
 {
@@ -299,12 +818,105 @@ void PyNetworkVarsUpdateClient( CBaseEntity *pEnt, int iEdict )
 	if( pEnt->m_PyNetworkVarsPlayerTransmitBits.Get(iEdict) == false )
 		return;
 
+	int iUserID = PyNetworkVarClientUserID( iEdict );
+
+	if( g_pynetworkvar_batch.GetBool() )
+	{
+		PyNetworkVarsUpdateClientBatched( pEnt, iEdict, iUserID );
+		return;
+	}
+
 	for( int i=0; i<pEnt->m_utlPyNetworkVars.Count(); i++ )
 	{
-		if( pEnt->m_utlPyNetworkVars.Element(i)->m_PlayerUpdateBits.Get(iEdict) == false )
+		CPythonNetworkVarBase *pVar = pEnt->m_utlPyNetworkVars.Element(i);
+		if( pVar->m_PlayerUpdateBits.Get(iEdict) == false )
+			continue;
+
+		s_nPyNetworkVarCalls++;
+		pVar->NetworkVarsUpdateClient(pEnt, iEdict);
+
+		// The client now has the full data, in case batching gets turned on again
+		if( pVar->m_PlayerUpdateBits.Get(iEdict) == false )
+			pVar->SetClientVersion( iEdict, iUserID, pVar->GetVersion() );
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Returns true if one of the network variables of the entity still
+//			needs to be send to a connected client.
+//-----------------------------------------------------------------------------
+static bool PyNetworkVarsHasPendingUpdates( CBaseEntity *pEnt )
+{
+	for( int i = 0; i < pEnt->m_utlPyNetworkVars.Count(); i++ )
+	{
+		CPythonNetworkVarBase *pVar = pEnt->m_utlPyNetworkVars.Element(i);
+		for( int iClient = 1; iClient <= gpGlobals->maxClients; iClient++ )
+		{
+			if( pVar->m_PlayerUpdateBits.Get(iClient) && UTIL_PlayerByIndex( iClient ) )
+				return true;
+		}
+	}
+	return false;
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Called once per tick before the first client is updated. Removes 
+//			entities without pending updates from the queue.
+//-----------------------------------------------------------------------------
+static void PyNetworkVarsPruneQueue()
+{
+	// Counts of the previous snapshot
+	VPROF_INCREMENT_COUNTER( "PyNetworkVars: python calls", s_nPyNetworkVarCalls );
+	VPROF_INCREMENT_COUNTER( "PyNetworkVars: queued entities", s_PyNetworkVarQueue.Count() );
+	s_nPyNetworkVarCalls = 0;
+	s_PyNetworkVarQueueTick = gpGlobals->tickcount;
+
+	for( int i = s_PyNetworkVarQueue.Count() - 1; i >= 0; i-- )
+	{
+		CBaseEntity *pEnt = s_PyNetworkVarQueue[i];
+		if( pEnt && PyNetworkVarsHasPendingUpdates( pEnt ) )
 			continue;
 
-		pEnt->m_utlPyNetworkVars.Element(i)->NetworkVarsUpdateClient(pEnt, iEdict);
+		if( pEnt )
+			pEnt->m_bPyNetworkVarsQueued = false;
+		s_PyNetworkVarQueue.FastRemove( i );
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Sends the pending network variables of the entities transmitted
+//			to the client. Called at the end of CheckTransmit, so all calls
+//			into python for a client are done in one go.
+//-----------------------------------------------------------------------------
+void PyNetworkVarsUpdateTransmitted( CCheckTransmitInfo *pInfo )
+{
+	VPROF_BUDGET( "PyNetworkVarsUpdateTransmitted", VPROF_BUDGETGROUP_GAME );
+
+	if( s_PyNetworkVarQueueTick != gpGlobals->tickcount )
+		PyNetworkVarsPruneQueue();
+
+	int iClient = ENTINDEX( pInfo->m_pClientEnt );
+
+	// Entities are removed from the queue once all connected clients are up to date.
+	// A new client in a slot still has the bits set, so requeue everything with network vars.
+	int iUserID = PyNetworkVarClientUserID( iClient );
+	if( s_PyNetworkVarTransmitUserIDs[iClient] != iUserID )
+	{
+		s_PyNetworkVarTransmitUserIDs[iClient] = iUserID;
+		for( CBaseEntity *pEnt = gEntList.FirstEnt(); pEnt != NULL; pEnt = gEntList.NextEnt( pEnt ) )
+		{
+			if( pEnt->m_utlPyNetworkVars.Count() != 0 )
+				PyNetworkVarQueueEntity( pEnt );
+		}
+	}
+
+	for( int i = 0; i < s_PyNetworkVarQueue.Count(); i++ )
+	{
+		CBaseEntity *pEnt = s_PyNetworkVarQueue[i];
+		if( !pEnt || !pEnt->edict() || !pInfo->m_pTransmitEdict->Get( pEnt->entindex() ) )
+			continue;
+
+		PyNetworkVarsUpdateClient( pEnt, iClient );
 	}
 }
 
@@ -527,6 +1139,246 @@ void __MsgFunc_PyNetworkDictFull( bf_read &msg )
 	}
 }
 
+// ================== Batched ==================
+static CUtlVector< CUtlString > s_PyNetworkVarNames;
+
+void __MsgFunc_PyNetworkVarNames( bf_read &msg )
+{
+	char buf[_MAX_PATH];
+	int count, id, i;
+
+	count = msg.ReadByte();
+	for( i = 0; i < count; i++ )
+	{
+		id = msg.ReadShort();
+		msg.ReadString(buf, _MAX_PATH);
+		if( id < 0 || id >= PYNETVAR_MAX_NAMEIDS )
+			continue;
+
+		if( s_PyNetworkVarNames.Count() <= id )
+			s_PyNetworkVarNames.SetCount( id + 1 );
+		s_PyNetworkVarNames[id] = buf;
+
+		if( g_debug_pynetworkvar.GetBool() )
+		{
+			Msg("Received PyNetworkVar name %d: %s\n", id, buf);
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Current value of a network var, to apply a delta update on. If the 
+//			entity does not exist yet, the value waiting in the delayed update 
+//			list is used.
+//-----------------------------------------------------------------------------
+static bp::object PyNetworkVarGetCurrent( EHANDLE h, const char *pName )
+{
+	if( h == NULL )
+		return SrcPySystem()->GetDelayedUpdateData( h, pName );
+	return bp::getattr( h->GetPyInstance(), pName, bp::object() );
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Version and data of the last batched update applied on each network
+//			variable. A delta is only applied on the data and version it was 
+//			made for. An entity recreated by a full snapshot has new data, so 
+//			it asks for a full update instead.
+//-----------------------------------------------------------------------------
+struct PyNetworkVarApplied_t
+{
+	int m_iSerialNumber;
+	int m_iVersion;
+	bp::object m_Data;
+};
+
+static CUtlMap< unsigned int, PyNetworkVarApplied_t > s_PyNetworkVarApplied( DefLessFunc( unsigned int ) );
+
+static unsigned int PyNetworkVarAppliedKey( EHANDLE h, int id )
+{
+	return (unsigned int)h.GetEntryIndex() * PYNETVAR_MAX_NAMEIDS + id;
+}
+
+static bool PyNetworkVarCanApplyDelta( EHANDLE h, int id, int iBaseVersion, bp::object data )
+{
+	unsigned short idx = s_PyNetworkVarApplied.Find( PyNetworkVarAppliedKey( h, id ) );
+	if( idx == s_PyNetworkVarApplied.InvalidIndex() )
+		return false;
+	const PyNetworkVarApplied_t &applied = s_PyNetworkVarApplied[idx];
+	return applied.m_iSerialNumber == h.GetSerialNumber() && applied.m_iVersion == iBaseVersion && 
+		applied.m_Data.ptr() == data.ptr();
+}
+
+static void PyNetworkVarSetApplied( EHANDLE h, int id, int iVersion, bp::object data )
+{
+	unsigned int key = PyNetworkVarAppliedKey( h, id );
+	unsigned short idx = s_PyNetworkVarApplied.Find( key );
+	if( idx == s_PyNetworkVarApplied.InvalidIndex() )
+		idx = s_PyNetworkVarApplied.Insert( key );
+	PyNetworkVarApplied_t &applied = s_PyNetworkVarApplied[idx];
+	applied.m_iSerialNumber = h.GetSerialNumber();
+	applied.m_iVersion = iVersion;
+	applied.m_Data = data;
+}
+
+class CPyNetworkVarAppliedSystem : public CAutoGameSystem
+{
+public:
+	CPyNetworkVarAppliedSystem() : CAutoGameSystem( "CPyNetworkVarAppliedSystem" ) {}
+
+	virtual void LevelShutdownPostEntity() { s_PyNetworkVarApplied.RemoveAll(); }
+};
+
+static CPyNetworkVarAppliedSystem s_PyNetworkVarAppliedSystem;
+
+//-----------------------------------------------------------------------------
+// Purpose: The server keeps sending deltas against the version it thinks we
+//			have, so ask for a full update if an update can't be applied.
+//-----------------------------------------------------------------------------
+static void PyNetworkVarRequestResend( EHANDLE h, int id )
+{
+	if( g_debug_pynetworkvar.GetBool() )
+	{
+		Msg("#%d Requesting full update of network variable id %d\n", h.GetEntryIndex(), id);
+	}
+	engine->ServerCmd( VarArgs( "py_networkvar_resend %d %d", h.GetEntryIndex(), id ) );
+}
+
+void __MsgFunc_PyNetworkVarBatch( bf_read &msg )
+{
+	int count, id, nBits, iStart, iVersion, iBaseVersion, kind, length, changed, idx, i, j;
+	bool bDelta, bValid;
+	bp::object data;
+
+	// Read entity
+	EHANDLE h = ReadEHANLE( msg );
+
+	count = msg.ReadByte();
+	for( i = 0; i < count; i++ )
+	{
+		id = msg.ReadShort();
+		nBits = msg.ReadShort();
+		iStart = msg.GetNumBitsRead();
+
+		const char *pName = s_PyNetworkVarNames.IsValidIndex( id ) ? s_PyNetworkVarNames[id].Get() : NULL;
+		if( !pName || !pName[0] )
+		{
+			Warning("PyNetworkVarBatch: unknown network variable id %d\n", id);
+			PyNetworkVarRequestResend( h, id );
+			msg.Seek( iStart + nBits );
+			continue;
+		}
+
+		iVersion = msg.ReadUBitVar();
+		iBaseVersion = msg.ReadUBitVar();
+		kind = msg.ReadByte();
+
+		// Deltas update the current list or dictionary in place
+		bDelta = false;
+		bValid = true;
+		try {
+			switch( kind )
+			{
+			case PYNETVAR_VALUE:
+			case PYNETVAR_VALUE_CC:
+				data = PyReadElement(msg);
+				break;
+			case PYNETVAR_ARRAY_FULL:
+				{
+					bp::list list;
+					length = msg.ReadShort();
+					for( j = 0; j < length; j++ )
+						list.append( PyReadElement(msg) );
+					data = list;
+				}
+				break;
+			case PYNETVAR_ARRAY_DELTA:
+				bDelta = true;
+				length = msg.ReadShort();
+				changed = msg.ReadShort();
+				data = PyNetworkVarGetCurrent( h, pName );
+				bValid = PyNetworkVarCanApplyDelta( h, id, iBaseVersion, data ) && 
+					bp::extract<bp::list>(data).check() && bp::len(data) == length;
+				for( j = 0; bValid && j < changed; j++ )
+				{
+					idx = msg.ReadShort();
+					data[idx] = PyReadElement(msg);
+				}
+				break;
+			case PYNETVAR_DICT_FULL:
+				{
+					bp::dict dict;
+					length = msg.ReadShort();
+					for( j = 0; j < length; j++ )
+					{
+						bp::object key = PyReadElement(msg);
+						dict[key] = PyReadElement(msg);
+					}
+					data = dict;
+				}
+				break;
+			case PYNETVAR_DICT_DELTA:
+				bDelta = true;
+				changed = msg.ReadShort();
+				data = PyNetworkVarGetCurrent( h, pName );
+				bValid = PyNetworkVarCanApplyDelta( h, id, iBaseVersion, data ) && 
+					bp::extract<bp::dict>(data).check();
+				for( j = 0; bValid && j < changed; j++ )
+				{
+					bp::object key = PyReadElement(msg);
+					data[key] = PyReadElement(msg);
+				}
+				break;
+			default:
+				Warning("PyNetworkVarBatch: unknown update type %d\n", kind);
+				bValid = false;
+				break;
+			}
+		} catch(boost::python::error_already_set &) {
+			PyErr_Print();
+			PyErr_Clear();
+			bValid = false;
+		}
+
+		// Continue at the next update, also when this one was not read completely
+		msg.Seek( iStart + nBits );
+
+		if( !bValid )
+		{
+			if( g_debug_pynetworkvar.GetBool() )
+			{
+				Msg("#%d Received PyNetworkVarBatch update for %s (version %d, base %d), but could not apply it\n", 
+					h.GetEntryIndex(), pName, iVersion, iBaseVersion);
+			}
+			PyNetworkVarRequestResend( h, id );
+			continue;
+		}
+
+		PyNetworkVarSetApplied( h, id, iVersion, data );
+
+		if( h == NULL )
+		{
+			if( g_debug_pynetworkvar.GetBool() )
+			{
+				Msg("#%d Received PyNetworkVarBatch %s, but entity NULL\n", h.GetEntryIndex(), pName);
+			}
+
+			// Deltas were directly applied on the data in the delayed update list
+			if( !bDelta )
+				SrcPySystem()->AddToDelayedUpdateList( h, (char *)pName, data, kind == PYNETVAR_VALUE_CC );
+			continue;
+		}
+
+		h->PyUpdateNetworkVar( pName, data );
+		if( kind == PYNETVAR_VALUE_CC )
+			h->PyNetworkVarCallChangedCallback( pName );
+
+		if( g_debug_pynetworkvar.GetBool() )
+		{
+			Msg("#%d Received PyNetworkVarBatch %s%s\n", h->entindex(), pName, bDelta ? " (delta)" : "");
+		}
+	}
+}
+
 // register message handler once
 void HookPyNetworkVar() 
 {
@@ -539,6 +1391,8 @@ void HookPyNetworkVar()
 		usermessages->HookMessage( "PyNetworkArrayFull", __MsgFunc_PyNetworkArrayFull );
 		usermessages->HookMessage( "PyNetworkDictElement", __MsgFunc_PyNetworkDictElement );
 		usermessages->HookMessage( "PyNetworkDictFull", __MsgFunc_PyNetworkDictFull );
+		usermessages->HookMessage( "PyNetworkVarNames", __MsgFunc_PyNetworkVarNames );
+		usermessages->HookMessage( "PyNetworkVarBatch", __MsgFunc_PyNetworkVarBatch );
 	}
 #else
 	usermessages->HookMessage( "PyNetworkVar", __MsgFunc_PyNetworkVar );
@@ -546,6 +1400,8 @@ void HookPyNetworkVar()
 	usermessages->HookMessage( "PyNetworkArrayFull", __MsgFunc_PyNetworkArrayFull );
 	usermessages->HookMessage( "PyNetworkDictElement", __MsgFunc_PyNetworkDictElement );
 	usermessages->HookMessage( "PyNetworkDictFull", __MsgFunc_PyNetworkDictFull );
+	usermessages->HookMessage( "PyNetworkVarNames", __MsgFunc_PyNetworkVarNames );
+	usermessages->HookMessage( "PyNetworkVarBatch", __MsgFunc_PyNetworkVarBatch );
 #endif // HL2WARS_ASW_DEV
 }
 
@@ -15,8 +15,37 @@
 
 namespace bp = boost::python;
 
+// Kinds of updates in a batched network var message
+enum PyNetworkVarUpdate_t
+{
+	PYNETVAR_VALUE = 0,
+	PYNETVAR_VALUE_CC,		// Value, calling the changed callback on the client
+	PYNETVAR_ARRAY_FULL,
+	PYNETVAR_ARRAY_DELTA,	// Changed elements of the array
+	PYNETVAR_DICT_FULL,
+	PYNETVAR_DICT_DELTA,	// Changed keys of the dictionary
+};
+
+// Maximum number of interned network var names
+#define PYNETVAR_MAX_NAMEIDS 1024
+
 #ifndef CLIENT_DLL
 #define PYNETVAR_MAX_NAME 260
+
+//-----------------------------------------------------------------------------
+// Purpose: Serialized update of a network var. Written once and copied into
+//			the batched message of each client needing the same update.
+//-----------------------------------------------------------------------------
+struct PyNetworkVarPayload_t
+{
+	PyNetworkVarPayload_t() : m_iBaseVersion(-1), m_iVersion(-1), m_nBits(0) {}
+
+	int m_iBaseVersion;	// Version the client must have for a delta, or 0 for a full update
+	int m_iVersion;		// Version of the network var after applying the update
+	int m_nBits;
+	CUtlMemory< unsigned char > m_Data;
+};
+
 class CPythonNetworkVarBase
 {
 public:
@@ -26,16 +55,48 @@ public:
 	void NetworkStateChanged( void );
 	virtual void NetworkVarsUpdateClient( CBaseEntity *pEnt, int iClient );
 
+	// Batched updates
+	int GetNameId() const { return m_iNameId; }
+	const char *GetName() const { return m_Name; }
+	int GetVersion() const { return m_iVersion; }
+	const PyNetworkVarPayload_t *GetPayload( int iClient, int iUserID );
+	void SetClientVersion( int iClient, int iUserID, int iVersion );
+	void ResendFull( int iClient );
+
 public:
 	// This bit vector contains the players who don't have the most up to date data
 	CBitVec<ABSOLUTE_PLAYER_LIMIT> m_PlayerUpdateBits;
 
 protected:
+	// Marks a single element as changed, so it can be send as delta
+	int ElementStateChanged( void );
+
+	// Writes the update from iBaseVersion (0 for a full update) to the current version
+	virtual bool WritePayload( bf_write &buf, int iBaseVersion ) { return false; }
+
 	char m_Name[PYNETVAR_MAX_NAME];
 	bool m_bChangedCallback;
 
 	bp::object m_wrefEnt;
+	EHANDLE m_hEnt;
 
+	// m_iVersion increases with each change, m_iFullVersion is the version of 
+	// the last change requiring a full update.
+	int m_iVersion;
+	int m_iFullVersion;
+
+private:
+	int m_iNameId;
+
+	struct ClientVersion_t
+	{
+		int m_iUserID;
+		int m_iVersion;
+	};
+	CUtlVector< ClientVersion_t > m_ClientVersions;
+
+	// Last full and last delta update
+	PyNetworkVarPayload_t m_Payloads[2];
 };
 
 class CPythonNetworkVar : CPythonNetworkVarBase
@@ -49,6 +110,9 @@ public:
 	void Set( bp::object data );
 	bp::object Get( void );
 
+protected:
+	virtual bool WritePayload( bf_write &buf, int iBaseVersion );
+
 private:
 	bp::object m_dataInternal;
 };
@@ -66,8 +130,14 @@ public:
 
 	void Set( bp::list data );
 
+protected:
+	virtual bool WritePayload( bf_write &buf, int iBaseVersion );
+
 private:
+	void ResetElementVersions();
+
 	bp::list m_dataInternal;
+	CUtlVector< int > m_ElementVersions;
 };
 
 class CPythonNetworkDict : CPythonNetworkVarBase
@@ -83,11 +153,16 @@ public:
 
 	void Set( bp::dict data );
 
+protected:
+	virtual bool WritePayload( bf_write &buf, int iBaseVersion );
+
 private:
 	bp::dict m_dataInternal;
+	bp::dict m_KeyVersions;
 };
 
 void PyNetworkVarsUpdateClient( CBaseEntity *pEnt, int iEdict );
+void PyNetworkVarsUpdateTransmitted( CCheckTransmitInfo *pInfo );
 
 #else
 	void HookPyNetworkVar();
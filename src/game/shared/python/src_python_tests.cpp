@@ -5,6 +5,8 @@
 // $NoKeywords: $
 //=============================================================================//
 #include "cbase.h"
+#include "src_python_tests.h"
+#include "src_python.h"
 
 // memdbgon must be the last include file in a .cpp file!!!
 #include "tier0/memdbgon.h"
@@ -31,4 +33,76 @@ void SrcPyTest_NCrossProducts( int n, Vector &a, Vector &b )
 	int i;
 	for( i=0; i<n; i++ )
 		Vector c = a.Cross(b);
-}
\ No newline at end of file
+}
+
+//-----------------------------------------------------------------------------
+// Purpose: Microbenchmark for attribute access through entity handles
+//-----------------------------------------------------------------------------
+float SrcPyTest_HandleAttrPerSecond( boost::python::object handle, const char *pAttrName, int n )
+{
+	double fStartTime = Plat_FloatTime();
+	for( int i = 0; i < n; i++ )
+	{
+		PyObject *pAttr = PyObject_GetAttrString( handle.ptr(), pAttrName );
+		if( !pAttr )
+			boost::python::throw_error_already_set();
+		Py_DECREF( pAttr );
+	}
+	double fElapsed = Plat_FloatTime() - fStartTime;
+	return fElapsed > 0.0 ? (float)( n / fElapsed ) : 0.0f;
+}
+
+#ifndef CLIENT_DLL
+CON_COMMAND_F( py_benchmark_handleattr, "Measures attribute access through the handle of a python entity\n\tArguments: [attribute=GetAbsOrigin] [accesses=100000]", FCVAR_CHEAT )
+#else
+CON_COMMAND_F( cl_py_benchmark_handleattr, "Measures attribute access through the handle of a python entity\n\tArguments: [attribute=GetAbsOrigin] [accesses=100000]", FCVAR_CHEAT )
+#endif // CLIENT_DLL
+{
+	if( !SrcPySystem()->IsPythonRunning() )
+		return;
+#ifndef CLIENT_DLL
+	if( !UTIL_IsCommandIssuedByServerAdmin() )
+		return;
+#endif // CLIENT_DLL
+
+	const char *pAttrName = args.ArgC() > 1 ? args[1] : "GetAbsOrigin";
+	int n = args.ArgC() > 2 ? MAX( atoi( args[2] ), 1 ) : 100000;
+
+	// Prefer an entity with a python instance, falling back to the first entity
+	CBaseEntity *pEnt = NULL;
+	CBaseEntity *pFirst = NULL;
+#ifdef CLIENT_DLL
+	for( C_BaseEntity *pIter = ClientEntityList().FirstBaseEntity(); pIter; pIter = ClientEntityList().NextBaseEntity( pIter ) )
+#else
+	for( CBaseEntity *pIter = gEntList.FirstEnt(); pIter; pIter = gEntList.NextEnt( pIter ) )
+#endif // CLIENT_DLL
+	{
+		if( !pFirst )
+			pFirst = pIter;
+		if( pIter->GetPyInstance().ptr() != Py_None )
+		{
+			pEnt = pIter;
+			break;
+		}
+	}
+	if( !pEnt )
+		pEnt = pFirst;
+	if( !pEnt )
+	{
+		Warning( "No entities to test\n" );
+		return;
+	}
+
+	try {
+		boost::python::object instance = pEnt->GetPyInstance();
+		if( instance.ptr() == Py_None )
+			instance = boost::python::object( boost::python::ptr( pEnt ) );
+
+		float fHandle = SrcPyTest_HandleAttrPerSecond( pEnt->GetPyHandle(), pAttrName, n );
+		float fDirect = SrcPyTest_HandleAttrPerSecond( instance, pAttrName, n );
+		Msg( "%s.%s: %.0f accesses/s through the handle, %.0f accesses/s on the entity (%d accesses)\n", 
+			pEnt->GetClassname(), pAttrName, fHandle, fDirect, n );
+	} catch( boost::python::error_already_set & ) {
+		PyErr_Print();
+	}
+}
@@ -12,6 +12,8 @@
 #pragma once
 #endif
 
+#include <boost/python.hpp>
+
 class CBaseEntity;
 
 // Entity Converter related function tests
@@ -20,4 +22,7 @@ void SrcPyTest_EntityArg( CBaseEntity *pEntity );
 // Temp test
 void SrcPyTest_NCrossProducts( int n, Vector &a, Vector &b );
 
+// Attribute access through an entity handle, returns accesses per second
+float SrcPyTest_HandleAttrPerSecond( boost::python::object handle, const char *pAttrName, int n );
+
 #endif // SRCPYTHON_TESTS_H
\ No newline at end of file
@@ -159,44 +159,69 @@ void PyFillWriteElement( pywrite &w, bp::object data, bp::object type )
 	}
 }
 
-void PyWriteElement( pywrite &w )
+//-----------------------------------------------------------------------------
+// Purpose: Writes the element into a buffer. Used for data which is serialized
+//			once and send to multiple clients.
+//-----------------------------------------------------------------------------
+void PyWriteElement( pywrite &w, bf_write &buf )
 {
-	WRITE_BYTE(w.type);
+	buf.WriteByte(w.type);
 	switch(w.type)
 	{
 	case PYTYPE_INT:
-		WRITE_LONG(w.writeint);
+		buf.WriteLong(w.writeint);
 		break;
 	case PYTYPE_FLOAT:
-		WRITE_FLOAT(w.writefloat);
+		buf.WriteFloat(w.writefloat);
 		break;
 	case PYTYPE_STRING:
-		WRITE_STRING(w.writestr);
+		buf.WriteString(w.writestr);
 		break;
 	case PYTYPE_BOOL:
-		WRITE_BYTE(w.writebool);
+		buf.WriteByte(w.writebool);
 		break;
 	case PYTYPE_VECTOR:
 	case PYTYPE_QANGLE:
-		WRITE_FLOAT(w.writevector[0]);
-		WRITE_FLOAT(w.writevector[1]);
-		WRITE_FLOAT(w.writevector[2]);
+		buf.WriteFloat(w.writevector[0]);
+		buf.WriteFloat(w.writevector[1]);
+		buf.WriteFloat(w.writevector[2]);
 		break;
 	case PYTYPE_LIST:
 	case PYTYPE_DICT:
 	case PYTYPE_TUPLE:
-		WRITE_SHORT(w.writelist.Count());
+		buf.WriteShort(w.writelist.Count());
 		for( int i = 0; i < w.writelist.Count(); i++ )
-			PyWriteElement( w.writelist[i] );
+			PyWriteElement( w.writelist[i], buf );
 		break;
 	case PYTYPE_NONE:
 		break;
 	case PYTYPE_HANDLE:
-		WRITE_EHANDLE(w.writehandle);
+		// Same encoding as WRITE_EHANDLE
+		if( w.writehandle.Get() )
+		{
+			int iSerialNum = w.writehandle.GetSerialNumber() & (1 << NUM_NETWORKED_EHANDLE_SERIAL_NUMBER_BITS) - 1;
+			buf.WriteLong( w.writehandle.GetEntryIndex() | (iSerialNum << MAX_EDICT_BITS) );
+		}
+		else
+		{
+			buf.WriteLong( INVALID_NETWORKED_EHANDLE_VALUE );
+		}
 		break;
 	}
 }
 
+//-----------------------------------------------------------------------------
+// Purpose: Writes the elements into a buffer. Returns false if they do not 
+//			fit, in which case no message should be send at all. Messages are
+//			serialized before they are started, so they are never truncated.
+//-----------------------------------------------------------------------------
+bool PyWriteElements( CUtlVector< pywrite > &writelist, bf_write &buf )
+{
+	for( int i = 0; i < writelist.Count(); i++ )
+		PyWriteElement( writelist[i], buf );
+	return !buf.IsOverflowed();
+}
+
 void PyPrintElement( pywrite &w )
 {
 	switch(w.type)
@@ -274,13 +299,19 @@ void PySendUserMessage( IRecipientFilter& filter, const char *messagename, boost
 		return;
 	}
 
+	// Message name and length are written in front of the elements
+	unsigned char data[MAX_USER_MSG_DATA];
+	bf_write buf( "PySendUserMessage", data, MAX( MAX_USER_MSG_DATA - Q_strlen(messagename) - 2, 0 ) );
+	if( !PyWriteElements( writelist, buf ) )
+	{
+		PyErr_SetString(PyExc_ValueError, "Message too large" );
+		throw boost::python::error_already_set(); 
+	}
+
 	UserMessageBegin( filter, "PyMessage");
 	WRITE_STRING(messagename);
 	WRITE_BYTE(length);
-	for(int i=0; i<writelist.Count(); i++)
-	{
-		PyWriteElement(writelist.Element(i));
-	}
+	WRITE_BITS(data, buf.GetNumBitsWritten());
 	MessageEnd();
 
 	if( g_debug_pyusermessage.GetBool() )
@@ -35,7 +35,8 @@
 	} pywrite;
 
 	void PyFillWriteElement( pywrite &w, bp::object data, bp::object type );
-	void PyWriteElement( pywrite &w );
+	void PyWriteElement( pywrite &w, bf_write &buf );
+	bool PyWriteElements( CUtlVector< pywrite > &writelist, bf_write &buf );
 	void PyPrintElement( pywrite &w );
 	void PySendUserMessage( IRecipientFilter& filter, const char *messagename, boost::python::list msg );
 #else
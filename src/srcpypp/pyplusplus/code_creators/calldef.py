@@ -13,6 +13,11 @@ import class_declaration
 from pygccxml import declarations
 from pyplusplus import decl_wrappers
 
+# When True, the override wrappers declare their override variable through the 
+# PY_OVERRIDE_LOOKUP macro (see src_python.h) instead of calling get_override directly.
+# Set by src_module_builder from settings.cached_override_lookup.
+cached_override_lookup = False
+
 #TODO:
 #Add to docs:
 #public memebr functions - call, override, call base implementation
@@ -151,6 +156,15 @@ class calldef_wrapper_t( code_creator.code_creator_t
     def override_identifier(self):
         return algorithm.create_identifier( self, '::boost::python::override' )
 
+    def override_lookup( self, var_name=None, override=None ):
+        if var_name is None:
+            var_name = 'func_' + self.declaration.alias
+        if override is None:
+            override = self.override_identifier()
+        if cached_override_lookup:
+            return 'PY_OVERRIDE_LOOKUP( %s, "%s" );' % ( var_name, self.declaration.alias )
+        return '%s %s = this->get_override( "%s" );' % ( override, var_name, self.declaration.alias )
+
     def function_call_args( self ):
         arg_utils = calldef_utils.argument_utils_t( self.declaration, algorithm.make_id_creator( self ) )
         return arg_utils.call_args()
@@ -363,7 +377,7 @@ class mem_fun_pv_wrapper_t( calldef_wrapper_t ):
         if precall_code:
             template.append( os.linesep.join( precall_code ) )
 
-        template.append( '%(override)s func_%(alias)s = this->get_override( "%(alias)s" );' )
+        template.append( self.override_lookup() )
         template.append( 'try {')
         if self.declaration.return_type \
            and auto_ptr_traits.is_smart_pointer( self.declaration.return_type ):
@@ -511,9 +525,8 @@ class mem_fun_v_wrapper_t( calldef_wrapper_t ):
         template.append( '#endif // _DEBUG/PY_CHECK_LOG_OVERRIDES' )
         
         # NOTE: Comparing directly gives problems
-        template.append( '%(override)s func_%(alias)s = this->get_override( "%(alias)s" );' )
+        template.append( self.override_lookup() )
         template.append( 'if( func_%(alias)s.ptr() != Py_None )' )
-        #template.append( 'if( %(override)s func_%(alias)s = this->get_override( "%(alias)s" ) )' )
         template.append( self.indent('try {' ) )
         template.append( self.indent(self.indent('%(return_)sfunc_%(alias)s( %(args)s );' ) ) )
         template.append( self.indent('} catch(bp::error_already_set &) {') )
@@ -765,9 +778,8 @@ class mem_fun_protected_v_wrapper_t( calldef_wrapper_t ):
             template.append( os.linesep.join( precall_code ) )    
         
         # NOTE: Comparing directly gives problems
-        template.append( '%(override)s func_%(alias)s = this->get_override( "%(alias)s" );' )
+        template.append( self.override_lookup() )
         template.append( 'if( func_%(alias)s.ptr() != Py_None )' )
-        #template.append( 'if( %(override)s func_%(alias)s = this->get_override( "%(alias)s" ) )' )
         template.append( self.indent('try {' ) )
         template.append( self.indent(self.indent('%(return_)sfunc_%(alias)s( %(args)s );' ) ) )
         template.append( self.indent('} catch(bp::error_already_set &) {') )
@@ -880,7 +892,7 @@ class mem_fun_protected_pv_wrapper_t( calldef_wrapper_t ):
         if precall_code:
             template.append( os.linesep.join( precall_code ) )
 
-        template.append( '%(override)s func_%(alias)s = this->get_override( "%(alias)s" );' )
+        template.append( self.override_lookup() )
         template.append( '%(return_)sfunc_%(alias)s( %(args)s );')
         template = os.linesep.join( template )
 
@@ -940,7 +952,7 @@ class mem_fun_private_v_wrapper_t( calldef_wrapper_t ):
         if precall_code:
             template.append( os.linesep.join( precall_code ) )
 
-        template.append( '%(override)s func_%(alias)s = this->get_override( "%(alias)s" );' )
+        template.append( self.override_lookup() )
         template.append( '%(return_)sfunc_%(alias)s( %(args)s );')
         template = os.linesep.join( template )
 
@@ -392,6 +392,7 @@ class mem_fun_v_transformed_wrapper_t( calldef_wrapper_t ):
         tmpl_values['throw'] = self.throw_specifier_code()        
         tmpl_values['py_function_var'] = cntrl.py_function_var
         tmpl_values['function_alias'] = self.declaration.alias
+        tmpl_values['override_lookup'] = self.override_lookup( cntrl.py_function_var, 'bpl::override' )
         tmpl_values['declare_py_variables'] \
             = os.linesep + os.linesep.join( map( lambda var: self.indent( var.declare_var_string(), 2 )
                                                  , cntrl.py_variables ) )
@@ -6,6 +6,10 @@ APPEND_FILE_ONLY = False
 # Alien Swarm code base? 
 ASW_CODE_BASE = True
 
+# Generate wrapper overrides which cache the get_override lookup per Python class 
+# (PY_OVERRIDE_LOOKUP in src_python.h)
+cached_override_lookup = True
+
 # Project project paths (see vxprojinfo.py for the available info)
 vcxprojserver = '../game/server/wars_server.vcxproj'
 vcxprojclient = '../game/client/wars_client.vcxproj'
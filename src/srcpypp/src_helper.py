@@ -151,7 +151,7 @@ def AddWrapReg( mb, cls_name, declaration, args_mod_in ):
     template = []
     
     # NOTE: Comparing directly gives problems
-    template.append( '%(override)s func_%(alias)s = this->get_override( "%(alias)s" );' )
+    template.append( wrapper.override_lookup() )
     template.append( 'if( func_%(alias)s.ptr() != Py_None )' )
     template.append( wrapper.indent('try {' ) )
     template.append( wrapper.indent(wrapper.indent('%(return_)sfunc_%(alias)s( %(args_mod_in)s );' ) ) )
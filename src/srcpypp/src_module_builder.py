@@ -2,9 +2,12 @@
 # src_module_builder provides a builder setted up for building modules for source sdk code
 
 from pyplusplus import module_builder
+from pyplusplus.code_creators import calldef
 from pygccxml import parser
 import settings
 
+calldef.cached_override_lookup = settings.cached_override_lookup
+
 # Include directories
 incl_paths = [
     'gccxml_bin/v09/linux2/share/gccxml-0.9/GCC/4.2',